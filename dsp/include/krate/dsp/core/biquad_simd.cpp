@@ -0,0 +1,102 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Stereo Biquad Cascade
+// ==============================================================================
+// This file uses Highway's self-inclusion pattern: foreach_target.h re-includes
+// this file once per ISA target. The SIMD kernels compile for each target;
+// HWY_EXPORT/HWY_DYNAMIC_DISPATCH (inside #if HWY_ONCE) select the best at
+// runtime.
+// ==============================================================================
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "krate/dsp/core/biquad_simd.cpp"
+#include "hwy/foreach_target.h"  // NOLINT(misc-header-include-cycle) Highway self-inclusion by design
+#include "hwy/highway.h"
+
+#include <cstddef>
+
+// =============================================================================
+// Per-Target SIMD Kernels (compiled once per ISA target)
+// =============================================================================
+
+HWY_BEFORE_NAMESPACE();
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE is a macro
+namespace Krate {
+namespace DSP {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// -----------------------------------------------------------------------------
+// BiquadCascadeStereoImpl: both channels of each frame as one vector
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void BiquadCascadeStereoImpl(float* HWY_RESTRICT lr, size_t numFrames,
+                             const float* HWY_RESTRICT coeffs,
+                             float* HWY_RESTRICT state, size_t numSections) {
+    // Two lanes where the target has them; single-lane targets (scalar)
+    // walk the channels one after the other with the same code
+    const hn::CappedTag<float, 2> d;
+    const size_t N = hn::Lanes(d);
+    const auto threshold = hn::Set(d, 1e-15f);  // kDenormalThreshold
+
+    for (size_t s = 0; s < numSections; ++s) {
+        const float* c = coeffs + 5 * s;
+        float* z = state + 4 * s;
+        const auto b0 = hn::Set(d, c[0]);
+        const auto b1 = hn::Set(d, c[1]);
+        const auto b2 = hn::Set(d, c[2]);
+        const auto a1 = hn::Set(d, c[3]);
+        const auto a2 = hn::Set(d, c[4]);
+
+        for (size_t ch = 0; ch < 2; ch += N) {
+            auto z1 = hn::LoadU(d, z + ch);
+            auto z2 = hn::LoadU(d, z + 2 + ch);
+            for (size_t i = 0; i < numFrames; ++i) {
+                float* frame = lr + 2 * i + ch;
+                const auto x = hn::LoadU(d, frame);
+                const auto y = hn::MulAdd(b0, x, z1);
+                z1 = hn::NegMulAdd(a1, y, hn::MulAdd(b1, x, z2));
+                z2 = hn::NegMulAdd(a2, y, hn::Mul(b2, x));
+                z1 = hn::IfThenZeroElse(hn::Lt(hn::Abs(z1), threshold), z1);
+                z2 = hn::IfThenZeroElse(hn::Lt(hn::Abs(z2), threshold), z2);
+                hn::StoreU(y, d, frame);
+            }
+            hn::StoreU(z1, d, z + ch);
+            hn::StoreU(z2, d, z + 2 + ch);
+        }
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace DSP
+}  // namespace Krate
+
+HWY_AFTER_NAMESPACE();
+
+// =============================================================================
+// Dispatch Table + Wrapper Functions (compiled once)
+// =============================================================================
+
+#if HWY_ONCE
+
+#include "krate/dsp/core/biquad_simd.h"
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE dispatch section
+namespace Krate {
+namespace DSP {
+
+HWY_EXPORT(BiquadCascadeStereoImpl);
+
+void biquadCascadeStereo(float* lr, std::size_t numFrames, const float* coeffs,
+                         float* state, std::size_t numSections) noexcept {
+    if (numFrames == 0 || numSections == 0) return;
+    HWY_DYNAMIC_DISPATCH(BiquadCascadeStereoImpl)(lr, numFrames, coeffs, state,
+                                                  numSections);
+}
+
+}  // namespace DSP
+}  // namespace Krate
+
+#endif  // HWY_ONCE
@@ -0,0 +1,49 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Stereo Biquad Cascade
+// ==============================================================================
+// Runs the left and right channels of an interleaved stereo buffer through
+// the same chain of TDF2 biquads as one 2-lane vector, using Google Highway
+// for runtime SIMD dispatch (SSE2/AVX2/AVX-512/NEON).
+//
+// A biquad is a recursion, so one channel cannot be vectorized across time.
+// Two channels with identical coefficients can: the L and R recursions are
+// independent and share every multiply, so pairing them halves the number
+// of dependent multiply-add chains. Sections are processed one at a time
+// over the whole block, keeping each section's state in registers.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle IV: SIMD & DSP Optimization (Highway runtime dispatch)
+// - Principle IX: Layer 0 (no DSP dependencies)
+// ==============================================================================
+
+#pragma once
+
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+/// Floats per section in the biquadCascadeStereo() coefficient array
+inline constexpr std::size_t kBiquadStereoCoeffStride = 5;
+
+/// Floats per section in the biquadCascadeStereo() state array
+inline constexpr std::size_t kBiquadStereoStateStride = 4;
+
+/// @brief Cascade of TDF2 biquads over an interleaved stereo buffer, in place.
+///
+/// Per section and channel, matching Biquad::process():
+///   y = b0*x + z1;  z1 = b1*x - a1*y + z2;  z2 = b2*x - a2*y
+/// with z1/z2 flushed to zero below kDenormalThreshold. Unlike Biquad, the
+/// input is not checked for NaN/Inf; callers sanitize it once up front.
+///
+/// @param lr          numFrames interleaved frames (L0, R0, L1, R1, ...)
+/// @param numFrames   Number of stereo frames
+/// @param coeffs      numSections x {b0, b1, b2, a1, a2}
+/// @param state       numSections x {z1L, z1R, z2L, z2R}, updated in place
+/// @param numSections Number of biquad sections
+void biquadCascadeStereo(float* lr, std::size_t numFrames, const float* coeffs,
+                         float* state, std::size_t numSections) noexcept;
+
+}  // namespace DSP
+}  // namespace Krate
@@ -0,0 +1,104 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Direct-Form Convolution Kernel
+// ==============================================================================
+// This file uses Highway's self-inclusion pattern: foreach_target.h re-includes
+// this file once per ISA target. The SIMD kernels compile for each target;
+// HWY_EXPORT/HWY_DYNAMIC_DISPATCH (inside #if HWY_ONCE) select the best at
+// runtime.
+// ==============================================================================
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "krate/dsp/core/convolution_simd.cpp"
+#include "hwy/foreach_target.h"  // NOLINT(misc-header-include-cycle) Highway self-inclusion by design
+#include "hwy/highway.h"
+
+#include <cstddef>
+
+// =============================================================================
+// Per-Target SIMD Kernels (compiled once per ISA target)
+// =============================================================================
+
+HWY_BEFORE_NAMESPACE();
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE is a macro
+namespace Krate {
+namespace DSP {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// -----------------------------------------------------------------------------
+// ConvolveDirectFIRImpl: out[m] = sum_j r[j] * w[m + j]
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void ConvolveDirectFIRImpl(const float* HWY_RESTRICT window,
+                           const float* HWY_RESTRICT reversedTaps,
+                           size_t numTaps,
+                           float* HWY_RESTRICT out,
+                           size_t n) {
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+
+    size_t m = 0;
+    // Two independent accumulators hide the multiply-add latency
+    for (; m + 2 * N <= n; m += 2 * N) {
+        auto acc0 = hn::Zero(d);
+        auto acc1 = hn::Zero(d);
+        for (size_t j = 0; j < numTaps; ++j) {
+            const auto tap = hn::Set(d, reversedTaps[j]);
+            acc0 = hn::MulAdd(hn::LoadU(d, window + m + j), tap, acc0);
+            acc1 = hn::MulAdd(hn::LoadU(d, window + m + N + j), tap, acc1);
+        }
+        hn::StoreU(acc0, d, out + m);
+        hn::StoreU(acc1, d, out + m + N);
+    }
+
+    for (; m + N <= n; m += N) {
+        auto acc = hn::Zero(d);
+        for (size_t j = 0; j < numTaps; ++j) {
+            acc = hn::MulAdd(hn::LoadU(d, window + m + j),
+                             hn::Set(d, reversedTaps[j]), acc);
+        }
+        hn::StoreU(acc, d, out + m);
+    }
+
+    for (; m < n; ++m) {
+        float acc = 0.0f;
+        for (size_t j = 0; j < numTaps; ++j) {
+            acc += reversedTaps[j] * window[m + j];
+        }
+        out[m] = acc;
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace DSP
+}  // namespace Krate
+
+HWY_AFTER_NAMESPACE();
+
+// =============================================================================
+// Dispatch Table + Wrapper Functions (compiled once)
+// =============================================================================
+
+#if HWY_ONCE
+
+#include "krate/dsp/core/convolution_simd.h"
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE dispatch section
+namespace Krate {
+namespace DSP {
+
+HWY_EXPORT(ConvolveDirectFIRImpl);
+
+void convolveDirectFIR(const float* window, const float* reversedTaps,
+                       std::size_t numTaps, float* out, std::size_t n) noexcept {
+    if (n == 0) return;
+    HWY_DYNAMIC_DISPATCH(ConvolveDirectFIRImpl)(window, reversedTaps, numTaps, out, n);
+}
+
+}  // namespace DSP
+}  // namespace Krate
+
+#endif  // HWY_ONCE
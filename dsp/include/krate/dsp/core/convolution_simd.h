@@ -0,0 +1,40 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Direct-Form Convolution Kernel
+// ==============================================================================
+// Block kernel for the short direct-form head of a partitioned convolver,
+// using Google Highway for runtime SIMD dispatch (SSE2/AVX2/AVX-512/NEON).
+//
+// The taps are stored time-reversed so every output is a plain dot product
+// with a sliding window; vectorization runs across consecutive outputs, so
+// each tap costs one broadcast and one multiply-add per SIMD lane group.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle IV: SIMD & DSP Optimization (Highway runtime dispatch)
+// - Principle IX: Layer 0 (no DSP dependencies)
+// ==============================================================================
+
+#pragma once
+
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Direct-form FIR over a block, taps supplied time-reversed.
+///
+/// With K = numTaps, r = reversedTaps and w = window, for every m in [0, n):
+///   out[m] = sum_{j < K} r[j] * w[m + j]
+/// which equals sum_k h[k] * x[m - k] for r[j] = h[K - 1 - j] when w holds
+/// K - 1 history samples followed by the n new samples.
+///
+/// @param window       K - 1 history samples followed by the n new samples
+/// @param reversedTaps Impulse response taps, last tap first
+/// @param numTaps      K
+/// @param out          n output samples (must not alias window)
+/// @param n            Number of output samples
+void convolveDirectFIR(const float* window, const float* reversedTaps,
+                       std::size_t numTaps, float* out, std::size_t n) noexcept;
+
+}  // namespace DSP
+}  // namespace Krate
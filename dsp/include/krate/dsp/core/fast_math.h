@@ -10,6 +10,11 @@
 //
 // Performance: fastTanh is ~3x faster than std::tanh (verified benchmark)
 //
+// fastTan/fastExp2 exist for filter coefficient math (bilinear prewarp and
+// semitone-to-ratio) where a libm call per sample per voice dominates. They
+// are accurate to float precision over their documented domains, but are not
+// bit-identical to std::, so callers make them opt-in.
+//
 // Note: fastSin/fastCos/fastExp were removed because MSVC's std:: versions
 // are highly optimized (SIMD/lookup tables) and our polynomial approximations
 // were slower. Use std::sin/cos/exp for those functions.
@@ -20,6 +25,9 @@
 #pragma once
 
 #include <krate/dsp/core/db_utils.h>  // detail::isNaN, detail::isInf
+#include <bit>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 
 namespace Krate {
@@ -88,6 +96,68 @@ using Krate::DSP::detail::isInf;
     return x * (945.0f + 105.0f * x2 + x4) / (945.0f + 420.0f * x2 + 15.0f * x4);
 }
 
+/// @brief Fast tangent for bilinear-transform prewarping.
+///
+/// Padé (5,4) approximant on [0, pi/4], reflected through
+/// tan(x) = 1 / tan(pi/2 - x) for the upper half of the range, so a single
+/// division covers the whole domain.
+///
+/// @param x Angle in radians, |x| < pi/2 (e.g. pi * fc / fs for fc < fs/2)
+/// @return Approximate tan(x)
+///
+/// @accuracy Relative error < 2.3e-7 (about 2 ulp) for |x| <= pi/4. Above
+///           that the reflected argument pi/2 - |x| loses bits to rounding,
+///           so the error grows toward pi/2: < 3e-6 up to 0.99 * pi/2
+///           (fc = 0.495 * fs), measured against double-precision tan.
+/// @note Outside (-pi/2, pi/2) the result is meaningless; clamp the cutoff
+///       first (every filter that uses this already does).
+[[nodiscard]] constexpr float fastTan(float x) noexcept {
+    constexpr float kQuarterPi = 0.78539816339744831f;
+    constexpr float kHalfPi = 1.5707963267948966f;
+
+    const float sign = x < 0.0f ? -1.0f : 1.0f;
+    const float ax = x * sign;
+    const bool reflect = ax > kQuarterPi;
+    const float t = reflect ? kHalfPi - ax : ax;
+
+    const float t2 = t * t;
+    const float num = t * (945.0f - 105.0f * t2 + t2 * t2);
+    const float den = 945.0f - 420.0f * t2 + 15.0f * t2 * t2;
+    return sign * (reflect ? den / num : num / den);
+}
+
+/// @brief Fast base-2 exponential.
+///
+/// Splits x into integer and fractional parts, evaluates 2^f for
+/// f in [-0.5, 0.5] with a degree-6 minimax polynomial (Cephes exp2f) and
+/// scales by 2^n through the float exponent bits.
+///
+/// @param x Exponent (clamped to [-126, 127] to stay in the normal range)
+/// @return Approximate 2^x
+///
+/// @accuracy Relative error < 1e-7 (about 1 ulp)
+/// @note NaN input returns NaN
+[[nodiscard]] inline float fastExp2(float x) noexcept {
+    if (detail::isNaN(x)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    x = x < -126.0f ? -126.0f : (x > 127.0f ? 127.0f : x);
+
+    const float n = std::floor(x + 0.5f);
+    const float f = x - n;
+
+    float p = 1.535336188319500e-4f;
+    p = p * f + 1.339887440266574e-3f;
+    p = p * f + 9.618437357674640e-3f;
+    p = p * f + 5.550332471162809e-2f;
+    p = p * f + 2.402264791363012e-1f;
+    p = p * f + 6.931472028550421e-1f;
+    const float frac = 1.0f + f * p;
+
+    const auto bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+    return frac * std::bit_cast<float>(bits);
+}
+
 } // namespace FastMath
 } // namespace DSP
 } // namespace Krate
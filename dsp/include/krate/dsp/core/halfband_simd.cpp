@@ -0,0 +1,145 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Polyphase Halfband Kernels
+// ==============================================================================
+// This file uses Highway's self-inclusion pattern: foreach_target.h re-includes
+// this file once per ISA target. The SIMD kernels compile for each target;
+// HWY_EXPORT/HWY_DYNAMIC_DISPATCH (inside #if HWY_ONCE) select the best at
+// runtime.
+// ==============================================================================
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "krate/dsp/core/halfband_simd.cpp"
+#include "hwy/foreach_target.h"  // NOLINT(misc-header-include-cycle) Highway self-inclusion by design
+#include "hwy/highway.h"
+
+#include <cstddef>
+
+// =============================================================================
+// Per-Target SIMD Kernels (compiled once per ISA target)
+// =============================================================================
+
+HWY_BEFORE_NAMESPACE();
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE is a macro
+namespace Krate {
+namespace DSP {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Symmetric K-pair FIR at output m: sum_k c[k] * (w[m+K+1+k] + w[m+K-k])
+inline float symmetricPairsScalar(const float* HWY_RESTRICT w,
+                                  const float* HWY_RESTRICT coeffs,
+                                  size_t numPairs, size_t m) {
+    float acc = 0.0f;
+    for (size_t k = 0; k < numPairs; ++k) {
+        acc += coeffs[k] * (w[m + numPairs + 1 + k] + w[m + numPairs - k]);
+    }
+    return acc;
+}
+
+// -----------------------------------------------------------------------------
+// HalfbandInterpolate2xImpl: FIR branch -> even outputs, delay -> odd outputs
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void HalfbandInterpolate2xImpl(const float* HWY_RESTRICT window,
+                               const float* HWY_RESTRICT coeffs,
+                               size_t numPairs,
+                               float* HWY_RESTRICT out,
+                               size_t n) {
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+    const float* HWY_RESTRICT centre = window + numPairs + 1;
+
+    size_t m = 0;
+    for (; m + N <= n; m += N) {
+        auto acc = hn::Zero(d);
+        for (size_t k = 0; k < numPairs; ++k) {
+            const auto pair = hn::Add(hn::LoadU(d, centre + m + k),
+                                      hn::LoadU(d, window + m + numPairs - k));
+            acc = hn::MulAdd(pair, hn::Set(d, coeffs[k]), acc);
+        }
+        hn::StoreInterleaved2(acc, hn::LoadU(d, centre + m), d, out + 2 * m);
+    }
+
+    for (; m < n; ++m) {
+        out[2 * m] = symmetricPairsScalar(window, coeffs, numPairs, m);
+        out[2 * m + 1] = centre[m];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// HalfbandDecimate2xImpl: FIR on even phase + half-gain delayed odd phase
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void HalfbandDecimate2xImpl(const float* HWY_RESTRICT evenWindow,
+                            const float* HWY_RESTRICT oddWindow,
+                            const float* HWY_RESTRICT coeffs,
+                            size_t numPairs,
+                            float* HWY_RESTRICT out,
+                            size_t n) {
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+    const float* HWY_RESTRICT centre = evenWindow + numPairs + 1;
+    const float* HWY_RESTRICT delayed = oddWindow + numPairs;
+    const auto half = hn::Set(d, 0.5f);
+
+    size_t m = 0;
+    for (; m + N <= n; m += N) {
+        auto acc = hn::Mul(hn::LoadU(d, delayed + m), half);
+        for (size_t k = 0; k < numPairs; ++k) {
+            const auto pair = hn::Add(hn::LoadU(d, centre + m + k),
+                                      hn::LoadU(d, evenWindow + m + numPairs - k));
+            acc = hn::MulAdd(pair, hn::Set(d, coeffs[k]), acc);
+        }
+        hn::StoreU(acc, d, out + m);
+    }
+
+    for (; m < n; ++m) {
+        out[m] = 0.5f * delayed[m]
+               + symmetricPairsScalar(evenWindow, coeffs, numPairs, m);
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace DSP
+}  // namespace Krate
+
+HWY_AFTER_NAMESPACE();
+
+// =============================================================================
+// Dispatch Table + Wrapper Functions (compiled once)
+// =============================================================================
+
+#if HWY_ONCE
+
+#include "krate/dsp/core/halfband_simd.h"
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE dispatch section
+namespace Krate {
+namespace DSP {
+
+HWY_EXPORT(HalfbandInterpolate2xImpl);
+HWY_EXPORT(HalfbandDecimate2xImpl);
+
+void halfbandInterpolate2x(const float* window, const float* coeffs,
+                           std::size_t numPairs, float* out,
+                           std::size_t n) noexcept {
+    if (n == 0) return;
+    HWY_DYNAMIC_DISPATCH(HalfbandInterpolate2xImpl)(window, coeffs, numPairs, out, n);
+}
+
+void halfbandDecimate2x(const float* evenWindow, const float* oddWindow,
+                        const float* coeffs, std::size_t numPairs, float* out,
+                        std::size_t n) noexcept {
+    if (n == 0) return;
+    HWY_DYNAMIC_DISPATCH(HalfbandDecimate2xImpl)(evenWindow, oddWindow, coeffs,
+                                                 numPairs, out, n);
+}
+
+}  // namespace DSP
+}  // namespace Krate
+
+#endif  // HWY_ONCE
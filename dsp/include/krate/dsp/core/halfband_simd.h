@@ -0,0 +1,61 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Polyphase Halfband Kernels
+// ==============================================================================
+// Block kernels for 2x interpolation and decimation with a symmetric halfband
+// FIR, using Google Highway for runtime SIMD dispatch (SSE2/AVX2/AVX-512/NEON).
+//
+// A halfband filter of length 4K+3 has K non-zero symmetric tap pairs plus a
+// centre tap of 0.5; every other tap is zero. Split into polyphase branches,
+// one branch is the K-pair symmetric FIR and the other a pure delay, so each
+// output costs K multiply-adds instead of 4K+3, and the zero-stuffed (or
+// discarded) half of the signal is never computed. Vectorization runs
+// across consecutive outputs.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle IV: SIMD & DSP Optimization (Highway runtime dispatch)
+// - Principle IX: Layer 0 (no DSP dependencies)
+// ==============================================================================
+
+#pragma once
+
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief 2x halfband interpolation (zero-stuff + lowpass), polyphase form.
+///
+/// With K = numPairs and w = window, for every input index m in [0, n):
+///   out[2m]     = sum_k coeffs[k] * (w[m + K + 1 + k] + w[m + K - k])
+///   out[2m + 1] = w[m + K + 1]
+///
+/// @param window    2K + 1 history samples followed by the n new samples
+/// @param coeffs    Tap-pair coefficients, nearest-to-centre first, already
+///                  scaled by the interpolation gain (2x for zero stuffing)
+/// @param numPairs  K
+/// @param out       2n output samples (must not alias window)
+/// @param n         Number of new input samples
+void halfbandInterpolate2x(const float* window, const float* coeffs,
+                           std::size_t numPairs, float* out,
+                           std::size_t n) noexcept;
+
+/// @brief 2x halfband decimation (lowpass + drop odd outputs), polyphase form.
+///
+/// The input is split into its even and odd phases. With K = numPairs,
+/// e = evenWindow and o = oddWindow:
+///   out[m] = sum_k coeffs[k] * (e[m + K + 1 + k] + e[m + K - k])
+///          + 0.5 * o[m + K]
+///
+/// @param evenWindow 2K + 1 history samples followed by n even-phase samples
+/// @param oddWindow  2K + 1 history samples followed by n odd-phase samples
+/// @param coeffs     Tap-pair coefficients, nearest-to-centre first
+/// @param numPairs   K
+/// @param out        n output samples (must not alias the windows)
+/// @param n          Number of output samples
+void halfbandDecimate2x(const float* evenWindow, const float* oddWindow,
+                        const float* coeffs, std::size_t numPairs, float* out,
+                        std::size_t n) noexcept;
+
+}  // namespace DSP
+}  // namespace Krate
@@ -14,11 +14,53 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace Krate {
 namespace DSP {
 
+namespace detail {
+
+/// One Xorshift32 step (shifts 13, 17, 5).
+[[nodiscard]] constexpr uint32_t xorshift32Step(uint32_t s) noexcept {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+/// 32x32 matrix over GF(2); column j is the image of state bit j.
+using Gf2Matrix32 = std::array<uint32_t, 32>;
+
+[[nodiscard]] constexpr uint32_t applyGf2(const Gf2Matrix32& m, uint32_t v) noexcept {
+    uint32_t result = 0;
+    for (size_t j = 0; j < 32; ++j) {
+        if ((v >> j) & 1u) result ^= m[j];
+    }
+    return result;
+}
+
+/// Xorshift32 is linear over GF(2): entry i is the transition matrix raised
+/// to 2^i, so any jump distance is a product of at most 32 of them.
+[[nodiscard]] constexpr std::array<Gf2Matrix32, 32> makeXorshift32JumpTable() noexcept {
+    std::array<Gf2Matrix32, 32> table{};
+    for (size_t j = 0; j < 32; ++j) {
+        table[0][j] = xorshift32Step(uint32_t{1} << j);
+    }
+    for (size_t i = 1; i < 32; ++i) {
+        for (size_t j = 0; j < 32; ++j) {
+            table[i][j] = applyGf2(table[i - 1], table[i - 1][j]);
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<Gf2Matrix32, 32> kXorshift32Jumps = makeXorshift32JumpTable();
+
+} // namespace detail
+
 // ==============================================================================
 // Xorshift32 PRNG
 // ==============================================================================
@@ -73,6 +115,18 @@ public:
         state_ = (seedValue != 0) ? seedValue : kDefaultSeed;
     }
 
+    /// Skip ahead as if next() had been called count times.
+    /// O(log count): applies precomputed powers of the transition matrix,
+    /// and the 2^32-1 period bounds the work to 32 of them.
+    constexpr void discard(uint64_t count) noexcept {
+        count %= kPeriod;
+        for (size_t bit = 0; count != 0; ++bit, count >>= 1) {
+            if (count & 1u) {
+                state_ = detail::applyGf2(detail::kXorshift32Jumps[bit], state_);
+            }
+        }
+    }
+
     /// Get current state (for debugging/serialization).
     /// @return Current internal state
     [[nodiscard]] constexpr uint32_t state() const noexcept {
@@ -83,6 +137,9 @@ private:
     /// Default seed used when 0 is passed (0 would cause generator to output only zeros)
     static constexpr uint32_t kDefaultSeed = 2463534242u;
 
+    /// Sequence period (every non-zero state is visited once)
+    static constexpr uint64_t kPeriod = 0xFFFFFFFFull;
+
     /// Conversion factor from uint32_t to [0, 1] float
     /// 1.0 / (2^32 - 1) = 1.0 / 4294967295.0
     static constexpr float kToFloat = 2.3283064370807974e-10f;
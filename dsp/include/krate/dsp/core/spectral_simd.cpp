@@ -16,8 +16,11 @@
 #include "hwy/highway.h"
 #include "hwy/contrib/math/math-inl.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <numbers>
 
 // =============================================================================
@@ -262,6 +265,161 @@ void BatchWrapPhaseInPlaceImpl(float* HWY_RESTRICT data, size_t count) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// DetectSpectralPeaksImpl: local maxima of a magnitude spectrum
+// -----------------------------------------------------------------------------
+// mags[k] > max(mags[k-1], mags[k+1]) is the same test as the two scalar
+// compares. Peaks are sparse, so vectors without a hit cost one compare and
+// a branch; hit lanes are then walked in ascending order.
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+size_t DetectSpectralPeaksImpl(const float* HWY_RESTRICT mags, size_t numBins,
+                               uint16_t* HWY_RESTRICT peakIndices, size_t maxPeaks,
+                               bool* HWY_RESTRICT isPeak) {
+    std::memset(isPeak, 0, numBins * sizeof(bool));
+    if (numBins < 3 || maxPeaks == 0) return 0;
+
+    constexpr size_t kMaxPeakLanes = 16;
+    const hn::CappedTag<float, kMaxPeakLanes> d;
+    const size_t N = hn::Lanes(d);
+    const auto one = hn::Set(d, 1.0f);
+    float hits[kMaxPeakLanes];
+
+    size_t numPeaks = 0;
+    size_t k = 1;
+    const size_t end = numBins - 1;
+
+    for (; k + N <= end; k += N) {
+        const auto left = hn::LoadU(d, mags + k - 1);
+        const auto centre = hn::LoadU(d, mags + k);
+        const auto right = hn::LoadU(d, mags + k + 1);
+        const auto peak = hn::Gt(centre, hn::Max(left, right));
+        if (hn::AllFalse(d, peak)) continue;
+
+        hn::StoreU(hn::IfThenElseZero(peak, one), d, hits);
+        for (size_t i = 0; i < N; ++i) {
+            if (hits[i] == 0.0f) continue;
+            isPeak[k + i] = true;
+            peakIndices[numPeaks] = static_cast<uint16_t>(k + i);
+            if (++numPeaks == maxPeaks) return numPeaks;
+        }
+    }
+
+    // Scalar tail
+    for (; k < end; ++k) {
+        if (mags[k] > mags[k - 1] && mags[k] > mags[k + 1]) {
+            isPeak[k] = true;
+            peakIndices[numPeaks] = static_cast<uint16_t>(k);
+            if (++numPeaks == maxPeaks) break;
+        }
+    }
+    return numPeaks;
+}
+
+// -----------------------------------------------------------------------------
+// AssignPeakRegionsImpl: fill each peak's region of influence
+// -----------------------------------------------------------------------------
+// Regions are contiguous runs bounded by the midpoints between neighbouring
+// peaks, so the assignment is one broadcast fill per run.
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void AssignPeakRegionsImpl(const uint16_t* HWY_RESTRICT peakIndices, size_t numPeaks,
+                           size_t numBins, uint16_t* HWY_RESTRICT regionPeak) {
+    const hn::ScalableTag<uint16_t> d;
+    const size_t N = hn::Lanes(d);
+
+    size_t k = 0;
+    for (size_t p = 0; p < numPeaks && k < numBins; ++p) {
+        size_t runEnd = numBins;
+        if (p + 1 < numPeaks) {
+            const size_t midpoint = (static_cast<size_t>(peakIndices[p]) + peakIndices[p + 1]) / 2;
+            runEnd = std::min(midpoint + 1, numBins);
+        }
+
+        const uint16_t peakBin = peakIndices[p];
+        const auto fill = hn::Set(d, peakBin);
+        for (; k + N <= runEnd; k += N) {
+            hn::StoreU(fill, d, regionPeak + k);
+        }
+        for (; k < runEnd; ++k) {
+            regionPeak[k] = peakBin;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// MorphSpectraImpl: magnitude lerp + complex-lerp phase, Cartesian in and out
+// -----------------------------------------------------------------------------
+// The output phase is C/|C| with C the complex lerp of A and B, so only
+// sqrt and one divide per bin are needed. complexOut may alias an input:
+// each bin is fully loaded before it is stored.
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void MorphSpectraImpl(const float* complexA, const float* complexB, size_t numBins,
+                      float magMorph, float phaseMorph, const float* gains,
+                      float* complexOut) {
+    constexpr float kMinNormSq = 1e-30f;
+    const float magWeightA = 1.0f - magMorph;
+    const float phaseWeightA = 1.0f - phaseMorph;
+
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+    const auto wMagA = hn::Set(d, magWeightA);
+    const auto wMagB = hn::Set(d, magMorph);
+    const auto wPhaseA = hn::Set(d, phaseWeightA);
+    const auto wPhaseB = hn::Set(d, phaseMorph);
+    const auto minNormSq = hn::Set(d, kMinNormSq);
+
+    size_t k = 0;
+    for (; k + N <= numBins; k += N) {
+        hn::Vec<decltype(d)> ar;
+        hn::Vec<decltype(d)> ai;
+        hn::Vec<decltype(d)> br;
+        hn::Vec<decltype(d)> bi;
+        hn::LoadInterleaved2(d, complexA + k * 2, ar, ai);
+        hn::LoadInterleaved2(d, complexB + k * 2, br, bi);
+
+        const auto magA = hn::Sqrt(hn::MulAdd(ai, ai, hn::Mul(ar, ar)));
+        const auto magB = hn::Sqrt(hn::MulAdd(bi, bi, hn::Mul(br, br)));
+        auto mag = hn::MulAdd(magB, wMagB, hn::Mul(magA, wMagA));
+        if (gains != nullptr) mag = hn::Mul(mag, hn::LoadU(d, gains + k));
+
+        const auto cr = hn::MulAdd(br, wPhaseB, hn::Mul(ar, wPhaseA));
+        const auto ci = hn::MulAdd(bi, wPhaseB, hn::Mul(ai, wPhaseA));
+        const auto normSq = hn::MulAdd(ci, ci, hn::Mul(cr, cr));
+        const auto valid = hn::Gt(normSq, minNormSq);
+        const auto scale = hn::Div(mag, hn::Sqrt(hn::Max(normSq, minNormSq)));
+
+        const auto re = hn::IfThenElse(valid, hn::Mul(cr, scale), mag);
+        const auto im = hn::IfThenElseZero(valid, hn::Mul(ci, scale));
+        hn::StoreInterleaved2(re, im, d, complexOut + k * 2);
+    }
+
+    // Scalar tail
+    for (; k < numBins; ++k) {
+        const float ar = complexA[k * 2];
+        const float ai = complexA[k * 2 + 1];
+        const float br = complexB[k * 2];
+        const float bi = complexB[k * 2 + 1];
+
+        float mag = std::sqrt(ar * ar + ai * ai) * magWeightA
+                  + std::sqrt(br * br + bi * bi) * magMorph;
+        if (gains != nullptr) mag *= gains[k];
+
+        const float cr = ar * phaseWeightA + br * phaseMorph;
+        const float ci = ai * phaseWeightA + bi * phaseMorph;
+        const float normSq = cr * cr + ci * ci;
+        if (normSq > kMinNormSq) {
+            const float scale = mag / std::sqrt(normSq);
+            complexOut[k * 2] = cr * scale;
+            complexOut[k * 2 + 1] = ci * scale;
+        } else {
+            complexOut[k * 2] = mag;
+            complexOut[k * 2 + 1] = 0.0f;
+        }
+    }
+}
+
 }  // namespace HWY_NAMESPACE
 }  // namespace DSP
 }  // namespace Krate
@@ -287,6 +445,9 @@ HWY_EXPORT(BatchLog10Impl);
 HWY_EXPORT(BatchPow10Impl);
 HWY_EXPORT(BatchWrapPhaseImpl);
 HWY_EXPORT(BatchWrapPhaseInPlaceImpl);
+HWY_EXPORT(DetectSpectralPeaksImpl);
+HWY_EXPORT(AssignPeakRegionsImpl);
+HWY_EXPORT(MorphSpectraImpl);
 
 void computePolarBulk(const float* complexData, size_t numBins,
                       float* mags, float* phases) noexcept {
@@ -318,6 +479,25 @@ void batchWrapPhase(float* data, std::size_t count) noexcept {
     HWY_DYNAMIC_DISPATCH(BatchWrapPhaseInPlaceImpl)(data, count);
 }
 
+std::size_t detectSpectralPeaks(const float* mags, std::size_t numBins,
+                                uint16_t* peakIndices, std::size_t maxPeaks,
+                                bool* isPeak) noexcept {
+    return HWY_DYNAMIC_DISPATCH(DetectSpectralPeaksImpl)(mags, numBins, peakIndices,
+                                                         maxPeaks, isPeak);
+}
+
+void assignPeakRegions(const uint16_t* peakIndices, std::size_t numPeaks,
+                       std::size_t numBins, uint16_t* regionPeak) noexcept {
+    HWY_DYNAMIC_DISPATCH(AssignPeakRegionsImpl)(peakIndices, numPeaks, numBins, regionPeak);
+}
+
+void morphSpectraBulk(const float* complexA, const float* complexB,
+                      std::size_t numBins, float magMorph, float phaseMorph,
+                      const float* gains, float* complexOut) noexcept {
+    HWY_DYNAMIC_DISPATCH(MorphSpectraImpl)(complexA, complexB, numBins, magMorph,
+                                           phaseMorph, gains, complexOut);
+}
+
 }  // namespace DSP
 }  // namespace Krate
 
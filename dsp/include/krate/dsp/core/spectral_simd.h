@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace Krate {
 namespace DSP {
@@ -88,5 +89,56 @@ void batchWrapPhase(const float* input, float* output, std::size_t count) noexce
 /// @note SIMD-accelerated with runtime ISA dispatch
 void batchWrapPhase(float* data, std::size_t count) noexcept;
 
+/// @brief Find local magnitude maxima (identity phase locking, Laroche-Dolson)
+///
+/// Bin k (1 <= k < numBins-1) is a peak when mags[k] > mags[k-1] and
+/// mags[k] > mags[k+1]. Peaks are reported in ascending bin order; the scan
+/// stops once maxPeaks have been found.
+///
+/// @param mags Magnitude spectrum (numBins floats)
+/// @param numBins Number of bins
+/// @param peakIndices Output peak bin indices (must hold maxPeaks entries)
+/// @param maxPeaks Capacity of peakIndices
+/// @param isPeak Output per-bin peak flags (must hold numBins entries; all
+///        numBins flags are written)
+/// @return Number of peaks written to peakIndices
+/// @note SIMD-accelerated with runtime ISA dispatch
+std::size_t detectSpectralPeaks(const float* mags, std::size_t numBins,
+                                uint16_t* peakIndices, std::size_t maxPeaks,
+                                bool* isPeak) noexcept;
+
+/// @brief Assign every bin to its nearest peak's region of influence
+///
+/// Bins up to and including the midpoint (p[i] + p[i+1]) / 2 belong to
+/// peak i; bins past the last midpoint belong to the last peak.
+///
+/// @param peakIndices Ascending peak bin indices, as from detectSpectralPeaks()
+/// @param numPeaks Number of peaks (no-op when 0)
+/// @param numBins Number of bins
+/// @param regionPeak Output controlling peak bin per bin (must hold numBins entries)
+/// @note SIMD-accelerated with runtime ISA dispatch
+void assignPeakRegions(const uint16_t* peakIndices, std::size_t numPeaks,
+                       std::size_t numBins, uint16_t* regionPeak) noexcept;
+
+/// @brief Morph two complex spectra without a polar round trip
+///
+/// out[k] = ((1 - magMorph) |A[k]| + magMorph |B[k]|) * gains[k] * C[k] / |C[k]|
+/// with C = (1 - phaseMorph) A + phaseMorph B. phaseMorph 0 keeps the phase
+/// of A, 1 keeps B, and magMorph gives complex-lerp phase blending, so the
+/// phase never has to be extracted with atan2. Bins where C is zero take
+/// phase 0, matching atan2(0, 0).
+///
+/// @param complexA Interleaved {real, imag} spectrum A (numBins bins)
+/// @param complexB Interleaved {real, imag} spectrum B (numBins bins)
+/// @param numBins Number of complex bins
+/// @param magMorph Magnitude interpolation weight of B
+/// @param phaseMorph Complex interpolation weight of B for the phase
+/// @param gains Per-bin magnitude gains (numBins floats), or nullptr for unity
+/// @param complexOut Output interleaved spectrum; may alias complexA or complexB
+/// @note SIMD-accelerated with runtime ISA dispatch
+void morphSpectraBulk(const float* complexA, const float* complexB,
+                      std::size_t numBins, float magMorph, float phaseMorph,
+                      const float* gains, float* complexOut) noexcept;
+
 } // namespace DSP
 } // namespace Krate
@@ -0,0 +1,106 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Voice Lane Mixing
+// ==============================================================================
+// This file uses Highway's self-inclusion pattern: foreach_target.h re-includes
+// this file once per ISA target. The SIMD kernels compile for each target;
+// HWY_EXPORT/HWY_DYNAMIC_DISPATCH (inside #if HWY_ONCE) select the best at
+// runtime.
+// ==============================================================================
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "krate/dsp/core/voice_mix_simd.cpp"
+#include "hwy/foreach_target.h"  // NOLINT(misc-header-include-cycle) Highway self-inclusion by design
+#include "hwy/highway.h"
+
+#include <cstddef>
+
+// =============================================================================
+// Per-Target SIMD Kernels (compiled once per ISA target)
+// =============================================================================
+
+HWY_BEFORE_NAMESPACE();
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE is a macro
+namespace Krate {
+namespace DSP {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// -----------------------------------------------------------------------------
+// MixVoiceLanesStereoImpl: lanes[v][s] * gains[v] -> outL/outR
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void MixVoiceLanesStereoImpl(const float* const* HWY_RESTRICT lanes,
+                             const float* HWY_RESTRICT gainsL,
+                             const float* HWY_RESTRICT gainsR,
+                             size_t numLanes,
+                             float* HWY_RESTRICT outL,
+                             float* HWY_RESTRICT outR,
+                             size_t numSamples) {
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+
+    size_t s = 0;
+
+    // SIMD loop: N samples per iteration, all voices accumulated in registers
+    for (; s + N <= numSamples; s += N) {
+        auto accL = hn::LoadU(d, outL + s);
+        auto accR = hn::LoadU(d, outR + s);
+        for (size_t v = 0; v < numLanes; ++v) {
+            const auto x = hn::LoadU(d, lanes[v] + s);
+            accL = hn::MulAdd(x, hn::Set(d, gainsL[v]), accL);
+            accR = hn::MulAdd(x, hn::Set(d, gainsR[v]), accR);
+        }
+        hn::StoreU(accL, d, outL + s);
+        hn::StoreU(accR, d, outR + s);
+    }
+
+    // Scalar tail
+    for (; s < numSamples; ++s) {
+        float accL = outL[s];
+        float accR = outR[s];
+        for (size_t v = 0; v < numLanes; ++v) {
+            const float x = lanes[v][s];
+            accL += x * gainsL[v];
+            accR += x * gainsR[v];
+        }
+        outL[s] = accL;
+        outR[s] = accR;
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace DSP
+}  // namespace Krate
+
+HWY_AFTER_NAMESPACE();
+
+// =============================================================================
+// Dispatch Table + Wrapper Functions (compiled once)
+// =============================================================================
+
+#if HWY_ONCE
+
+#include "krate/dsp/core/voice_mix_simd.h"
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE dispatch section
+namespace Krate {
+namespace DSP {
+
+HWY_EXPORT(MixVoiceLanesStereoImpl);
+
+void mixVoiceLanesStereo(const float* const* lanes, const float* gainsL,
+                         const float* gainsR, std::size_t numLanes,
+                         float* outL, float* outR,
+                         std::size_t numSamples) noexcept {
+    if (numLanes == 0) return;
+    HWY_DYNAMIC_DISPATCH(MixVoiceLanesStereoImpl)(lanes, gainsL, gainsR, numLanes,
+                                                  outL, outR, numSamples);
+}
+
+}  // namespace DSP
+}  // namespace Krate
+
+#endif  // HWY_ONCE
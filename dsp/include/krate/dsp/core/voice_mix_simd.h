@@ -0,0 +1,52 @@
+// ==============================================================================
+// Layer 0: Core Utility - SIMD-Accelerated Voice Lane Mixing
+// ==============================================================================
+// Sums a set of mono voice lanes into a stereo bus with a constant per-voice
+// gain pair (pan law already applied), using Google Highway for runtime SIMD
+// dispatch (SSE2/AVX2/AVX-512/NEON).
+//
+// Polyphonic engines render every active voice into its own lane first and
+// mix once per block: each output sample is loaded and stored once instead of
+// once per voice, and the lane loads vectorize across time.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle IV: SIMD & DSP Optimization (Highway runtime dispatch)
+// - Principle IX: Layer 0 (no DSP dependencies)
+// ==============================================================================
+
+#pragma once
+
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Accumulate mono voice lanes into a stereo pair.
+///
+/// For every sample s:
+///   outL[s] += sum_v lanes[v][s] * gainsL[v]
+///   outR[s] += sum_v lanes[v][s] * gainsR[v]
+///
+/// Voices are summed in index order, so for a given lane order the result
+/// is reproducible run to run on one machine. It is not bit-identical across
+/// ISA targets: the vector loop uses MulAdd (fused where the target has FMA)
+/// and the scalar tail rounds the product separately, so results differ
+/// between targets, and between the body and tail, within float rounding.
+///
+/// @param lanes     Array of numLanes pointers, each to numSamples floats
+/// @param gainsL    Left gain per lane (numLanes floats)
+/// @param gainsR    Right gain per lane (numLanes floats)
+/// @param numLanes  Number of voice lanes (0 is a no-op)
+/// @param outL      Left accumulator (numSamples floats, not cleared)
+/// @param outR      Right accumulator (numSamples floats, not cleared)
+/// @param numSamples Number of samples per lane
+/// @note Lanes must not alias outL/outR.
+/// @note SIMD-accelerated with runtime ISA dispatch
+void mixVoiceLanesStereo(const float* const* lanes, const float* gainsL,
+                         const float* gainsR, std::size_t numLanes,
+                         float* outL, float* outR,
+                         std::size_t numSamples) noexcept;
+
+}  // namespace DSP
+}  // namespace Krate
@@ -1,9 +1,9 @@
 // ==============================================================================
-// Layer 4: User Feature - FDN Reverb (8-Channel Feedback Delay Network)
+// Layer 4: User Feature - FDN Reverb (8/16/32-Channel Feedback Delay Network)
 // ==============================================================================
-// Implements an 8-channel Feedback Delay Network reverb with:
+// Implements an N-channel Feedback Delay Network reverb (N = 8, 16 or 32) with:
 // - Feedforward Hadamard diffuser (4 cascaded FWHT steps) (FR-008)
-// - Householder feedback matrix O(N) for N=8 (FR-010)
+// - Householder feedback matrix O(N) (FR-010)
 // - One-pole damping filters per channel (FR-011)
 // - DC blockers per channel (FR-012)
 // - Gordon-Smith quadrature LFO on 4 longest channels (FR-013)
@@ -14,11 +14,15 @@
 //
 // Signal flow:
 //   Input -> Mono sum -> Pre-delay -> inject into channels
-//         -> Read from 8 delay lines (output taps here)
+//         -> Read from N delay lines (output taps here)
 //         -> One-pole damping -> DC blockers -> Hadamard diffuser
 //         -> Householder feedback -> apply gains -> add input -> write to delays
 //         -> Stereo output from delay reads with width control
 //
+// Delay lines are stored frame-major (one row of N samples per time step,
+// shared write position), so each sample writes one contiguous row and reads
+// all N taps with a single gather.
+//
 // Composes:
 // - DelayLine (Layer 1): Pre-delay
 // - ReverbParams (Layer 4): Shared parameter interface
@@ -49,8 +53,11 @@
 #include <krate/dsp/primitives/delay_line.h>  // nextPowerOf2, DelayLine
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace Krate {
@@ -60,15 +67,28 @@ namespace DSP {
 // Forward declarations for SIMD kernels (defined in fdn_reverb_simd.cpp)
 // =============================================================================
 
-/// SIMD-accelerated one-pole filter bank (8 channels)
+/// SIMD-accelerated one-pole filter bank
 void fdnApplyFilterBankSIMD(const float* inputs, float* states,
                             const float* coeffs, float* outputs,
                             size_t numChannels) noexcept;
 
-/// SIMD-accelerated Hadamard (FWHT) butterfly
+/// SIMD-accelerated damping stage: one-pole filter bank, per-channel Jot DC
+/// gain and DC blocker fused into one pass over the channels
+void fdnApplyDampingSIMD(const float* inputs, float* filterStates,
+                         const float* coeffs, const float* gainDC,
+                         float* dcBlockX, float* dcBlockY, float dcBlockR,
+                         float* outputs, size_t numChannels) noexcept;
+
+/// SIMD-batched tap read from a frame-major delay ring:
+/// outputs[i] = ring[((writePos - 1 - delays[i]) & mask) * numChannels + i]
+void fdnGatherTapsSIMD(const float* ring, const int32_t* delays,
+                       int32_t writePos, int32_t mask,
+                       float* outputs, size_t numChannels) noexcept;
+
+/// SIMD-accelerated Hadamard (FWHT) butterfly, numChannels = power of 2 >= 8
 void fdnApplyHadamardSIMD(float* data, size_t numChannels) noexcept;
 
-/// SIMD-accelerated Householder feedback matrix
+/// SIMD-accelerated Householder feedback matrix, numChannels = multiple of 4
 void fdnApplyHouseholderSIMD(float* data, size_t numChannels) noexcept;
 
 /// SIMD-accelerated feedback gain + input injection: data[i] = data[i] * gains[i] + input
@@ -90,8 +110,65 @@ static constexpr double kReferenceSampleRate = 48000.0;
 /// Adjusted: [149, 193, 241, 307, 389, 491, 631, 797] (all prime, GCD=1 for all pairs)
 static constexpr size_t kRefDelays[8] = {149, 193, 241, 307, 389, 491, 631, 797};
 
-/// Normalization factor for 8-point Hadamard: 1/sqrt(8)
-static constexpr float kHadamardNorm = 0.35355339059327373f;  // 1/sqrt(8)
+/// 16-line reference delays: same 149-797 span, exponential targets snapped
+/// to the nearest unused prime
+static constexpr size_t kRefDelays16[16] = {
+    149, 167, 191, 211, 233, 263, 293, 331,
+    367, 409, 457, 509, 569, 641, 709, 797};
+
+/// 32-line reference delays: same span and construction as kRefDelays16
+static constexpr size_t kRefDelays32[32] = {
+    149, 157, 167, 173, 181, 197, 211, 223,
+    229, 241, 257, 271, 283, 307, 317, 337,
+    353, 373, 397, 419, 439, 463, 491, 521,
+    547, 577, 607, 641, 677, 719, 757, 797};
+
+/// Reference delay table for an N-line network
+template <size_t N>
+[[nodiscard]] constexpr const size_t* refDelays() noexcept {
+    if constexpr (N == 8) return kRefDelays;
+    else if constexpr (N == 16) return kRefDelays16;
+    else return kRefDelays32;
+}
+
+/// Diffuser reference delays for an N-line network, drawn from the 32
+/// consecutive primes 13..157: step s, channel c uses prime (8s + c) mod 32.
+/// For N=8 each step gets its own 8 primes (13-41, 43-73, 79-109, 113-157);
+/// larger networks reuse the pool with distinct primes within each step, so
+/// the mean diffuser path length (and hence the decay time) matches N=8.
+template <size_t N, size_t NumSteps>
+[[nodiscard]] constexpr std::array<size_t, N * NumSteps> makeDiffuserRefDelays() noexcept {
+    constexpr size_t kPoolSize = 32;
+    static_assert(N <= kPoolSize, "not enough distinct diffuser primes per step");
+
+    std::array<size_t, kPoolSize> pool{};
+    size_t candidate = 13;
+    for (size_t i = 0; i < kPoolSize; ++candidate) {
+        bool prime = true;
+        for (size_t k = 2; k * k <= candidate; ++k) {
+            if (candidate % k == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) pool[i++] = candidate;
+    }
+
+    std::array<size_t, N * NumSteps> delays{};
+    for (size_t step = 0; step < NumSteps; ++step) {
+        for (size_t ch = 0; ch < N; ++ch) {
+            delays[step * N + ch] = pool[(8 * step + ch) % kPoolSize];
+        }
+    }
+    return delays;
+}
+
+/// 1/sqrt(n) for a power-of-two n
+[[nodiscard]] constexpr float invSqrtPow2(size_t n) noexcept {
+    float result = 1.0f;
+    for (; n >= 4; n >>= 2) result *= 0.5f;
+    return (n == 2) ? result * 0.70710678118654752f : result;
+}
 
 /// Parameter smoothing time in milliseconds
 static constexpr float kSmoothingTimeMs = 10.0f;
@@ -99,23 +176,33 @@ static constexpr float kSmoothingTimeMs = 10.0f;
 } // namespace fdn_detail
 
 // =============================================================================
-// FDNReverb Class (FR-007)
+// FDNReverbN Class (FR-007)
 // =============================================================================
 
-/// @brief 8-channel Feedback Delay Network reverb (Layer 4).
+/// @brief NumLines-channel Feedback Delay Network reverb (Layer 4).
 ///
 /// Architecture:
 ///   Input -> Mono sum -> Pre-delay -> Hadamard diffuser (4 steps)
-///         -> Feedback loop (Householder matrix + 8 delay lines
+///         -> Feedback loop (Householder matrix + NumLines delay lines
 ///            + one-pole damping + DC blockers + 4-channel LFO modulation)
 ///         -> Stereo output with width control
-class FDNReverb {
+///
+/// More lines raise echo density (N^k paths after k round trips) at roughly
+/// linear cost per sample. The output gain is 1/sqrt(2N) so the tail level
+/// stays comparable across sizes; FDNReverbN<8> is the original reverb.
+///
+/// @tparam NumLines Number of delay lines: 8, 16 or 32
+template <size_t NumLines>
+class FDNReverbN {
+    static_assert(NumLines == 8 || NumLines == 16 || NumLines == 32,
+                  "FDNReverbN supports 8, 16 or 32 delay lines");
+
 public:
     // =========================================================================
     // Constants
     // =========================================================================
 
-    static constexpr size_t kNumChannels = 8;
+    static constexpr size_t kNumChannels = NumLines;
     static constexpr size_t kNumModulatedChannels = 4;
     static constexpr size_t kNumDiffuserSteps = 4;
     static constexpr size_t kSubBlockSize = 16;
@@ -124,7 +211,7 @@ public:
     // Lifecycle
     // =========================================================================
 
-    FDNReverb() noexcept = default;
+    FDNReverbN() noexcept = default;
 
     /// @brief Prepare for processing. Allocates all buffers. (FR-020)
     /// @note Must be called from a non-real-time thread (allocates memory).
@@ -135,65 +222,58 @@ public:
         sampleRate_ = sampleRate;
 
         // -- Scale delay lengths from 48kHz reference (FR-009) --
+        const size_t* refDelayTable = refDelays<kNumChannels>();
         for (size_t i = 0; i < kNumChannels; ++i) {
             size_t scaled = static_cast<size_t>(
-                std::round(static_cast<double>(kRefDelays[i]) * sampleRate / kReferenceSampleRate));
+                std::round(static_cast<double>(refDelayTable[i]) * sampleRate / kReferenceSampleRate));
             // Enforce 3ms min / 20ms max per FR-009 rule 3
             size_t minDelay = static_cast<size_t>(0.003 * sampleRate);
             size_t maxDelay = static_cast<size_t>(0.020 * sampleRate);
             delayLengths_[i] = std::clamp(scaled, minDelay, maxDelay);
+            delayTaps_[i] = static_cast<int32_t>(delayLengths_[i]);
         }
 
-        // -- Allocate contiguous delay buffer with power-of-2 sections --
-        totalDelayBufferSize_ = 0;
-        for (size_t i = 0; i < kNumChannels; ++i) {
-            // Add margin for LFO modulation on longer delays + safety
-            size_t maxLen = delayLengths_[i] + 64;
-            delaySectionSizes_[i] = nextPowerOf2(maxLen);
-            delaySectionMasks_[i] = delaySectionSizes_[i] - 1;
-            delaySectionOffsets_[i] = totalDelayBufferSize_;
-            totalDelayBufferSize_ += delaySectionSizes_[i];
-        }
-        delayBuffer_.assign(totalDelayBufferSize_, 0.0f);
+        // -- Allocate frame-major delay ring (one row per time step) --
+        // Sized for the longest line plus margin for LFO modulation + safety
+        size_t longest = *std::max_element(delayLengths_, delayLengths_ + kNumChannels);
+        size_t ringLength = nextPowerOf2(longest + 64);
+        delayRingMask_ = ringLength - 1;
+        delayRing_.assign(ringLength * kNumChannels, 0.0f);
 
         // -- Per-channel diffuser delay lengths (FR-008) --
         // Each channel within a step has a distinct prime delay for improved
         // temporal diffusion and decorrelation.
-        static constexpr size_t kDiffRefDelays[kNumDiffuserSteps][kNumChannels] = {
-            {13, 17, 19, 23, 29, 31, 37, 41},       // Step 0: ~0.27-0.85ms
-            {43, 47, 53, 59, 61, 67, 71, 73},       // Step 1: ~0.90-1.52ms
-            {79, 83, 89, 97, 101, 103, 107, 109},   // Step 2: ~1.65-2.27ms
-            {113, 127, 131, 137, 139, 149, 151, 157} // Step 3: ~2.35-3.27ms
-        };
-
-        totalDiffuserBufferSize_ = 0;
+        static constexpr auto kDiffRefDelays =
+            makeDiffuserRefDelays<kNumChannels, kNumDiffuserSteps>();
+
+        size_t totalDiffuserBufferSize = 0;
         for (size_t step = 0; step < kNumDiffuserSteps; ++step) {
+            size_t stepLongest = 1;
             for (size_t ch = 0; ch < kNumChannels; ++ch) {
                 size_t idx = step * kNumChannels + ch;
                 size_t scaled = static_cast<size_t>(
-                    std::round(static_cast<double>(kDiffRefDelays[step][ch])
+                    std::round(static_cast<double>(kDiffRefDelays[idx])
                                * sampleRate / kReferenceSampleRate));
                 scaled = std::max(scaled, size_t(1));
-                diffuserDelayLengths_[idx] = scaled;
-
-                size_t secSize = nextPowerOf2(scaled + 4);
-                diffuserSectionSizes_[idx] = secSize;
-                diffuserSectionMasks_[idx] = secSize - 1;
-                diffuserSectionOffsets_[idx] = totalDiffuserBufferSize_;
-                totalDiffuserBufferSize_ += secSize;
+                diffuserTaps_[idx] = static_cast<int32_t>(scaled);
+                stepLongest = std::max(stepLongest, scaled);
             }
+
+            size_t stepLength = nextPowerOf2(stepLongest + 4);
+            diffuserRingMasks_[step] = stepLength - 1;
+            diffuserRingOffsets_[step] = totalDiffuserBufferSize;
+            totalDiffuserBufferSize += stepLength * kNumChannels;
         }
-        diffuserBuffer_.assign(totalDiffuserBufferSize_, 0.0f);
+        diffuserRing_.assign(totalDiffuserBufferSize, 0.0f);
 
         // -- Pre-delay (up to 100ms) --
         preDelay_.prepare(sampleRate, 0.1f);
 
         // -- LFO initialization (FR-013): 4 channels, quadrature phase offsets --
-        // Modulate the 4 longest delays (indices 4,5,6,7 after ascending sort)
-        lfoModChannels_[0] = 4;
-        lfoModChannels_[1] = 5;
-        lfoModChannels_[2] = 6;
-        lfoModChannels_[3] = 7;
+        // Modulate the 4 longest delays (last 4 indices after ascending sort)
+        for (size_t j = 0; j < kNumModulatedChannels; ++j) {
+            lfoModChannels_[j] = kNumChannels - kNumModulatedChannels + j;
+        }
 
         for (size_t j = 0; j < kNumModulatedChannels; ++j) {
             float phase = static_cast<float>(j) * kHalfPi;
@@ -217,16 +297,15 @@ public:
     /// @brief Reset all internal state to silence. (FR-021)
     void reset() noexcept {
         // Zero-fill delay buffers
-        std::fill(delayBuffer_.begin(), delayBuffer_.end(), 0.0f);
-        std::fill(diffuserBuffer_.begin(), diffuserBuffer_.end(), 0.0f);
+        std::fill(delayRing_.begin(), delayRing_.end(), 0.0f);
+        std::fill(diffuserRing_.begin(), diffuserRing_.end(), 0.0f);
 
         // Reset write positions
-        for (auto& wp : delayWritePos_) wp = 0;
+        delayWritePos_ = 0;
         for (auto& wp : diffuserWritePos_) wp = 0;
 
         // Reset SoA state arrays
         for (size_t i = 0; i < kNumChannels; ++i) {
-            delayOutputs_[i] = 0.0f;
             filterStates_[i] = 0.0f;
             dcBlockX_[i] = 0.0f;
             dcBlockY_[i] = 0.0f;
@@ -338,9 +417,7 @@ public:
         }
 
         // -- Step 9: Write to delay lines --
-        for (size_t i = 0; i < kNumChannels; ++i) {
-            delayBufWrite(i, processed[i]);
-        }
+        delayBufWriteFrame(processed);
 
         // -- Step 10: Advance LFO (Gordon-Smith phasor) + pre-compute excursions --
         for (size_t j = 0; j < kNumModulatedChannels; ++j) {
@@ -352,17 +429,9 @@ public:
         }
 
         // -- Step 11: Stereo output from delay reads --
-        // Odd/even channel split for stereo
         float wetL = 0.0f;
         float wetR = 0.0f;
-        for (size_t i = 0; i < kNumChannels; i += 2) {
-            wetL += delReads[i];
-        }
-        for (size_t i = 1; i < kNumChannels; i += 2) {
-            wetR += delReads[i];
-        }
-        wetL *= 0.25f;  // 1/4 (sum of 4 channels)
-        wetR *= 0.25f;
+        mixToStereo(delReads, wetL, wetR);
 
         // Width processing
         float mid = 0.5f * (wetL + wetR);
@@ -381,7 +450,8 @@ public:
     /// Uses 16-sample sub-blocks: block-rate parameters (LFO epsilon, filter
     /// coefficients, dry/wet gains) are updated once per sub-block, then held
     /// constant for the inner 16-sample loop. SIMD kernels operate on the
-    /// 8-channel dimension within each sample step.
+    /// channel dimension within each sample step: tap reads are one gather per
+    /// delay bank, writes one contiguous row.
     void processBlock(float* left, float* right, size_t numSamples) noexcept {
         if (!prepared_) return;
 
@@ -433,19 +503,25 @@ public:
                     std::max(0.0f, subBlockPreDelaySamples));
 
                 // -- Step 3: Read delay outputs (output taps) --
+                // Fixed-length taps in one gather (a linear read at an
+                // integer delay is the sample itself), then cubic re-reads
+                // for the LFO-modulated channels.
                 alignas(32) float delReads[kNumChannels];
-                for (size_t i = 0; i < kNumChannels; ++i) {
-                    float delayF = static_cast<float>(delayLengths_[i]);
-                    delayF += lfoExcursionPerChannel_[i];
-                    delayF = std::max(1.0f, delayF);
+                fdnGatherTapsSIMD(delayRing_.data(), delayTaps_,
+                                  static_cast<int32_t>(delayWritePos_),
+                                  static_cast<int32_t>(delayRingMask_),
+                                  delReads, kNumChannels);
+                for (size_t j = 0; j < kNumModulatedChannels; ++j) {
+                    const size_t i = lfoModChannels_[j];
                     if (lfoExcursionPerChannel_[i] != 0.0f) {
-                        delReads[i] = delayBufReadCubic(i, delayF);
-                    } else {
-                        delReads[i] = delayBufReadLinear(i, delayF);
+                        float delayF = static_cast<float>(delayLengths_[i])
+                                     + lfoExcursionPerChannel_[i];
+                        delReads[i] = delayBufReadCubic(i, std::max(1.0f, delayF));
                     }
                 }
 
-                // -- Step 4: One-pole damping filters via SIMD (FR-011, FR-015a) --
+                // -- Steps 4-5: Damping + Jot DC gain + DC blockers via SIMD --
+                // (FR-011, FR-012, FR-015a)
                 alignas(32) float processed[kNumChannels];
                 if (subBlockFreeze) {
                     for (size_t i = 0; i < kNumChannels; ++i) {
@@ -453,48 +529,36 @@ public:
                         processed[i] = delReads[i];
                     }
                 } else {
-                    fdnApplyFilterBankSIMD(delReads, filterStates_,
-                                           subBlockFilterCoeffs,
-                                           processed, kNumChannels);
-                    // Apply per-channel Jot DC gain after filter bank
-                    for (size_t i = 0; i < kNumChannels; ++i) {
-                        processed[i] *= subBlockFilterGainDC[i];
-                    }
-                }
-
-                // -- Step 5: DC blockers (FR-012) --
-                if (!subBlockFreeze) {
-                    for (size_t i = 0; i < kNumChannels; ++i) {
-                        dcBlockY_[i] = processed[i] - dcBlockX_[i]
-                                     + dcBlockR_ * dcBlockY_[i];
-                        dcBlockX_[i] = processed[i];
-                        processed[i] = dcBlockY_[i];
-                    }
+                    fdnApplyDampingSIMD(delReads, filterStates_,
+                                        subBlockFilterCoeffs, subBlockFilterGainDC,
+                                        dcBlockX_, dcBlockY_, dcBlockR_,
+                                        processed, kNumChannels);
                 }
 
                 // -- Step 6: Hadamard diffuser via SIMD (FR-008, FR-015b) --
+                alignas(32) float diffused[kNumChannels];
+                float* frame = processed;
+                float* delayed = diffused;
                 for (size_t step = 0; step < kNumDiffuserSteps; ++step) {
-                    for (size_t ch = 0; ch < kNumChannels; ++ch) {
-                        size_t idx = step * kNumChannels + ch;
-                        float delayed = diffuserBufRead(step, ch,
-                                                        diffuserDelayLengths_[idx]);
-                        diffuserBufWrite(step, ch, processed[ch]);
-                        processed[ch] = delayed;
-                    }
-                    fdnApplyHadamardSIMD(processed, kNumChannels);
+                    fdnGatherTapsSIMD(diffuserRing_.data() + diffuserRingOffsets_[step],
+                                      diffuserTaps_ + step * kNumChannels,
+                                      static_cast<int32_t>(diffuserWritePos_[step]),
+                                      static_cast<int32_t>(diffuserRingMasks_[step]),
+                                      delayed, kNumChannels);
+                    diffuserBufWriteFrame(step, frame);
+                    std::swap(frame, delayed);
+                    fdnApplyHadamardSIMD(frame, kNumChannels);
                 }
 
                 // -- Step 7: Householder feedback via SIMD (FR-010, FR-015c) --
-                fdnApplyHouseholderSIMD(processed, kNumChannels);
+                fdnApplyHouseholderSIMD(frame, kNumChannels);
 
                 // -- Step 8: Apply feedback gains and add new input (SIMD) --
-                fdnApplyFeedbackSIMD(processed, subBlockFeedbackGains,
+                fdnApplyFeedbackSIMD(frame, subBlockFeedbackGains,
                                       preDelayed, kNumChannels);
 
                 // -- Step 9: Write to delay lines --
-                for (size_t i = 0; i < kNumChannels; ++i) {
-                    delayBufWrite(i, processed[i]);
-                }
+                delayBufWriteFrame(frame);
 
                 // -- Step 10: Advance LFO + pre-compute excursions --
                 for (size_t j = 0; j < kNumModulatedChannels; ++j) {
@@ -511,14 +575,7 @@ public:
                 // -- Step 11: Stereo output from delay reads --
                 float wetL = 0.0f;
                 float wetR = 0.0f;
-                for (size_t i = 0; i < kNumChannels; i += 2) {
-                    wetL += delReads[i];
-                }
-                for (size_t i = 1; i < kNumChannels; i += 2) {
-                    wetR += delReads[i];
-                }
-                wetL *= 0.25f;
-                wetR *= 0.25f;
+                mixToStereo(delReads, wetL, wetR);
 
                 float mid = 0.5f * (wetL + wetR);
                 float side = 0.5f * (wetL - wetR);
@@ -542,7 +599,15 @@ public:
         return prepared_;
     }
 
+    /// @brief Delay length of one line in samples at the prepared rate.
+    [[nodiscard]] size_t delayLength(size_t line) const noexcept {
+        return line < kNumChannels ? delayLengths_[line] : 0;
+    }
+
 private:
+    /// Output gain 1/sqrt(2N): 0.25 for 8 lines (1/4 of each 4-channel sum)
+    static constexpr float kOutputGain = fdn_detail::invSqrtPow2(2 * kNumChannels);
+
     // =========================================================================
     // Internal parameter update
     // =========================================================================
@@ -632,19 +697,18 @@ private:
     }
 
     // =========================================================================
-    // Delay buffer helpers (contiguous buffer with power-of-2 sections)
+    // Delay ring helpers (frame-major, power-of-2 rows, shared write position)
     // =========================================================================
 
-    void delayBufWrite(size_t channel, float sample) noexcept {
-        size_t offset = delaySectionOffsets_[channel];
-        delayBuffer_[offset + delayWritePos_[channel]] = sample;
-        delayWritePos_[channel] = (delayWritePos_[channel] + 1) & delaySectionMasks_[channel];
+    void delayBufWriteFrame(const float* frame) noexcept {
+        std::copy(frame, frame + kNumChannels,
+                  delayRing_.data() + delayWritePos_ * kNumChannels);
+        delayWritePos_ = (delayWritePos_ + 1) & delayRingMask_;
     }
 
     [[nodiscard]] float delayBufRead(size_t channel, size_t delaySamples) const noexcept {
-        size_t offset = delaySectionOffsets_[channel];
-        size_t readPos = (delayWritePos_[channel] - 1 - delaySamples) & delaySectionMasks_[channel];
-        return delayBuffer_[offset + readPos];
+        size_t readPos = (delayWritePos_ - 1 - delaySamples) & delayRingMask_;
+        return delayRing_[readPos * kNumChannels + channel];
     }
 
     [[nodiscard]] float delayBufReadLinear(size_t channel, float delaySamples) const noexcept {
@@ -670,72 +734,57 @@ private:
     }
 
     // =========================================================================
-    // Diffuser buffer helpers
+    // Diffuser ring helpers (one frame-major ring per step)
     // =========================================================================
 
-    void diffuserBufWrite(size_t step, size_t channel, float sample) noexcept {
-        size_t idx = step * kNumChannels + channel;
-        size_t offset = diffuserSectionOffsets_[idx];
-        diffuserBuffer_[offset + diffuserWritePos_[idx]] = sample;
-        diffuserWritePos_[idx] = (diffuserWritePos_[idx] + 1) & diffuserSectionMasks_[idx];
+    void diffuserBufWriteFrame(size_t step, const float* frame) noexcept {
+        float* ring = diffuserRing_.data() + diffuserRingOffsets_[step];
+        std::copy(frame, frame + kNumChannels,
+                  ring + diffuserWritePos_[step] * kNumChannels);
+        diffuserWritePos_[step] = (diffuserWritePos_[step] + 1) & diffuserRingMasks_[step];
     }
 
     [[nodiscard]] float diffuserBufRead(size_t step, size_t channel,
                                          size_t delaySamples) const noexcept {
-        size_t idx = step * kNumChannels + channel;
-        size_t offset = diffuserSectionOffsets_[idx];
-        size_t readPos = (diffuserWritePos_[idx] - 1 - delaySamples) & diffuserSectionMasks_[idx];
-        return diffuserBuffer_[offset + readPos];
+        size_t readPos = (diffuserWritePos_[step] - 1 - delaySamples) & diffuserRingMasks_[step];
+        return diffuserRing_[diffuserRingOffsets_[step] + readPos * kNumChannels + channel];
     }
 
     // =========================================================================
     // Hadamard FWHT (FR-008)
     // =========================================================================
 
-    /// 3-stage butterfly FWHT for 8 channels + 1/sqrt(8) normalization
+    /// log2(N)-stage butterfly FWHT + 1/sqrt(N) normalization
     static void applyHadamard(float x[kNumChannels]) noexcept {
-        using namespace fdn_detail;
-
-        // Stage 1: stride = 4
-        for (size_t i = 0; i < 4; ++i) {
-            float a = x[i];
-            float b = x[i + 4];
-            x[i] = a + b;
-            x[i + 4] = a - b;
-        }
-
-        // Stage 2: stride = 2
-        for (size_t k = 0; k < 8; k += 4) {
-            for (size_t i = 0; i < 2; ++i) {
-                float a = x[k + i];
-                float b = x[k + i + 2];
-                x[k + i] = a + b;
-                x[k + i + 2] = a - b;
+        constexpr float kNorm = fdn_detail::invSqrtPow2(kNumChannels);
+
+        for (size_t stride = kNumChannels / 2; stride >= 1; stride /= 2) {
+            for (size_t k = 0; k < kNumChannels; k += 2 * stride) {
+                for (size_t i = 0; i < stride; ++i) {
+                    float a = x[k + i];
+                    float b = x[k + i + stride];
+                    x[k + i] = a + b;
+                    x[k + i + stride] = a - b;
+                }
             }
         }
 
-        // Stage 3: stride = 1
-        for (size_t k = 0; k < 8; k += 2) {
-            float a = x[k];
-            float b = x[k + 1];
-            x[k] = a + b;
-            x[k + 1] = a - b;
-        }
-
         // Normalize
         for (size_t i = 0; i < kNumChannels; ++i) {
-            x[i] *= kHadamardNorm;
+            x[i] *= kNorm;
         }
     }
 
     /// Diffuser step: read from diffuser delay, apply Hadamard, write back (FR-008)
     void applyDiffuserStep(float x[kNumChannels], size_t stepIndex) noexcept {
+        float delayed[kNumChannels];
         for (size_t ch = 0; ch < kNumChannels; ++ch) {
             size_t idx = stepIndex * kNumChannels + ch;
-            float delayed = diffuserBufRead(stepIndex, ch, diffuserDelayLengths_[idx]);
-            diffuserBufWrite(stepIndex, ch, x[ch]);
-            x[ch] = delayed;
+            delayed[ch] = diffuserBufRead(stepIndex, ch,
+                                          static_cast<size_t>(diffuserTaps_[idx]));
         }
+        diffuserBufWriteFrame(stepIndex, x);
+        std::copy(delayed, delayed + kNumChannels, x);
 
         applyHadamard(x);
     }
@@ -744,19 +793,35 @@ private:
     // Householder feedback matrix (FR-010)
     // =========================================================================
 
-    /// y[i] = x[i] - (2/N) * sum(x) = x[i] - 0.25 * sum(x) for N=8
-    /// Total: 8 adds + 1 mul + 8 subs = 17 arithmetic ops
+    /// y[i] = x[i] - (2/N) * sum(x) (0.25 for N=8)
+    /// Total: N adds + 1 mul + N subs
     static void applyHouseholder(float x[kNumChannels]) noexcept {
         float sum = 0.0f;
         for (size_t i = 0; i < kNumChannels; ++i) {
             sum += x[i];
         }
-        float scaled = sum * 0.25f;  // 2/8 = 0.25
+        float scaled = sum * (2.0f / static_cast<float>(kNumChannels));
         for (size_t i = 0; i < kNumChannels; ++i) {
             x[i] -= scaled;
         }
     }
 
+    // =========================================================================
+    // Stereo tap mix
+    // =========================================================================
+
+    /// Odd/even channel split: even channels -> left, odd -> right
+    static void mixToStereo(const float* taps, float& wetL, float& wetR) noexcept {
+        for (size_t i = 0; i < kNumChannels; i += 2) {
+            wetL += taps[i];
+        }
+        for (size_t i = 1; i < kNumChannels; i += 2) {
+            wetR += taps[i];
+        }
+        wetL *= kOutputGain;
+        wetR *= kOutputGain;
+    }
+
     // =========================================================================
     // Configuration
     // =========================================================================
@@ -771,7 +836,6 @@ private:
     // =========================================================================
     // SoA state arrays (FR-014) - alignas(32) for SIMD
     // =========================================================================
-    alignas(32) float delayOutputs_[kNumChannels] = {};
     alignas(32) float filterStates_[kNumChannels] = {};
     alignas(32) float filterCoeffs_[kNumChannels] = {};
     alignas(32) float filterGainDC_[kNumChannels] = {};  // Per-channel DC gain (Jot absorption)
@@ -780,26 +844,22 @@ private:
     alignas(32) float feedbackGains_[kNumChannels] = {};
 
     // =========================================================================
-    // Main delay buffer (contiguous, FR-009)
+    // Main delay ring (frame-major, FR-009)
     // =========================================================================
-    std::vector<float> delayBuffer_;
-    size_t totalDelayBufferSize_ = 0;
+    std::vector<float> delayRing_;
+    size_t delayRingMask_ = 0;
+    size_t delayWritePos_ = 0;
     size_t delayLengths_[kNumChannels] = {};
-    size_t delaySectionSizes_[kNumChannels] = {};
-    size_t delaySectionMasks_[kNumChannels] = {};
-    size_t delaySectionOffsets_[kNumChannels] = {};
-    size_t delayWritePos_[kNumChannels] = {};
+    alignas(32) int32_t delayTaps_[kNumChannels] = {};  // delayLengths_ for the gather kernel
 
     // =========================================================================
-    // Diffuser delay buffers (4 steps x 8 channels)
+    // Diffuser delay rings (4 steps x N channels)
     // =========================================================================
-    std::vector<float> diffuserBuffer_;
-    size_t totalDiffuserBufferSize_ = 0;
-    size_t diffuserDelayLengths_[kNumDiffuserSteps * kNumChannels] = {};
-    size_t diffuserSectionSizes_[kNumDiffuserSteps * kNumChannels] = {};
-    size_t diffuserSectionMasks_[kNumDiffuserSteps * kNumChannels] = {};
-    size_t diffuserSectionOffsets_[kNumDiffuserSteps * kNumChannels] = {};
-    size_t diffuserWritePos_[kNumDiffuserSteps * kNumChannels] = {};
+    std::vector<float> diffuserRing_;
+    alignas(32) int32_t diffuserTaps_[kNumDiffuserSteps * kNumChannels] = {};
+    size_t diffuserRingOffsets_[kNumDiffuserSteps] = {};
+    size_t diffuserRingMasks_[kNumDiffuserSteps] = {};
+    size_t diffuserWritePos_[kNumDiffuserSteps] = {};
 
     // =========================================================================
     // Pre-delay
@@ -817,6 +877,15 @@ private:
     float lfoMaxExcursion_ = 0.0f;
 };
 
+/// 8-line FDN reverb (the reverb used by Ruinae's effects chain)
+using FDNReverb = FDNReverbN<8>;
+
+/// 16-line FDN reverb: denser early tail at roughly twice the cost
+using FDNReverb16 = FDNReverbN<16>;
+
+/// 32-line FDN reverb: densest tail, for long ambient settings
+using FDNReverb32 = FDNReverbN<32>;
+
 } // namespace DSP
 } // namespace Krate
 
@@ -1,10 +1,11 @@
 // ==============================================================================
 // Layer 4: FDN Reverb - Highway SIMD Kernels
 // ==============================================================================
-// SIMD-accelerated kernels for the 8-channel FDN reverb (FR-015):
-//   (a) One-pole filter bank (8-channel parallel filtering)
-//   (b) Hadamard FWHT butterfly (3-stage for N=8)
+// SIMD-accelerated kernels for the 8/16/32-channel FDN reverb (FR-015):
+//   (a) One-pole filter bank, fused with Jot DC gain and DC blockers
+//   (b) Hadamard FWHT butterfly (log2(N) stages)
 //   (c) Householder feedback matrix (sum + broadcast + subtract)
+//   (d) Delay tap gather from the frame-major delay rings
 //
 // Uses Highway's self-inclusion pattern: foreach_target.h re-includes this
 // file once per ISA target. The SIMD kernels compile for each target;
@@ -20,6 +21,7 @@
 #include "hwy/highway.h"
 
 #include <cstddef>
+#include <cstdint>
 
 // =============================================================================
 // Per-Target SIMD Kernels (compiled once per ISA target)
@@ -35,7 +37,7 @@ namespace HWY_NAMESPACE {
 namespace hn = hwy::HWY_NAMESPACE;
 
 // -----------------------------------------------------------------------------
-// ApplyFilterBankSIMD: 8-channel one-pole filter bank (FR-011, FR-015a)
+// ApplyFilterBankSIMD: N-channel one-pole filter bank (FR-011, FR-015a)
 // state[i] = coeff[i] * input[i] + (1 - coeff[i]) * state[i]
 // output[i] = state[i]
 // -----------------------------------------------------------------------------
@@ -72,74 +74,157 @@ void ApplyFilterBankSIMDImpl(const float* HWY_RESTRICT inputs,
 }
 
 // -----------------------------------------------------------------------------
-// ApplyHadamardSIMD: 8-point FWHT butterfly (FR-008, FR-015b)
-// 3 stages (log2(8) = 3), each doing N/2 add/subtract pairs
-// followed by 1/sqrt(8) normalization
-// Uses FixedTag<float, 4> for guaranteed 4-wide SIMD on all x86
+// ApplyDampingSIMD: filter bank + Jot DC gain + DC blocker (FR-011, FR-012)
+// state[i] = coeff[i] * input[i] + (1 - coeff[i]) * state[i]
+// x = state[i] * gainDC[i]
+// dcY[i] = x - dcX[i] + R * dcY[i]; dcX[i] = x; output[i] = dcY[i]
 // -----------------------------------------------------------------------------
 
 // NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
-void ApplyHadamardSIMDImpl(float* HWY_RESTRICT data,
-                           [[maybe_unused]] size_t numChannels) {
-    const hn::FixedTag<float, 4> d4;
+void ApplyDampingSIMDImpl(const float* HWY_RESTRICT inputs,
+                          float* HWY_RESTRICT filterStates,
+                          const float* HWY_RESTRICT coeffs,
+                          const float* HWY_RESTRICT gainDC,
+                          float* HWY_RESTRICT dcBlockX,
+                          float* HWY_RESTRICT dcBlockY,
+                          float dcBlockR,
+                          float* HWY_RESTRICT outputs,
+                          size_t numChannels) {
+    const hn::ScalableTag<float> d;
+    const size_t N = hn::Lanes(d);
+    const auto one = hn::Set(d, 1.0f);
+    const auto r = hn::Set(d, dcBlockR);
+
+    size_t i = 0;
+    for (; i + N <= numChannels; i += N) {
+        const auto input = hn::LoadU(d, inputs + i);
+        const auto state = hn::LoadU(d, filterStates + i);
+        const auto coeff = hn::LoadU(d, coeffs + i);
 
-    // Stage 1: stride = 4 (SIMD: lo[0:3] +/- hi[4:7])
-    {
-        auto lo = hn::LoadU(d4, data);
-        auto hi = hn::LoadU(d4, data + 4);
-        hn::StoreU(hn::Add(lo, hi), d4, data);
-        hn::StoreU(hn::Sub(lo, hi), d4, data + 4);
+        const auto oneMinusCoeff = hn::Sub(one, coeff);
+        const auto newState = hn::MulAdd(coeff, input, hn::Mul(oneMinusCoeff, state));
+        hn::StoreU(newState, d, filterStates + i);
+
+        // Separate Mul and Add, not MulAdd: the DC blocker replaced a scalar
+        // loop, and a fused multiply-add would round differently from it
+        const auto x = hn::Mul(newState, hn::LoadU(d, gainDC + i));
+        const auto y = hn::Add(hn::Sub(x, hn::LoadU(d, dcBlockX + i)),
+                               hn::Mul(r, hn::LoadU(d, dcBlockY + i)));
+        hn::StoreU(x, d, dcBlockX + i);
+        hn::StoreU(y, d, dcBlockY + i);
+        hn::StoreU(y, d, outputs + i);
     }
 
-    // Stage 2: stride = 2 (scalar — requires interleaved pairs)
-    for (size_t k = 0; k < 8; k += 4) {
-        for (size_t i = 0; i < 2; ++i) {
-            float a = data[k + i];
-            float b = data[k + i + 2];
-            data[k + i] = a + b;
-            data[k + i + 2] = a - b;
-        }
+    // Scalar tail
+    for (; i < numChannels; ++i) {
+        filterStates[i] = coeffs[i] * inputs[i] + (1.0f - coeffs[i]) * filterStates[i];
+        const float x = filterStates[i] * gainDC[i];
+        dcBlockY[i] = x - dcBlockX[i] + dcBlockR * dcBlockY[i];
+        dcBlockX[i] = x;
+        outputs[i] = dcBlockY[i];
     }
+}
 
-    // Stage 3: stride = 1 (scalar — adjacent pairs)
-    for (size_t k = 0; k < 8; k += 2) {
-        float a = data[k];
-        float b = data[k + 1];
-        data[k] = a + b;
-        data[k + 1] = a - b;
+// -----------------------------------------------------------------------------
+// GatherTapsSIMD: one tap per channel from a frame-major delay ring
+// outputs[i] = ring[((writePos - 1 - delays[i]) & mask) * numChannels + i]
+// -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void GatherTapsSIMDImpl(const float* HWY_RESTRICT ring,
+                        const int32_t* HWY_RESTRICT delays,
+                        int32_t writePos, int32_t mask,
+                        float* HWY_RESTRICT outputs,
+                        size_t numChannels) {
+    const hn::ScalableTag<float> d;
+    const hn::RebindToSigned<decltype(d)> di;
+    const size_t N = hn::Lanes(d);
+    const auto lastWritten = hn::Set(di, writePos - 1);
+    const auto maskVec = hn::Set(di, mask);
+    const auto stride = hn::Set(di, static_cast<int32_t>(numChannels));
+
+    size_t i = 0;
+    for (; i + N <= numChannels; i += N) {
+        const auto row = hn::And(hn::Sub(lastWritten, hn::LoadU(di, delays + i)), maskVec);
+        const auto index = hn::Add(hn::Mul(row, stride),
+                                   hn::Iota(di, static_cast<int32_t>(i)));
+        hn::StoreU(hn::GatherIndex(d, ring, index), d, outputs + i);
     }
 
-    // SIMD normalization: 2x 4-wide multiply by 1/sqrt(8)
-    constexpr float kNorm = 0.35355339059327373f;
-    const auto norm = hn::Set(d4, kNorm);
-    hn::StoreU(hn::Mul(hn::LoadU(d4, data), norm), d4, data);
-    hn::StoreU(hn::Mul(hn::LoadU(d4, data + 4), norm), d4, data + 4);
+    // Scalar tail
+    for (; i < numChannels; ++i) {
+        const int32_t row = (writePos - 1 - delays[i]) & mask;
+        outputs[i] = ring[static_cast<size_t>(row) * numChannels + i];
+    }
 }
 
 // -----------------------------------------------------------------------------
-// ApplyHouseholderSIMD: Householder feedback matrix (FR-010, FR-015c)
-// y[i] = x[i] - (2/N) * sum(x) for N=8
-// Uses 2x FixedTag<float, 4> for guaranteed SIMD on all x86
+// ApplyHadamardSIMD: N-point FWHT butterfly (FR-008, FR-015b)
+// log2(N) stages, each doing N/2 add/subtract pairs, followed by 1/sqrt(N)
+// normalization. Strides >= 4 pair whole 4-wide vectors; strides 2 and 1 are
+// done inside each vector with lane shuffles.
+// Uses FixedTag<float, 4> for guaranteed 4-wide SIMD on all x86
 // -----------------------------------------------------------------------------
 
 // NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
-void ApplyHouseholderSIMDImpl(float* HWY_RESTRICT data,
-                              [[maybe_unused]] size_t numChannels) {
+void ApplyHadamardSIMDImpl(float* HWY_RESTRICT data, size_t numChannels) {
     const hn::FixedTag<float, 4> d4;
 
-    // Load two halves
-    const auto lo = hn::LoadU(d4, data);
-    const auto hi = hn::LoadU(d4, data + 4);
+    // Strides N/2 .. 4: lo[k:k+4] +/- hi[k+stride:k+stride+4]
+    for (size_t stride = numChannels / 2; stride >= 4; stride /= 2) {
+        for (size_t k = 0; k < numChannels; k += 2 * stride) {
+            for (size_t i = 0; i < stride; i += 4) {
+                const auto lo = hn::LoadU(d4, data + k + i);
+                const auto hi = hn::LoadU(d4, data + k + i + stride);
+                hn::StoreU(hn::Add(lo, hi), d4, data + k + i);
+                hn::StoreU(hn::Sub(lo, hi), d4, data + k + i + stride);
+            }
+        }
+    }
+
+    // Strides 2 and 1 within each vector, then normalize:
+    //   [a b c d] -> [a+c b+d a-c b-d] -> pairwise sum/difference
+    float norm = 1.0f;
+    size_t n = numChannels;
+    for (; n >= 4; n >>= 2) norm *= 0.5f;
+    if (n == 2) norm *= 0.70710678118654752f;  // odd log2(N)
+    const auto normVec = hn::Set(d4, norm);
+
+    for (size_t k = 0; k < numChannels; k += 4) {
+        const auto v = hn::LoadU(d4, data + k);
+
+        const auto swapped2 = hn::Shuffle1032(v);  // [c d a b]
+        const auto s2 = hn::ConcatUpperLower(d4, hn::Sub(swapped2, v),
+                                             hn::Add(v, swapped2));
+
+        const auto swapped1 = hn::Shuffle2301(s2);  // pairs swapped
+        const auto s1 = hn::OddEven(hn::Sub(swapped1, s2), hn::Add(s2, swapped1));
+
+        hn::StoreU(hn::Mul(s1, normVec), d4, data + k);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ApplyHouseholderSIMD: Householder feedback matrix (FR-010, FR-015c)
+// y[i] = x[i] - (2/N) * sum(x)
+// Uses FixedTag<float, 4> for guaranteed SIMD on all x86
+// -----------------------------------------------------------------------------
 
-    // Sum all 8 elements
-    const float sumLo = hn::ReduceSum(d4, lo);
-    const float sumHi = hn::ReduceSum(d4, hi);
-    const float sum = sumLo + sumHi;
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void ApplyHouseholderSIMDImpl(float* HWY_RESTRICT data, size_t numChannels) {
+    const hn::FixedTag<float, 4> d4;
+
+    // Sum all N elements, one 4-wide block at a time
+    float sum = 0.0f;
+    for (size_t i = 0; i < numChannels; i += 4) {
+        sum += hn::ReduceSum(d4, hn::LoadU(d4, data + i));
+    }
 
     // Broadcast scaled sum and subtract
-    const auto scaled = hn::Set(d4, sum * 0.25f);  // 2/8 = 0.25
-    hn::StoreU(hn::Sub(lo, scaled), d4, data);
-    hn::StoreU(hn::Sub(hi, scaled), d4, data + 4);
+    const auto scaled = hn::Set(d4, sum * (2.0f / static_cast<float>(numChannels)));
+    for (size_t i = 0; i < numChannels; i += 4) {
+        hn::StoreU(hn::Sub(hn::LoadU(d4, data + i), scaled), d4, data + i);
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -184,6 +269,8 @@ HWY_AFTER_NAMESPACE();
 namespace Krate::DSP {  // NOLINT(modernize-concat-nested-namespaces) already concatenated; false positive under HWY_ONCE guard
 
 HWY_EXPORT(ApplyFilterBankSIMDImpl);
+HWY_EXPORT(ApplyDampingSIMDImpl);
+HWY_EXPORT(GatherTapsSIMDImpl);
 HWY_EXPORT(ApplyHadamardSIMDImpl);
 HWY_EXPORT(ApplyHouseholderSIMDImpl);
 HWY_EXPORT(ApplyFeedbackSIMDImpl);
@@ -196,6 +283,24 @@ void fdnApplyFilterBankSIMD(  // NOLINT(misc-use-internal-linkage) Highway HWY_D
                                                    outputs, numChannels);
 }
 
+void fdnApplyDampingSIMD(  // NOLINT(misc-use-internal-linkage) Highway HWY_DYNAMIC_DISPATCH requires external linkage
+    const float* inputs, float* filterStates,
+    const float* coeffs, const float* gainDC,
+    float* dcBlockX, float* dcBlockY, float dcBlockR,
+    float* outputs, size_t numChannels) noexcept {
+    HWY_DYNAMIC_DISPATCH(ApplyDampingSIMDImpl)(inputs, filterStates, coeffs, gainDC,
+                                                dcBlockX, dcBlockY, dcBlockR,
+                                                outputs, numChannels);
+}
+
+void fdnGatherTapsSIMD(  // NOLINT(misc-use-internal-linkage) Highway HWY_DYNAMIC_DISPATCH requires external linkage
+    const float* ring, const int32_t* delays,
+    int32_t writePos, int32_t mask,
+    float* outputs, size_t numChannels) noexcept {
+    HWY_DYNAMIC_DISPATCH(GatherTapsSIMDImpl)(ring, delays, writePos, mask,
+                                              outputs, numChannels);
+}
+
 void fdnApplyHadamardSIMD(  // NOLINT(misc-use-internal-linkage) Highway HWY_DYNAMIC_DISPATCH requires external linkage
     float* data, size_t numChannels) noexcept {
     HWY_DYNAMIC_DISPATCH(ApplyHadamardSIMDImpl)(data, numChannels);
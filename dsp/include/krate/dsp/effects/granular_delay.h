@@ -22,7 +22,9 @@
 #include <krate/dsp/systems/granular_engine.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 namespace Krate::DSP {
 
@@ -204,6 +206,14 @@ private:
     void processCore(const float* leftIn, const float* rightIn,
                      float* leftOut, float* rightOut,
                      size_t numSamples) noexcept {
+        // Without feedback the engine input is just the dry input, so the
+        // engine can run a whole block at a time
+        if (feedbackSmoother_.getTarget() == 0.0f && feedbackSmoother_.isComplete()) {
+            feedbackSmoother_.snapToTarget();
+            processWithoutFeedback(leftIn, rightIn, leftOut, rightOut, numSamples);
+            return;
+        }
+
         for (size_t i = 0; i < numSamples; ++i) {
             // Get smoothed parameters
             const float feedback = feedbackSmoother_.process();
@@ -230,35 +240,61 @@ private:
             float wetR = 0.0f;
             engine_.process(inputL, inputR, wetL, wetR);
 
-            // Apply soft limiter to wet output before storing for feedback
-            // This prevents extreme values from entering the feedback loop
-            const float limitedWetL = std::tanh(wetL * 0.5f) * 2.0f;
-            const float limitedWetR = std::tanh(wetR * 0.5f) * 2.0f;
-
-            // Store limited values for feedback
-            feedbackL_ = limitedWetL;
-            feedbackR_ = limitedWetR;
-
-            // Dry/wet mix (use limited wet for output as well)
-            const float dryL = leftIn[i] * (1.0f - dryWet);
-            const float dryR = rightIn[i] * (1.0f - dryWet);
-
-            float mixedL = dryL + limitedWetL * dryWet;
-            float mixedR = dryR + limitedWetR * dryWet;
-
-            // Apply stereo width (Phase 2.4)
-            // At width=0: mono (L == R == mid)
-            // At width=1: full stereo (unchanged)
-            if (stereoWidth_ < 1.0f) {
-                const float mid = (mixedL + mixedR) * 0.5f;
-                const float side = (mixedL - mixedR) * 0.5f;
-                mixedL = mid + stereoWidth_ * side;
-                mixedR = mid - stereoWidth_ * side;
+            mixOutput(leftIn[i], rightIn[i], wetL, wetR, dryWet, leftOut[i], rightOut[i]);
+        }
+    }
+
+    /// Block path for feedback == 0: the engine renders up to kWetChunk
+    /// samples at a time into the wet scratch buffers
+    void processWithoutFeedback(const float* leftIn, const float* rightIn,
+                                float* leftOut, float* rightOut,
+                                size_t numSamples) noexcept {
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t count = std::min(kWetChunk, numSamples - offset);
+            engine_.processBlock(leftIn + offset, rightIn + offset,
+                                 wetL_.data(), wetR_.data(), count);
+
+            for (size_t i = 0; i < count; ++i) {
+                const float dryWet = dryWetSmoother_.process();
+                mixOutput(leftIn[offset + i], rightIn[offset + i], wetL_[i], wetR_[i],
+                          dryWet, leftOut[offset + i], rightOut[offset + i]);
             }
+            offset += count;
+        }
+    }
 
-            leftOut[i] = mixedL;
-            rightOut[i] = mixedR;
+    /// Limit the wet signal, store it for feedback, and mix with the dry input
+    void mixOutput(float inL, float inR, float wetL, float wetR, float dryWet,
+                   float& outL, float& outR) noexcept {
+        // Apply soft limiter to wet output before storing for feedback
+        // This prevents extreme values from entering the feedback loop
+        const float limitedWetL = std::tanh(wetL * 0.5f) * 2.0f;
+        const float limitedWetR = std::tanh(wetR * 0.5f) * 2.0f;
+
+        // Store limited values for feedback
+        feedbackL_ = limitedWetL;
+        feedbackR_ = limitedWetR;
+
+        // Dry/wet mix (use limited wet for output as well)
+        const float dryL = inL * (1.0f - dryWet);
+        const float dryR = inR * (1.0f - dryWet);
+
+        float mixedL = dryL + limitedWetL * dryWet;
+        float mixedR = dryR + limitedWetR * dryWet;
+
+        // Apply stereo width (Phase 2.4)
+        // At width=0: mono (L == R == mid)
+        // At width=1: full stereo (unchanged)
+        if (stereoWidth_ < 1.0f) {
+            const float mid = (mixedL + mixedR) * 0.5f;
+            const float side = (mixedL - mixedR) * 0.5f;
+            mixedL = mid + stereoWidth_ * side;
+            mixedR = mid - stereoWidth_ * side;
         }
+
+        outL = mixedL;
+        outR = mixedR;
     }
 
 public:
@@ -275,8 +311,14 @@ public:
     void seed(uint32_t seedValue) noexcept { engine_.seed(seedValue); }
 
 private:
+    static constexpr size_t kWetChunk = 128;
+
     GranularEngine engine_;
 
+    // Wet scratch for the feedback-free block path
+    std::array<float, kWetChunk> wetL_{};
+    std::array<float, kWetChunk> wetR_{};
+
     // Feedback state
     float feedbackL_ = 0.0f;
     float feedbackR_ = 0.0f;
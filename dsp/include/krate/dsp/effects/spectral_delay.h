@@ -6,9 +6,9 @@
 // bands can have different delay times.
 //
 // Composes:
-// - STFT, OverlapAdd (Layer 1): Spectral analysis/resynthesis
+// - MultiChannelSTFT, MultiChannelOverlapAdd (Layer 1): Stereo analysis/resynthesis
 // - SpectralBuffer (Layer 1): Spectrum storage
-// - DelayLine (Layer 1): Per-bin delay lines
+// - SpectralDelayHistory: frame-major ring of past spectra, per-bin delay taps
 // - OnePoleSmoother (Layer 1): Parameter smoothing
 //
 // Feature: 033-spectral-delay
@@ -30,7 +30,6 @@
 #include <krate/dsp/core/math_constants.h>
 #include <krate/dsp/core/note_value.h>
 #include <krate/dsp/core/random.h>
-#include <krate/dsp/primitives/delay_line.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/primitives/spectral_buffer.h>
 #include <krate/dsp/primitives/stft.h>
@@ -63,11 +62,122 @@ enum class SpreadCurve : std::uint8_t {
     Logarithmic  ///< Logarithmic distribution (perceptually more even)
 };
 
+// =============================================================================
+// SpectralDelayHistory - Past spectra read by per-bin delay taps
+// =============================================================================
+
+/// @brief Frame-major ring of past stereo complex spectra
+///
+/// Row f holds every bin of one frame, so writing a frame is a linear sweep
+/// and each bin's delay tap is a gather down its column. The ring holds
+/// exactly maxDelayFrames + 1 rows: a read at the maximum delay lands on the
+/// oldest frame, just before it is overwritten.
+///
+/// A frame reads its taps, writes its row, then advance()s. Read that way,
+/// each bin behaves like its own DelayLine read with readLinear() before that
+/// frame's write(), bit for bit.
+///
+/// Real and imaginary parts are stored instead of magnitude and phase: when
+/// phase wraps from +π to -π, linear interpolation produces incorrect values
+/// (e.g., interp(3.1, -3.1, 0.5) = 0.0 instead of ~±π), complex
+/// interpolation does not.
+class SpectralDelayHistory {
+public:
+    /// @brief One bin of one frame, both channels
+    struct Bin {
+        float realL = 0.0f;
+        float imagL = 0.0f;
+        float realR = 0.0f;
+        float imagR = 0.0f;
+    };
+
+    /// @brief Allocate the ring and clear it
+    /// @note NOT real-time safe (allocates memory)
+    void prepare(std::size_t maxDelayFrames, std::size_t numBins) {
+        maxDelayFrames_ = maxDelayFrames;
+        frames_ = maxDelayFrames + 1;
+        bins_ = numBins;
+
+        const std::size_t size = frames_ * bins_;
+        realL_.assign(size, 0.0f);
+        imagL_.assign(size, 0.0f);
+        realR_.assign(size, 0.0f);
+        imagR_.assign(size, 0.0f);
+        writeFrame_ = 0;
+    }
+
+    /// @brief Clear every stored frame without reallocating
+    void reset() noexcept {
+        std::fill(realL_.begin(), realL_.end(), 0.0f);
+        std::fill(imagL_.begin(), imagL_.end(), 0.0f);
+        std::fill(realR_.begin(), realR_.end(), 0.0f);
+        std::fill(imagR_.begin(), imagR_.end(), 0.0f);
+        writeFrame_ = 0;
+    }
+
+    [[nodiscard]] std::size_t maxDelayFrames() const noexcept { return maxDelayFrames_; }
+
+    /// @brief Linearly interpolated tap `delayFrames` frames before the
+    /// newest stored frame (0 = newest), clamped to [0, maxDelayFrames]
+    [[nodiscard]] Bin read(std::size_t bin, float delayFrames) const noexcept {
+        const float clamped = std::clamp(delayFrames, 0.0f,
+                                         static_cast<float>(maxDelayFrames_));
+        const float intFrames = std::floor(clamped);
+        const float frac = clamped - intFrames;
+        const auto offset0 = static_cast<std::size_t>(intFrames);
+        const std::size_t offset1 = std::min(offset0 + 1, maxDelayFrames_);
+        const std::size_t idx0 = row(offset0) + bin;
+        const std::size_t idx1 = row(offset1) + bin;
+
+        Bin tap;
+        tap.realL = realL_[idx0] + frac * (realL_[idx1] - realL_[idx0]);
+        tap.imagL = imagL_[idx0] + frac * (imagL_[idx1] - imagL_[idx0]);
+        tap.realR = realR_[idx0] + frac * (realR_[idx1] - realR_[idx0]);
+        tap.imagR = imagR_[idx0] + frac * (imagR_[idx1] - imagR_[idx0]);
+        return tap;
+    }
+
+    /// @brief Store one bin of the frame being written
+    void write(std::size_t bin, const Bin& value) noexcept {
+        const std::size_t idx = writeFrame_ * bins_ + bin;
+        realL_[idx] = value.realL;
+        imagL_[idx] = value.imagL;
+        realR_[idx] = value.realR;
+        imagR_[idx] = value.imagR;
+    }
+
+    /// @brief Make the frame just written the newest one
+    void advance() noexcept {
+        writeFrame_ = (writeFrame_ + 1 == frames_) ? 0 : writeFrame_ + 1;
+    }
+
+private:
+    /// @brief Start of the row written `framesAgo` frames before the frame
+    /// about to be written (0 = newest stored frame)
+    [[nodiscard]] std::size_t row(std::size_t framesAgo) const noexcept {
+        // framesAgo <= maxDelayFrames_ < frames_, so one wrap suffices
+        const std::size_t back = framesAgo + 1;
+        const std::size_t frame = (writeFrame_ >= back)
+                                      ? writeFrame_ - back
+                                      : writeFrame_ + frames_ - back;
+        return frame * bins_;
+    }
+
+    std::vector<float> realL_;
+    std::vector<float> imagL_;
+    std::vector<float> realR_;
+    std::vector<float> imagR_;
+    std::size_t bins_ = 0;            ///< Bins per row
+    std::size_t frames_ = 0;          ///< Rows in the ring (maxDelayFrames_ + 1)
+    std::size_t maxDelayFrames_ = 0;  ///< Longest readable delay in frames
+    std::size_t writeFrame_ = 0;      ///< Row the next frame is written to
+};
+
 // =============================================================================
 // SpectralDelay - Layer 4 User Feature
 // =============================================================================
 
-/// @brief Spectral delay effect using per-bin delay lines
+/// @brief Spectral delay effect using a per-bin delayed spectral history
 ///
 /// Applies independent delay times to each frequency bin, creating unique
 /// frequency-dependent echo effects. Features include:
@@ -134,12 +244,10 @@ public:
         hopSize_ = fftSize_ / 2;  // 50% overlap
 
         // Prepare STFT analysis (stereo)
-        stftL_.prepare(fftSize_, hopSize_, WindowType::Hann);
-        stftR_.prepare(fftSize_, hopSize_, WindowType::Hann);
+        stft_.prepare(2, fftSize_, hopSize_, WindowType::Hann);
 
         // Prepare overlap-add synthesis (stereo)
-        overlapAddL_.prepare(fftSize_, hopSize_, WindowType::Hann);
-        overlapAddR_.prepare(fftSize_, hopSize_, WindowType::Hann);
+        overlapAdd_.prepare(2, fftSize_, hopSize_, WindowType::Hann);
 
         // Prepare spectral buffers
         const std::size_t numBins = fftSize_ / 2 + 1;
@@ -150,36 +258,12 @@ public:
         frozenSpectrumL_.prepare(fftSize_);
         frozenSpectrumR_.prepare(fftSize_);
 
-        // Calculate max delay in seconds for delay lines
-        const float maxDelaySeconds = kMaxDelayMs / 1000.0f;
-
-        // Prepare per-bin delay lines (stereo)
-        // Delay lines work at spectral frame rate (sampleRate / hopSize)
+        // Prepare the spectral history (stereo)
+        // The history runs at spectral frame rate (sampleRate / hopSize)
         const double frameRate = sampleRate / static_cast<double>(hopSize_);
-
-        // Prepare complex delay lines (real + imaginary parts)
-        binRealDelaysL_.clear();
-        binRealDelaysR_.clear();
-        binImagDelaysL_.clear();
-        binImagDelaysR_.clear();
-        binRealDelaysL_.reserve(numBins);
-        binRealDelaysR_.reserve(numBins);
-        binImagDelaysL_.reserve(numBins);
-        binImagDelaysR_.reserve(numBins);
-
-        for (std::size_t i = 0; i < numBins; ++i) {
-            // Real part delay lines
-            binRealDelaysL_.emplace_back();
-            binRealDelaysR_.emplace_back();
-            binRealDelaysL_.back().prepare(frameRate, maxDelaySeconds);
-            binRealDelaysR_.back().prepare(frameRate, maxDelaySeconds);
-
-            // Imaginary part delay lines
-            binImagDelaysL_.emplace_back();
-            binImagDelaysR_.emplace_back();
-            binImagDelaysL_.back().prepare(frameRate, maxDelaySeconds);
-            binImagDelaysR_.back().prepare(frameRate, maxDelaySeconds);
-        }
+        history_.prepare(static_cast<std::size_t>(
+                             frameRate * static_cast<double>(kMaxDelayMs / 1000.0f)),
+                         numBins);
 
         // Configure parameter smoothers (50ms smoothing time for spectral processing)
         // Increased from 10ms to reduce artifacts during parameter changes
@@ -238,15 +322,13 @@ public:
         prepared_ = true;
     }
 
-    /// @brief Reset all internal state (delay lines, STFT buffers)
+    /// @brief Reset all internal state (spectral history, STFT buffers)
     void reset() noexcept {
         // Reset STFT
-        stftL_.reset();
-        stftR_.reset();
+        stft_.reset();
 
         // Reset overlap-add
-        overlapAddL_.reset();
-        overlapAddR_.reset();
+        overlapAdd_.reset();
 
         // Reset spectral buffers
         inputSpectrumL_.reset();
@@ -256,21 +338,8 @@ public:
         frozenSpectrumL_.reset();
         frozenSpectrumR_.reset();
 
-        // Reset all per-bin complex delay lines (real parts)
-        for (auto& delay : binRealDelaysL_) {
-            delay.reset();
-        }
-        for (auto& delay : binRealDelaysR_) {
-            delay.reset();
-        }
-
-        // Reset all per-bin complex delay lines (imaginary parts)
-        for (auto& delay : binImagDelaysL_) {
-            delay.reset();
-        }
-        for (auto& delay : binImagDelaysR_) {
-            delay.reset();
-        }
+        // Clear the spectral history
+        history_.reset();
 
         // Reset freeze state
         wasFrozen_ = false;
@@ -342,32 +411,30 @@ public:
         std::copy(right, right + numSamples, dryBufferR_.begin());
 
         // Push samples into STFT analyzers
-        stftL_.pushSamples(left, numSamples);
-        stftR_.pushSamples(right, numSamples);
+        const float* inputs[] = {left, right};
+        stft_.pushSamples(inputs, numSamples);
 
-        // Process spectral frames
-        while (stftL_.canAnalyze() && stftR_.canAnalyze()) {
+        // Process spectral frames (both channels share one paired transform)
+        SpectralBuffer* analysisOut[] = {&inputSpectrumL_, &inputSpectrumR_};
+        const SpectralBuffer* synthesisIn[] = {&outputSpectrumL_, &outputSpectrumR_};
+        while (stft_.canAnalyze()) {
             // Analyze
-            stftL_.analyze(inputSpectrumL_);
-            stftR_.analyze(inputSpectrumR_);
+            stft_.analyze(analysisOut);
 
             // Process the spectral frame
             processSpectralFrame(inputSpectrumL_, inputSpectrumR_,
                                  outputSpectrumL_, outputSpectrumR_);
 
             // Synthesize
-            overlapAddL_.synthesize(outputSpectrumL_);
-            overlapAddR_.synthesize(outputSpectrumR_);
+            overlapAdd_.synthesize(synthesisIn);
         }
 
         // Pull processed samples
-        const std::size_t availableL = overlapAddL_.samplesAvailable();
-        const std::size_t availableR = overlapAddR_.samplesAvailable();
-        const std::size_t toPull = std::min({numSamples, availableL, availableR});
+        const std::size_t toPull = std::min(numSamples, overlapAdd_.samplesAvailable());
 
         if (toPull > 0) {
-            overlapAddL_.pullSamples(tempBufferL_.data(), toPull);
-            overlapAddR_.pullSamples(tempBufferR_.data(), toPull);
+            float* pulled[] = {tempBufferL_.data(), tempBufferR_.data()};
+            overlapAdd_.pullSamples(pulled, toPull);
 
             // Get smoothed parameters for this block
             const float wetMix = dryWetSmoother_.process();
@@ -705,12 +772,13 @@ private:
             }
         }
 
+        const float frameRate = static_cast<float>(sampleRate_) /
+                                static_cast<float>(hopSize_);
+
         // Process each bin
         for (std::size_t bin = 0; bin < numBins; ++bin) {
-            // Calculate per-bin delay time in frames
+            // Calculate per-bin delay time in frames (the history clamps it)
             const float binDelayMs = calculateBinDelayMs(bin, numBins, baseDelay, spread);
-            const float frameRate = static_cast<float>(sampleRate_) /
-                                    static_cast<float>(hopSize_);
             const float delayFrames = (binDelayMs / 1000.0f) * frameRate;
 
             // Calculate tilted feedback for this bin
@@ -723,18 +791,20 @@ private:
             const float inputPhaseL = inputL.getPhase(bin);
             const float inputPhaseR = inputR.getPhase(bin);
 
-            // Convert input to complex (real + imaginary) for delay line storage
+            // Convert input to complex (real + imaginary) for history storage
             // This avoids phase wrapping issues during linear interpolation
             const float inputRealL = inputMagL * std::cos(inputPhaseL);
             const float inputImagL = inputMagL * std::sin(inputPhaseL);
             const float inputRealR = inputMagR * std::cos(inputPhaseR);
             const float inputImagR = inputMagR * std::sin(inputPhaseR);
 
-            // Read delayed complex values from delay lines (linear interpolation is safe here)
-            const float delayedRealL = binRealDelaysL_[bin].readLinear(delayFrames);
-            const float delayedImagL = binImagDelaysL_[bin].readLinear(delayFrames);
-            const float delayedRealR = binRealDelaysR_[bin].readLinear(delayFrames);
-            const float delayedImagR = binImagDelaysR_[bin].readLinear(delayFrames);
+            // Read delayed complex values from the history (linear interpolation
+            // is safe here)
+            const SpectralDelayHistory::Bin delayed = history_.read(bin, delayFrames);
+            const float delayedRealL = delayed.realL;
+            const float delayedImagL = delayed.imagL;
+            const float delayedRealR = delayed.realR;
+            const float delayedImagR = delayed.imagR;
 
             // Convert delayed complex back to magnitude and phase
             const float delayedMagL = std::sqrt(delayedRealL * delayedRealL +
@@ -747,7 +817,7 @@ private:
             // Apply feedback: calculate feedback magnitude with soft limiting
             // Always apply tanh() to prevent distortion during feedback transitions
             // Previously only ran when feedback > 100%, but when feedback drops, limiting
-            // stopped instantly while delay line still contained high-amplitude signal
+            // stopped instantly while the history still contained high-amplitude signal
             float feedbackMagL = std::tanh(delayedMagL * binFeedback);
             float feedbackMagR = std::tanh(delayedMagR * binFeedback);
 
@@ -757,14 +827,14 @@ private:
             const float feedbackRealR = feedbackMagR * std::cos(delayedPhaseR);
             const float feedbackImagR = feedbackMagR * std::sin(delayedPhaseR);
 
-            // Only write to delay lines when not frozen
+            // Only write to the history when not frozen
             // This ensures freeze truly ignores new input
             if (!freezing) {
-                // Write complex values (input + feedback) to delay lines
-                binRealDelaysL_[bin].write(inputRealL + feedbackRealL);
-                binImagDelaysL_[bin].write(inputImagL + feedbackImagL);
-                binRealDelaysR_[bin].write(inputRealR + feedbackRealR);
-                binImagDelaysR_[bin].write(inputImagR + feedbackImagR);
+                // Write complex values (input + feedback) into this frame's row
+                history_.write(bin, {inputRealL + feedbackRealL,
+                                     inputImagL + feedbackImagL,
+                                     inputRealR + feedbackRealR,
+                                     inputImagR + feedbackImagR});
             }
 
             // Output is the delayed magnitude and phase
@@ -820,6 +890,12 @@ private:
             outputR.setPhase(bin, outPhaseR);
         }
 
+        // The frame just written becomes the newest row (frozen frames are
+        // not recorded, so the history stands still)
+        if (!freezing) {
+            history_.advance();
+        }
+
         // Apply diffusion magnitude blur if enabled
         // This spreads energy across neighboring frequency bins
         if (diffusion > 0.001f) {
@@ -850,12 +926,10 @@ private:
     std::size_t hopSize_ = kDefaultFFTSize / 2;  // 50% overlap
 
     // STFT Analysis (stereo)
-    STFT stftL_;
-    STFT stftR_;
+    MultiChannelSTFT stft_;
 
     // Overlap-Add Synthesis (stereo)
-    OverlapAdd overlapAddL_;
-    OverlapAdd overlapAddR_;
+    MultiChannelOverlapAdd overlapAdd_;
 
     // Spectral Buffers
     SpectralBuffer inputSpectrumL_;
@@ -865,16 +939,8 @@ private:
     SpectralBuffer frozenSpectrumL_;
     SpectralBuffer frozenSpectrumR_;
 
-    // Per-Bin Delay Lines for Complex Values (stereo)
-    // We delay real and imaginary parts instead of magnitude and phase
-    // to avoid phase wrapping issues during linear interpolation.
-    // When phase wraps from +π to -π, linear interpolation produces incorrect
-    // values (e.g., interp(3.1, -3.1, 0.5) = 0.0 instead of ~±π).
-    // Complex interpolation handles this correctly.
-    std::vector<DelayLine> binRealDelaysL_;
-    std::vector<DelayLine> binRealDelaysR_;
-    std::vector<DelayLine> binImagDelaysL_;
-    std::vector<DelayLine> binImagDelaysR_;
+    // Spectral history for complex values (stereo), read by per-bin taps
+    SpectralDelayHistory history_;
 
     // Parameters
     float baseDelayMs_ = kDefaultDelayMs;
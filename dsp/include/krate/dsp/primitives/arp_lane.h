@@ -107,6 +107,9 @@ public:
     /// @brief Reset position to step 0.
     void reset() noexcept { position_ = 0; }
 
+    /// @brief Jump to a step index, wrapped into [0, length-1].
+    void setPosition(size_t step) noexcept { position_ = step % length_; }
+
     /// @brief Get current step position index (for UI playhead).
     [[nodiscard]] size_t currentStep() const noexcept { return position_; }
 
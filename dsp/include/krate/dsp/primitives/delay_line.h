@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <cmath>
 #include <algorithm>
@@ -123,6 +124,28 @@ public:
     /// @note O(1) time complexity.
     [[nodiscard]] float readLinear(float delaySamples) const noexcept;
 
+    /// @brief Linear-interpolated read as readLinear() would have returned it
+    ///        `writesAgo` write() calls earlier.
+    ///
+    /// Lets a caller write a whole block first and then read each sample's
+    /// taps afterwards: for sample k of an n-sample block, pass
+    /// writesAgo = n - 1 - k.
+    ///
+    /// @param writesAgo Number of writes since the reference position.
+    /// @param delaySamples Delay relative to that position (fractional allowed).
+    /// @return The interpolated sample value.
+    ///
+    /// @note Delay is clamped to [0, maxDelaySamples], as in readLinear().
+    /// @pre writesAgo < blockReadHeadroom(), so the tap was not overwritten.
+    [[nodiscard]] float readLinearBehind(size_t writesAgo, float delaySamples) const noexcept;
+
+    /// @brief readLinearBehind() on two lines at once, sharing the index math.
+    /// @pre Both lines were prepared with the same settings and have seen the
+    ///      same number of writes (e.g. the two channels of a stereo delay).
+    static void readLinearBehindStereo(const DelayLine& left, const DelayLine& right,
+                                       size_t writesAgo, float delaySamples,
+                                       float& outLeft, float& outRight) noexcept;
+
     /// @brief Read a sample at a fractional delay with cubic Hermite interpolation.
     ///
     /// @param delaySamples Number of samples to delay (fractional allowed).
@@ -153,10 +176,18 @@ public:
     /// @return Maximum delay samples, or 0 if not prepared.
     [[nodiscard]] size_t maxDelaySamples() const noexcept;
 
+    /// @brief Largest block that can be written before reading it back with
+    ///        readLinearBehind() (buffer slack beyond maxDelaySamples).
+    /// @return Block length limit in samples, or 0 if not prepared.
+    [[nodiscard]] size_t blockReadHeadroom() const noexcept;
+
     /// @brief Get the current sample rate.
     /// @return Sample rate in Hz, or 0 if not prepared.
     [[nodiscard]] double sampleRate() const noexcept;
 
+    /// @brief Heap memory held by the circular buffer, in bytes.
+    [[nodiscard]] size_t heapBytes() const noexcept;
+
     /// @brief Peek at a sample that will be overwritten after N write() calls.
     ///
     /// This is useful for reading existing delay content before overwriting it,
@@ -237,6 +268,24 @@ inline float DelayLine::readLinear(float delaySamples) const noexcept {
     return y0 + frac * (y1 - y0);
 }
 
+inline float DelayLine::readLinearBehind(size_t writesAgo,
+                                         float delaySamples) const noexcept {
+    // Same clamping and interpolation as readLinear(), from an earlier write
+    // head. The clamped delay is non-negative, so truncation is floor().
+    const float clampedDelay = std::clamp(delaySamples, 0.0f, static_cast<float>(maxDelaySamples_));
+    const auto whole = static_cast<uint32_t>(clampedDelay);
+    const float frac = clampedDelay - static_cast<float>(whole);
+
+    const size_t index0 = whole;
+    const size_t index1 = std::min(index0 + 1, maxDelaySamples_);
+
+    const size_t newest = writeIndex_ - 1 - writesAgo;
+    const float y0 = buffer_[(newest - index0) & mask_];
+    const float y1 = buffer_[(newest - index1) & mask_];
+
+    return y0 + frac * (y1 - y0);
+}
+
 inline float DelayLine::readCubic(float delaySamples) const noexcept {
     // Clamp delay to [1, maxDelaySamples_ - 1] to ensure neighbors exist
     const float clampedDelay = std::clamp(delaySamples, 1.0f,
@@ -298,6 +347,35 @@ inline size_t DelayLine::maxDelaySamples() const noexcept {
     return maxDelaySamples_;
 }
 
+inline void DelayLine::readLinearBehindStereo(const DelayLine& left, const DelayLine& right,
+                                              size_t writesAgo, float delaySamples,
+                                              float& outLeft, float& outRight) noexcept {
+    const float clampedDelay =
+        std::clamp(delaySamples, 0.0f, static_cast<float>(left.maxDelaySamples_));
+    const auto whole = static_cast<uint32_t>(clampedDelay);
+    const float frac = clampedDelay - static_cast<float>(whole);
+
+    const size_t index0 = whole;
+    const size_t index1 = std::min(index0 + 1, left.maxDelaySamples_);
+
+    const size_t newest = left.writeIndex_ - 1 - writesAgo;
+    const size_t read0 = (newest - index0) & left.mask_;
+    const size_t read1 = (newest - index1) & left.mask_;
+
+    const float l0 = left.buffer_[read0];
+    const float r0 = right.buffer_[read0];
+    outLeft = l0 + frac * (left.buffer_[read1] - l0);
+    outRight = r0 + frac * (right.buffer_[read1] - r0);
+}
+
+inline size_t DelayLine::heapBytes() const noexcept {
+    return buffer_.capacity() * sizeof(float);
+}
+
+inline size_t DelayLine::blockReadHeadroom() const noexcept {
+    return buffer_.size() - std::min(buffer_.size(), maxDelaySamples_);
+}
+
 inline double DelayLine::sampleRate() const noexcept {
     return sampleRate_;
 }
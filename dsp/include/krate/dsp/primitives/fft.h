@@ -5,6 +5,17 @@
 // Provides forward (real-to-complex) and inverse (complex-to-real) transforms.
 // Uses SSE on x86/x64, NEON on ARM, with scalar fallback.
 //
+// Any size pffft can transform is accepted: N = 2^a * 3^b * 5^c with N a
+// multiple of 32 (of 2 on a scalar pffft build), up to kMaxAnalysisFFTSize. Besides powers of two this
+// allows 3*2^n / 5*2^n sizes (hops that land on musical durations) and the
+// 16k-64k transforms offline analysis needs for frequency resolution.
+// Setups (twiddle tables) are read-only after creation, so FFTPlanCache
+// shares one per size across every FFT and BatchFFT in the process.
+//
+// BatchFFT transforms several real channels per call by packing them in
+// pairs into one complex transform (z = a + ib) and splitting the spectra
+// with conjugate symmetry.
+//
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, allocations only in prepare())
 // - Principle III: Modern C++ (C++20, RAII, constexpr)
@@ -23,6 +34,8 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <pffft/pffft.h>
 
@@ -35,17 +48,37 @@ namespace DSP {
 
 struct Complex;
 class FFT;
+class BatchFFT;
 
 // =============================================================================
 // Constants
 // =============================================================================
 
-/// Minimum supported FFT size
+/// Smallest FFT size used by the real-time spectral processors
 inline constexpr size_t kMinFFTSize = 256;
 
-/// Maximum supported FFT size
+/// Largest FFT size used by the real-time spectral processors
 inline constexpr size_t kMaxFFTSize = 8192;
 
+/// Largest size FFT::prepare() accepts (offline / analysis transforms)
+inline constexpr size_t kMaxAnalysisFFTSize = size_t{1} << 18;
+
+/// @brief True if FFT/BatchFFT can be prepared with this size:
+/// N = 2^a * 3^b * 5^c, a multiple of 2 * S^2 where S is pffft_simd_size()
+/// (32 on SSE/NEON, 2 on a scalar build), at most kMaxAnalysisFFTSize.
+[[nodiscard]] inline bool isValidFFTSize(size_t fftSize) noexcept {
+    return fftSize > 0 && fftSize <= kMaxAnalysisFFTSize &&
+           pffft_is_valid_size(static_cast<int>(fftSize), PFFFT_REAL) != 0;
+}
+
+/// @brief Smallest valid FFT size >= minSize (0 if none up to the limit)
+[[nodiscard]] inline size_t nextValidFFTSize(size_t minSize) noexcept {
+    if (minSize > kMaxAnalysisFFTSize) return 0;
+    const int n = pffft_nearest_transform_size(
+        static_cast<int>(std::max<size_t>(minSize, 1)), PFFFT_REAL, 1);
+    return isValidFFTSize(static_cast<size_t>(n)) ? static_cast<size_t>(n) : 0;
+}
+
 // =============================================================================
 // Complex Number (POD)
 // =============================================================================
@@ -120,6 +153,73 @@ inline std::unique_ptr<float, PffftAlignedDeleter> makeAlignedBuffer(size_t numF
 
 } // namespace detail
 
+// =============================================================================
+// FFTPlanCache
+// =============================================================================
+
+/// @brief Process-wide store of pffft setups, one per (size, transform type).
+///
+/// A setup only holds twiddle factors and is never written after creation,
+/// so any number of transforms may run on it concurrently (each FFT owns its
+/// own work buffer). Entries are weak: a setup is freed when the last FFT
+/// using it is destroyed or re-prepared.
+///
+/// @par Thread Safety
+/// acquire() may be called from any thread (internally locked).
+class FFTPlanCache {
+public:
+    using Plan = std::shared_ptr<PFFFT_Setup>;
+
+    /// @brief The process-wide cache.
+    [[nodiscard]] static FFTPlanCache& instance() noexcept {
+        // Never destroyed: FFTs held by other statics may outlive it
+        static auto* cache = new FFTPlanCache();
+        return *cache;
+    }
+
+    /// @brief Shared setup for the given size, created on first request.
+    /// @return nullptr if pffft cannot transform this size
+    /// @note NOT real-time safe (locks, may allocate)
+    [[nodiscard]] Plan acquire(size_t fftSize, pffft_transform_t transform) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::erase_if(entries_, [](const Entry& e) { return e.plan.expired(); });
+        for (const auto& entry : entries_) {
+            if (entry.size == fftSize && entry.transform == transform) {
+                return entry.plan.lock();
+            }
+        }
+
+        Plan plan(pffft_new_setup(static_cast<int>(fftSize), transform),
+                  detail::PffftSetupDeleter{});
+        if (plan == nullptr) return nullptr;
+        entries_.push_back({fftSize, transform, plan});
+        return plan;
+    }
+
+    /// @brief Number of setups currently alive.
+    [[nodiscard]] size_t numPlans() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t count = 0;
+        for (const auto& entry : entries_) count += entry.plan.expired() ? 0 : 1;
+        return count;
+    }
+
+    FFTPlanCache(const FFTPlanCache&) = delete;
+    FFTPlanCache& operator=(const FFTPlanCache&) = delete;
+
+private:
+    struct Entry {
+        size_t size = 0;
+        pffft_transform_t transform = PFFFT_REAL;
+        std::weak_ptr<PFFFT_Setup> plan;
+    };
+
+    FFTPlanCache() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
+
 // =============================================================================
 // FFT Class
 // =============================================================================
@@ -130,7 +230,7 @@ public:
     FFT() noexcept = default;
     ~FFT() noexcept = default;
 
-    // Non-copyable, movable (unique_ptr members enable default move)
+    // Non-copyable, movable (smart pointer members enable default move)
     FFT(const FFT&) = delete;
     FFT& operator=(const FFT&) = delete;
     FFT(FFT&&) noexcept = default;
@@ -140,25 +240,27 @@ public:
     // Lifecycle
     // -------------------------------------------------------------------------
 
-    /// @brief Prepare FFT for given size (allocates pffft setup and aligned buffers)
-    /// @param fftSize Power of 2 in range [256, 8192]
-    /// @pre fftSize is power of 2
-    /// @note NOT real-time safe (allocates memory)
-    void prepare(size_t fftSize) noexcept {
-        size_ = fftSize;
-
-        // Validate power of 2
-        if (fftSize == 0 || !std::has_single_bit(fftSize)) {
+    /// @brief Prepare FFT for given size (shared pffft setup, own aligned buffers)
+    /// @param fftSize Any size accepted by isValidFFTSize(), e.g. 1024,
+    ///                3072 (3*2^10) or 65536
+    /// @note Invalid sizes leave the FFT unprepared.
+    /// @note NOT real-time safe (locks the plan cache and allocates memory)
+    /// @throws std::bad_alloc or std::system_error from the plan cache
+    void prepare(size_t fftSize) {
+        if (!isValidFFTSize(fftSize)) {
             size_ = 0;
+            setup_.reset();
             return;
         }
+        if (fftSize == size_ && setup_) return;  // already prepared
 
-        // Create pffft setup for real-valued transforms
-        setup_.reset(pffft_new_setup(static_cast<int>(fftSize), PFFFT_REAL));
+        // Shared pffft setup for real-valued transforms of this size
+        setup_ = FFTPlanCache::instance().acquire(fftSize, PFFFT_REAL);
         if (!setup_) {
             size_ = 0;
             return;
         }
+        size_ = fftSize;
 
         // Allocate SIMD-aligned buffers (16-byte on SSE, as required by pffft)
         buf1_ = detail::makeAlignedBuffer(fftSize);
@@ -254,13 +356,165 @@ public:
     /// @brief Check if prepare() has been called
     [[nodiscard]] bool isPrepared() const noexcept { return size_ > 0 && setup_ != nullptr; }
 
+    /// @brief The pffft setup in use (shared with other FFTs of this size)
+    [[nodiscard]] const PFFFT_Setup* setup() const noexcept { return setup_.get(); }
+
 private:
     size_t size_ = 0;
-    std::unique_ptr<PFFFT_Setup, detail::PffftSetupDeleter> setup_;
+    FFTPlanCache::Plan setup_;  // shared, read-only
     std::unique_ptr<float, detail::PffftAlignedDeleter> buf1_;  // Input staging
     std::unique_ptr<float, detail::PffftAlignedDeleter> buf2_;  // Output staging
     std::unique_ptr<float, detail::PffftAlignedDeleter> work_;  // pffft work buffer
 };
 
+// =============================================================================
+// BatchFFT Class
+// =============================================================================
+
+/// @brief FFT of several real channels per call (stereo, voices, multi-res).
+///
+/// Two real signals a, b share one complex transform of the same size:
+///   Z = FFT(a + ib),  A[k] = (Z[k] + conj(Z[N-k])) / 2,
+///                     B[k] = (Z[k] - conj(Z[N-k])) / 2i
+/// and the inverse rebuilds Z = A + iB over the full circle, so a stereo
+/// pair costs one complex transform plus one split/merge pass instead of two
+/// real transforms, two staging copies and two format conversions. An odd
+/// channel left over uses a plain real transform.
+///
+/// Output format and scaling are identical to FFT::forward()/inverse(); the
+/// imaginary parts of the DC and Nyquist bins are ignored on inverse, as in
+/// FFT::inverse().
+class BatchFFT {
+public:
+    BatchFFT() noexcept = default;
+    ~BatchFFT() noexcept = default;
+
+    BatchFFT(const BatchFFT&) = delete;
+    BatchFFT& operator=(const BatchFFT&) = delete;
+    BatchFFT(BatchFFT&&) noexcept = default;
+    BatchFFT& operator=(BatchFFT&&) noexcept = default;
+
+    /// @brief Prepare for the given size
+    /// @param fftSize Any size accepted by isValidFFTSize()
+    /// @note NOT real-time safe (locks the plan cache and allocates memory)
+    /// @throws std::bad_alloc or std::system_error from the plan cache
+    void prepare(size_t fftSize) {
+        size_ = 0;
+        single_.prepare(fftSize);
+        if (!single_.isPrepared()) return;
+
+        pairSetup_ = FFTPlanCache::instance().acquire(fftSize, PFFFT_COMPLEX);
+        if (!pairSetup_) return;
+
+        pairIn_ = detail::makeAlignedBuffer(2 * fftSize);
+        pairOut_ = detail::makeAlignedBuffer(2 * fftSize);
+        work_ = detail::makeAlignedBuffer(2 * fftSize);
+        size_ = fftSize;
+    }
+
+    /// @brief Forward FFT of numChannels real signals
+    /// @param inputs  numChannels pointers to N real samples
+    /// @param outputs numChannels pointers to N/2+1 complex bins
+    /// @note Real-time safe, noexcept
+    void forward(const float* const* inputs, Complex* const* outputs,
+                 size_t numChannels) noexcept {
+        if (!isPrepared()) return;
+
+        size_t ch = 0;
+        for (; ch + 1 < numChannels; ch += 2) {
+            forwardPair(inputs[ch], inputs[ch + 1], outputs[ch], outputs[ch + 1]);
+        }
+        if (ch < numChannels) single_.forward(inputs[ch], outputs[ch]);
+    }
+
+    /// @brief Inverse FFT of numChannels spectra (normalized, like FFT::inverse)
+    /// @param inputs  numChannels pointers to N/2+1 complex bins
+    /// @param outputs numChannels pointers to N real samples
+    /// @note Real-time safe, noexcept
+    void inverse(const Complex* const* inputs, float* const* outputs,
+                 size_t numChannels) noexcept {
+        if (!isPrepared()) return;
+
+        size_t ch = 0;
+        for (; ch + 1 < numChannels; ch += 2) {
+            inversePair(inputs[ch], inputs[ch + 1], outputs[ch], outputs[ch + 1]);
+        }
+        if (ch < numChannels) single_.inverse(inputs[ch], outputs[ch]);
+    }
+
+    /// @brief Forward FFT of two real signals with one complex transform
+    void forwardPair(const float* a, const float* b, Complex* outA, Complex* outB) noexcept {
+        if (!isPrepared()) return;
+        const size_t N = size_;
+        float* z = pairIn_.get();
+        for (size_t i = 0; i < N; ++i) {
+            z[2 * i] = a[i];
+            z[2 * i + 1] = b[i];
+        }
+
+        pffft_transform_ordered(pairSetup_.get(), z, pairOut_.get(), work_.get(),
+                                PFFFT_FORWARD);
+
+        // Split Z into the two Hermitian halves; bins 0 and N/2 pair with
+        // themselves and come out purely real
+        const float* Z = pairOut_.get();
+        outA[0] = {Z[0], 0.0f};
+        outB[0] = {Z[1], 0.0f};
+        outA[N / 2] = {Z[N], 0.0f};
+        outB[N / 2] = {Z[N + 1], 0.0f};
+        for (size_t k = 1; k < N / 2; ++k) {
+            const float zr = Z[2 * k];
+            const float zi = Z[2 * k + 1];
+            const float wr = Z[2 * (N - k)];
+            const float wi = Z[2 * (N - k) + 1];
+            outA[k] = {0.5f * (zr + wr), 0.5f * (zi - wi)};
+            outB[k] = {0.5f * (zi + wi), 0.5f * (wr - zr)};
+        }
+    }
+
+    /// @brief Inverse FFT of two spectra with one complex transform
+    void inversePair(const Complex* inA, const Complex* inB, float* a, float* b) noexcept {
+        if (!isPrepared()) return;
+        const size_t N = size_;
+
+        // Z = A + iB, with A[N-k] = conj(A[k]) and B[N-k] = conj(B[k])
+        float* z = pairIn_.get();
+        z[0] = inA[0].real;
+        z[1] = inB[0].real;
+        z[N] = inA[N / 2].real;
+        z[N + 1] = inB[N / 2].real;
+        for (size_t k = 1; k < N / 2; ++k) {
+            const Complex A = inA[k];
+            const Complex B = inB[k];
+            z[2 * k] = A.real - B.imag;
+            z[2 * k + 1] = A.imag + B.real;
+            z[2 * (N - k)] = A.real + B.imag;
+            z[2 * (N - k) + 1] = B.real - A.imag;
+        }
+
+        pffft_transform_ordered(pairSetup_.get(), z, pairOut_.get(), work_.get(),
+                                PFFFT_BACKWARD);
+
+        const float scale = 1.0f / static_cast<float>(N);
+        const float* out = pairOut_.get();
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = out[2 * i] * scale;
+            b[i] = out[2 * i + 1] * scale;
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] size_t numBins() const noexcept { return size_ / 2 + 1; }
+    [[nodiscard]] bool isPrepared() const noexcept { return size_ > 0; }
+
+private:
+    size_t size_ = 0;
+    FFT single_;  // odd channel out
+    FFTPlanCache::Plan pairSetup_;  // shared, read-only
+    std::unique_ptr<float, detail::PffftAlignedDeleter> pairIn_;   // interleaved a + ib
+    std::unique_ptr<float, detail::PffftAlignedDeleter> pairOut_;
+    std::unique_ptr<float, detail::PffftAlignedDeleter> work_;
+};
+
 } // namespace DSP
 } // namespace Krate
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <span>
@@ -36,6 +37,8 @@ struct Grain {
 /// Pre-allocated grain pool with voice stealing
 /// Manages a fixed pool of grains for real-time granular synthesis.
 /// Uses voice stealing (oldest grain) when pool is exhausted.
+/// Active slots are tracked in a bitmask kept up to date by acquire/release,
+/// so listing the active grains costs O(active), not O(kMaxGrains).
 class GrainPool {
 public:
     static constexpr size_t kMaxGrains = 64;
@@ -52,20 +55,22 @@ public:
             grain = Grain{};
         }
         activeCount_ = 0;
+        activeMask_ = 0;
     }
 
     /// Acquire a grain from pool
     /// @param currentSample Current sample count (used for age tracking)
     /// @return Pointer to available grain, or oldest grain if pool exhausted
     [[nodiscard]] Grain* acquireGrain(size_t currentSample) noexcept {
-        // First, try to find an inactive grain
-        for (auto& grain : grains_) {
-            if (!grain.active) {
-                grain.active = true;
-                grain.startSample = currentSample;
-                ++activeCount_;
-                return &grain;
-            }
+        // First, try to find an inactive grain (lowest free slot)
+        if (activeMask_ != ~uint64_t{0}) {
+            const auto slot = static_cast<size_t>(std::countr_one(activeMask_));
+            Grain& grain = grains_[slot];
+            grain.active = true;
+            grain.startSample = currentSample;
+            activeMask_ |= uint64_t{1} << slot;
+            ++activeCount_;
+            return &grain;
         }
 
         // Pool exhausted - steal the oldest active grain
@@ -96,21 +101,20 @@ public:
     void releaseGrain(Grain* grain) noexcept {
         if (grain != nullptr && grain->active) {
             grain->active = false;
+            activeMask_ &= ~(uint64_t{1} << static_cast<size_t>(grain - grains_.data()));
             if (activeCount_ > 0) {
                 --activeCount_;
             }
         }
     }
 
-    /// Get all active grains for processing
-    /// @return Span of pointers to active grains
+    /// Get all active grains for processing, in slot order
+    /// @return Span of pointers to active grains (a snapshot: releasing grains
+    ///         while iterating it is safe)
     [[nodiscard]] std::span<Grain* const> activeGrains() noexcept {
-        // Rebuild active list
         size_t count = 0;
-        for (auto& grain : grains_) {
-            if (grain.active && count < kMaxGrains) {
-                activeList_[count++] = &grain;
-            }
+        for (uint64_t mask = activeMask_; mask != 0; mask &= mask - 1) {
+            activeList_[count++] = &grains_[static_cast<size_t>(std::countr_zero(mask))];
         }
         return std::span<Grain* const>(activeList_.data(), count);
     }
@@ -125,6 +129,9 @@ private:
     std::array<Grain, kMaxGrains> grains_{};
     std::array<Grain*, kMaxGrains> activeList_{};
     size_t activeCount_ = 0;
+    uint64_t activeMask_ = 0;  ///< Bit i set while grains_[i] is active
+
+    static_assert(kMaxGrains == 64, "activeMask_ holds one bit per grain");
 };
 
 }  // namespace Krate::DSP
@@ -341,6 +341,70 @@ public:
         lastMarkovDegree_ = -1;
     }
 
+    /// @brief PRNG state (Random/Walk/Markov modes). Not touched by reset();
+    /// exposed so callers can snapshot and restore it.
+    [[nodiscard]] uint32_t randomState() const noexcept { return rng_.state(); }
+
+    /// @brief Restore a PRNG state captured with randomState().
+    void setRandomState(uint32_t state) noexcept { rng_.seed(state); }
+
+    /// @brief Advance @p steps times without producing notes.
+    /// The deterministic modes repeat every pattern cycle x octave range
+    /// advances, so at most two cycles are stepped whatever @p steps is.
+    /// Random, Walk and Markov draw one PRNG value per advance, which is
+    /// skipped with Xorshift32::discard(); Random has no other state, but
+    /// the Walk position and Markov degree depend on every draw and are
+    /// left where they are (isSkipExact() is false for those two).
+    void skip(size_t steps, const HeldNoteBuffer& held) noexcept {
+        if (held.empty() || steps == 0) {
+            return;
+        }
+        const size_t size = held.size();
+        const auto range = static_cast<size_t>(octaveRange_);
+
+        if (mode_ == ArpMode::Random || mode_ == ArpMode::Walk ||
+            mode_ == ArpMode::Markov) {
+            // A single held note gives Markov nothing to sample
+            if (mode_ != ArpMode::Markov || size > 1) {
+                rng_.discard(steps);
+            }
+            // Every advance moves the octave on by one (Sequential and
+            // Interleaved alike); the first also folds an out-of-range offset
+            octaveOffset_ = (octaveOffset_ + 1 >= octaveRange_) ? 0 : octaveOffset_ + 1;
+            octaveOffset_ = static_cast<int>(
+                (static_cast<size_t>(octaveOffset_) + steps - 1) % range);
+            return;
+        }
+
+        size_t cycle = size;
+        if (mode_ == ArpMode::UpDown || mode_ == ArpMode::DownUp) {
+            cycle = (size > 1) ? 2 * (size - 1) : 1;
+        } else if (mode_ == ArpMode::Chord || mode_ == ArpMode::Gravity) {
+            cycle = 1;
+        }
+        // One period brings an out-of-range index or octave back onto the cycle
+        const size_t period = cycle * range;
+        const size_t count = (steps <= 2 * period) ? steps : period + (steps - period) % period;
+        for (size_t i = 0; i < count; ++i) {
+            (void)advance(held);
+        }
+    }
+
+    /// @brief True when skip() lands exactly where advance() would.
+    [[nodiscard]] bool isSkipExact() const noexcept {
+        return mode_ != ArpMode::Walk && mode_ != ArpMode::Markov;
+    }
+
+    /// @brief True when @p other picks notes the same way: mode, octave
+    /// range and order, and Markov context. Pattern position and PRNG state
+    /// are not compared.
+    [[nodiscard]] bool sameConfig(const NoteSelector& other) const noexcept {
+        return mode_ == other.mode_ && octaveMode_ == other.octaveMode_ &&
+               octaveRange_ == other.octaveRange_ &&
+               markovMatrix_ == other.markovMatrix_ &&
+               markovScale_ == other.markovScale_ && markovRoot_ == other.markovRoot_;
+    }
+
 private:
     /// @brief Apply octave transposition with MIDI clamping (FR-028).
     static uint8_t applyOctave(uint8_t baseNote, int octaveOffset) noexcept {
@@ -248,6 +248,19 @@ public:
         slope_ = std::clamp(poles, kMinSlope, kMaxSlope);
     }
 
+    /// @brief Use FastMath::fastTan for the stage coefficient prewarp
+    ///
+    /// The coefficient is recomputed every (oversampled) sample while the
+    /// cutoff smoother is moving, so under modulation std::tan dominates the
+    /// linear model's cost. The approximation is accurate to float precision
+    /// but not bit-identical, hence opt-in.
+    ///
+    /// @param enabled true to use the fast approximation
+    void setFastCoefficients(bool enabled) noexcept {
+        fastCoefficients_ = enabled;
+        cachedGRate_ = 0.0f;  // Invalidate cached g
+    }
+
     // =========================================================================
     // Parameters
     // =========================================================================
@@ -486,6 +499,9 @@ private:
     /// Filter is prepared for processing
     bool prepared_ = false;
 
+    /// Use FastMath::fastTan in calculateG()
+    bool fastCoefficients_ = false;
+
     // =========================================================================
     // Cached Parameters
     // =========================================================================
@@ -502,6 +518,11 @@ private:
     /// Cached linear gain from drive
     float driveGain_ = 1.0f;
 
+    /// Last calculateG() inputs/result (rate 0 = invalid)
+    float cachedGCutoff_ = 0.0f;
+    float cachedGRate_ = 0.0f;
+    float cachedG_ = 0.0f;
+
     // =========================================================================
     // Private Methods
     // =========================================================================
@@ -516,16 +537,26 @@ private:
     /// Uses the standard bilinear transform coefficient for the one-pole
     /// stages in the ladder filter. Includes clamping to prevent instability.
     [[nodiscard]] float calculateG(float cutoff, float rate) noexcept {
+        // Once the smoother has settled the cutoff repeats exactly; skip the
+        // tan() until it moves again.
+        if (cutoff == cachedGCutoff_ && rate == cachedGRate_) {
+            return cachedG_;
+        }
+
         // Clamp to prevent instability near Nyquist
         // Use 0.45 as max ratio to stay well away from the pi/2 singularity
         float fc = std::min(cutoff, rate * 0.45f);
 
         // Standard bilinear transform coefficient
-        float g = std::tan(kPi * fc / rate);
+        const float w = kPi * fc / rate;
+        float g = fastCoefficients_ ? FastMath::fastTan(w) : std::tan(w);
 
         // Additional safety: clamp g to prevent numerical instability
         // At fc/rate = 0.45, g = tan(0.45*pi) = ~5.67
-        return std::min(g, 10.0f);
+        cachedGCutoff_ = cutoff;
+        cachedGRate_ = rate;
+        cachedG_ = std::min(g, 10.0f);
+        return cachedG_;
     }
 
     /// Linear model processing (Stilson/Smith)
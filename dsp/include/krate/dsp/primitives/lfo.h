@@ -83,7 +83,7 @@ public:
     /// @brief Prepare the LFO for processing.
     void prepare(double sampleRate) noexcept {
         sampleRate_ = sampleRate;
-        generateWavetables();
+        wavetables_ = &sharedWavetables();
         updatePhaseIncrement();
         updateCrossfadeIncrement();
         // Rate-derived like the increments above, and only otherwise recomputed
@@ -363,23 +363,37 @@ public:
     /// @brief Get the current quantize steps (0 = off).
     [[nodiscard]] int quantizeSteps() const noexcept { return quantizeSteps_; }
 
+    /// @brief Heap memory held by this LFO, in bytes.
+    ///
+    /// Always 0: the wavetables are shared process-wide (sharedWavetables())
+    /// and not counted per instance.
+    [[nodiscard]] size_t heapBytes() const noexcept { return 0; }
+
 private:
     // =========================================================================
     // Wavetable Generation
     // =========================================================================
 
-    void generateWavetables() noexcept {
-        // Resize wavetables
-        for (auto& table : wavetables_) {
-            table.resize(kTableSize);
-        }
+    using Wavetable = std::array<float, kTableSize>;
+    using WavetableSet = std::array<Wavetable, 4>;
+
+    /// @brief Sine, Triangle, Sawtooth and Square tables, built once on first
+    /// use (from prepare(), never the audio thread) and shared by every LFO.
+    /// They depend on nothing but kTableSize.
+    [[nodiscard]] static const WavetableSet& sharedWavetables() noexcept {
+        static const WavetableSet tables = generateWavetables();
+        return tables;
+    }
+
+    [[nodiscard]] static WavetableSet generateWavetables() noexcept {
+        WavetableSet wavetables{};
 
         constexpr double twoPi = 2.0 * std::numbers::pi;
 
         // Generate Sine wavetable
         for (size_t i = 0; i < kTableSize; ++i) {
             double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Sine)][i] =
+            wavetables[static_cast<size_t>(Waveform::Sine)][i] =
                 static_cast<float>(std::sin(twoPi * phase));
         }
 
@@ -398,22 +412,23 @@ private:
                 // -1 to 0
                 value = static_cast<float>(phase * 4.0 - 4.0);
             }
-            wavetables_[static_cast<size_t>(Waveform::Triangle)][i] = value;
+            wavetables[static_cast<size_t>(Waveform::Triangle)][i] = value;
         }
 
         // Generate Sawtooth wavetable (-1 to +1)
         for (size_t i = 0; i < kTableSize; ++i) {
             double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Sawtooth)][i] =
+            wavetables[static_cast<size_t>(Waveform::Sawtooth)][i] =
                 static_cast<float>(2.0 * phase - 1.0);
         }
 
         // Generate Square wavetable (+1 for first half, -1 for second half)
         for (size_t i = 0; i < kTableSize; ++i) {
             double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Square)][i] =
+            wavetables[static_cast<size_t>(Waveform::Square)][i] =
                 (phase < 0.5) ? 1.0f : -1.0f;
         }
+        return wavetables;
     }
 
     // =========================================================================
@@ -421,7 +436,7 @@ private:
     // =========================================================================
 
     [[nodiscard]] float readWavetable(size_t tableIndex, double phase) const noexcept {
-        const auto& table = wavetables_[tableIndex];
+        const auto& table = (*wavetables_)[tableIndex];
 
         // Scale phase to table index
         double scaledPhase = phase * static_cast<double>(kTableSize);
@@ -550,8 +565,8 @@ private:
     float previousRandom_ = 0.0f;  // SmoothRandom: previous target
     float targetRandom_ = 0.0f;    // SmoothRandom: current target
 
-    // Wavetables (Sine, Triangle, Sawtooth, Square)
-    std::array<std::vector<float>, 4> wavetables_;
+    // Wavetables (Sine, Triangle, Sawtooth, Square), shared; set by prepare()
+    const WavetableSet* wavetables_ = nullptr;
 
     // Crossfade state (for smooth waveform transitions)
     Waveform previousWaveform_ = Waveform::Sine;  // Waveform we were crossfading from (for reference)
@@ -22,8 +22,11 @@
 
 #include "biquad.h"
 
+#include <krate/dsp/core/halfband_simd.h>
+
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -207,6 +210,134 @@ private:
 using HalfbandFilterStandard = HalfbandFilter<detail::kStandardFirLength>;
 using HalfbandFilterHigh = HalfbandFilter<detail::kHighFirLength>;
 
+// =============================================================================
+// Polyphase Halfband Interpolator / Decimator
+// =============================================================================
+// Same filters as HalfbandFilter, in polyphase form: one branch is the
+// symmetric FIR over the non-zero tap pairs, the other a pure delay through
+// the centre tap. Nothing is computed for the stuffed zeros (interpolation)
+// or for the discarded outputs (decimation), and whole blocks run through
+// the SIMD kernels in halfband_simd.h.
+
+namespace detail {
+
+/// @brief Double-length circular history: every sample is written twice,
+/// kSize apart, so the last History + n samples are always one contiguous
+/// window. No per-sample shifting, no wrap handling in the kernels.
+template<size_t History, size_t Chunk>
+class HalfbandHistory {
+public:
+    static constexpr size_t kSize = std::bit_ceil(History + Chunk);
+
+    /// Append n <= Chunk samples read with the given stride; returns the
+    /// History + n sample window ending at the newest sample.
+    const float* append(const float* input, size_t stride, size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            const float x = input[i * stride];
+            buffer_[pos_] = x;
+            buffer_[pos_ + kSize] = x;
+            pos_ = (pos_ + 1) & (kSize - 1);
+        }
+        return buffer_.data() + ((pos_ + 2 * kSize - n - History) & (kSize - 1));
+    }
+
+    void reset() noexcept {
+        buffer_.fill(0.0f);
+        pos_ = 0;
+    }
+
+private:
+    std::array<float, 2 * kSize> buffer_{};
+    size_t pos_ = 0;
+};
+
+/// Samples per kernel call; bounds the history ring size.
+constexpr size_t kHalfbandChunk = 64;
+
+} // namespace detail
+
+/// @brief 2x polyphase halfband interpolator (zero-stuff + HalfbandFilter).
+/// @tparam NumTaps Filter length 4K + 3 (31 = Standard, 63 = High)
+template<size_t NumTaps>
+class HalfbandInterpolator {
+public:
+    static_assert(NumTaps >= 3 && (NumTaps - 3) % 4 == 0,
+                  "Halfband length must be 4K + 3");
+    static constexpr size_t kNumPairs = (NumTaps - 3) / 4;
+    static constexpr size_t kLatency = (NumTaps - 1) / 2;
+
+    /// Set the tap-pair coefficients (h[+-1], h[+-3], ...), as for
+    /// HalfbandFilter::setCoefficients(). The 0.5 centre tap is implicit.
+    void setCoefficients(const float* coeffs, size_t numCoeffs) noexcept {
+        for (size_t k = 0; k < kNumPairs; ++k) {
+            // Zero-stuffing gain folded into the taps
+            coeffs_[k] = (k < numCoeffs) ? 2.0f * coeffs[k] : 0.0f;
+        }
+    }
+
+    /// Upsample numSamples inputs into 2 * numSamples outputs.
+    /// @note output must not alias input
+    void process(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t done = 0; done < numSamples;) {
+            const size_t n = std::min(detail::kHalfbandChunk, numSamples - done);
+            const float* window = history_.append(input + done, 1, n);
+            halfbandInterpolate2x(window, coeffs_.data(), kNumPairs, output + 2 * done, n);
+            done += n;
+        }
+    }
+
+    void reset() noexcept { history_.reset(); }
+
+    [[nodiscard]] static constexpr size_t getLatency() noexcept { return kLatency; }
+
+private:
+    std::array<float, kNumPairs> coeffs_{};
+    detail::HalfbandHistory<2 * kNumPairs + 1, detail::kHalfbandChunk> history_;
+};
+
+/// @brief 2x polyphase halfband decimator (HalfbandFilter + drop odd outputs).
+/// @tparam NumTaps Filter length 4K + 3 (31 = Standard, 63 = High)
+template<size_t NumTaps>
+class HalfbandDecimator {
+public:
+    static_assert(NumTaps >= 3 && (NumTaps - 3) % 4 == 0,
+                  "Halfband length must be 4K + 3");
+    static constexpr size_t kNumPairs = (NumTaps - 3) / 4;
+    static constexpr size_t kLatency = (NumTaps - 1) / 2;
+
+    /// Set the tap-pair coefficients (h[+-1], h[+-3], ...), as for
+    /// HalfbandFilter::setCoefficients(). The 0.5 centre tap is implicit.
+    void setCoefficients(const float* coeffs, size_t numCoeffs) noexcept {
+        for (size_t k = 0; k < kNumPairs; ++k) {
+            coeffs_[k] = (k < numCoeffs) ? coeffs[k] : 0.0f;
+        }
+    }
+
+    /// Downsample 2 * numSamples inputs into numSamples outputs.
+    /// @note output may alias input (each chunk is read before it is written)
+    void process(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t done = 0; done < numSamples;) {
+            const size_t n = std::min(detail::kHalfbandChunk, numSamples - done);
+            const float* even = evenHistory_.append(input + 2 * done, 2, n);
+            const float* odd = oddHistory_.append(input + 2 * done + 1, 2, n);
+            halfbandDecimate2x(even, odd, coeffs_.data(), kNumPairs, output + done, n);
+            done += n;
+        }
+    }
+
+    void reset() noexcept {
+        evenHistory_.reset();
+        oddHistory_.reset();
+    }
+
+    [[nodiscard]] static constexpr size_t getLatency() noexcept { return kLatency; }
+
+private:
+    std::array<float, kNumPairs> coeffs_{};
+    detail::HalfbandHistory<2 * kNumPairs + 1, detail::kHalfbandChunk> evenHistory_;
+    detail::HalfbandHistory<2 * kNumPairs + 1, detail::kHalfbandChunk> oddHistory_;
+};
+
 // =============================================================================
 // Oversampler Class Template
 // =============================================================================
@@ -374,11 +505,11 @@ private:
     std::array<BiquadCascade<4>, NumChannels * kNumStages> iirUpsampleFilters_;
     std::array<BiquadCascade<4>, NumChannels * kNumStages> iirDownsampleFilters_;
 
-    // FIR filters for Standard/High quality with LinearPhase mode
-    std::array<HalfbandFilterStandard, NumChannels * kNumStages> firStandardUpsample_;
-    std::array<HalfbandFilterStandard, NumChannels * kNumStages> firStandardDownsample_;
-    std::array<HalfbandFilterHigh, NumChannels * kNumStages> firHighUpsample_;
-    std::array<HalfbandFilterHigh, NumChannels * kNumStages> firHighDownsample_;
+    // Polyphase FIR filters for Standard/High quality with LinearPhase mode
+    std::array<HalfbandInterpolator<detail::kStandardFirLength>, NumChannels * kNumStages> firStandardUpsample_;
+    std::array<HalfbandDecimator<detail::kStandardFirLength>, NumChannels * kNumStages> firStandardDownsample_;
+    std::array<HalfbandInterpolator<detail::kHighFirLength>, NumChannels * kNumStages> firHighUpsample_;
+    std::array<HalfbandDecimator<detail::kHighFirLength>, NumChannels * kNumStages> firHighDownsample_;
 
     // Pre-allocated buffers
     std::vector<float> oversampledBuffer_;  // Size: maxBlockSize * Factor * NumChannels
@@ -682,51 +813,27 @@ void Oversampler<Factor, NumChannels>::upsampleFir(
     size_t numSamples,
     size_t channel
 ) noexcept {
+    const bool standard = (quality_ == OversamplingQuality::Standard);
+
     if constexpr (Factor == 2) {
-        // Single 2x stage: zero-stuff then filter
         const size_t idx = getFilterIndex(channel, 0);
-
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Zero-stuffing: insert sample, then zero
-            output[i * 2] = input[i] * 2.0f;  // Gain compensation
-            output[i * 2 + 1] = 0.0f;
-        }
-
-        // Apply FIR filter based on quality
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx].processBlock(output, numSamples * 2);
+        if (standard) {
+            firStandardUpsample_[idx].process(input, output, numSamples);
         } else {
-            firHighUpsample_[idx].processBlock(output, numSamples * 2);
+            firHighUpsample_[idx].process(input, output, numSamples);
         }
     } else {
-        // 4x: Two cascaded 2x stages
+        // 4x: Two cascaded 2x stages, the 2x signal staged in tempBuffer_
         const size_t idx0 = getFilterIndex(channel, 0);
         const size_t idx1 = getFilterIndex(channel, 1);
+        float* intermediate = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
 
-        // Stage 1: 1x -> 2x
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i * 2] = input[i] * 2.0f;
-            output[i * 2 + 1] = 0.0f;
-        }
-
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx0].processBlock(output, numSamples * 2);
+        if (standard) {
+            firStandardUpsample_[idx0].process(input, intermediate, numSamples);
+            firStandardUpsample_[idx1].process(intermediate, output, numSamples * 2);
         } else {
-            firHighUpsample_[idx0].processBlock(output, numSamples * 2);
-        }
-
-        // Stage 2: 2x -> 4x (work backwards for in-place expansion)
-        for (size_t i = numSamples * 2; i > 0; --i) {
-            const size_t srcIdx = i - 1;
-            const size_t dstIdx = (i - 1) * 2;
-            output[dstIdx + 1] = 0.0f;
-            output[dstIdx] = output[srcIdx] * 2.0f;
-        }
-
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx1].processBlock(output, numSamples * 4);
-        } else {
-            firHighUpsample_[idx1].processBlock(output, numSamples * 4);
+            firHighUpsample_[idx0].process(input, intermediate, numSamples);
+            firHighUpsample_[idx1].process(intermediate, output, numSamples * 2);
         }
     }
 }
@@ -738,52 +845,27 @@ void Oversampler<Factor, NumChannels>::downsampleFir(
     size_t numSamples,
     size_t channel
 ) noexcept {
-    // We need a temporary buffer for filtering since input is const
-    float* temp = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
-    std::copy(input, input + numSamples * Factor, temp);
+    const bool standard = (quality_ == OversamplingQuality::Standard);
 
     if constexpr (Factor == 2) {
-        // Single 2x stage: filter then decimate
         const size_t idx = getFilterIndex(channel, 0);
-
-        // Apply FIR filter based on quality
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx].processBlock(temp, numSamples * 2);
+        if (standard) {
+            firStandardDownsample_[idx].process(input, output, numSamples);
         } else {
-            firHighDownsample_[idx].processBlock(temp, numSamples * 2);
-        }
-
-        // Decimate: take every 2nd sample
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
+            firHighDownsample_[idx].process(input, output, numSamples);
         }
     } else {
         // 4x: Two cascaded 2x stages (reverse order)
         const size_t idx0 = getFilterIndex(channel, 0);
         const size_t idx1 = getFilterIndex(channel, 1);
+        float* intermediate = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
 
-        // Stage 1: 4x -> 2x
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx1].processBlock(temp, numSamples * 4);
+        if (standard) {
+            firStandardDownsample_[idx1].process(input, intermediate, numSamples * 2);
+            firStandardDownsample_[idx0].process(intermediate, output, numSamples);
         } else {
-            firHighDownsample_[idx1].processBlock(temp, numSamples * 4);
-        }
-
-        // Decimate to 2x
-        for (size_t i = 0; i < numSamples * 2; ++i) {
-            temp[i] = temp[i * 2];
-        }
-
-        // Stage 2: 2x -> 1x
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx0].processBlock(temp, numSamples * 2);
-        } else {
-            firHighDownsample_[idx0].processBlock(temp, numSamples * 2);
-        }
-
-        // Final decimation
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
+            firHighDownsample_[idx1].process(input, intermediate, numSamples * 2);
+            firHighDownsample_[idx0].process(intermediate, output, numSamples);
         }
     }
 }
@@ -0,0 +1,542 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Zero-Latency Partitioned Convolver
+// ==============================================================================
+// Convolves up to two channels with long impulse responses (seconds) at zero
+// latency and a cost that grows only logarithmically with IR length.
+//
+// The IR is split into a short direct-form head and a chain of frequency-domain
+// stages. Each stage is uniformly partitioned (overlap-save, one FFT of 2N per
+// N input samples, pre-transformed IR partitions, frequency-domain delay line)
+// and the partition size grows 4x from stage to stage:
+//
+//   IR:   [ head B | 7 x B | 6 x 4B | 6 x 16B | ... | n x maxBlockSize ]
+//
+//   - Head: the first B taps, direct form (SIMD FIR), no latency.
+//   - Stage 0 (N = B) starts at tap B and is computed the moment its input
+//     block completes, on the audio thread.
+//   - Every later stage starts at tap 2N, so its result is needed one full
+//     block after its input completes. That job runs on a background thread
+//     (when enabled), spreading the large FFTs over N samples of wall time
+//     instead of landing on one audio callback. If the worker falls behind,
+//     the audio thread finishes the job itself rather than output garbage.
+//
+// The spectral multiply-accumulate is pffft's zconvolve_accumulate, which
+// works directly on pffft's SIMD-interleaved (unordered) spectra.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (process() is noexcept and allocation-free;
+//   setImpulseResponse() allocates and must not overlap process())
+// - Principle III: Modern C++ (C++20 atomics, RAII)
+// - Principle IV: SIMD & DSP Optimization (pffft spectra, Highway FIR head)
+// - Principle IX: Layer 1 (depends on Layer 0 and fft.h / pffft)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/convolution_simd.h>
+#include <krate/dsp/core/scoped_denormal_mode.h>
+#include <krate/dsp/primitives/fft.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Zero-latency convolver: direct-form head + non-uniformly
+/// partitioned FFT tail with optional background processing.
+///
+/// @code
+/// PartitionedConvolver conv;
+/// const float* ir[] = {irLeft, irRight};
+/// conv.setImpulseResponse(ir, 2, irLength);   // setup thread
+/// conv.process(inputs, outputs, numSamples);   // audio thread
+/// @endcode
+///
+/// process() accepts any block size; input and output may alias.
+class PartitionedConvolver {
+public:
+    static constexpr size_t kMaxChannels = 2;
+    static constexpr size_t kMinHeadBlockSize = 16;
+    static constexpr size_t kMaxPartitionSize = 65536;
+
+    struct Options {
+        /// Direct-form head length and first partition size (power of 2).
+        /// Smaller is cheaper per sample on the FFT side but costs more FFTs;
+        /// 64 suits typical host buffers.
+        size_t headBlockSize = 64;
+        /// Largest partition size (power of 2, >= headBlockSize).
+        size_t maxBlockSize = 8192;
+        /// Compute stages after the first on a background thread.
+        bool backgroundTail = true;
+    };
+
+    PartitionedConvolver() noexcept = default;
+    ~PartitionedConvolver() { stopWorker(); }
+
+    PartitionedConvolver(const PartitionedConvolver&) = delete;
+    PartitionedConvolver& operator=(const PartitionedConvolver&) = delete;
+    PartitionedConvolver(PartitionedConvolver&&) = delete;
+    PartitionedConvolver& operator=(PartitionedConvolver&&) = delete;
+
+    // =========================================================================
+    // Setup (NOT real-time safe)
+    // =========================================================================
+
+    /// @brief Load one IR per channel and clear all history.
+    /// @param ir          numChannels pointers to `length` samples each
+    /// @param numChannels 1 or 2
+    /// @param length      IR length in samples (0 unloads)
+    /// @return false if the arguments are invalid (state is then unloaded)
+    /// @note Allocates, joins/spawns the worker thread. Must not run
+    ///       concurrently with process().
+    bool setImpulseResponse(const float* const* ir, size_t numChannels,
+                            size_t length, const Options& options) {
+        stopWorker();
+        release();
+
+        if (length == 0) return true;
+        if (ir == nullptr || numChannels == 0 || numChannels > kMaxChannels) return false;
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            if (ir[ch] == nullptr) return false;
+        }
+
+        const size_t head = std::clamp(roundUpPow2(options.headBlockSize),
+                                       kMinHeadBlockSize, kMaxPartitionSize);
+        const size_t maxN = std::clamp(roundUpPow2(options.maxBlockSize),
+                                       head, kMaxPartitionSize);
+
+        numChannels_ = numChannels;
+        irLength_ = length;
+        headBlockSize_ = head;
+        headTaps_ = std::min(head, length);
+        backgroundTail_ = options.backgroundTail;
+
+        // Head: taps stored reversed for convolveDirectFIR()
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            auto& c = channels_[ch];
+            c.headTaps.assign(headTaps_, 0.0f);
+            for (size_t k = 0; k < headTaps_; ++k) {
+                c.headTaps[headTaps_ - 1 - k] = ir[ch][k];
+            }
+            c.headWindow.assign(2 * head - 1, 0.0f);
+        }
+
+        buildStages(ir, head, maxN);
+
+        size_t largest = head;
+        for (const auto& stage : stages_) largest = std::max(largest, stage->blockSize);
+        inputRingMask_ = 2 * largest - 1;
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            channels_[ch].inputRing.assign(2 * largest, 0.0f);
+        }
+
+        if (backgroundTail_ && stages_.size() > 1) startWorker();
+        return true;
+    }
+
+    /// @brief Load with default Options.
+    bool setImpulseResponse(const float* const* ir, size_t numChannels, size_t length) {
+        return setImpulseResponse(ir, numChannels, length, Options{});
+    }
+
+    /// @brief Clear all signal history (IR is kept).
+    /// @note Waits for any in-flight background job. Must not run
+    ///       concurrently with process().
+    void reset() noexcept {
+        for (auto& stage : stages_) {
+            ensureDone(*stage);
+            for (size_t ch = 0; ch < numChannels_; ++ch) {
+                auto& sc = stage->channels[ch];
+                zero(sc.fdl.get(), stage->numPartitions * 2 * stage->blockSize);
+                zero(sc.slots.get(), stage->numSlots * stage->blockSize);
+                zero(sc.input.get(), 2 * stage->blockSize);
+            }
+            stage->fdlPos = 0;
+        }
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            std::fill(channels_[ch].headWindow.begin(), channels_[ch].headWindow.end(), 0.0f);
+            std::fill(channels_[ch].inputRing.begin(), channels_[ch].inputRing.end(), 0.0f);
+        }
+        samplePos_ = 0;
+    }
+
+    // =========================================================================
+    // Processing (real-time safe)
+    // =========================================================================
+
+    /// @brief Convolve numChannels() channels. Output is the wet signal only.
+    /// @note in[ch] and out[ch] may point to the same buffer. Nothing is
+    ///       written while no IR is loaded.
+    void process(const float* const* in, float* const* out, size_t numSamples) noexcept {
+        if (numChannels_ == 0) return;
+
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t blockPos = static_cast<size_t>(samplePos_ & (headBlockSize_ - 1));
+            const size_t len = std::min(numSamples - done, headBlockSize_ - blockPos);
+
+            for (size_t ch = 0; ch < numChannels_; ++ch) {
+                processHeadChunk(ch, in[ch] + done, out[ch] + done, blockPos, len);
+            }
+            addStageOutputs(out, done, len);
+
+            samplePos_ += len;
+            done += len;
+            if ((samplePos_ & (headBlockSize_ - 1)) == 0) onBlockBoundary();
+        }
+    }
+
+    /// @brief Convenience overload for a single-channel IR.
+    void process(const float* in, float* out, size_t numSamples) noexcept {
+        if (numChannels_ != 1) {
+            zero(out, numSamples);
+            return;
+        }
+        const float* ins[] = {in};
+        float* outs[] = {out};
+        process(ins, outs, numSamples);
+    }
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    [[nodiscard]] size_t numChannels() const noexcept { return numChannels_; }
+    [[nodiscard]] size_t irLength() const noexcept { return irLength_; }
+    [[nodiscard]] size_t headBlockSize() const noexcept { return headBlockSize_; }
+    [[nodiscard]] size_t numStages() const noexcept { return stages_.size(); }
+    [[nodiscard]] size_t stageBlockSize(size_t i) const noexcept { return stages_[i]->blockSize; }
+    [[nodiscard]] size_t stageOffset(size_t i) const noexcept { return stages_[i]->offset; }
+    [[nodiscard]] size_t stagePartitions(size_t i) const noexcept { return stages_[i]->numPartitions; }
+    [[nodiscard]] bool hasBackgroundWorker() const noexcept { return worker_.joinable(); }
+
+    /// Always 0: the head covers the samples the FFT stages cannot.
+    [[nodiscard]] static constexpr size_t latency() noexcept { return 0; }
+
+private:
+    using AlignedBuffer = std::unique_ptr<float, detail::PffftAlignedDeleter>;
+
+    enum JobState : int { kDone = 0, kPending = 1, kRunning = 2 };
+
+    /// Per-channel head history and input ring
+    struct Channel {
+        std::vector<float> headTaps;    // reversed, headTaps_ long
+        std::vector<float> headWindow;  // [B - 1 history][B current block]
+        std::vector<float> inputRing;   // last 2 x largest partition size
+    };
+
+    struct StageChannel {
+        AlignedBuffer partitions;  // P spectra of 2N (unordered, pre-scaled)
+        AlignedBuffer fdl;         // P input spectra, ring indexed by fdlPos
+        AlignedBuffer input;       // 2N time-domain window for the next job
+        AlignedBuffer slots;       // numSlots finished output blocks of N
+    };
+
+    /// One uniformly partitioned segment of the IR
+    struct Stage {
+        size_t blockSize = 0;      // N
+        size_t offset = 0;         // first IR tap covered
+        size_t numPartitions = 0;  // P
+        size_t numSlots = 0;
+        bool background = false;
+        std::unique_ptr<PFFFT_Setup, detail::PffftSetupDeleter> setup;
+        std::array<StageChannel, kMaxChannels> channels;
+        AlignedBuffer accum;
+        AlignedBuffer work;
+        size_t fdlPos = 0;
+        uint64_t jobIndex = 0;     // job being (or last) computed
+        std::atomic<int> state{kDone};
+    };
+
+    // -------------------------------------------------------------------------
+    // Setup helpers
+    // -------------------------------------------------------------------------
+
+    static size_t roundUpPow2(size_t n) noexcept {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    static void zero(float* p, size_t n) noexcept {
+        std::memset(p, 0, n * sizeof(float));
+    }
+
+    static AlignedBuffer makeZeroed(size_t n) {
+        auto buf = detail::makeAlignedBuffer(n);
+        zero(buf.get(), n);
+        return buf;
+    }
+
+    /// Stage layout: each stage ends where the next (4x larger) stage may
+    /// start, i.e. at twice its block size; the last stage covers the rest.
+    void buildStages(const float* const* ir, size_t head, size_t maxN) {
+        size_t offset = head;
+        size_t n = head;
+        while (offset < irLength_) {
+            const size_t nextN = std::min(4 * n, maxN);
+            const size_t remaining = (irLength_ - offset + n - 1) / n;
+            size_t partitions = (nextN > n) ? (2 * nextN - offset) / n : remaining;
+            partitions = std::min(partitions, remaining);
+
+            stages_.push_back(makeStage(ir, n, offset, partitions));
+            offset += partitions * n;
+            n = nextN;
+        }
+    }
+
+    std::unique_ptr<Stage> makeStage(const float* const* ir, size_t n,
+                                     size_t offset, size_t partitions) {
+        auto stage = std::make_unique<Stage>();
+        const size_t fftSize = 2 * n;
+        stage->blockSize = n;
+        stage->offset = offset;
+        stage->numPartitions = partitions;
+        // A slot is rewritten numSlots jobs later; readers lag by offset / N
+        stage->numSlots = offset / n + 1;
+        // The first stage's result is due the instant its input completes
+        stage->background = backgroundTail_ && offset >= fftSize;
+        stage->setup.reset(pffft_new_setup(static_cast<int>(fftSize), PFFFT_REAL));
+        stage->accum = makeZeroed(fftSize);
+        stage->work = makeZeroed(fftSize);
+
+        const float scale = 1.0f / static_cast<float>(fftSize);
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            auto& sc = stage->channels[ch];
+            sc.partitions = makeZeroed(partitions * fftSize);
+            sc.fdl = makeZeroed(partitions * fftSize);
+            sc.input = makeZeroed(fftSize);
+            sc.slots = makeZeroed(stage->numSlots * n);
+
+            for (size_t p = 0; p < partitions; ++p) {
+                float* time = stage->accum.get();
+                zero(time, fftSize);
+                const size_t start = offset + p * n;
+                const size_t count = std::min(n, irLength_ - start);
+                for (size_t k = 0; k < count; ++k) time[k] = ir[ch][start + k] * scale;
+
+                float* spectrum = sc.partitions.get() + p * fftSize;
+                pffft_transform(stage->setup.get(), time, spectrum, stage->work.get(),
+                                PFFFT_FORWARD);
+            }
+        }
+        zero(stage->accum.get(), fftSize);
+        return stage;
+    }
+
+    void release() noexcept {
+        stages_.clear();
+        for (auto& c : channels_) c = Channel{};
+        numChannels_ = 0;
+        irLength_ = 0;
+        headTaps_ = 0;
+        samplePos_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Audio thread
+    // -------------------------------------------------------------------------
+
+    void processHeadChunk(size_t ch, const float* in, float* out,
+                          size_t blockPos, size_t len) noexcept {
+        auto& c = channels_[ch];
+        const size_t history = headBlockSize_ - 1;
+
+        // Stash input first so in == out is safe
+        std::memcpy(c.headWindow.data() + history + blockPos, in, len * sizeof(float));
+        const size_t ringPos = static_cast<size_t>(samplePos_) & inputRingMask_;
+        const size_t firstPart = std::min(len, c.inputRing.size() - ringPos);
+        std::memcpy(c.inputRing.data() + ringPos, in, firstPart * sizeof(float));
+        std::memcpy(c.inputRing.data(), in + firstPart, (len - firstPart) * sizeof(float));
+
+        convolveDirectFIR(c.headWindow.data() + (headBlockSize_ - headTaps_) + blockPos,
+                          c.headTaps.data(), headTaps_, out, len);
+    }
+
+    void addStageOutputs(float* const* out, size_t done, size_t len) noexcept {
+        for (auto& stagePtr : stages_) {
+            Stage& stage = *stagePtr;
+            if (samplePos_ < stage.offset) continue;
+            const uint64_t rel = samplePos_ - stage.offset;
+            const size_t slot = static_cast<size_t>((rel / stage.blockSize) % stage.numSlots);
+            const size_t pos = static_cast<size_t>(rel % stage.blockSize);
+            for (size_t ch = 0; ch < numChannels_; ++ch) {
+                const float* src = stage.channels[ch].slots.get() + slot * stage.blockSize + pos;
+                float* dst = out[ch] + done;
+                for (size_t i = 0; i < len; ++i) dst[i] += src[i];
+            }
+        }
+    }
+
+    /// Runs every headBlockSize samples: shift the head history, collect
+    /// results that start playing now, then hand completed input blocks to
+    /// their stages.
+    void onBlockBoundary() noexcept {
+        // Keep the last B - 1 samples as head history
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            float* window = channels_[ch].headWindow.data();
+            std::memmove(window, window + headBlockSize_, (headBlockSize_ - 1) * sizeof(float));
+        }
+
+        for (auto& stagePtr : stages_) {
+            Stage& stage = *stagePtr;
+            const size_t n = stage.blockSize;
+
+            if (samplePos_ >= stage.offset && (samplePos_ - stage.offset) % n == 0) {
+                ensureDone(stage);
+            }
+            if (samplePos_ % n == 0) submit(stage);
+        }
+    }
+
+    void submit(Stage& stage) noexcept {
+        ensureDone(stage);  // previous job still owns the input window
+
+        const size_t fftSize = 2 * stage.blockSize;
+        const size_t start = static_cast<size_t>(samplePos_ - fftSize) & inputRingMask_;
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            const auto& ring = channels_[ch].inputRing;
+            float* dst = stage.channels[ch].input.get();
+            const size_t firstPart = std::min(fftSize, ring.size() - start);
+            std::memcpy(dst, ring.data() + start, firstPart * sizeof(float));
+            std::memcpy(dst + firstPart, ring.data(), (fftSize - firstPart) * sizeof(float));
+        }
+        stage.jobIndex = samplePos_ / stage.blockSize - 1;
+
+        if (stage.background && worker_.joinable()) {
+            stage.state.store(kPending, std::memory_order_release);
+            wakeWorker();
+        } else {
+            runJob(stage);
+        }
+    }
+
+    /// Make sure the stage's last submitted job has finished. Steals a job the
+    /// worker has not started yet; spins only if it is mid-job.
+    static void ensureDone(Stage& stage) noexcept {
+        int expected = kPending;
+        if (stage.state.compare_exchange_strong(expected, kRunning,
+                                                std::memory_order_acq_rel)) {
+            runJob(stage);
+            stage.state.store(kDone, std::memory_order_release);
+            return;
+        }
+        while (stage.state.load(std::memory_order_acquire) != kDone) {
+            std::this_thread::yield();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // FFT job (audio thread or worker)
+    // -------------------------------------------------------------------------
+
+    /// Overlap-save over the frequency-domain delay line: transform the newest
+    /// 2N window, sum H[p] * X[pos - p] over all partitions, inverse
+    /// transform, keep the last N samples.
+    static void runJob(Stage& stage) noexcept {
+        const size_t n = stage.blockSize;
+        const size_t fftSize = 2 * n;
+        const size_t partitions = stage.numPartitions;
+        PFFFT_Setup* setup = stage.setup.get();
+        float* accum = stage.accum.get();
+        float* work = stage.work.get();
+        const size_t slot = static_cast<size_t>(stage.jobIndex % stage.numSlots);
+
+        for (auto& sc : stage.channels) {
+            if (!sc.fdl) continue;
+            float* fdl = sc.fdl.get();
+            pffft_transform(setup, sc.input.get(), fdl + stage.fdlPos * fftSize, work,
+                            PFFFT_FORWARD);
+
+            zero(accum, fftSize);
+            size_t idx = stage.fdlPos;
+            for (size_t p = 0; p < partitions; ++p) {
+                pffft_zconvolve_accumulate(setup, fdl + idx * fftSize,
+                                           sc.partitions.get() + p * fftSize, accum, 1.0f);
+                idx = (idx == 0) ? partitions - 1 : idx - 1;
+            }
+
+            pffft_transform(setup, accum, accum, work, PFFFT_BACKWARD);
+            std::memcpy(sc.slots.get() + slot * n, accum + n, n * sizeof(float));
+        }
+        stage.fdlPos = (stage.fdlPos + 1 == partitions) ? 0 : stage.fdlPos + 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Background worker
+    // -------------------------------------------------------------------------
+
+    void startWorker() {
+        stopping_.store(false, std::memory_order_relaxed);
+        worker_ = std::thread([this] { workerLoop(); });
+    }
+
+    void stopWorker() noexcept {
+        if (!worker_.joinable()) return;
+        stopping_.store(true, std::memory_order_seq_cst);
+        wakeWorker();
+        worker_.join();
+        // Anything the worker left behind is finished here
+        for (auto& stage : stages_) ensureDone(*stage);
+    }
+
+    void wakeWorker() noexcept {
+        generation_.fetch_add(1, std::memory_order_seq_cst);
+        generation_.notify_one();
+    }
+
+    void workerLoop() noexcept {
+        const ScopedDenormalMode denormalGuard;
+        uint32_t seen = generation_.load(std::memory_order_acquire);
+        for (;;) {
+            if (stopping_.load(std::memory_order_acquire)) return;
+
+            // Smallest stages first: they have the nearest deadline
+            bool ranAny = false;
+            for (auto& stagePtr : stages_) {
+                Stage& stage = *stagePtr;
+                int expected = kPending;
+                if (stage.state.compare_exchange_strong(expected, kRunning,
+                                                        std::memory_order_acq_rel)) {
+                    runJob(stage);
+                    stage.state.store(kDone, std::memory_order_release);
+                    ranAny = true;
+                }
+            }
+            if (ranAny) continue;
+
+            generation_.wait(seen, std::memory_order_acquire);
+            seen = generation_.load(std::memory_order_acquire);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // State
+    // -------------------------------------------------------------------------
+
+    std::array<Channel, kMaxChannels> channels_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+
+    size_t numChannels_ = 0;
+    size_t irLength_ = 0;
+    size_t headBlockSize_ = 64;
+    size_t headTaps_ = 0;
+    size_t inputRingMask_ = 0;
+    uint64_t samplePos_ = 0;
+    bool backgroundTail_ = true;
+
+    std::atomic<uint32_t> generation_{0};
+    std::atomic<bool> stopping_{false};
+    std::thread worker_;
+};
+
+}  // namespace DSP
+}  // namespace Krate
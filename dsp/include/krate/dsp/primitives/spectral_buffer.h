@@ -158,6 +158,20 @@ public:
         return data_.data();
     }
 
+    /// @brief Direct const access to all numBins() magnitudes (for bulk kernels)
+    /// @note Syncs polar from Cartesian if needed.
+    [[nodiscard]] const float* magnitudes() const noexcept {
+        ensurePolarValid();
+        return mags_.data();
+    }
+
+    /// @brief Direct const access to all numBins() phases in radians
+    /// @note Syncs polar from Cartesian if needed.
+    [[nodiscard]] const float* phases() const noexcept {
+        ensurePolarValid();
+        return phases_.data();
+    }
+
     // -------------------------------------------------------------------------
     // Query
     // -------------------------------------------------------------------------
@@ -4,6 +4,11 @@
 // STFT for continuous audio stream analysis and OverlapAdd for synthesis.
 // Provides streaming spectral processing with configurable windows and overlap.
 //
+// MultiChannelSTFT / MultiChannelOverlapAdd run K channels in lockstep: one
+// window, one hop counter, and one BatchFFT call per frame (channels are
+// transformed in pairs), so a stereo stream costs one complex transform per
+// frame instead of two independent STFT pipelines.
+//
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept process, allocation in prepare())
 // - Principle III: Modern C++ (C++20, RAII)
@@ -21,7 +26,9 @@
 #include "../core/window_functions.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstring>
 #include <vector>
 
 namespace Krate {
@@ -343,5 +350,320 @@ private:
     size_t samplesReady_ = 0;
 };
 
+// =============================================================================
+// MultiChannelSTFT Class
+// =============================================================================
+
+/// @brief STFT over K channels sharing window, hop bookkeeping and transforms
+///
+/// Frame-for-frame equivalent to K separate STFT instances fed the same
+/// number of samples, up to float rounding in the paired transform.
+class MultiChannelSTFT {
+public:
+    static constexpr size_t kMaxChannels = 8;
+
+    MultiChannelSTFT() noexcept = default;
+    ~MultiChannelSTFT() noexcept = default;
+
+    // Non-copyable, movable
+    MultiChannelSTFT(const MultiChannelSTFT&) = delete;
+    MultiChannelSTFT& operator=(const MultiChannelSTFT&) = delete;
+    MultiChannelSTFT(MultiChannelSTFT&&) noexcept = default;
+    MultiChannelSTFT& operator=(MultiChannelSTFT&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    /// @brief Prepare multi-channel STFT processor
+    /// @param numChannels Channel count, clamped to [1, kMaxChannels]
+    /// @param fftSize FFT size (power of 2, 256-8192)
+    /// @param hopSize Frame advance in samples
+    /// @param window Window type for analysis
+    /// @param kaiserBeta Kaiser beta parameter (only used if window == Kaiser)
+    /// @note NOT real-time safe (allocates memory)
+    void prepare(
+        size_t numChannels,
+        size_t fftSize,
+        size_t hopSize,
+        WindowType window = WindowType::Hann,
+        float kaiserBeta = 9.0f
+    ) noexcept {
+        numChannels_ = std::clamp<size_t>(numChannels, 1, kMaxChannels);
+        fftSize_ = fftSize;
+        hopSize_ = hopSize;
+        windowType_ = window;
+
+        fft_.prepare(fftSize);
+        window_ = Window::generate(window, fftSize, kaiserBeta);
+
+        // Same capacity as STFT: up to 7 * fftSize samples pushed ahead
+        for (size_t ch = 0; ch < kMaxChannels; ++ch) {
+            const bool used = ch < numChannels_;
+            inputBuffers_[ch].assign(used ? fftSize * 8 : 0, 0.0f);
+            windowedFrames_[ch].assign(used ? fftSize : 0, 0.0f);
+        }
+
+        writeIndex_ = 0;
+        samplesAvailable_ = 0;
+    }
+
+    /// @brief Reset internal buffers (clear accumulated samples)
+    /// @note Real-time safe
+    void reset() noexcept {
+        for (auto& buffer : inputBuffers_) std::fill(buffer.begin(), buffer.end(), 0.0f);
+        writeIndex_ = 0;
+        samplesAvailable_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Input (Real-Time Safe)
+    // -------------------------------------------------------------------------
+
+    /// @brief Push the same number of samples into every channel
+    /// @param inputs numChannels() pointers to numSamples samples
+    /// @note Real-time safe, noexcept
+    void pushSamples(const float* const* inputs, size_t numSamples) noexcept {
+        if (inputs == nullptr || !isPrepared()) return;
+
+        const size_t bufSize = inputBuffers_[0].size();
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t chunk = std::min(numSamples - done, bufSize - writeIndex_);
+            for (size_t ch = 0; ch < numChannels_; ++ch) {
+                std::memcpy(inputBuffers_[ch].data() + writeIndex_, inputs[ch] + done,
+                            chunk * sizeof(float));
+            }
+            writeIndex_ = (writeIndex_ + chunk) % bufSize;
+            done += chunk;
+        }
+        samplesAvailable_ += numSamples;
+    }
+
+    // -------------------------------------------------------------------------
+    // Analysis (Real-Time Safe)
+    // -------------------------------------------------------------------------
+
+    /// @brief Check if enough samples for analysis frame
+    [[nodiscard]] bool canAnalyze() const noexcept {
+        return samplesAvailable_ >= fftSize_;
+    }
+
+    /// @brief Windowed FFT analysis of every channel
+    /// @param outputs numChannels() SpectralBuffers to receive the spectra
+    /// @pre canAnalyze() returns true
+    /// @note Real-time safe, noexcept
+    void analyze(SpectralBuffer* const* outputs) noexcept {
+        if (!canAnalyze() || outputs == nullptr) return;
+
+        const size_t bufSize = inputBuffers_[0].size();
+        const size_t readStart = (writeIndex_ + bufSize - samplesAvailable_) % bufSize;
+        const size_t firstPart = std::min(fftSize_, bufSize - readStart);
+
+        std::array<const float*, kMaxChannels> frames{};
+        std::array<Complex*, kMaxChannels> spectra{};
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            if (!outputs[ch]->isPrepared()) return;
+            const float* in = inputBuffers_[ch].data();
+            float* frame = windowedFrames_[ch].data();
+            for (size_t i = 0; i < firstPart; ++i) {
+                frame[i] = in[readStart + i] * window_[i];
+            }
+            for (size_t i = firstPart; i < fftSize_; ++i) {
+                frame[i] = in[i - firstPart] * window_[i];
+            }
+            frames[ch] = frame;
+            spectra[ch] = outputs[ch]->data();
+        }
+
+        fft_.forward(frames.data(), spectra.data(), numChannels_);
+        samplesAvailable_ -= hopSize_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Query
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] size_t numChannels() const noexcept { return numChannels_; }
+    [[nodiscard]] size_t fftSize() const noexcept { return fftSize_; }
+    [[nodiscard]] size_t hopSize() const noexcept { return hopSize_; }
+    [[nodiscard]] WindowType windowType() const noexcept { return windowType_; }
+
+    /// @brief Processing latency in samples (equals fftSize)
+    [[nodiscard]] size_t latency() const noexcept { return fftSize_; }
+
+    [[nodiscard]] bool isPrepared() const noexcept { return fftSize_ > 0; }
+
+private:
+    BatchFFT fft_;
+    std::vector<float> window_;
+    std::array<std::vector<float>, kMaxChannels> inputBuffers_;
+    std::array<std::vector<float>, kMaxChannels> windowedFrames_;
+    WindowType windowType_ = WindowType::Hann;
+    size_t numChannels_ = 0;
+    size_t fftSize_ = 0;
+    size_t hopSize_ = 0;
+    size_t writeIndex_ = 0;
+    size_t samplesAvailable_ = 0;
+};
+
+// =============================================================================
+// MultiChannelOverlapAdd Class
+// =============================================================================
+
+/// @brief Overlap-Add synthesis for K channels sharing transforms and hop state
+class MultiChannelOverlapAdd {
+public:
+    static constexpr size_t kMaxChannels = MultiChannelSTFT::kMaxChannels;
+
+    MultiChannelOverlapAdd() noexcept = default;
+    ~MultiChannelOverlapAdd() noexcept = default;
+
+    // Non-copyable, movable
+    MultiChannelOverlapAdd(const MultiChannelOverlapAdd&) = delete;
+    MultiChannelOverlapAdd& operator=(const MultiChannelOverlapAdd&) = delete;
+    MultiChannelOverlapAdd(MultiChannelOverlapAdd&&) noexcept = default;
+    MultiChannelOverlapAdd& operator=(MultiChannelOverlapAdd&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    /// @brief Prepare synthesis processor (parameters as OverlapAdd::prepare)
+    /// @param numChannels Channel count, clamped to [1, kMaxChannels]
+    /// @note NOT real-time safe (allocates memory)
+    void prepare(
+        size_t numChannels,
+        size_t fftSize,
+        size_t hopSize,
+        WindowType window = WindowType::Hann,
+        float kaiserBeta = 9.0f,
+        bool applySynthesisWindow = false
+    ) noexcept {
+        numChannels_ = std::clamp<size_t>(numChannels, 1, kMaxChannels);
+        fftSize_ = fftSize;
+        hopSize_ = hopSize;
+        applySynthesisWindow_ = applySynthesisWindow;
+
+        fft_.prepare(fftSize);
+        synthesisWindow_ = Window::generate(window, fftSize, kaiserBeta);
+
+        // COLA normalization, as in OverlapAdd
+        const size_t numOverlaps = (fftSize + hopSize - 1) / hopSize;
+        float colaSum = 0.0f;
+        for (size_t frame = 0; frame < numOverlaps; ++frame) {
+            const size_t idx = frame * hopSize;
+            if (idx < fftSize) {
+                colaSum += applySynthesisWindow ? synthesisWindow_[idx] * synthesisWindow_[idx]
+                                                : synthesisWindow_[idx];
+            }
+        }
+        colaNormalization_ = (colaSum > 0.0f) ? (1.0f / colaSum) : 1.0f;
+
+        // Fold the normalization into the synthesis gain applied per sample
+        synthesisGain_.resize(fftSize);
+        for (size_t i = 0; i < fftSize; ++i) {
+            synthesisGain_[i] = applySynthesisWindow ? synthesisWindow_[i] * colaNormalization_
+                                                     : colaNormalization_;
+        }
+
+        for (size_t ch = 0; ch < kMaxChannels; ++ch) {
+            const bool used = ch < numChannels_;
+            outputBuffers_[ch].assign(used ? fftSize * 2 : 0, 0.0f);
+            ifftBuffers_[ch].assign(used ? fftSize : 0, 0.0f);
+        }
+
+        samplesReady_ = 0;
+    }
+
+    /// @brief Reset output accumulators
+    /// @note Real-time safe
+    void reset() noexcept {
+        for (auto& buffer : outputBuffers_) std::fill(buffer.begin(), buffer.end(), 0.0f);
+        samplesReady_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Synthesis (Real-Time Safe)
+    // -------------------------------------------------------------------------
+
+    /// @brief Add one IFFT frame per channel to the output accumulators
+    /// @param inputs numChannels() SpectralBuffers to synthesize
+    /// @note Real-time safe, noexcept
+    void synthesize(const SpectralBuffer* const* inputs) noexcept {
+        if (!isPrepared() || inputs == nullptr) return;
+
+        std::array<const Complex*, kMaxChannels> spectra{};
+        std::array<float*, kMaxChannels> frames{};
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            if (!inputs[ch]->isPrepared()) return;
+            spectra[ch] = inputs[ch]->data();
+            frames[ch] = ifftBuffers_[ch].data();
+        }
+
+        fft_.inverse(spectra.data(), frames.data(), numChannels_);
+
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            float* out = outputBuffers_[ch].data();
+            const float* frame = frames[ch];
+            for (size_t i = 0; i < fftSize_; ++i) {
+                out[i] += frame[i] * synthesisGain_[i];
+            }
+        }
+
+        samplesReady_ += hopSize_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Output (Real-Time Safe)
+    // -------------------------------------------------------------------------
+
+    /// @brief Get number of samples available to pull (per channel)
+    [[nodiscard]] size_t samplesAvailable() const noexcept {
+        return samplesReady_;
+    }
+
+    /// @brief Extract output samples from every channel's accumulator
+    /// @param outputs numChannels() destination buffers
+    /// @param numSamples Number of samples to extract per channel
+    /// @pre numSamples <= samplesAvailable()
+    /// @note Real-time safe, noexcept
+    void pullSamples(float* const* outputs, size_t numSamples) noexcept {
+        if (outputs == nullptr || numSamples > samplesReady_) return;
+
+        for (size_t ch = 0; ch < numChannels_; ++ch) {
+            auto& buffer = outputBuffers_[ch];
+            const auto n = static_cast<std::ptrdiff_t>(numSamples);
+            std::copy(buffer.begin(), buffer.begin() + n, outputs[ch]);
+            std::copy(buffer.begin() + n, buffer.end(), buffer.begin());
+            std::fill(buffer.end() - n, buffer.end(), 0.0f);
+        }
+
+        samplesReady_ -= numSamples;
+    }
+
+    // -------------------------------------------------------------------------
+    // Query
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] size_t numChannels() const noexcept { return numChannels_; }
+    [[nodiscard]] size_t fftSize() const noexcept { return fftSize_; }
+    [[nodiscard]] size_t hopSize() const noexcept { return hopSize_; }
+    [[nodiscard]] bool isPrepared() const noexcept { return fftSize_ > 0; }
+
+private:
+    BatchFFT fft_;
+    std::vector<float> synthesisWindow_;
+    std::vector<float> synthesisGain_;  // window (optional) x COLA normalization
+    std::array<std::vector<float>, kMaxChannels> outputBuffers_;
+    std::array<std::vector<float>, kMaxChannels> ifftBuffers_;
+    float colaNormalization_ = 1.0f;
+    bool applySynthesisWindow_ = false;
+    size_t numChannels_ = 0;
+    size_t fftSize_ = 0;
+    size_t hopSize_ = 0;
+    size_t samplesReady_ = 0;
+};
+
 } // namespace DSP
 } // namespace Krate
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/core/fast_math.h>
 #include <krate/dsp/core/math_constants.h>
 
 #include <cmath>
@@ -252,6 +253,18 @@ public:
         }
     }
 
+    /// @brief Use FastMath::fastTan for the cutoff prewarp instead of std::tan.
+    ///
+    /// The approximation is accurate to float precision over the whole
+    /// cutoff range but not bit-identical, so it is opt-in. Worth enabling
+    /// when the cutoff is modulated per sample or per control block across
+    /// many voices. Takes effect on the next setCutoff().
+    ///
+    /// @param enabled true to use the fast approximation
+    void setFastCoefficients(bool enabled) noexcept {
+        fastCoefficients_ = enabled;
+    }
+
     /// @brief Set the gain for peak and shelf modes.
     ///
     /// Ignored for Lowpass, Highpass, Bandpass, Notch, and Allpass modes.
@@ -487,7 +500,8 @@ private:
 
     /// @brief Compute the g coefficient from a cutoff frequency.
     [[nodiscard]] float computeG(float hz) const noexcept {
-        return std::tan(kPi * hz / static_cast<float>(sampleRate_));
+        const float w = kPi * hz / static_cast<float>(sampleRate_);
+        return fastCoefficients_ ? FastMath::fastTan(w) : std::tan(w);
     }
 
     /// @brief Advance the one-pole smoother for g, k, and mix coefficients.
@@ -719,6 +733,7 @@ private:
     float gainDb_ = 0.0f;
     SVFMode mode_ = SVFMode::Lowpass;
     bool prepared_ = false;
+    bool fastCoefficients_ = false;  // fastTan prewarp (setFastCoefficients)
 
     // Coefficients (see data-model.md for derivation)
     float g_ = 0.0f;   // tan(pi * fc / fs)
@@ -0,0 +1,210 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Shared Wavetable Cache
+// ==============================================================================
+// Process-wide, reference-counted store of immutable mipmapped wavetables.
+// Every oscillator that needs a standard waveform (saw, square, triangle) or a
+// harmonic spectrum asks the cache instead of generating its own ~90 KB
+// WavetableData. Identical recipes are generated once (FFT/IFFT) and shared
+// read-only; a table is freed when its last Handle goes away.
+//
+// The cache lives in whichever binary includes this header (one per plugin
+// module), which is the sharing scope that matters: all instances of a plugin
+// in a host process.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (NOT real-time safe -- acquire/release at
+//                 init time only; reading a table through a Handle is)
+// - Principle III: Modern C++ (C++20, RAII handles, value semantics)
+// - Principle IX: Layer 1 (depends on Layer 0: wavetable_data.h;
+//                  Layer 1: wavetable_generator.h)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/wavetable_data.h>
+#include <krate/dsp/primitives/wavetable_generator.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Waveform recipe understood by WavetableCache.
+enum class CachedWaveform : uint8_t {
+    Saw = 0,     ///< generateMipmappedSaw
+    Square,      ///< generateMipmappedSquare
+    Triangle,    ///< generateMipmappedTriangle
+    Harmonics    ///< generateMipmappedFromHarmonics with the given amplitudes
+};
+
+/// @brief Process-wide cache of shared, immutable mipmapped wavetables.
+///
+/// @code
+/// auto sine = WavetableCache::instance().acquireHarmonics(&one, 1);
+/// osc.setWavetable(sine.get());   // valid while `sine` is alive
+/// @endcode
+///
+/// @par Thread Safety
+/// acquire*() and Handle copy/destruction may be called from any thread
+/// (internally locked). Table contents never change after generation, so
+/// any number of threads may read them concurrently.
+class WavetableCache {
+    struct Entry;
+
+public:
+    /// @brief Shared ownership of one cached table. Empty when
+    /// default-constructed or moved from.
+    class Handle {
+    public:
+        Handle() noexcept = default;
+        ~Handle() { reset(); }
+
+        Handle(const Handle& other) noexcept : entry_(other.entry_) {
+            if (entry_ != nullptr) WavetableCache::instance().addRef(entry_);
+        }
+        Handle& operator=(const Handle& other) noexcept {
+            if (this != &other) {
+                Handle copy(other);
+                std::swap(entry_, copy.entry_);
+            }
+            return *this;
+        }
+        Handle(Handle&& other) noexcept : entry_(std::exchange(other.entry_, nullptr)) {}
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                entry_ = std::exchange(other.entry_, nullptr);
+            }
+            return *this;
+        }
+
+        /// @brief The shared table, or nullptr for an empty handle.
+        [[nodiscard]] const WavetableData* get() const noexcept {
+            return entry_ != nullptr ? entry_->data.get() : nullptr;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return entry_ != nullptr; }
+
+        /// @brief Drop this handle's reference (frees the table if last).
+        void reset() noexcept {
+            if (entry_ != nullptr) {
+                WavetableCache::instance().release(entry_);
+                entry_ = nullptr;
+            }
+        }
+
+    private:
+        friend class WavetableCache;
+        Entry* entry_ = nullptr;
+        explicit Handle(Entry* entry) noexcept : entry_(entry) {}
+    };
+
+    /// @brief The process-wide cache.
+    [[nodiscard]] static WavetableCache& instance() noexcept {
+        // Never destroyed: Handles held by other statics may outlive any
+        // destruction order we could pick.
+        static auto* cache = new WavetableCache();
+        return *cache;
+    }
+
+    /// @brief Acquire a standard waveform (Saw, Square or Triangle).
+    /// @note NOT real-time safe (may generate the table)
+    [[nodiscard]] Handle acquire(CachedWaveform waveform) {
+        return acquireImpl(waveform, nullptr, 0);
+    }
+
+    /// @brief Acquire the table for a harmonic spectrum (index 0 =
+    /// fundamental), as generated by generateMipmappedFromHarmonics().
+    /// Recipes compare by exact amplitude values.
+    /// @note NOT real-time safe (may generate the table)
+    [[nodiscard]] Handle acquireHarmonics(const float* harmonicAmplitudes,
+                                          size_t numHarmonics) {
+        if (harmonicAmplitudes == nullptr) numHarmonics = 0;
+        return acquireImpl(CachedWaveform::Harmonics, harmonicAmplitudes, numHarmonics);
+    }
+
+    /// @brief Number of distinct tables currently alive.
+    [[nodiscard]] size_t numTables() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    WavetableCache(const WavetableCache&) = delete;
+    WavetableCache& operator=(const WavetableCache&) = delete;
+
+private:
+    struct Entry {
+        CachedWaveform waveform = CachedWaveform::Saw;
+        std::vector<float> harmonics;
+        std::unique_ptr<WavetableData> data;
+        size_t refCount = 0;
+    };
+
+    WavetableCache() = default;
+
+    Handle acquireImpl(CachedWaveform waveform, const float* harmonics, size_t numHarmonics) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& entry : entries_) {
+            if (matches(*entry, waveform, harmonics, numHarmonics)) {
+                ++entry->refCount;
+                return Handle(entry.get());
+            }
+        }
+
+        // Generate under the lock: concurrent first requests for the same
+        // recipe must not build it twice.
+        auto entry = std::make_unique<Entry>();
+        entry->waveform = waveform;
+        entry->harmonics.assign(harmonics, harmonics + numHarmonics);
+        entry->data = std::make_unique<WavetableData>();
+        switch (waveform) {
+            case CachedWaveform::Saw:      generateMipmappedSaw(*entry->data); break;
+            case CachedWaveform::Square:   generateMipmappedSquare(*entry->data); break;
+            case CachedWaveform::Triangle: generateMipmappedTriangle(*entry->data); break;
+            case CachedWaveform::Harmonics:
+                generateMipmappedFromHarmonics(*entry->data, entry->harmonics.data(),
+                                               entry->harmonics.size());
+                break;
+        }
+        entry->refCount = 1;
+        entries_.push_back(std::move(entry));
+        return Handle(entries_.back().get());
+    }
+
+    [[nodiscard]] static bool matches(const Entry& entry, CachedWaveform waveform,
+                                      const float* harmonics, size_t numHarmonics) noexcept {
+        if (entry.waveform != waveform || entry.harmonics.size() != numHarmonics) return false;
+        for (size_t i = 0; i < numHarmonics; ++i) {
+            if (entry.harmonics[i] != harmonics[i]) return false;
+        }
+        return true;
+    }
+
+    void addRef(Entry* entry) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++entry->refCount;
+    }
+
+    void release(Entry* entry) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--entry->refCount != 0) return;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            if (entries_[i].get() == entry) {
+                entries_[i] = std::move(entries_.back());
+                entries_.pop_back();
+                return;
+            }
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+};
+
+} // namespace DSP
+} // namespace Krate
@@ -6,6 +6,9 @@
 // moving them out has no runtime cost.
 #include <krate/dsp/processors/arpeggiator_core.h>
 
+#include <numeric>
+#include <type_traits>
+
 namespace Krate::DSP {
 
 size_t ArpeggiatorCore::processBlock(const BlockContext& ctx,
@@ -1255,4 +1258,682 @@ void ArpeggiatorCore::fireStep(const BlockContext& ctx,
         }
     }
 
+namespace {
+
+/// Lane steps the seek solver may spend looking for one lane's cycle.
+constexpr size_t kSeekCycleBudget = 4096;
+
+/// Longest condition-lane x Euclidean period the seek solver walks.
+constexpr size_t kSeekConditionPeriodBudget = 8 * kSeekCycleBudget;
+
+/// One lane's per-step advance as fireStep() runs it, length jitter aside.
+/// Position, accumulator and swing phase take finitely many values, so the
+/// motion is eventually periodic (LaneCycle).
+struct LaneMotion {
+    size_t length{1};
+    float speed{1.0f};
+    float swing{0.0f};
+    const std::array<float, 256>* curve{nullptr};  ///< nullptr: curve off
+    float curveDepth{0.0f};
+
+    struct State {
+        size_t position{0};
+        float accum{0.0f};
+        uint64_t advances{0};
+    };
+
+    /// Mirrors advanceLaneBySpeed() float for float.
+    void step(State& s) const noexcept {
+        float laneSpeed = speed;
+        if (curve != nullptr) {
+            const float loopPos = static_cast<float>(s.position)
+                                / std::max(1.0f, static_cast<float>(length));
+            const int tableIdx = std::clamp(static_cast<int>(loopPos * 255.0f), 0, 255);
+            const float offset =
+                ((*curve)[static_cast<size_t>(tableIdx)] - 0.5f) * 2.0f * curveDepth;
+            laneSpeed = std::clamp(laneSpeed * (1.0f + offset), 0.1f, 8.0f);
+        }
+        s.accum += laneSpeed;
+        float threshold = 1.0f;
+        if (swing > 0.0f) {
+            threshold = ((s.advances & 1u) == 0u) ? 1.0f + swing : 1.0f - swing;
+        }
+        while (s.accum >= threshold) {
+            s.accum -= threshold;
+            s.position = (s.position + 1 < length) ? s.position + 1 : 0;
+            ++s.advances;
+            if (swing > 0.0f) {
+                threshold = ((s.advances & 1u) == 0u) ? 1.0f + swing : 1.0f - swing;
+            }
+        }
+    }
+
+    [[nodiscard]] bool samePhase(const State& a, const State& b) const noexcept {
+        return a.position == b.position && a.accum == b.accum &&
+               (swing <= 0.0f || ((a.advances ^ b.advances) & 1u) == 0u);
+    }
+};
+
+/// Steps before a LaneMotion turns periodic (start) and its period (length).
+struct LaneCycle {
+    size_t start{0};
+    size_t length{1};
+    bool found{false};
+};
+
+/// Brent's cycle detection from the reset state, within kSeekCycleBudget
+/// steps. Without a cycle in budget the first kSeekCycleBudget steps stand
+/// in for one (found = false), which is off only by accumulator rounding.
+LaneCycle findLaneCycle(const LaneMotion& motion) noexcept {
+    LaneMotion::State tortoise{};
+    LaneMotion::State hare{};
+    motion.step(hare);
+    size_t power = 1;
+    size_t length = 1;
+    size_t evaluations = 1;
+    while (!motion.samePhase(tortoise, hare)) {
+        if (evaluations >= kSeekCycleBudget) {
+            return LaneCycle{0, kSeekCycleBudget, false};
+        }
+        if (power == length) {
+            tortoise = hare;
+            power *= 2;
+            length = 0;
+        }
+        motion.step(hare);
+        ++length;
+        ++evaluations;
+    }
+
+    LaneMotion::State a{};
+    LaneMotion::State b{};
+    for (size_t i = 0; i < length; ++i) motion.step(b);
+    size_t start = 0;
+    while (!motion.samePhase(a, b)) {
+        motion.step(a);
+        motion.step(b);
+        ++start;
+    }
+    return LaneCycle{start, length, true};
+}
+
+/// LaneMotion state after `steps` steps from the reset state.
+LaneMotion::State laneStateAfter(const LaneMotion& motion, const LaneCycle& cycle,
+                                 uint64_t steps) noexcept {
+    LaneMotion::State s{};
+    if (steps <= cycle.start + cycle.length) {
+        for (uint64_t i = 0; i < steps; ++i) motion.step(s);
+        return s;
+    }
+    for (size_t i = 0; i < cycle.start; ++i) motion.step(s);
+    LaneMotion::State lap = s;
+    for (size_t i = 0; i < cycle.length; ++i) motion.step(lap);
+    const uint64_t laps = (steps - cycle.start) / cycle.length;
+    const uint64_t rest = (steps - cycle.start) % cycle.length;
+    const uint64_t advancesPerLap = lap.advances - s.advances;
+    for (uint64_t i = 0; i < rest; ++i) motion.step(s);
+    s.advances += laps * advancesPerLap;
+    s.position = static_cast<size_t>(s.advances % motion.length);
+    return s;
+}
+
+/// Joint period of the condition lane and the Euclidean pattern.
+size_t conditionPeriod(const LaneCycle& cycle, size_t euclideanSteps) noexcept {
+    return cycle.length / std::gcd(cycle.length, euclideanSteps) * euclideanSteps;
+}
+
+/// Condition-lane wraps (loopCount_) and conditionRng_ draws over a run.
+struct ConditionCounts {
+    uint64_t wraps{0};
+    uint64_t draws{0};
+};
+
+/// Counts over the first `steps` steps. drawsAt(conditionStep, step) says
+/// whether step `step`, reading condition step `conditionStep`, draws.
+template <typename DrawPredicate>
+ConditionCounts countConditionSteps(const LaneMotion& motion, const LaneCycle& cycle,
+                                    size_t euclideanSteps, uint64_t steps,
+                                    DrawPredicate drawsAt) noexcept {
+    const uint64_t period = std::min(conditionPeriod(cycle, euclideanSteps),
+                                     kSeekConditionPeriodBudget);
+    auto walk = [&](LaneMotion::State& s, uint64_t& step, uint64_t count) {
+        ConditionCounts c;
+        for (uint64_t i = 0; i < count; ++i, ++step) {
+            const size_t before = s.position;
+            motion.step(s);
+            if (s.position == 0) ++c.wraps;
+            if (drawsAt(before, step)) ++c.draws;
+        }
+        return c;
+    };
+
+    LaneMotion::State s{};
+    uint64_t step = 0;
+    if (steps <= cycle.start + 2 * period) {
+        return walk(s, step, steps);
+    }
+    ConditionCounts total = walk(s, step, cycle.start);
+    LaneMotion::State lapState = s;
+    uint64_t lapStep = step;
+    const ConditionCounts lap = walk(lapState, lapStep, period);
+    const uint64_t laps = (steps - cycle.start) / period;
+    const ConditionCounts rest = walk(s, step, (steps - cycle.start) % period);
+    total.wraps += laps * lap.wraps + rest.wraps;
+    total.draws += laps * lap.draws + rest.draws;
+    return total;
+}
+
+[[nodiscard]] bool isProbabilityCondition(uint8_t cond) noexcept {
+    switch (static_cast<TrigCondition>(cond)) {
+        case TrigCondition::Prob10:
+        case TrigCondition::Prob25:
+        case TrigCondition::Prob50:
+        case TrigCondition::Prob75:
+        case TrigCondition::Prob90:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// FNV-1a over the bytes of the values fed to it (seekSettingsKey()).
+class SeekKeyHasher {
+public:
+    template <typename T>
+    void add(const T& value) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    template <typename T>
+    void addLane(const ArpLane<T>& lane) noexcept {
+        add(lane.length());
+        for (size_t i = 0; i < lane.length(); ++i) add(lane.getStep(i));
+    }
+
+    [[nodiscard]] uint64_t value() const noexcept { return hash_; }
+
+private:
+    uint64_t hash_{14695981039346656037ull};
+};
+
+}  // namespace
+
+void ArpeggiatorCore::seekTo(double ppq, const BlockContext& ctx) noexcept {
+        // Whatever is sounding now was heard by the host: release it at the
+        // next block start, after the state below has been rebuilt.
+        std::array<uint8_t, kMaxPendingNoteOffs> release{};
+        size_t releaseCount = 0;
+        auto addRelease = [&](uint8_t note) {
+            for (size_t i = 0; i < releaseCount; ++i) {
+                if (release[i] == note) return;
+            }
+            if (releaseCount < release.size()) release[releaseCount++] = note;
+        };
+        for (size_t i = 0; i < currentArpNoteCount_; ++i) addRelease(currentArpNotes_[i]);
+        for (size_t i = 0; i < pendingNoteOffCount_; ++i) addRelease(pendingNoteOffs_[i].note);
+
+        // Requests aimed at the host must survive the silent fast-forward
+        const bool panicRequested = panicRequested_;
+        const bool needsDisableNoteOff = needsDisableNoteOff_;
+        panicRequested_ = false;
+        needsDisableNoteOff_ = false;
+
+        // State at the origin, right after the transport-start step is armed
+        // (the !wasPlaying_ and firstStepPending_ paths of processBlock)
+        restoreSeekOrigin();
+        currentArpNoteCount_ = 0;
+        pendingNoteOffCount_ = 0;
+        transportLoopPending_ = false;
+        selector_.reset();
+        swingStepCounter_ = 0;
+        resetLanes();
+        wasPlaying_ = true;
+        firstStepPending_ = false;
+        currentStepDuration_ = calculateStepDuration(ctx);
+        sampleCounter_ = currentStepDuration_;
+
+        const double tempo = std::clamp(ctx.tempoBPM, kMinTempoBPM, kMaxTempoBPM);
+        const double seconds = std::max(ppq, 0.0) * 60.0 / tempo;
+        const auto targetSample = static_cast<size_t>(std::llround(seconds * ctx.sampleRate));
+
+        // Disabled, or Live mode with nothing held: processBlock would not
+        // have advanced time, so the armed origin state is already exact.
+        const bool advances = enabled_ &&
+            !(heldNotes_.empty() && sourceMode_ != SourceMode::Sequencer);
+        lastSeekReplayedSamples_ = 0;
+        if (advances && targetSample > 0) {
+            fastForward(ctx, targetSample);
+        }
+
+        // Notes started during the fast-forward never reached the host.
+        // Pending ratchet sub-steps are kept: they fall after the seek point.
+        currentArpNoteCount_ = 0;
+        pendingNoteOffCount_ = 0;
+        tieActive_ = false;
+        for (size_t i = 0; i < releaseCount; ++i) {
+            pendingNoteOffs_[pendingNoteOffCount_++] = PendingNoteOff{release[i], 0};
+        }
+        panicRequested_ = panicRequested;
+        needsDisableNoteOff_ = needsDisableNoteOff;
+    }
+
+bool ArpeggiatorCore::isSeekClosedForm() const noexcept {
+        // Bar resets and strum direction draws depend on more than the step index
+        if (retriggerMode_ == ArpRetriggerMode::Beat) return false;
+        if (strumTimeMs_ > 0.0f && strumDirection_ >= 2) return false;
+
+        // Walk/Markov note order depends on the notes it walked through
+        if (sourceMode_ != SourceMode::Sequencer && !selector_.isSkipExact()) return false;
+
+        // Jittered lane lengths draw from one shared generator on each wrap
+        for (size_t i = 0; i < kNumLanes; ++i) {
+            if (laneLengthJitters_[i] != 0) return false;
+        }
+
+        // A ratchet holds its step's duration (fireStep() defers the
+        // recalculation), so under swing it shifts every later step.
+        // Evaluated as fireStep() would, Spice blend included.
+        if (swing_ > 0.0f) {
+            for (size_t step = 0; step < ratchetLane_.length(); ++step) {
+                int count = std::max(1, static_cast<int>(ratchetLane_.getStep(step)));
+                if (spice_ > 0.0f) {
+                    const float blend = static_cast<float>(count) +
+                        (static_cast<float>(ratchetOverlay_[step]) -
+                         static_cast<float>(count)) * spice_;
+                    count = std::clamp(static_cast<int>(std::round(blend)), 1, 4);
+                }
+                if (count > 1) return false;
+            }
+        }
+        return true;
+    }
+
+void ArpeggiatorCore::fastForward(const BlockContext& ctx,
+                                  size_t targetSample) noexcept {
+        const bool seqMode = (sourceMode_ == SourceMode::Sequencer);
+
+        // Step 0 fires at sample 0; the gap before step j is the swung
+        // duration for swing counter j, so gaps alternate short (odd j) and
+        // long (even j): T(2m) = m * (S + L), T(2m + 1) = m * (S + L) + S.
+        const size_t longDuration = currentStepDuration_;
+        swingStepCounter_ = 1;
+        const size_t shortDuration = calculateStepDuration(ctx);
+        swingStepCounter_ = 0;
+        const size_t pairDuration = longDuration + shortDuration;
+        auto stepStart = [&](size_t step) {
+            return (step / 2) * pairDuration + ((step & 1u) != 0u ? shortDuration : 0);
+        };
+
+        // Last step fired strictly before targetSample
+        const size_t lastSample = targetSample - 1;
+        const size_t lastStep = 2 * (lastSample / pairDuration) +
+            ((lastSample % pairDuration) >= shortDuration ? 1 : 0);
+
+        // Lane motions (velocity, gate, pitch, modifier, ratchet, condition,
+        // chord, inversion, MIDI delay, sequencer note)
+        const std::array<size_t, kNumLanes> laneLengths{
+            velocityLane_.length(), gateLane_.length(), pitchLane_.length(),
+            modifierLane_.length(), ratchetLane_.length(), conditionLane_.length(),
+            chordLane_.length(), inversionLane_.length(), midiDelayLane_.length(),
+            seqNoteLane_.length()};
+        const size_t numLanes = seqMode ? kNumLanes : kNumLanes - 1;
+        std::array<LaneMotion, kNumLanes> motions{};
+        std::array<LaneCycle, kNumLanes> cycles{};
+        auto solveLaneCycles = [&] {
+            bool found = true;
+            for (size_t i = 0; i < numLanes; ++i) {
+                LaneMotion& motion = motions[i];
+                motion.length = laneLengths[i];
+                motion.speed = laneSpeedMultipliers_[i];
+                motion.swing = laneSwingAmounts_[i];
+                const float depth = laneSpeedCurveDepths_[i].load(std::memory_order_relaxed);
+                if (laneSpeedCurveEnabled_[i].load(std::memory_order_relaxed) &&
+                    depth > 0.0f) {
+                    motion.curve = &laneSpeedCurveTables_[i];
+                    motion.curveDepth = depth;
+                }
+                cycles[i] = findLaneCycle(motion);
+                found = found && cycles[i].found;
+            }
+            return found;
+        };
+        const bool closedForm = isSeekClosedForm();
+        bool exact = closedForm && solveLaneCycles();
+
+        // Euclidean gating is inert in Sequencer mode
+        const bool euclidean = euclideanEnabled_ && !seqMode;
+        const size_t euclideanSteps = euclidean ? static_cast<size_t>(euclideanSteps_) : 1;
+        exact = exact &&
+            conditionPeriod(cycles[5], euclideanSteps) <= kSeekConditionPeriodBudget;
+
+        // History-dependent settings: replay the playthrough itself, from
+        // the latest checkpoint a previous seek left at or before the target.
+        // Past the replay budget, solve the state kSeekReplayBudgetSteps steps
+        // back as if nothing depended on history and replay only those.
+        size_t anchorStep = lastStep;
+        uint64_t key = 0;
+        if (!exact) {
+            key = seekSettingsKey(ctx);
+            SeekCheckpoint* checkpoint = findSeekCheckpoint(key, targetSample);
+            const size_t fromSample = (checkpoint != nullptr) ? checkpoint->targetSample : 0;
+            if (targetSample - fromSample <= kSeekReplayBudgetSteps / 2 * pairDuration) {
+                if (checkpoint != nullptr) {
+                    checkpoint->lastUsed = ++seekCheckpointClock_;
+                    restoreSeekCheckpoint(*checkpoint);
+                }
+                fastForwardReplay(ctx, fromSample, targetSample);
+                lastSeekReplayedSamples_ = targetSample - fromSample;
+                storeSeekCheckpoint(key, targetSample);
+                return;
+            }
+            if (!closedForm) {
+                (void)solveLaneCycles();
+            }
+            // More than the budget's samples before the target: lastStep
+            // is at least kSeekReplayBudgetSteps
+            anchorStep = lastStep - kSeekReplayBudgetSteps;
+        }
+
+        // Solve the state right before the anchor step (the last one when
+        // exact) and play on from it, which also rebuilds the strum and any
+        // ratchet in flight
+        if (anchorStep > 0) {
+            auto placeLane = [&](auto& lane, size_t laneIdx) {
+                const auto state = laneStateAfter(motions[laneIdx], cycles[laneIdx], anchorStep);
+                lane.setPosition(state.position);
+                laneAccumulators_[laneIdx] = state.accum;
+                laneSwingCounters_[laneIdx] = static_cast<uint8_t>(state.advances);
+                laneLastSteps_[laneIdx] = static_cast<uint8_t>(state.position);
+            };
+            placeLane(velocityLane_,  0);
+            placeLane(gateLane_,      1);
+            placeLane(pitchLane_,     2);
+            placeLane(modifierLane_,  3);
+            placeLane(ratchetLane_,   4);
+            placeLane(conditionLane_, 5);
+            placeLane(chordLane_,     6);
+            placeLane(inversionLane_, 7);
+            placeLane(midiDelayLane_, 8);
+            if (seqMode) {
+                placeLane(seqNoteLane_, 9);
+            }
+
+            // Every step path counts condition-lane wraps; a probability
+            // condition draws once, and only on steps the Euclidean pattern
+            // lets through to it. Condition values are read before the advance.
+            const ConditionCounts counts = countConditionSteps(
+                motions[5], cycles[5], euclideanSteps, anchorStep,
+                [&](size_t conditionStep, uint64_t step) {
+                    if (euclidean && !EuclideanPattern::isHit(euclideanPattern_,
+                            static_cast<int>(step % euclideanSteps), euclideanSteps_)) {
+                        return false;
+                    }
+                    return isProbabilityCondition((spice_ >= 0.5f)
+                        ? conditionOverlay_[conditionStep]
+                        : conditionLane_.getStep(conditionStep));
+                });
+            loopCount_ = static_cast<size_t>(counts.wraps);
+            conditionRng_.discard(counts.draws);
+            if (euclidean) {
+                euclideanPosition_ = anchorStep % euclideanSteps;
+            }
+
+            // Every step path draws three humanize values
+            humanizeRng_.discard(3 * static_cast<uint64_t>(anchorStep));
+            if (!seqMode) {
+                selector_.skip(anchorStep, heldNotes_);
+            }
+            swingStepCounter_ = anchorStep;
+        }
+
+        // The anchor step fires on the first replayed sample
+        currentStepDuration_ = calculateStepDuration(ctx);
+        sampleCounter_ = currentStepDuration_;
+        const size_t anchorSample = stepStart(anchorStep);
+        fastForwardReplay(ctx, anchorSample, targetSample);
+        lastSeekReplayedSamples_ = targetSample - anchorSample;
+        if (!exact) {
+            storeSeekCheckpoint(key, targetSample);
+        }
+    }
+
+void ArpeggiatorCore::fastForwardReplay(const BlockContext& ctx, size_t fromSample,
+                                        size_t toSample) noexcept {
+        BlockContext replay = ctx;
+        replay.isPlaying = true;
+        replay.projectTimeMusicValid = false;
+
+        // Chunks well below one step keep each call far from the event cap,
+        // which would otherwise end a block before all of its time is consumed
+        std::array<ArpEvent, kMaxEvents> scratch{};
+        size_t position = fromSample;
+        while (position < toSample) {
+            const size_t chunk = std::min(toSample - position,
+                std::max(size_t{1}, currentStepDuration_ / 16));
+            replay.blockSize = chunk;
+            replay.transportPositionSamples = static_cast<int64_t>(position);
+            (void)processBlock(replay, scratch);
+            position += chunk;
+        }
+    }
+
+uint64_t ArpeggiatorCore::seekSettingsKey(const BlockContext& ctx) const noexcept {
+        SeekKeyHasher h;
+
+        // Timing and the origin the playthrough starts from
+        h.add(sampleRate_);
+        h.add(ctx.sampleRate);
+        h.add(std::clamp(ctx.tempoBPM, kMinTempoBPM, kMaxTempoBPM));
+        h.add(ctx.samplesPerBar());
+        h.add(seekOrigin_);
+        h.add(tempoSync_);
+        h.add(noteValue_);
+        h.add(noteModifier_);
+        h.add(freeRateHz_);
+        h.add(gateLengthPercent_);
+        h.add(swing_);
+        h.add(retriggerMode_);
+
+        // Note source
+        h.add(enabled_);
+        h.add(sourceMode_);
+        h.add(arpMode_);
+        h.add(heldNotes_.size());
+        for (const HeldNote& held : heldNotes_.byInsertOrder()) {
+            h.add(held.note);
+            h.add(held.velocity);
+        }
+        for (const auto& rest : seqRestFlags_) h.add(rest.load(std::memory_order_relaxed));
+
+        // Lanes and their motion
+        h.addLane(velocityLane_);
+        h.addLane(gateLane_);
+        h.addLane(pitchLane_);
+        h.addLane(modifierLane_);
+        h.addLane(ratchetLane_);
+        h.addLane(conditionLane_);
+        h.addLane(chordLane_);
+        h.addLane(inversionLane_);
+        h.addLane(midiDelayLane_);
+        h.addLane(seqNoteLane_);
+        h.add(laneSpeedMultipliers_);
+        h.add(laneSwingAmounts_);
+        h.add(laneLengthJitters_);
+        for (size_t i = 0; i < kNumLanes; ++i) {
+            const float depth = laneSpeedCurveDepths_[i].load(std::memory_order_relaxed);
+            const bool curve = laneSpeedCurveEnabled_[i].load(std::memory_order_relaxed) &&
+                               depth > 0.0f;
+            h.add(curve);
+            if (curve) {
+                h.add(depth);
+                h.add(laneSpeedCurveTables_[i]);
+            }
+        }
+
+        // Per-step modifiers, ratchets, strum and pitch processing
+        h.add(accentVelocity_);
+        h.add(ratchetSwing_);
+        h.add(ratchetDecay_);
+        h.add(strumTimeMs_);
+        h.add(strumDirection_);
+        h.add(voicingMode_);
+        h.add(velocityCurveType_);
+        h.add(velocityCurveAmount_);
+        h.add(transpose_);
+        h.add(rangeLow_);
+        h.add(rangeHigh_);
+        h.add(rangeMode_);
+        h.add(pinNote_);
+        h.add(pinFlags_);
+        h.add(scaleHarmonizer_.getScale());
+        h.add(scaleHarmonizer_.getKey());
+
+        // Euclidean gating, conditions and Spice/Humanize
+        h.add(euclideanEnabled_);
+        h.add(euclideanHits_);
+        h.add(euclideanSteps_);
+        h.add(euclideanRotation_);
+        h.add(fillActive_);
+        h.add(velocityOverlay_);
+        h.add(gateOverlay_);
+        h.add(ratchetOverlay_);
+        h.add(conditionOverlay_);
+        h.add(spice_);
+        h.add(humanize_);
+        return h.value();
+    }
+
+ArpeggiatorCore::SeekCheckpoint* ArpeggiatorCore::findSeekCheckpoint(
+    uint64_t key, size_t targetSample) noexcept {
+        SeekCheckpoint* best = nullptr;
+        for (SeekCheckpoint& checkpoint : seekCheckpoints_) {
+            if (!checkpoint.valid || checkpoint.key != key ||
+                checkpoint.targetSample > targetSample ||
+                !checkpoint.selector.sameConfig(selector_)) {
+                continue;
+            }
+            if (best == nullptr || checkpoint.targetSample > best->targetSample) {
+                best = &checkpoint;
+            }
+        }
+        return best;
+    }
+
+void ArpeggiatorCore::storeSeekCheckpoint(uint64_t key, size_t targetSample) noexcept {
+        // Same target again, else a free slot, else the least recently used
+        SeekCheckpoint* slot = &seekCheckpoints_[0];
+        for (SeekCheckpoint& checkpoint : seekCheckpoints_) {
+            if (checkpoint.valid && checkpoint.key == key &&
+                checkpoint.targetSample == targetSample) {
+                slot = &checkpoint;
+                break;
+            }
+            if (!checkpoint.valid ||
+                (slot->valid && checkpoint.lastUsed < slot->lastUsed)) {
+                slot = &checkpoint;
+            }
+        }
+
+        SeekCheckpoint& c = *slot;
+        c.valid = true;
+        c.key = key;
+        c.targetSample = targetSample;
+        c.lastUsed = ++seekCheckpointClock_;
+
+        c.sampleCounter = sampleCounter_;
+        c.currentStepDuration = currentStepDuration_;
+        c.swingStepCounter = swingStepCounter_;
+
+        c.lanePositions = {velocityLane_.currentStep(), gateLane_.currentStep(),
+                           pitchLane_.currentStep(), modifierLane_.currentStep(),
+                           ratchetLane_.currentStep(), conditionLane_.currentStep(),
+                           chordLane_.currentStep(), inversionLane_.currentStep(),
+                           midiDelayLane_.currentStep(), seqNoteLane_.currentStep()};
+        c.laneAccumulators = laneAccumulators_;
+        c.laneSwingCounters = laneSwingCounters_;
+        c.lanePendingSkips = lanePendingSkips_;
+        c.laneLastSteps = laneLastSteps_;
+        c.euclideanPosition = euclideanPosition_;
+        c.loopCount = loopCount_;
+        c.tieActive = tieActive_;
+
+        c.selector = selector_;
+        c.condition = conditionRng_.state();
+        c.humanize = humanizeRng_.state();
+        c.lengthJitter = lengthJitterRng_;
+        c.strumRandom = strumRandomState_;
+        c.strumAlternate = strumAlternateCounter_;
+        c.strumOffsets = strumOffsets_;
+
+        c.currentArpNotes = currentArpNotes_;
+        c.currentArpNoteCount = currentArpNoteCount_;
+        c.pendingNoteOffs = pendingNoteOffs_;
+        c.pendingNoteOffCount = pendingNoteOffCount_;
+        c.ratchetSubStepsRemaining = ratchetSubStepsRemaining_;
+        c.ratchetSubStepDurations = ratchetSubStepDurations_;
+        c.ratchetGateDurations = ratchetGateDurations_;
+        c.ratchetSubStepIndex = ratchetSubStepIndex_;
+        c.ratchetTotalSubSteps = ratchetTotalSubSteps_;
+        c.ratchetSubStepCounter = ratchetSubStepCounter_;
+        c.ratchetNote = ratchetNote_;
+        c.ratchetVelocity = ratchetVelocity_;
+        c.ratchetIsLastSubStep = ratchetIsLastSubStep_;
+        c.ratchetNotes = ratchetNotes_;
+        c.ratchetVelocities = ratchetVelocities_;
+        c.ratchetNoteCount = ratchetNoteCount_;
+    }
+
+void ArpeggiatorCore::restoreSeekCheckpoint(const SeekCheckpoint& c) noexcept {
+        sampleCounter_ = c.sampleCounter;
+        currentStepDuration_ = c.currentStepDuration;
+        swingStepCounter_ = c.swingStepCounter;
+
+        velocityLane_.setPosition(c.lanePositions[0]);
+        gateLane_.setPosition(c.lanePositions[1]);
+        pitchLane_.setPosition(c.lanePositions[2]);
+        modifierLane_.setPosition(c.lanePositions[3]);
+        ratchetLane_.setPosition(c.lanePositions[4]);
+        conditionLane_.setPosition(c.lanePositions[5]);
+        chordLane_.setPosition(c.lanePositions[6]);
+        inversionLane_.setPosition(c.lanePositions[7]);
+        midiDelayLane_.setPosition(c.lanePositions[8]);
+        seqNoteLane_.setPosition(c.lanePositions[9]);
+        laneAccumulators_ = c.laneAccumulators;
+        laneSwingCounters_ = c.laneSwingCounters;
+        lanePendingSkips_ = c.lanePendingSkips;
+        laneLastSteps_ = c.laneLastSteps;
+        euclideanPosition_ = c.euclideanPosition;
+        loopCount_ = c.loopCount;
+        tieActive_ = c.tieActive;
+
+        selector_ = c.selector;
+        conditionRng_.seed(c.condition);
+        humanizeRng_.seed(c.humanize);
+        lengthJitterRng_ = c.lengthJitter;
+        strumRandomState_ = c.strumRandom;
+        strumAlternateCounter_ = c.strumAlternate;
+        strumOffsets_ = c.strumOffsets;
+
+        currentArpNotes_ = c.currentArpNotes;
+        currentArpNoteCount_ = c.currentArpNoteCount;
+        pendingNoteOffs_ = c.pendingNoteOffs;
+        pendingNoteOffCount_ = c.pendingNoteOffCount;
+        ratchetSubStepsRemaining_ = c.ratchetSubStepsRemaining;
+        ratchetSubStepDurations_ = c.ratchetSubStepDurations;
+        ratchetGateDurations_ = c.ratchetGateDurations;
+        ratchetSubStepIndex_ = c.ratchetSubStepIndex;
+        ratchetTotalSubSteps_ = c.ratchetTotalSubSteps;
+        ratchetSubStepCounter_ = c.ratchetSubStepCounter;
+        ratchetNote_ = c.ratchetNote;
+        ratchetVelocity_ = c.ratchetVelocity;
+        ratchetIsLastSubStep_ = c.ratchetIsLastSubStep;
+        ratchetNotes_ = c.ratchetNotes;
+        ratchetVelocities_ = c.ratchetVelocities;
+        ratchetNoteCount_ = c.ratchetNoteCount;
+    }
+
 }  // namespace Krate::DSP
@@ -233,6 +233,10 @@ public:
             seqRestFlags_[i].store(1, std::memory_order_relaxed);
         }
         seqNoteLane_.setLength(16);
+
+        // seekTo() replays from the construction-time generator states until
+        // the first reset()
+        captureSeekOrigin();
     }
 
     // =========================================================================
@@ -266,6 +270,7 @@ public:
         heldNotes_.clear();
         resetLanes();
         regenerateEuclideanPattern();  // 075-euclidean-timing: regenerate from current params (FR-014)
+        captureSeekOrigin();
     }
 
     // =========================================================================
@@ -996,6 +1001,68 @@ public:
             : newSampleCounter;
     }
 
+    /// @brief Rebuild the state a linear playthrough would have at a host
+    /// position (loop wrap, scrub, offline bounce starting mid-song).
+    ///
+    /// "Linear playthrough" means: transport started at PPQ 0 right after the
+    /// last reset()/prepare(), with the current settings and held notes, and
+    /// played uninterrupted up to @p ppq. Lane phases, Euclidean position,
+    /// condition loop count, swing phase and every PRNG (conditions, humanize,
+    /// note selector, length jitter, strum) land where that playthrough would
+    /// leave them, so the following steps match it exactly.
+    ///
+    /// No NoteOn is emitted for steps that started before @p ppq. Notes
+    /// sounding when seekTo() is called are released at offset 0 of the next
+    /// processBlock().
+    ///
+    /// Cost: the state right before the last step that started ahead of
+    /// @p ppq is solved, then that one step is played silently through
+    /// processBlock(). Lane phases come from each lane's motion cycle (speed,
+    /// speed curve and per-lane swing make it periodic), the condition loop
+    /// count and probability draws from one period of the condition lane
+    /// against the Euclidean pattern, the generators from
+    /// Xorshift32::discard() and the note order from NoteSelector::skip().
+    /// None of it depends on how far into the song @p ppq is.
+    ///
+    /// History-dependent state: Beat retrigger, length jitter, random/alternate
+    /// strum, Walk/Markov note order, ratchets under swing, and lane cycles
+    /// longer than the solver's budget depend on every step before @p ppq.
+    /// For those the playthrough itself is replayed through processBlock()
+    /// with its events discarded. Each such seek keeps a checkpoint of the
+    /// full playback state at its target (the kSeekCheckpoints most recent,
+    /// keyed by the settings, held notes and tempo they were replayed with),
+    /// and a later seek replays only from the latest matching checkpoint at or
+    /// before its target. Every pass of a DAW loop after the first restores
+    /// the loop-start checkpoint and replays nothing; a forward scrub replays
+    /// only the distance moved.
+    ///
+    /// The replay is capped at kSeekReplayBudgetSteps steps, so no seek costs
+    /// more than that wherever the song is. Past the cap the state that many
+    /// steps before @p ppq is solved as if nothing depended on history, and
+    /// only those steps are replayed. The result plays the right settings on
+    /// the step grid, but its random draws and history-driven state are an
+    /// approximation of the playthrough, not the playthrough itself. The
+    /// landing is stored as a checkpoint, so later loop passes repeat it.
+    ///
+    /// Call while the transport is playing, before processBlock().
+    /// @param ppq Target position in quarter notes (clamped to >= 0)
+    /// @param ctx Block context supplying tempo and sample rate
+    void seekTo(double ppq, const BlockContext& ctx) noexcept;
+
+    /// @brief Samples the last seekTo() played through processBlock(): at
+    /// most one step when the state was solved exactly; for history-dependent
+    /// settings, the distance from PPQ 0 or from the checkpoint it resumed,
+    /// capped at about kSeekReplayBudgetSteps steps.
+    [[nodiscard]] size_t lastSeekReplayedSamples() const noexcept {
+        return lastSeekReplayedSamples_;
+    }
+
+    /// Checkpoints kept for history-dependent seeks (see seekTo()).
+    static constexpr size_t kSeekCheckpoints = 4;
+
+    /// Most steps a history-dependent seek replays (see seekTo()).
+    static constexpr size_t kSeekReplayBudgetSteps = 64;
+
     // =========================================================================
     // Processing (FR-019 through FR-024)
     // =========================================================================
@@ -1021,6 +1088,70 @@ private:
         size_t samplesRemaining{0};
     };
 
+    /// @brief Generator states a linear playthrough starts from (seekTo()).
+    struct SeekOrigin {
+        uint32_t condition{0};
+        uint32_t humanize{0};
+        uint32_t selector{0};
+        uint32_t lengthJitter{0};
+        uint32_t strumRandom{0};
+        uint32_t strumAlternate{0};
+    };
+
+    /// @brief Full playback state at one history-dependent seek target, so
+    /// later seeks resume the replay there instead of at PPQ 0 (seekTo()).
+    struct SeekCheckpoint {
+        // Key: settings fingerprint (seekSettingsKey()) and the selector,
+        // whose configuration is compared directly
+        bool valid{false};
+        uint64_t key{0};
+        size_t targetSample{0};
+        uint64_t lastUsed{0};
+
+        // Step clock
+        size_t sampleCounter{0};
+        size_t currentStepDuration{0};
+        size_t swingStepCounter{0};
+
+        // Lanes (velocity, gate, pitch, modifier, ratchet, condition, chord,
+        // inversion, MIDI delay, sequencer note)
+        std::array<size_t, kNumLanes> lanePositions{};
+        std::array<float, kNumLanes> laneAccumulators{};
+        std::array<uint8_t, kNumLanes> laneSwingCounters{};
+        std::array<int8_t, kNumLanes> lanePendingSkips{};
+        std::array<uint8_t, kNumLanes> laneLastSteps{};
+        size_t euclideanPosition{0};
+        size_t loopCount{0};
+        bool tieActive{false};
+
+        // Generators
+        NoteSelector selector{};
+        uint32_t condition{0};
+        uint32_t humanize{0};
+        uint32_t lengthJitter{0};
+        uint32_t strumRandom{0};
+        uint32_t strumAlternate{0};
+        std::array<int32_t, 32> strumOffsets{};
+
+        // Notes and ratchet sub-steps in flight
+        std::array<uint8_t, 32> currentArpNotes{};
+        size_t currentArpNoteCount{0};
+        std::array<PendingNoteOff, kMaxPendingNoteOffs> pendingNoteOffs{};
+        size_t pendingNoteOffCount{0};
+        uint8_t ratchetSubStepsRemaining{0};
+        std::array<size_t, 4> ratchetSubStepDurations{};
+        std::array<size_t, 4> ratchetGateDurations{};
+        uint8_t ratchetSubStepIndex{0};
+        uint8_t ratchetTotalSubSteps{0};
+        size_t ratchetSubStepCounter{0};
+        uint8_t ratchetNote{0};
+        uint8_t ratchetVelocity{0};
+        bool ratchetIsLastSubStep{false};
+        std::array<uint8_t, 32> ratchetNotes{};
+        std::array<uint8_t, 32> ratchetVelocities{};
+        size_t ratchetNoteCount{0};
+    };
+
     // =========================================================================
     // Internal Methods
     // =========================================================================
@@ -1462,6 +1593,54 @@ private:
             euclideanHits_, euclideanSteps_, euclideanRotation_);
     }
 
+    // =========================================================================
+    // Seek Support
+    // =========================================================================
+
+    void captureSeekOrigin() noexcept {
+        seekOrigin_.condition = conditionRng_.state();
+        seekOrigin_.humanize = humanizeRng_.state();
+        seekOrigin_.selector = selector_.randomState();
+        seekOrigin_.lengthJitter = lengthJitterRng_;
+        seekOrigin_.strumRandom = strumRandomState_;
+        seekOrigin_.strumAlternate = strumAlternateCounter_;
+    }
+
+    void restoreSeekOrigin() noexcept {
+        conditionRng_.seed(seekOrigin_.condition);
+        humanizeRng_.seed(seekOrigin_.humanize);
+        selector_.setRandomState(seekOrigin_.selector);
+        lengthJitterRng_ = seekOrigin_.lengthJitter;
+        strumRandomState_ = seekOrigin_.strumRandom;
+        strumAlternateCounter_ = seekOrigin_.strumAlternate;
+    }
+
+    /// @brief True when no history-dependent feature is in play, so the
+    /// seek solver is exact (lane cycles aside, see seekTo()).
+    [[nodiscard]] bool isSeekClosedForm() const noexcept;
+
+    /// @brief Fast-forward from the armed origin to targetSample (seekTo()).
+    void fastForward(const BlockContext& ctx, size_t targetSample) noexcept;
+
+    /// @brief Play [fromSample, toSample) through processBlock() silently.
+    void fastForwardReplay(const BlockContext& ctx, size_t fromSample,
+                           size_t toSample) noexcept;
+
+    /// @brief Fingerprint of everything a replay from PPQ 0 depends on,
+    /// apart from the selector configuration (see SeekCheckpoint).
+    [[nodiscard]] uint64_t seekSettingsKey(const BlockContext& ctx) const noexcept;
+
+    /// @brief Latest checkpoint for @p key at or before targetSample, or null.
+    [[nodiscard]] SeekCheckpoint* findSeekCheckpoint(uint64_t key,
+                                                     size_t targetSample) noexcept;
+
+    /// @brief Record the current playback state as the checkpoint for
+    /// targetSample, replacing the least recently used one.
+    void storeSeekCheckpoint(uint64_t key, size_t targetSample) noexcept;
+
+    /// @brief Restore the playback state from a checkpoint.
+    void restoreSeekCheckpoint(const SeekCheckpoint& checkpoint) noexcept;
+
     // =========================================================================
     // Lane Reset (072-independent-lanes)
     // =========================================================================
@@ -1685,6 +1864,10 @@ private:
     bool wasPlaying_ = false;
     bool firstStepPending_ = true;
     bool transportLoopPending_ = false;
+    SeekOrigin seekOrigin_;  ///< Generator states at the last reset()
+    size_t lastSeekReplayedSamples_ = 0;  ///< See lastSeekReplayedSamples()
+    std::array<SeekCheckpoint, kSeekCheckpoints> seekCheckpoints_{};  ///< See seekTo()
+    uint64_t seekCheckpointClock_ = 0;    ///< Use order for checkpoint replacement
 
     // =========================================================================
     // Latch State
@@ -275,6 +275,10 @@ public:
     [[nodiscard]] bool isActive() const noexcept { return active_; }
     [[nodiscard]] bool isPrepared() const noexcept { return prepared_; }
 
+    /// @brief Heap memory held by this exciter, in bytes (the rosin LFO's
+    /// wavetables are shared process-wide, so currently 0).
+    [[nodiscard]] size_t heapBytes() const noexcept { return rosinLfo_.heapBytes(); }
+
 private:
     /// @brief Core friction junction computation (steps 1-7).
     /// @param feedbackVelocity Resonator feedback velocity
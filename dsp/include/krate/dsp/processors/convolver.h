@@ -0,0 +1,230 @@
+// ==============================================================================
+// Layer 2: DSP Processor - Stereo Convolver
+// ==============================================================================
+// Zero-latency stereo convolution with glitch-free impulse response swaps.
+//
+// Two PartitionedConvolver engines alternate: a new IR is loaded into the idle
+// engine off the audio thread, then the audio thread crossfades the *input*
+// from the active engine to it and sums both outputs. Crossfading the outputs
+// instead would click: the incoming engine starts with empty history, so each
+// of its taps would switch on abruptly as the history fills. With an input
+// fade every tap ramps in (and the old IR's tail rings out) smoothly, at the
+// cost of running both engines until the old tail has drained.
+//
+// Swap protocol (lock-free, one loader thread + the audio thread):
+//   loader:  swapPending_ == false -> build idle engine -> swapPending_ = true
+//   audio:   sees swapPending_ -> fade input -> drain old tail
+//            -> flip active_ -> swapPending_ = false
+// The loader never touches an engine the audio thread is processing, and the
+// audio thread only starts processing the idle engine after the release store
+// of swapPending_ has published it.
+//
+// Output is the wet signal only; mixing with the dry path is up to the caller.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (process() is noexcept and allocation-free)
+// - Principle III: Modern C++ (C++20 atomics, RAII)
+// - Principle IX: Layer 2 (depends on Layer 0/1 only)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/crossfade_utils.h>
+#include <krate/dsp/primitives/partitioned_convolver.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Stereo convolution processor with crossfaded IR replacement.
+///
+/// @code
+/// Convolver conv;
+/// conv.prepare(48000.0, 512);
+/// conv.loadImpulseResponse(irL, irR, irLength);   // loader thread
+/// conv.process(left, right, numSamples);           // audio thread, in place
+/// @endcode
+class Convolver {
+public:
+    static constexpr float kDefaultCrossfadeMs = 30.0f;
+
+    Convolver() noexcept = default;
+
+    Convolver(const Convolver&) = delete;
+    Convolver& operator=(const Convolver&) = delete;
+    Convolver(Convolver&&) = delete;
+    Convolver& operator=(Convolver&&) = delete;
+
+    // =========================================================================
+    // Setup (NOT real-time safe)
+    // =========================================================================
+
+    /// @brief Size scratch buffers and the crossfade for the host settings.
+    void prepare(double sampleRate, size_t maxBlockSize) {
+        sampleRate_ = sampleRate;
+        maxBlockSize_ = std::max<size_t>(maxBlockSize, 1);
+        for (auto& buf : scratch_) buf.assign(maxBlockSize_, 0.0f);
+        fadeIncrement_ = crossfadeIncrement(crossfadeMs_, sampleRate_);
+    }
+
+    /// @brief Crossfade length used by IR swaps.
+    void setCrossfadeTime(float ms) noexcept {
+        crossfadeMs_ = std::max(ms, 0.0f);
+        fadeIncrement_ = crossfadeIncrement(crossfadeMs_, sampleRate_);
+    }
+
+    /// @brief Partitioning used by subsequent loads.
+    void setOptions(const PartitionedConvolver::Options& options) noexcept {
+        options_ = options;
+    }
+
+    /// @brief Queue a new stereo IR; the audio thread fades over to it.
+    /// @param left   Left-channel IR
+    /// @param right  Right-channel IR, or nullptr to use `left` for both
+    /// @param length IR length in samples (0 fades to silence)
+    /// @return false if the previous swap (fade plus old tail) has not
+    ///         finished yet (try again later) or the IR is invalid
+    /// @note Allocates. Call from one loader thread at a time.
+    bool loadImpulseResponse(const float* left, const float* right, size_t length) {
+        if (swapPending_.load(std::memory_order_acquire)) return false;
+
+        const int idle = 1 - active_.load(std::memory_order_acquire);
+        const float* channels[] = {left, right != nullptr ? right : left};
+        if (!engines_[static_cast<size_t>(idle)].setImpulseResponse(channels, 2, length,
+                                                                    options_)) {
+            return false;
+        }
+        swapPending_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Clear all signal history in both engines.
+    /// @note Must not overlap process() or loadImpulseResponse().
+    void reset() noexcept {
+        for (auto& engine : engines_) engine.reset();
+        swapping_ = false;
+        fadePosition_ = 0.0f;
+        drainRemaining_ = 0;
+    }
+
+    // =========================================================================
+    // Processing (real-time safe)
+    // =========================================================================
+
+    /// @brief Replace left/right with the convolved (wet) signal.
+    /// @note IR swaps only start once prepare() has sized the fade buffers.
+    void process(float* left, float* right, size_t numSamples) noexcept {
+        if (!swapping_ && !scratch_[0].empty() &&
+            swapPending_.load(std::memory_order_acquire)) {
+            swapping_ = true;
+            fadePosition_ = 0.0f;
+            const auto active = static_cast<size_t>(active_.load(std::memory_order_relaxed));
+            drainRemaining_ = engines_[active].irLength();
+        }
+
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t len = std::min(numSamples - done, maxBlockSize_);
+            processChunk(left + done, right + done, len);
+            done += len;
+        }
+    }
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    /// True from a successful load until the old IR has fully drained.
+    [[nodiscard]] bool isSwapPending() const noexcept {
+        return swapPending_.load(std::memory_order_acquire);
+    }
+
+    /// IR length of the active engine (the outgoing one until a swap completes).
+    [[nodiscard]] size_t irLength() const noexcept {
+        return engines_[static_cast<size_t>(active_.load(std::memory_order_acquire))].irLength();
+    }
+
+    [[nodiscard]] static constexpr size_t latency() noexcept {
+        return PartitionedConvolver::latency();
+    }
+
+private:
+    static void runEngine(PartitionedConvolver& engine, float* left, float* right,
+                          size_t n) noexcept {
+        if (engine.numChannels() == 0) {
+            std::memset(left, 0, n * sizeof(float));
+            std::memset(right, 0, n * sizeof(float));
+            return;
+        }
+        const float* in[] = {left, right};
+        float* out[] = {left, right};
+        engine.process(in, out, n);
+    }
+
+    void processChunk(float* left, float* right, size_t n) noexcept {
+        const int active = active_.load(std::memory_order_relaxed);
+        auto& current = engines_[static_cast<size_t>(active)];
+
+        if (!swapping_) {
+            runEngine(current, left, right, n);
+            return;
+        }
+
+        // Incoming engine input: x * g; outgoing engine input: x * (1 - g)
+        auto& incoming = engines_[static_cast<size_t>(1 - active)];
+        float* newLeft = scratch_[0].data();
+        float* newRight = scratch_[1].data();
+        if (fadePosition_ < 1.0f) {
+            for (size_t i = 0; i < n; ++i) {
+                fadePosition_ = std::min(fadePosition_ + fadeIncrement_, 1.0f);
+                newLeft[i] = left[i] * fadePosition_;
+                newRight[i] = right[i] * fadePosition_;
+                left[i] -= newLeft[i];
+                right[i] -= newRight[i];
+            }
+        } else {
+            std::memcpy(newLeft, left, n * sizeof(float));
+            std::memcpy(newRight, right, n * sizeof(float));
+            std::memset(left, 0, n * sizeof(float));
+            std::memset(right, 0, n * sizeof(float));
+            drainRemaining_ -= std::min(drainRemaining_, n);
+        }
+
+        runEngine(current, left, right, n);
+        runEngine(incoming, newLeft, newRight, n);
+        for (size_t i = 0; i < n; ++i) {
+            left[i] += newLeft[i];
+            right[i] += newRight[i];
+        }
+
+        if (fadePosition_ >= 1.0f && drainRemaining_ == 0) {
+            // The outgoing engine is rebuilt by the next load, never reset here
+            swapping_ = false;
+            active_.store(1 - active, std::memory_order_release);
+            swapPending_.store(false, std::memory_order_release);
+        }
+    }
+
+    std::array<PartitionedConvolver, 2> engines_;
+    std::array<std::vector<float>, 2> scratch_;
+    PartitionedConvolver::Options options_{};
+
+    std::atomic<int> active_{0};
+    std::atomic<bool> swapPending_{false};
+    bool swapping_ = false;
+    float fadePosition_ = 0.0f;
+    size_t drainRemaining_ = 0;
+    float fadeIncrement_ = 1.0f;
+    float crossfadeMs_ = kDefaultCrossfadeMs;
+    double sampleRate_ = 44100.0;
+    size_t maxBlockSize_ = 512;
+};
+
+}  // namespace DSP
+}  // namespace Krate
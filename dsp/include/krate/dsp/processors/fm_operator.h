@@ -18,7 +18,7 @@
 #pragma once
 
 #include <krate/dsp/primitives/wavetable_oscillator.h>
-#include <krate/dsp/primitives/wavetable_generator.h>
+#include <krate/dsp/primitives/wavetable_cache.h>
 #include <krate/dsp/core/wavetable_data.h>
 #include <krate/dsp/core/fast_math.h>
 #include <krate/dsp/core/db_utils.h>
@@ -48,8 +48,8 @@ namespace DSP {
 /// - Level-controlled output with raw output access for modulator use
 ///
 /// @par Memory Model
-/// Owns an internal WavetableData (~90 KB) for the sine wavetable.
-/// Each FMOperator instance is self-contained.
+/// All operators read one shared, immutable sine WavetableData (~90 KB)
+/// from WavetableCache. An operator holds only a handle and oscillator state.
 ///
 /// @par Thread Safety
 /// Single-threaded model. All methods must be called from the same thread.
@@ -101,30 +101,57 @@ public:
 
     /// @brief Initialize the operator for the given sample rate (FR-002).
     ///
-    /// Generates the internal sine wavetable and initializes the oscillator.
-    /// All internal state is reset.
+    /// Binds the shared sine wavetable (generating it on first use) and
+    /// initializes the oscillator. All internal state is reset.
     ///
     /// @param sampleRate Sample rate in Hz (must be > 0)
     ///
-    /// @note NOT real-time safe (allocates internally via FFT for wavetable)
+    /// @note NOT real-time safe (the first call generates the table via FFT)
     /// @note Calling prepare() multiple times is safe; state is fully reset
     void prepare(double sampleRate) noexcept {
         sampleRate_ = sampleRate;
 
-        // Generate sine wavetable (FR-015)
-        // Single harmonic at amplitude 1.0 produces a pure sine wave
-        const float harmonics[] = {1.0f};
-        generateMipmappedFromHarmonics(sineTable_, harmonics, 1);
-
-        // Configure oscillator
+        // Configure oscillator on the shared sine wavetable (FR-015)
         osc_.prepare(sampleRate);
-        osc_.setWavetable(&sineTable_);
+        if (!sineTable_) {
+            sineTable_ = acquireSineTable();
+        }
+        osc_.setWavetable(sineTable_.get());
 
         // Reset state
         previousRawOutput_ = 0.0f;
         prepared_ = true;
     }
 
+    /// @brief Initialize the operator on a sine table pinned by the caller.
+    ///
+    /// Same as prepare(double) but reads @p sineTable (from acquireSineTable())
+    /// instead of taking a handle of its own, so it never touches the cache:
+    /// an owner that swaps operators in on the audio thread pins the table
+    /// once and re-prepares without locking or allocating. Any handle this
+    /// operator held is kept; the caller must keep @p sineTable alive.
+    ///
+    /// @param sampleRate Sample rate in Hz (must be > 0)
+    /// @param sineTable Table from acquireSineTable(); nullptr leaves the
+    ///        operator silent
+    ///
+    /// @note Real-time safe
+    void prepare(double sampleRate, const WavetableData* sineTable) noexcept {
+        sampleRate_ = sampleRate;
+        osc_.prepare(sampleRate);
+        osc_.setWavetable(sineTable);
+        previousRawOutput_ = 0.0f;
+        prepared_ = true;
+    }
+
+    /// @brief Acquire the shared sine table that prepare(double) binds.
+    /// @note NOT real-time safe (locks the cache; the first call generates it)
+    [[nodiscard]] static WavetableCache::Handle acquireSineTable() {
+        // Single harmonic at amplitude 1.0 produces a pure sine wave
+        const float harmonics[] = {1.0f};
+        return WavetableCache::instance().acquireHarmonics(harmonics, 1);
+    }
+
     /// @brief Reset phase and feedback history, preserving configuration (FR-003).
     ///
     /// After reset():
@@ -358,8 +385,8 @@ private:
     // Internal state (reset on reset())
     float previousRawOutput_ = 0.0f;  ///< Last raw output for feedback
 
-    // Resources (regenerated on prepare())
-    WavetableData sineTable_;         ///< Mipmapped sine wavetable
+    // Resources (re-bound on prepare())
+    WavetableCache::Handle sineTable_; ///< Shared mipmapped sine table
     WavetableOscillator osc_;         ///< Internal oscillator engine
 
     // Lifecycle state
@@ -16,7 +16,10 @@
 #include <krate/dsp/primitives/delay_line.h>
 #include <krate/dsp/primitives/grain_pool.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -149,6 +152,75 @@ public:
         return {outputL, outputR};
     }
 
+    /// Render a grain across a block whose input has already been written to
+    /// the delay buffers, accumulating into the output buffers.
+    /// Matches calling processGrain() once per sample with the write head
+    /// moving along (amplitude and pan are folded into one gain, so results
+    /// agree to float rounding); stops early when the grain completes.
+    /// @param grain Grain state to process
+    /// @param delayBufferL Left channel delay buffer
+    /// @param delayBufferR Right channel delay buffer
+    /// @param outputL Left accumulation buffer (numSamples long)
+    /// @param outputR Right accumulation buffer (numSamples long)
+    /// @param numSamples Samples to render
+    /// @param writesAfterFirst Writes made after the one belonging to the
+    ///        first sample (see DelayLine::readLinearBehind()). Samples past
+    ///        the last write (frozen input) all read from the final write.
+    /// @return Number of samples rendered (< numSamples if the grain completed)
+    size_t processGrainBlock(Grain& grain,
+                             const DelayLine& delayBufferL,
+                             const DelayLine& delayBufferR,
+                             float* outputL, float* outputR,
+                             size_t numSamples,
+                             size_t writesAfterFirst) noexcept {
+        if (!grain.active || envelopeTable_.empty()) {
+            return 0;
+        }
+
+        // Grain state in locals so the loop stays in registers
+        const float* table = envelopeTable_.data();
+        const auto lastEntry = static_cast<uint32_t>(envelopeTableSize_ - 1);
+        const float tableScale = static_cast<float>(lastEntry);
+        const float envelopeIncrement = grain.envelopeIncrement;
+        const float step = std::abs(grain.playbackRate);
+        const float gainL = grain.amplitude * grain.panL;
+        const float gainR = grain.amplitude * grain.panR;
+        float phase = grain.envelopePhase;
+        float position = grain.readPosition;
+
+        size_t rendered = 0;
+        while (rendered < numSamples) {
+            // GrainEnvelope::lookup() with 32-bit indexing (phase is in [0, 1])
+            const float envelopeIndex = std::clamp(phase, 0.0f, 1.0f) * tableScale;
+            const auto e0 = static_cast<uint32_t>(envelopeIndex);
+            const uint32_t e1 = std::min(e0 + 1, lastEntry);
+            const float envelope =
+                table[e0] + (envelopeIndex - static_cast<float>(e0)) * (table[e1] - table[e0]);
+
+            const float delaySamples = std::max(0.0f, position);
+            const size_t writesAgo =
+                (writesAfterFirst > rendered) ? writesAfterFirst - rendered : 0;
+            float sampleL = 0.0f;
+            float sampleR = 0.0f;
+            DelayLine::readLinearBehindStereo(delayBufferL, delayBufferR, writesAgo,
+                                              delaySamples, sampleL, sampleR);
+
+            outputL[rendered] += sampleL * envelope * gainL;
+            outputR[rendered] += sampleR * envelope * gainR;
+
+            phase += envelopeIncrement;
+            position += step;
+            ++rendered;
+            if (phase >= 1.0f) {
+                break;
+            }
+        }
+
+        grain.envelopePhase = phase;
+        grain.readPosition = position;
+        return rendered;
+    }
+
     /// Check if grain has completed playback
     /// @param grain Grain to check
     /// @return true if grain envelope has completed
@@ -32,6 +32,9 @@ namespace DSP {
 
 class ImpactExciter {
 public:
+    /// Default comb filter capacity: 55 ms covers position 1.0 down to ~18 Hz.
+    static constexpr float kDefaultMaxCombDelaySeconds = 0.055f;
+
     ImpactExciter() noexcept = default;
     ~ImpactExciter() = default;
 
@@ -49,7 +52,11 @@ public:
     /// Must be called before trigger() or process().
     /// @param sampleRate Sample rate in Hz
     /// @param voiceId Unique voice identifier for RNG seeding
-    void prepare(double sampleRate, uint32_t voiceId) noexcept
+    /// @param maxCombDelaySeconds Longest strike-position comb delay. 0 skips
+    ///        the comb buffer entirely (for callers that always trigger with
+    ///        position = 0), making prepare() allocation-free.
+    void prepare(double sampleRate, uint32_t voiceId,
+                 float maxCombDelaySeconds = kDefaultMaxCombDelaySeconds) noexcept
     {
         sampleRate_ = sampleRate;
 
@@ -62,8 +69,11 @@ public:
         svf_.setCutoff(1000.0f);
         svf_.snapToTarget();
 
-        // Prepare comb filter delay line (55ms max at given sample rate)
-        combDelay_.prepare(sampleRate, 0.055f);
+        // Prepare comb filter delay line (55ms max by default)
+        maxCombDelaySamples_ = static_cast<int>(
+            maxCombDelaySeconds * static_cast<float>(sampleRate)) - 1;
+        if (maxCombDelaySamples_ > 0)
+            combDelay_.prepare(sampleRate, maxCombDelaySeconds);
 
         // Compute energy decay coefficient: decay = exp(-1 / (tau * sampleRate))
         // tau = 5ms = 0.005s
@@ -180,12 +190,11 @@ public:
 
         // -- Strike position comb filter --
         // FR-022: combDelay = floor(position * sampleRate / f0)
-        if (f0 > 0.0f && position > 0.0f) {
+        if (f0 > 0.0f && position > 0.0f && maxCombDelaySamples_ > 0) {
             float periodSamples = static_cast<float>(sampleRate_) / f0;
             combDelaySamples_ = static_cast<int>(std::floor(position * periodSamples));
             // Clamp to delay line maximum
-            int maxDelay = static_cast<int>(0.055f * static_cast<float>(sampleRate_)) - 1;
-            combDelaySamples_ = std::clamp(combDelaySamples_, 0, maxDelay);
+            combDelaySamples_ = std::clamp(combDelaySamples_, 0, maxCombDelaySamples_);
         } else {
             combDelaySamples_ = 0;
         }
@@ -357,6 +366,7 @@ private:
     // -- Strike position comb filter --
     DelayLine combDelay_;
     int combDelaySamples_ = 0;
+    int maxCombDelaySamples_ = 0;
     float combWet_ = 0.7f;
 
     // -- Energy capping (FR-034) --
@@ -351,32 +351,29 @@ public:
     /// Process a block of samples.
     /// Smooths coefficients once at block start (block-rate smoothing is
     /// sufficient for coefficient updates and saves ~9 FLOPs/mode/sample).
-    /// Uses SIMD-accelerated mode loop via Highway dynamic dispatch.
+    /// Uses the time-blocked SIMD kernel (mode state held in registers across
+    /// the block) over the compacted set of live modes.
     void processBlock(const float* input, float* output, int numSamples) noexcept
     {
-        smoothCoefficients();
-        for (int i = 0; i < numSamples; ++i) {
-            float ex = applyTransientEmphasis(input[i]);
-
-            // SIMD-accelerated mode loop (processes all modes for one sample)
-            float modeSum = processModalBankSampleSIMD(
-                sinState_, cosState_, epsilon_, radius_, inputGain_,
-                ex, numModes_);
-
-            output[i] = applyOutputStage(modeSum);
-        }
-        flushSilentModes();
+        processBlockSIMD(input, output, numSamples, 1.0f);
     }
 
     /// Process a block of samples with decay scaling (mallet choke).
+    /// Radii are block-constant, so pow(R, decayScale) is taken once per mode
+    /// per block and the block runs through the same SIMD kernel. Bowed-mode
+    /// taps need per-mode injection and stay on the scalar path.
     void processBlock(const float* input, float* output, int numSamples,
                       float decayScale) noexcept
     {
-        smoothCoefficients();
-        for (int i = 0; i < numSamples; ++i) {
-            output[i] = processSampleCore(input[i], decayScale);
+        if (bowModeActive_) {
+            smoothCoefficients();
+            for (int i = 0; i < numSamples; ++i) {
+                output[i] = processSampleCore(input[i], decayScale);
+            }
+            flushSilentModes();
+            return;
         }
-        flushSilentModes();
+        processBlockSIMD(input, output, numSamples, decayScale);
     }
 
     /// Check mode energy and zero out states below silence threshold (FR-027).
@@ -588,6 +585,16 @@ private:
     alignas(32) float inputGainTarget_[kMaxModes]{};
     bool active_[kMaxModes]{};
 
+    // Compacted live-mode workspace for processBlock(): modes that are silent
+    // and unexcited for a chunk are left out of the kernel entirely
+    alignas(32) float packedSin_[kMaxModes]{};
+    alignas(32) float packedCos_[kMaxModes]{};
+    alignas(32) float packedEpsilon_[kMaxModes]{};
+    alignas(32) float packedRadius_[kMaxModes]{};
+    alignas(32) float packedInputGain_[kMaxModes]{};
+    alignas(32) float chokeRadius_[kMaxModes]{};  ///< pow(radius_, decayScale)
+    int liveModes_[kMaxModes]{};
+
     int numActiveModes_ = 0;
     int numModes_ = 0;
     float sampleRate_ = 44100.0f;
@@ -808,6 +815,93 @@ private:
         }
     }
 
+    /// Block processing shared by both processBlock() overloads: transient
+    /// emphasis and the output stage stay per sample, the mode recurrence runs
+    /// in kModalBankBlockRun-sample chunks through processModalBankBlockSIMD.
+    void processBlockSIMD(const float* input, float* output, int numSamples,
+                          float decayScale) noexcept
+    {
+        constexpr int kChunk = static_cast<int>(kModalBankBlockRun);
+        smoothCoefficients();
+
+        // Mallet choke: R_eff = pow(R, decayScale). Radii are block-constant
+        // after smoothCoefficients(), so the pow is taken once per block.
+        const float* radius = radius_;
+        if (decayScale != 1.0f) {
+            for (int k = 0; k < numModes_; ++k) {
+                chokeRadius_[k] = std::pow(radius_[k], decayScale);
+            }
+            radius = chokeRadius_;
+        }
+
+        float excitation[kChunk];
+        float modeSum[kChunk];
+        for (int offset = 0; offset < numSamples; offset += kChunk) {
+            const int n = std::min(kChunk, numSamples - offset);
+            bool excited = false;
+            for (int i = 0; i < n; ++i) {
+                excitation[i] = applyTransientEmphasis(input[offset + i]);
+                excited = excited || excitation[i] != 0.0f;
+            }
+
+            processLiveModes(radius, excitation, modeSum, n, excited);
+
+            for (int i = 0; i < n; ++i) {
+                output[offset + i] = applyOutputStage(modeSum[i]);
+            }
+        }
+        flushSilentModes();
+    }
+
+    /// Run the block kernel over the modes that can produce output this
+    /// chunk: those still ringing, plus (when the chunk carries excitation)
+    /// those with a non-zero input gain. Every other mode has zero state and
+    /// zero drive, so it would only add exact zeros -- culled modes cost
+    /// nothing. When all modes are live the kernel runs on the member arrays
+    /// directly; otherwise the live set is packed contiguously.
+    void processLiveModes(const float* radius, const float* excitation,
+                          float* modeSum, int numSamples, bool excited) noexcept
+    {
+        int numLive = 0;
+        for (int k = 0; k < numModes_; ++k) {
+            if (sinState_[k] != 0.0f || cosState_[k] != 0.0f ||
+                (excited && inputGain_[k] != 0.0f)) {
+                liveModes_[numLive++] = k;
+            }
+        }
+
+        if (numLive == 0) {
+            std::fill_n(modeSum, numSamples, 0.0f);
+            return;
+        }
+
+        if (numLive == numModes_) {
+            processModalBankBlockSIMD(sinState_, cosState_, epsilon_, radius,
+                                      inputGain_, excitation, modeSum,
+                                      numSamples, numModes_);
+            return;
+        }
+
+        for (int j = 0; j < numLive; ++j) {
+            const int k = liveModes_[j];
+            packedSin_[j] = sinState_[k];
+            packedCos_[j] = cosState_[k];
+            packedEpsilon_[j] = epsilon_[k];
+            packedRadius_[j] = radius[k];
+            packedInputGain_[j] = inputGain_[k];
+        }
+
+        processModalBankBlockSIMD(packedSin_, packedCos_, packedEpsilon_,
+                                  packedRadius_, packedInputGain_, excitation,
+                                  modeSum, numSamples, numLive);
+
+        for (int j = 0; j < numLive; ++j) {
+            const int k = liveModes_[j];
+            sinState_[k] = packedSin_[j];
+            cosState_[k] = packedCos_[j];
+        }
+    }
+
     /// Core per-sample resonator processing (no coefficient smoothing).
     /// Branchless inner loop: inactive modes have zero coefficients and
     /// contribute nothing to output.
@@ -15,6 +15,9 @@
 #include "hwy/foreach_target.h"  // NOLINT(misc-header-include-cycle) Highway self-inclusion by design
 #include "hwy/highway.h"
 
+#include "krate/dsp/processors/modal_resonator_bank_simd.h"
+
+#include <algorithm>
 #include <cstddef>
 
 // =============================================================================
@@ -135,6 +138,151 @@ void ProcessModalBankSampleSIMDImpl(
     }
 }
 
+// -----------------------------------------------------------------------------
+// ProcessModalBankBlockSIMDImpl: time-blocked coupled-form resonator loop
+//
+// For each run of up to kModalBankBlockRun samples:
+//   For each pass of up to 4 mode groups (4N modes):
+//     1. Load sin/cos state and coefficients once
+//     2. Advance the groups through every sample of the run in registers,
+//        adding their s_new into a per-sample lane accumulator
+//     3. Store sin/cos state once
+//   Then reduce each sample's lane accumulator to the scalar mode sum.
+//
+// Along time the recurrence is serial, so each pass needs enough independent
+// groups in flight to cover its latency. The recurrence is refactored with
+// Reps = R*eps precomputed per pass:
+//   s_new = R*s + (Reps*c + gain*ex)
+//   c_new = R*c - Reps*s_new
+// which leaves three dependent FMAs per sample (c -> s_new -> c_new) instead
+// of five; four groups then keep the FMA ports busy. The tag is capped at 16
+// lanes so the lane accumulator has a fixed size on every target.
+// -----------------------------------------------------------------------------
+
+constexpr size_t kBlockMaxLanes = 16;
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void ProcessModalBankBlockSIMDImpl(
+    float* HWY_RESTRICT sinState,
+    float* HWY_RESTRICT cosState,
+    const float* HWY_RESTRICT epsilon,
+    const float* HWY_RESTRICT radius,
+    const float* HWY_RESTRICT inputGain,
+    const float* HWY_RESTRICT excitation,
+    float* HWY_RESTRICT modeSum,
+    int numSamples,
+    int numModes) {
+
+    const hn::CappedTag<float, kBlockMaxLanes> d;
+    const size_t N = hn::Lanes(d);
+    const size_t count = static_cast<size_t>(std::max(numModes, 0));
+    const size_t frames = static_cast<size_t>(std::max(numSamples, 0));
+
+    // One N-lane partial sum per sample of the run (LoadU/StoreU: see above)
+    float laneSums[kModalBankBlockRun * kBlockMaxLanes];
+
+    for (size_t start = 0; start < frames; start += kModalBankBlockRun) {
+        const size_t run = std::min(kModalBankBlockRun, frames - start);
+        const float* HWY_RESTRICT ex = excitation + start;
+        std::fill_n(laneSums, run * N, 0.0f);
+
+        size_t m = 0;
+
+        for (; m + 4 * N <= count; m += 4 * N) {
+            const size_t m1 = m + N;
+            const size_t m2 = m + 2 * N;
+            const size_t m3 = m + 3 * N;
+            auto vSin0 = hn::LoadU(d, sinState + m);
+            auto vSin1 = hn::LoadU(d, sinState + m1);
+            auto vSin2 = hn::LoadU(d, sinState + m2);
+            auto vSin3 = hn::LoadU(d, sinState + m3);
+            auto vCos0 = hn::LoadU(d, cosState + m);
+            auto vCos1 = hn::LoadU(d, cosState + m1);
+            auto vCos2 = hn::LoadU(d, cosState + m2);
+            auto vCos3 = hn::LoadU(d, cosState + m3);
+            const auto vR0 = hn::LoadU(d, radius + m);
+            const auto vR1 = hn::LoadU(d, radius + m1);
+            const auto vR2 = hn::LoadU(d, radius + m2);
+            const auto vR3 = hn::LoadU(d, radius + m3);
+            const auto vReps0 = hn::Mul(vR0, hn::LoadU(d, epsilon + m));
+            const auto vReps1 = hn::Mul(vR1, hn::LoadU(d, epsilon + m1));
+            const auto vReps2 = hn::Mul(vR2, hn::LoadU(d, epsilon + m2));
+            const auto vReps3 = hn::Mul(vR3, hn::LoadU(d, epsilon + m3));
+            const auto vGain0 = hn::LoadU(d, inputGain + m);
+            const auto vGain1 = hn::LoadU(d, inputGain + m1);
+            const auto vGain2 = hn::LoadU(d, inputGain + m2);
+            const auto vGain3 = hn::LoadU(d, inputGain + m3);
+
+            for (size_t i = 0; i < run; ++i) {
+                const auto vEx = hn::Set(d, ex[i]);
+                vSin0 = hn::MulAdd(vR0, vSin0, hn::MulAdd(vReps0, vCos0, hn::Mul(vGain0, vEx)));
+                vSin1 = hn::MulAdd(vR1, vSin1, hn::MulAdd(vReps1, vCos1, hn::Mul(vGain1, vEx)));
+                vSin2 = hn::MulAdd(vR2, vSin2, hn::MulAdd(vReps2, vCos2, hn::Mul(vGain2, vEx)));
+                vSin3 = hn::MulAdd(vR3, vSin3, hn::MulAdd(vReps3, vCos3, hn::Mul(vGain3, vEx)));
+                vCos0 = hn::NegMulAdd(vReps0, vSin0, hn::Mul(vR0, vCos0));
+                vCos1 = hn::NegMulAdd(vReps1, vSin1, hn::Mul(vR1, vCos1));
+                vCos2 = hn::NegMulAdd(vReps2, vSin2, hn::Mul(vR2, vCos2));
+                vCos3 = hn::NegMulAdd(vReps3, vSin3, hn::Mul(vR3, vCos3));
+
+                float* acc = laneSums + i * N;
+                const auto vPass = hn::Add(hn::Add(vSin0, vSin1), hn::Add(vSin2, vSin3));
+                hn::StoreU(hn::Add(hn::LoadU(d, acc), vPass), d, acc);
+            }
+
+            hn::StoreU(vSin0, d, sinState + m);
+            hn::StoreU(vSin1, d, sinState + m1);
+            hn::StoreU(vSin2, d, sinState + m2);
+            hn::StoreU(vSin3, d, sinState + m3);
+            hn::StoreU(vCos0, d, cosState + m);
+            hn::StoreU(vCos1, d, cosState + m1);
+            hn::StoreU(vCos2, d, cosState + m2);
+            hn::StoreU(vCos3, d, cosState + m3);
+        }
+
+        // Remaining full groups, one per pass
+        for (; m + N <= count; m += N) {
+            auto vSin = hn::LoadU(d, sinState + m);
+            auto vCos = hn::LoadU(d, cosState + m);
+            const auto vR = hn::LoadU(d, radius + m);
+            const auto vReps = hn::Mul(vR, hn::LoadU(d, epsilon + m));
+            const auto vGain = hn::LoadU(d, inputGain + m);
+
+            for (size_t i = 0; i < run; ++i) {
+                const auto vEx = hn::Set(d, ex[i]);
+                vSin = hn::MulAdd(vR, vSin, hn::MulAdd(vReps, vCos, hn::Mul(vGain, vEx)));
+                vCos = hn::NegMulAdd(vReps, vSin, hn::Mul(vR, vCos));
+
+                float* acc = laneSums + i * N;
+                hn::StoreU(hn::Add(hn::LoadU(d, acc), vSin), d, acc);
+            }
+
+            hn::StoreU(vSin, d, sinState + m);
+            hn::StoreU(vCos, d, cosState + m);
+        }
+
+        float* HWY_RESTRICT out = modeSum + start;
+        for (size_t i = 0; i < run; ++i) {
+            out[i] = hn::ReduceSum(d, hn::LoadU(d, laneSums + i * N));
+        }
+
+        // Scalar tail for remaining modes
+        for (; m < count; ++m) {
+            float s = sinState[m];
+            float c = cosState[m];
+            const float R = radius[m];
+            const float Reps = R * epsilon[m];
+            const float gain = inputGain[m];
+            for (size_t i = 0; i < run; ++i) {
+                s = R * s + (Reps * c + gain * ex[i]);
+                c = R * c - Reps * s;
+                out[i] += s;
+            }
+            sinState[m] = s;
+            cosState[m] = c;
+        }
+    }
+}
+
 }  // namespace HWY_NAMESPACE
 }  // namespace DSP
 }  // namespace Krate
@@ -147,8 +295,6 @@ HWY_AFTER_NAMESPACE();
 
 #if HWY_ONCE
 
-#include "krate/dsp/processors/modal_resonator_bank_simd.h"
-
 // NOLINTNEXTLINE(modernize-concat-nested-namespaces) HWY_NAMESPACE dispatch section
 namespace Krate {
 namespace DSP {
@@ -173,6 +319,24 @@ float processModalBankSampleSIMD(
     return outSum;
 }
 
+HWY_EXPORT(ProcessModalBankBlockSIMDImpl);
+
+void processModalBankBlockSIMD(
+    float* sinState,
+    float* cosState,
+    const float* epsilon,
+    const float* radius,
+    const float* inputGain,
+    const float* excitation,
+    float* modeSum,
+    int numSamples,
+    int numModes) noexcept {
+
+    HWY_DYNAMIC_DISPATCH(ProcessModalBankBlockSIMDImpl)(
+        sinState, cosState, epsilon, radius, inputGain,
+        excitation, modeSum, numSamples, numModes);
+}
+
 }  // namespace DSP
 }  // namespace Krate
 
@@ -10,15 +10,26 @@
 // so we cannot vectorize along time. Instead we vectorize across modes:
 // process 4 (SSE) or 8 (AVX2) modes simultaneously per iteration.
 //
+// processModalBankBlockSIMD() is the time-blocked variant: each group of modes
+// is loaded once, advanced through a run of samples in registers, and stored
+// once, so per-sample memory traffic is one lane-sum accumulator instead of
+// five coefficient/state loads and two state stores per group.
+//
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocation)
 // - Principle IV: SIMD & DSP Optimization (Highway runtime dispatch)
 // - Principle IX: Layer 2 (depends on Layer 0)
 // ==============================================================================
 
+#include <cstddef>
+
 namespace Krate {
 namespace DSP {
 
+/// Samples advanced per register-resident pass in processModalBankBlockSIMD().
+/// Longer blocks are processed as consecutive runs.
+inline constexpr size_t kModalBankBlockRun = 64;
+
 /// @brief SIMD-accelerated coupled-form resonator batch processing for one sample.
 ///
 /// Processes `numModes` resonators for a single excitation sample:
@@ -42,5 +53,31 @@ float processModalBankSampleSIMD(
     float excitation,
     int numModes) noexcept;
 
+/// @brief SIMD-accelerated coupled-form resonator batch processing for a block.
+///
+/// Same recurrence as processModalBankSampleSIMD(), but time-blocked: mode
+/// state stays in registers across up to kModalBankBlockRun samples.
+/// Coefficients are held constant for the whole block.
+///
+/// @param sinState      In/out sin state array (numModes)
+/// @param cosState      In/out cos state array (numModes)
+/// @param epsilon       Frequency coefficients (numModes)
+/// @param radius        Damping radius coefficients (numModes)
+/// @param inputGain     Input gain per mode (numModes)
+/// @param excitation    Excitation samples (after transient emphasis)
+/// @param modeSum       Output: sum of all mode outputs per sample (overwritten)
+/// @param numSamples    Number of samples in excitation/modeSum
+/// @param numModes      Number of modes to process
+void processModalBankBlockSIMD(
+    float* sinState,
+    float* cosState,
+    const float* epsilon,
+    const float* radius,
+    const float* inputGain,
+    const float* excitation,
+    float* modeSum,
+    int numSamples,
+    int numModes) noexcept;
+
 }  // namespace DSP
 }  // namespace Krate
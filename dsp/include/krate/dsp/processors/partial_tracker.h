@@ -13,6 +13,8 @@
 //
 // Polyphonic Analysis Upgrade:
 // - Hungarian algorithm for globally optimal peak-to-track matching
+// - Optional sparse, frequency-banded matcher (PartialMatcher::Banded) that
+//   solves only the small clusters of overlapping candidates
 // - Linear prediction for frequency continuation through vibrato/bends
 //
 // Constitution Compliance:
@@ -33,16 +35,31 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
 namespace Krate::DSP {
 
+/// @brief Frame-to-frame assignment engine used by PartialTracker.
+enum class PartialMatcher : uint8_t {
+    /// Dense Hungarian solve over every track x peak pair. O(n^3) per frame.
+    Hungarian = 0,
+    /// Sparse matcher. Candidate peaks per track come from a binary search of
+    /// the frequency-sorted peak list (matches are bounded by
+    /// kMaxMatchDistanceFraction). Overlapping candidates form independent
+    /// clusters. Clusters up to kMaxExactMatchCluster are solved exactly
+    /// (same result as Hungarian); larger ones greedily by cost, then
+    /// repaired with augmenting paths. O(n log n) for typical spectra.
+    Banded
+};
+
 /// @brief Spectral partial tracker with harmonic sieve, frame-to-frame
 ///        matching, birth/death management, and 48-partial cap.
 ///
 /// Uses the Hungarian algorithm for globally optimal peak-to-track matching
-/// and linear prediction for frequency continuation through vibrato and bends.
+/// (or the sparse PartialMatcher::Banded engine, see setMatcher()) and linear
+/// prediction for frequency continuation through vibrato and bends.
 ///
 /// Processes SpectralBuffer frames from STFT analysis alongside F0 estimates
 /// from the YIN pitch detector. Outputs tracked Partial data suitable for
@@ -79,6 +96,11 @@ public:
     /// indexed as [track * numPeaks + peak] (WI-23).
     static constexpr int kMaxTrackablePeaks = 128;
 
+    /// Largest track or peak count of a candidate cluster that the Banded
+    /// matcher still solves exactly. Harmonic spectra only form clusters
+    /// above roughly the 20th harmonic, where 5% windows start to overlap.
+    static constexpr int kMaxExactMatchCluster = 32;
+
     /// Dual-window crossover, in short-window bins. Below this the long window
     /// supplies the peaks; above it the short window does. Four bins puts the
     /// crossover at ~172 Hz for 1024/44.1k, covering the near-DC region where
@@ -125,6 +147,24 @@ public:
         amplitudeScale_ = scale;
     }
 
+    /// @brief Select the frame-to-frame assignment engine.
+    ///
+    /// Hungarian (default) is globally optimal; Banded gives the same
+    /// assignments whenever every candidate cluster fits
+    /// kMaxExactMatchCluster, at a fraction of the cost. Larger clusters are
+    /// solved greedily and only checked for track continuity, so every
+    /// in-tree user, live analysis included, stays on Hungarian until Banded
+    /// has been validated on recorded material.
+    /// @note Real-time safe; takes effect on the next frame
+    void setMatcher(PartialMatcher matcher) noexcept {
+        matcher_ = matcher;
+    }
+
+    /// @brief Current assignment engine.
+    [[nodiscard]] PartialMatcher getMatcher() const noexcept {
+        return matcher_;
+    }
+
     /// @brief Prepare the tracker for a given FFT size and sample rate.
     /// @param fftSize FFT size used by the STFT analysis
     /// @param sampleRate Audio sample rate in Hz
@@ -147,6 +187,10 @@ public:
         // audio thread (it only ever resizes within this capacity).
         peakSelectIdx_.reserve(numBins_);
 
+        // Banded matcher scratch: every track x peak pair at most
+        matchEdges_.resize(kMaxPartials * static_cast<size_t>(kMaxTrackablePeaks));
+        matchEdgeOrder_.resize(matchEdges_.size());
+
         reset();
     }
 
@@ -728,9 +772,46 @@ private:
     // Frame-to-Frame Matching (FR-024) — Hungarian Algorithm
     // =========================================================================
 
-    /// Match current peaks to previous partials using the Hungarian algorithm
-    /// for globally optimal assignment. Uses predicted frequencies from linear
-    /// extrapolation as the reference for cost computation.
+    /// Cost of continuing `prevPartial` with peak `peak`: normalized frequency
+    /// distance from the predicted frequency plus an amplitude-similarity
+    /// penalty. kForbiddenCost when the peak is outside the match window.
+    [[nodiscard]] float matchCost(const Partial& prevPartial, float refFreq,
+                                  float maxDist, int peak) const noexcept {
+        const float peakFreq = peakFreqs_[static_cast<size_t>(peak)];
+        const float freqDist = std::abs(peakFreq - refFreq);
+
+        if (freqDist > maxDist) {
+            // Too far: forbidden assignment
+            return kForbiddenCost;
+        }
+
+        // Cost = normalized frequency distance + amplitude similarity penalty
+        float normalizedFreqDist = freqDist / maxDist;
+
+        // Amplitude similarity (optional weighting)
+        float ampDist = 0.0f;
+        if (prevPartial.amplitude > 1e-10f) {
+            float ampRatio = peakAmps_[static_cast<size_t>(peak)] /
+                             prevPartial.amplitude;
+            // Penalize large amplitude changes
+            ampDist = std::abs(1.0f - ampRatio);
+            ampDist = std::min(ampDist, 1.0f); // cap at 1.0
+        }
+
+        return (1.0f - kAmplitudeWeight) * normalizedFreqDist +
+               kAmplitudeWeight * ampDist;
+    }
+
+    /// Record the assignment of previous track `track` to current peak `peak`.
+    void commitMatch(int track, int peak) noexcept {
+        peakMatched_[static_cast<size_t>(peak)] = true;
+        matched_[static_cast<size_t>(track)] = true;
+        peakMatchedSlot_[static_cast<size_t>(peak)] = track;
+    }
+
+    /// Match current peaks to previous partials using the selected engine.
+    /// Uses predicted frequencies from linear extrapolation as the reference
+    /// for cost computation.
     void matchTracks() noexcept {
         // Reset match flags
         for (int i = 0; i < numPeaks_; ++i) {
@@ -747,6 +828,11 @@ private:
         const int rows = previousActiveCount_; // previous tracks
         const int cols = numPeaks_;             // current peaks
 
+        if (matcher_ == PartialMatcher::Banded) {
+            matchTracksBanded(rows, cols);
+            return;
+        }
+
         // Build cost matrix: cost[track * cols + peak]
         // Use predicted frequency for better tracking through vibrato/bends
         for (int t = 0; t < rows; ++t) {
@@ -764,30 +850,8 @@ private:
             float maxDist = prevPartial.frequency * kMaxMatchDistanceFraction;
 
             for (int p = 0; p < cols; ++p) {
-                const float peakFreq = peakFreqs_[static_cast<size_t>(p)];
-                const float freqDist = std::abs(peakFreq - refFreq);
-
-                if (freqDist > maxDist) {
-                    // Too far: forbidden assignment
-                    costMatrix_[static_cast<size_t>(t * cols + p)] = kForbiddenCost;
-                } else {
-                    // Cost = normalized frequency distance + amplitude similarity penalty
-                    float normalizedFreqDist = freqDist / maxDist;
-
-                    // Amplitude similarity (optional weighting)
-                    float ampDist = 0.0f;
-                    if (prevPartial.amplitude > 1e-10f) {
-                        float ampRatio = peakAmps_[static_cast<size_t>(p)] /
-                                         prevPartial.amplitude;
-                        // Penalize large amplitude changes
-                        ampDist = std::abs(1.0f - ampRatio);
-                        ampDist = std::min(ampDist, 1.0f); // cap at 1.0
-                    }
-
-                    costMatrix_[static_cast<size_t>(t * cols + p)] =
-                        (1.0f - kAmplitudeWeight) * normalizedFreqDist +
-                        kAmplitudeWeight * ampDist;
-                }
+                costMatrix_[static_cast<size_t>(t * cols + p)] =
+                    matchCost(prevPartial, refFreq, maxDist, p);
             }
         }
 
@@ -801,14 +865,238 @@ private:
                 float cost = costMatrix_[static_cast<size_t>(t * cols + assignedPeak)];
                 if (cost < kForbiddenCost * 0.5f) {
                     // Valid assignment
-                    peakMatched_[static_cast<size_t>(assignedPeak)] = true;
-                    matched_[static_cast<size_t>(t)] = true;
-                    peakMatchedSlot_[static_cast<size_t>(assignedPeak)] = t;
+                    commitMatch(t, assignedPeak);
                 }
             }
         }
     }
 
+    // =========================================================================
+    // Frame-to-Frame Matching (FR-024) — Banded Matcher
+    // =========================================================================
+
+    /// Sparse equivalent of the Hungarian match (PartialMatcher::Banded).
+    ///
+    /// 1. Sort peaks by frequency; each live track's candidates are the peaks
+    ///    inside its +/-kMaxMatchDistanceFraction window (binary search).
+    /// 2. Union tracks and peaks that share a candidate edge into clusters.
+    ///    Different clusters cannot compete for a peak, so the optimal
+    ///    assignment is the union of each cluster's optimum.
+    /// 3. Solve each cluster: exactly (small Hungarian, same criterion as the
+    ///    dense solve: most matches, then lowest cost) up to
+    ///    kMaxExactMatchCluster, else greedily by ascending cost, then
+    ///    repaired with augmenting paths until no unmatched track can be
+    ///    matched (maximum cardinality, like the dense solve).
+    void matchTracksBanded(int rows, int cols) noexcept {
+        // --- 1. Frequency-sorted peak view ---
+        for (int p = 0; p < cols; ++p) {
+            peakOrder_[static_cast<size_t>(p)] = p;
+        }
+        std::sort(peakOrder_.begin(), peakOrder_.begin() + cols,
+                  [this](int a, int b) noexcept {
+                      const float fa = peakFreqs_[static_cast<size_t>(a)];
+                      const float fb = peakFreqs_[static_cast<size_t>(b)];
+                      return fa < fb || (fa == fb && a < b);
+                  });
+        for (int i = 0; i < cols; ++i) {
+            sortedPeakFreqs_[static_cast<size_t>(i)] =
+                peakFreqs_[static_cast<size_t>(peakOrder_[static_cast<size_t>(i)])];
+        }
+
+        // Union-find over tracks [0, rows) and peaks [rows, rows + cols)
+        for (int n = 0; n < rows + cols; ++n) {
+            clusterParent_[static_cast<size_t>(n)] = n;
+        }
+
+        // --- Candidate edges, grouped by track ---
+        const float* sortedBegin = sortedPeakFreqs_.data();
+        const float* sortedEnd = sortedBegin + cols;
+        int numEdges = 0;
+        for (int t = 0; t < rows; ++t) {
+            const auto& prevPartial = previousPartials_[static_cast<size_t>(t)];
+            trackEdgeBegin_[static_cast<size_t>(t)] = numEdges;
+            trackEdgeEnd_[static_cast<size_t>(t)] = numEdges;
+            if (prevPartial.frequency <= 0.0f) continue; // Dead partial
+
+            const float refFreq = predictFrequency(t);
+            const float maxDist = prevPartial.frequency * kMaxMatchDistanceFraction;
+
+            // Search slightly wider than the window; matchCost() applies the
+            // exact bound so the edge set matches the dense cost matrix.
+            const float slack = maxDist * 1e-3f;
+            const float* it = std::lower_bound(sortedBegin, sortedEnd,
+                                               refFreq - maxDist - slack);
+            for (; it != sortedEnd && *it <= refFreq + maxDist + slack; ++it) {
+                const int p = peakOrder_[static_cast<size_t>(it - sortedBegin)];
+                const float cost = matchCost(prevPartial, refFreq, maxDist, p);
+                if (cost >= kForbiddenCost * 0.5f) continue;
+
+                matchEdges_[static_cast<size_t>(numEdges)] = MatchEdge{cost, t, p};
+                ++numEdges;
+                uniteClusters(t, rows + p);
+            }
+            trackEdgeEnd_[static_cast<size_t>(t)] = numEdges;
+        }
+
+        // --- 2. Order edges by (cluster, cost) ---
+        for (int e = 0; e < numEdges; ++e) {
+            auto& edge = matchEdges_[static_cast<size_t>(e)];
+            edge.cluster = findCluster(edge.track);
+            matchEdgeOrder_[static_cast<size_t>(e)] = e;
+        }
+        std::sort(matchEdgeOrder_.begin(), matchEdgeOrder_.begin() + numEdges,
+                  [this](int a, int b) noexcept {
+                      const auto& ea = matchEdges_[static_cast<size_t>(a)];
+                      const auto& eb = matchEdges_[static_cast<size_t>(b)];
+                      if (ea.cluster != eb.cluster) return ea.cluster < eb.cluster;
+                      if (ea.cost != eb.cost) return ea.cost < eb.cost;
+                      return a < b;
+                  });
+
+        // --- 3. Solve cluster by cluster ---
+        clusterRow_.fill(-1);
+        clusterCol_.fill(-1);
+        int begin = 0;
+        while (begin < numEdges) {
+            const int cluster =
+                matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(begin)])].cluster;
+            int end = begin + 1;
+            while (end < numEdges &&
+                   matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(end)])].cluster
+                       == cluster) {
+                ++end;
+            }
+            solveCluster(begin, end);
+            begin = end;
+        }
+    }
+
+    /// Solve one cluster: edges matchEdgeOrder_[begin, end), sorted by cost.
+    void solveCluster(int begin, int end) noexcept {
+        // Local row/column numbering for the cluster's tracks and peaks
+        int numRows = 0;
+        int numCols = 0;
+        for (int i = begin; i < end; ++i) {
+            const auto& edge = matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(i)])];
+            auto& row = clusterRow_[static_cast<size_t>(edge.track)];
+            if (row < 0) {
+                row = numRows;
+                if (numRows < kMaxPartialsInt) {
+                    clusterTracks_[static_cast<size_t>(numRows)] = edge.track;
+                }
+                ++numRows;
+            }
+            auto& col = clusterCol_[static_cast<size_t>(edge.peak)];
+            if (col < 0) {
+                col = numCols;
+                if (numCols < kMaxTrackablePeaks) {
+                    clusterPeaks_[static_cast<size_t>(numCols)] = edge.peak;
+                }
+                ++numCols;
+            }
+        }
+
+        if (std::max(numRows, numCols) <= kMaxExactMatchCluster) {
+            // Exact: the dense problem restricted to this cluster
+            std::fill(clusterCost_.begin(),
+                      clusterCost_.begin() + numRows * numCols, kForbiddenCost);
+            for (int i = begin; i < end; ++i) {
+                const auto& edge = matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(i)])];
+                const int r = clusterRow_[static_cast<size_t>(edge.track)];
+                const int c = clusterCol_[static_cast<size_t>(edge.peak)];
+                clusterCost_[static_cast<size_t>(r * numCols + c)] = edge.cost;
+            }
+            clusterSolver_.solve(clusterCost_.data(), numRows, numCols);
+            for (int r = 0; r < numRows; ++r) {
+                const int c = clusterSolver_.getRowAssignment(r);
+                if (c < 0 || c >= numCols) continue;
+                if (clusterCost_[static_cast<size_t>(r * numCols + c)] < kForbiddenCost * 0.5f) {
+                    commitMatch(clusterTracks_[static_cast<size_t>(r)],
+                                clusterPeaks_[static_cast<size_t>(c)]);
+                }
+            }
+        } else {
+            // Greedy: cheapest edges first
+            for (int i = begin; i < end; ++i) {
+                const auto& edge = matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(i)])];
+                if (!matched_[static_cast<size_t>(edge.track)] &&
+                    !peakMatched_[static_cast<size_t>(edge.peak)]) {
+                    commitMatch(edge.track, edge.peak);
+                }
+            }
+
+            // Repair: grow each unmatched track's augmenting path
+            for (int r = 0; r < numRows; ++r) {
+                const int track = clusterTracks_[static_cast<size_t>(r)];
+                if (!matched_[static_cast<size_t>(track)]) augmentFrom(track);
+            }
+        }
+
+        // Leave the local numbering clean for the next cluster
+        for (int i = begin; i < end; ++i) {
+            const auto& edge = matchEdges_[static_cast<size_t>(matchEdgeOrder_[static_cast<size_t>(i)])];
+            clusterRow_[static_cast<size_t>(edge.track)] = -1;
+            clusterCol_[static_cast<size_t>(edge.peak)] = -1;
+        }
+    }
+
+    /// Breadth-first search for an augmenting path from unmatched `track`:
+    /// alternate candidate edges and current matches until a free peak is
+    /// reached, then flip the path. Matches one more track if possible.
+    void augmentFrom(int track) noexcept {
+        visitedTrack_.fill(false);
+        int head = 0;
+        int tail = 0;
+        augmentQueue_[static_cast<size_t>(tail++)] = track;
+        visitedTrack_[static_cast<size_t>(track)] = true;
+        augmentVia_[static_cast<size_t>(track)] = -1;
+
+        while (head < tail) {
+            const int u = augmentQueue_[static_cast<size_t>(head++)];
+            for (int e = trackEdgeBegin_[static_cast<size_t>(u)];
+                 e < trackEdgeEnd_[static_cast<size_t>(u)]; ++e) {
+                const int peak = matchEdges_[static_cast<size_t>(e)].peak;
+                if (!peakMatched_[static_cast<size_t>(peak)]) {
+                    // Flip the path: each track on it takes the peak it
+                    // reached next, handing its old peak down the chain
+                    int t = u;
+                    int p = peak;
+                    while (t >= 0) {
+                        const int prevPeak = augmentVia_[static_cast<size_t>(t)];
+                        const int prevTrack = prevPeak >= 0
+                            ? augmentFrom_[static_cast<size_t>(t)] : -1;
+                        commitMatch(t, p);
+                        p = prevPeak;
+                        t = prevTrack;
+                    }
+                    return;
+                }
+                const int owner = peakMatchedSlot_[static_cast<size_t>(peak)];
+                if (visitedTrack_[static_cast<size_t>(owner)]) continue;
+                visitedTrack_[static_cast<size_t>(owner)] = true;
+                augmentVia_[static_cast<size_t>(owner)] = peak;
+                augmentFrom_[static_cast<size_t>(owner)] = u;
+                augmentQueue_[static_cast<size_t>(tail++)] = owner;
+            }
+        }
+    }
+
+    [[nodiscard]] int findCluster(int node) noexcept {
+        while (clusterParent_[static_cast<size_t>(node)] != node) {
+            // Path halving
+            auto& parent = clusterParent_[static_cast<size_t>(node)];
+            parent = clusterParent_[static_cast<size_t>(parent)];
+            node = parent;
+        }
+        return node;
+    }
+
+    void uniteClusters(int a, int b) noexcept {
+        a = findCluster(a);
+        b = findCluster(b);
+        if (a != b) clusterParent_[static_cast<size_t>(std::max(a, b))] = std::min(a, b);
+    }
+
     // =========================================================================
     // Birth/Death Management (FR-025)
     // =========================================================================
@@ -1093,6 +1381,55 @@ private:
 
     /// Hungarian algorithm solver
     HungarianAlgorithm<static_cast<size_t>(kMaxTrackablePeaks)> hungarian_;
+
+    // --- Banded matcher (PartialMatcher::Banded) ---
+
+    static constexpr int kMaxPartialsInt = static_cast<int>(kMaxPartials);
+
+    /// Candidate track-to-peak pair inside the match window.
+    struct MatchEdge {
+        float cost = 0.0f;
+        int track = 0;
+        int peak = 0;
+        int cluster = 0;
+    };
+
+    PartialMatcher matcher_ = PartialMatcher::Hungarian;
+
+    /// Candidate edges (sized in prepare() for every track x peak pair)
+    std::vector<MatchEdge> matchEdges_;
+    /// Edge indices sorted by (cluster, cost)
+    std::vector<int> matchEdgeOrder_;
+
+    /// Peak indices sorted by frequency, and the sorted frequencies
+    std::array<int, static_cast<size_t>(kMaxTrackablePeaks)> peakOrder_{};
+    std::array<float, static_cast<size_t>(kMaxTrackablePeaks)> sortedPeakFreqs_{};
+
+    /// Union-find parents over tracks then peaks
+    std::array<int, kMaxPartials + static_cast<size_t>(kMaxTrackablePeaks)> clusterParent_{};
+
+    /// Cluster-local row/column index per track/peak (-1 = not in cluster)
+    std::array<int, kMaxPartials> clusterRow_{};
+    std::array<int, static_cast<size_t>(kMaxTrackablePeaks)> clusterCol_{};
+    /// Inverse maps: local row -> track, local column -> peak
+    std::array<int, kMaxPartials> clusterTracks_{};
+    std::array<int, static_cast<size_t>(kMaxTrackablePeaks)> clusterPeaks_{};
+
+    /// Candidate edge range per track in matchEdges_
+    std::array<int, kMaxPartials> trackEdgeBegin_{};
+    std::array<int, kMaxPartials> trackEdgeEnd_{};
+
+    /// Augmenting-path search state: BFS queue, visited tracks, and for each
+    /// reached track the peak it was reached through and the track before it
+    std::array<int, kMaxPartials> augmentQueue_{};
+    std::array<bool, kMaxPartials> visitedTrack_{};
+    std::array<int, kMaxPartials> augmentVia_{};
+    std::array<int, kMaxPartials> augmentFrom_{};
+
+    /// Dense cost matrix and solver for one exactly-solved cluster
+    std::array<float, static_cast<size_t>(kMaxExactMatchCluster)
+                          * static_cast<size_t>(kMaxExactMatchCluster)> clusterCost_{};
+    HungarianAlgorithm<static_cast<size_t>(kMaxExactMatchCluster)> clusterSolver_;
 };
 
 } // namespace Krate::DSP
@@ -18,7 +18,7 @@
 #pragma once
 
 #include <krate/dsp/primitives/wavetable_oscillator.h>
-#include <krate/dsp/primitives/wavetable_generator.h>
+#include <krate/dsp/primitives/wavetable_cache.h>
 #include <krate/dsp/core/wavetable_data.h>
 #include <krate/dsp/core/phase_utils.h>
 #include <krate/dsp/core/math_constants.h>
@@ -72,8 +72,8 @@ inline constexpr size_t kNumPDWaveforms = 8;
 /// - Automatic mipmap anti-aliasing via internal WavetableOscillator
 ///
 /// @par Memory Model
-/// Owns internal WavetableData (~90 KB) for the cosine wavetable.
-/// Each PhaseDistortionOscillator instance is self-contained.
+/// Reads a shared, immutable cosine WavetableData (~90 KB) from
+/// WavetableCache; all instances use the same table.
 ///
 /// @par Thread Safety
 /// Single-threaded model. All methods must be called from the same thread.
@@ -127,12 +127,12 @@ public:
 
     /// @brief Initialize the oscillator for the given sample rate (FR-016).
     ///
-    /// Generates the internal cosine wavetable and initializes the oscillator.
+    /// Acquires the shared cosine wavetable and initializes the oscillator.
     /// All internal state is reset. Memory allocation occurs here.
     ///
     /// @param sampleRate Sample rate in Hz (44100-192000 supported)
     ///
-    /// @note NOT real-time safe (generates wavetable via FFT)
+    /// @note NOT real-time safe (may generate the shared wavetable via FFT)
     /// @note Calling prepare() multiple times is safe; state is fully reset
     void prepare(double sampleRate) noexcept {
         sampleRate_ = static_cast<float>(sampleRate);
@@ -140,12 +140,14 @@ public:
         // Generate cosine wavetable (FR-003)
         // Single harmonic at amplitude 1.0 produces a sine wave
         // We use sine table and add 0.25 phase offset to get cosine
-        const float harmonics[] = {1.0f};
-        generateMipmappedFromHarmonics(cosineTable_, harmonics, 1);
+        if (!cosineTable_) {
+            const float harmonics[] = {1.0f};
+            cosineTable_ = WavetableCache::instance().acquireHarmonics(harmonics, 1);
+        }
 
         // Configure internal oscillator for cosine lookup
         osc_.prepare(sampleRate);
-        osc_.setWavetable(&cosineTable_);
+        osc_.setWavetable(cosineTable_.get());
 
         // Reset state
         phaseAcc_.reset();
@@ -608,7 +610,8 @@ private:
         if (cosPhase >= 1.0f) cosPhase -= 1.0f;
 
         // Direct table lookup at the computed cosine phase
-        const float* table = cosineTable_.getLevel(0);  // Use level 0 for best quality
+        const WavetableData* data = cosineTable_.get();
+        const float* table = data != nullptr ? data->getLevel(0) : nullptr;  // Level 0 for best quality
         if (table == nullptr) {
             return 0.0f;
         }
@@ -647,7 +650,7 @@ private:
     float maxResonanceFactor_ = kDefaultMaxResonanceFactor; ///< Max resonance for resonant waveforms
 
     // Resources (regenerated on prepare())
-    WavetableData cosineTable_;           ///< Mipmapped cosine wavetable
+    WavetableCache::Handle cosineTable_;  ///< Shared mipmapped cosine wavetable
     WavetableOscillator osc_;             ///< Internal oscillator (for future use)
     PhaseAccumulator phaseAcc_;           ///< Phase tracking
 
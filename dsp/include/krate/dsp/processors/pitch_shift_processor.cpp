@@ -5,6 +5,8 @@
 // so moving them costs nothing at runtime.
 #include <krate/dsp/processors/pitch_shift_processor.h>
 
+#include <krate/dsp/core/spectral_simd.h>
+
 namespace Krate::DSP {
 
 void SimplePitchShifter::process(const float* input, float* output, std::size_t numSamples,
@@ -311,7 +313,6 @@ void PhaseVocoderPitchShifter::prepare(double sampleRate, std::size_t /*maxBlock
         const std::size_t numBins = kFFTSize / 2 + 1;
         prevPhase_.resize(numBins, 0.0f);
         synthPhase_.resize(numBins, 0.0f);
-        magnitude_.resize(numBins, 0.0f);
         frequency_.resize(numBins, 0.0f);
 
         // Calculate expected phase advance per bin per hop
@@ -387,106 +388,66 @@ void PhaseVocoderPitchShifter::processFrame(const SpectralBuffer& analysis, Spec
                       float pitchRatio) noexcept {
         const std::size_t numBins = kFFTSize / 2 + 1;
 
-        // Step 1: Extract magnitude and compute instantaneous frequency
-        for (std::size_t k = 0; k < numBins; ++k) {
-            // Get magnitude and phase from the analysis parameter (not internal member)
-            magnitude_[k] = analysis.getMagnitude(k);
-            float phase = analysis.getPhase(k);
-
-            // Compute phase difference from previous frame
-            float phaseDiff = phase - prevPhase_[k];
-            prevPhase_[k] = phase;
-
-            // Subtract expected phase increment to get deviation
-            float deviation = phaseDiff - expectedPhaseInc_[k];
+        // The analysis buffer's polar cache is filled by computePolarBulk();
+        // the frame works on those arrays directly instead of per-bin getters.
+        const float* magnitude = analysis.magnitudes();
+        const float* phase = analysis.phases();
 
-            // Wrap deviation to [-pi, pi]
-            deviation = wrapPhase(deviation);
-
-            // Compute true frequency as deviation from bin center
-            // true_freq = bin_freq + deviation / (2pi * hopSize / sampleRate)
-            // But we store as phase per hop for synthesis
-            frequency_[k] = expectedPhaseInc_[k] + deviation;
+        // Step 1: Instantaneous frequency from the wrapped phase deviation
+        //   frequency = expected + wrap(phase - prevPhase - expected)
+        for (std::size_t k = 0; k < numBins; ++k) {
+            frequency_[k] = phase[k] - prevPhase_[k] - expectedPhaseInc_[k];
+        }
+        batchWrapPhase(frequency_.data(), numBins);
+        for (std::size_t k = 0; k < numBins; ++k) {
+            frequency_[k] += expectedPhaseInc_[k];
         }
+        std::copy(phase, phase + numBins, prevPhase_.begin());
 
         // Step 1b: Extract original spectral envelope if formant preservation enabled
         if (formantPreserve_) {
-            formantPreserver_.extractEnvelope(magnitude_.data(), originalEnvelope_.data());
+            formantPreserver_.extractEnvelope(magnitude, originalEnvelope_.data());
         }
 
         // Step 1b-reset: Transient detection and phase reset (FR-012)
-        // Note: prevPhase_[k] already holds the current frame's analysis phase
-        // (updated above at line: prevPhase_[k] = phase), which is correct for
-        // phase reset per FR-012.
+        // prevPhase_ already holds the current frame's analysis phase, which is
+        // what FR-012 resets to.
         if (phaseResetEnabled_) {
-            const bool isTransient = transientDetector_.detect(magnitude_.data(), numBins);
+            const bool isTransient = transientDetector_.detect(magnitude, numBins);
             if (isTransient) {
-                for (std::size_t k = 0; k < numBins; ++k) {
-                    synthPhase_[k] = prevPhase_[k];
-                }
+                std::copy(prevPhase_.begin(), prevPhase_.end(), synthPhase_.begin());
             }
         }
 
         // Step 1c: Phase locking setup (peak detection + region assignment)
         if (phaseLockingEnabled_) {
-            // Stage A: Peak detection in analysis-domain magnitude spectrum
-            numPeaks_ = 0;
-            // Clear only the bins we use (numBins, not kMaxBins)
-            for (std::size_t k = 0; k < numBins; ++k) {
-                isPeak_[k] = false;
-            }
-
-            for (std::size_t k = 1; k < numBins - 1 && numPeaks_ < kMaxPeaks; ++k) {
-                if (magnitude_[k] > magnitude_[k - 1] && magnitude_[k] > magnitude_[k + 1]) {
-                    isPeak_[k] = true;
-                    peakIndices_[numPeaks_] = static_cast<uint16_t>(k);
-                    ++numPeaks_;
-                }
-            }
-
-            // Stage B: Region-of-influence assignment
-            if (numPeaks_ > 0) {
-                if (numPeaks_ == 1) {
-                    // Single peak: all bins assigned to it
-                    for (std::size_t k = 0; k < numBins; ++k) {
-                        regionPeak_[k] = peakIndices_[0];
-                    }
-                } else {
-                    // Forward scan: assign bins to peaks based on midpoint boundaries
-                    std::size_t peakIdx = 0;
-                    for (std::size_t k = 0; k < numBins; ++k) {
-                        // Move to next peak if we've passed the midpoint
-                        if (peakIdx + 1 < numPeaks_) {
-                            uint16_t midpoint = static_cast<uint16_t>(
-                                (peakIndices_[peakIdx] + peakIndices_[peakIdx + 1]) / 2);
-                            if (k > midpoint) {
-                                ++peakIdx;
-                            }
-                        }
-                        regionPeak_[k] = peakIndices_[peakIdx];
-                    }
-                }
-            }
+            numPeaks_ = detectSpectralPeaks(magnitude, numBins, peakIndices_.data(),
+                                            kMaxPeaks, isPeak_.data());
+            assignPeakRegions(peakIndices_.data(), numPeaks_, numBins, regionPeak_.data());
         }
 
         // Toggle-to-basic re-initialization check
         if (wasLocked_ && !phaseLockingEnabled_) {
-            for (std::size_t k = 0; k < numBins; ++k) {
-                synthPhase_[k] = prevPhase_[k];
-            }
+            std::copy(prevPhase_.begin(), prevPhase_.end(), synthPhase_.begin());
         }
         wasLocked_ = phaseLockingEnabled_;
 
-        // Step 2: Pitch shift by scaling frequencies and resampling spectrum
-        synthesis.reset();
+        // Step 2: Pitch shift by scaling frequencies and resampling spectrum.
+        // Synthesis bin k reads source bin k / pitchRatio; bins whose source
+        // lies past the last bin stay silent. The mapping is monotonic, so the
+        // mapped bins are the prefix [0, mappedBins).
+        std::size_t mappedBins = 0;
+        while (mappedBins < numBins &&
+               static_cast<float>(mappedBins) / pitchRatio < static_cast<float>(numBins - 1)) {
+            ++mappedBins;
+        }
 
         if (phaseLockingEnabled_ && numPeaks_ > 0) {
             // Two-pass synthesis: peaks first, then non-peaks
 
             // Pass 1: Process PEAK bins only (accumulate synthPhase_ for peaks)
-            for (std::size_t k = 0; k < numBins; ++k) {
+            for (std::size_t k = 0; k < mappedBins; ++k) {
                 float srcBin = static_cast<float>(k) / pitchRatio;
-                if (srcBin >= static_cast<float>(numBins - 1)) continue;
 
                 auto srcBinRounded = static_cast<std::size_t>(srcBin + 0.5f);
                 if (srcBinRounded >= numBins) srcBinRounded = numBins - 1;
@@ -499,23 +460,15 @@ void PhaseVocoderPitchShifter::processFrame(const SpectralBuffer& analysis, Spec
                 if (srcBin1 >= numBins) srcBin1 = numBins - 1;
 
                 float frac = srcBin - static_cast<float>(srcBin0);
-                float mag = magnitude_[srcBin0] * (1.0f - frac) + magnitude_[srcBin1] * frac;
-                shiftedMagnitude_[k] = mag;
+                shiftedMagnitude_[k] = magnitude[srcBin0] * (1.0f - frac) + magnitude[srcBin1] * frac;
 
                 // Peak bin: standard horizontal phase propagation
-                float freq = frequency_[srcBin0] * pitchRatio;
-                synthPhase_[k] += freq;
-                synthPhase_[k] = wrapPhase(synthPhase_[k]);
-
-                float real = mag * std::cos(synthPhase_[k]);
-                float imag = mag * std::sin(synthPhase_[k]);
-                synthesis.setCartesian(k, real, imag);
+                synthPhase_[k] += frequency_[srcBin0] * pitchRatio;
             }
 
             // Pass 2: Process NON-PEAK bins (use peak phases from Pass 1)
-            for (std::size_t k = 0; k < numBins; ++k) {
+            for (std::size_t k = 0; k < mappedBins; ++k) {
                 float srcBin = static_cast<float>(k) / pitchRatio;
-                if (srcBin >= static_cast<float>(numBins - 1)) continue;
 
                 auto srcBinRounded = static_cast<std::size_t>(srcBin + 0.5f);
                 if (srcBinRounded >= numBins) srcBinRounded = numBins - 1;
@@ -528,8 +481,7 @@ void PhaseVocoderPitchShifter::processFrame(const SpectralBuffer& analysis, Spec
                 if (srcBin1 >= numBins) srcBin1 = numBins - 1;
 
                 float frac = srcBin - static_cast<float>(srcBin0);
-                float mag = magnitude_[srcBin0] * (1.0f - frac) + magnitude_[srcBin1] * frac;
-                shiftedMagnitude_[k] = mag;
+                shiftedMagnitude_[k] = magnitude[srcBin0] * (1.0f - frac) + magnitude[srcBin1] * frac;
 
                 // Non-peak bin: identity phase locking via rotation angle
                 uint16_t analysisPeak = regionPeak_[srcBinRounded];
@@ -540,80 +492,60 @@ void PhaseVocoderPitchShifter::processFrame(const SpectralBuffer& analysis, Spec
                 if (synthPeakBin >= numBins) synthPeakBin = numBins - 1;
 
                 // Rotation angle: peak's synthesis phase minus peak's analysis phase
-                float analysisPhaseAtPeak = prevPhase_[analysisPeak];
-                float rotationAngle = synthPhase_[synthPeakBin] - analysisPhaseAtPeak;
+                float rotationAngle = synthPhase_[synthPeakBin] - prevPhase_[analysisPeak];
 
                 // Apply rotation to this bin's analysis phase (interpolated)
                 float analysisPhaseAtSrc = prevPhase_[srcBin0] * (1.0f - frac)
                                          + prevPhase_[srcBin1] * frac;
-                float phaseForOutput = analysisPhaseAtSrc + rotationAngle;
-
-                // Store in synthPhase_ for formant step compatibility
-                synthPhase_[k] = phaseForOutput;
-
-                float real = mag * std::cos(phaseForOutput);
-                float imag = mag * std::sin(phaseForOutput);
-                synthesis.setCartesian(k, real, imag);
+                synthPhase_[k] = analysisPhaseAtSrc + rotationAngle;
             }
         } else {
             // Basic path: standard per-bin phase accumulation (pre-modification behavior)
             // Also used as fallback when phaseLockingEnabled_ && numPeaks_ == 0 (FR-011)
-            for (std::size_t k = 0; k < numBins; ++k) {
-                // Map source bin to destination bin
+            for (std::size_t k = 0; k < mappedBins; ++k) {
                 float srcBin = static_cast<float>(k) / pitchRatio;
 
-                // Skip if source bin is out of range
-                if (srcBin >= static_cast<float>(numBins - 1)) continue;
-
                 // Linear interpolation for magnitude
                 auto srcBin0 = static_cast<std::size_t>(srcBin);
                 std::size_t srcBin1 = srcBin0 + 1;
                 if (srcBin1 >= numBins) srcBin1 = numBins - 1;
 
                 float frac = srcBin - static_cast<float>(srcBin0);
-                float mag = magnitude_[srcBin0] * (1.0f - frac) + magnitude_[srcBin1] * frac;
-
-                // Store shifted magnitude for formant preservation
-                shiftedMagnitude_[k] = mag;
+                shiftedMagnitude_[k] = magnitude[srcBin0] * (1.0f - frac) + magnitude[srcBin1] * frac;
 
-                // Scale frequency by pitch ratio
-                float freq = frequency_[srcBin0] * pitchRatio;
-
-                // Accumulate synthesis phase
-                synthPhase_[k] += freq;
-                synthPhase_[k] = wrapPhase(synthPhase_[k]);
-
-                // Set synthesis bin (Cartesian form)
-                float real = mag * std::cos(synthPhase_[k]);
-                float imag = mag * std::sin(synthPhase_[k]);
-                synthesis.setCartesian(k, real, imag);
+                // Accumulate synthesis phase with the scaled frequency
+                synthPhase_[k] += frequency_[srcBin0] * pitchRatio;
             }
         }
 
+        // Phases are only ever consumed mod 2pi, so one bulk wrap covers both
+        // the accumulated and the phase-locked bins
+        batchWrapPhase(synthPhase_.data(), mappedBins);
+        std::fill(shiftedMagnitude_.begin() + static_cast<std::ptrdiff_t>(mappedBins),
+                  shiftedMagnitude_.end(), 0.0f);
+
         // Step 3: Apply formant preservation if enabled
         if (formantPreserve_) {
             // Extract envelope of the shifted spectrum
             formantPreserver_.extractEnvelope(shiftedMagnitude_.data(), shiftedEnvelope_.data());
 
-            // Apply formant preservation: adjust magnitudes to preserve original envelope
-            for (std::size_t k = 0; k < numBins; ++k) {
-                // Compute envelope ratio: originalEnv / shiftedEnv
+            // Adjust magnitudes to preserve the original envelope. The ratio
+            // originalEnv / shiftedEnv is clamped to avoid extreme amplification
+            // (especially at extreme shifts).
+            for (std::size_t k = 0; k < mappedBins; ++k) {
                 float shiftedEnv = std::max(shiftedEnvelope_[k], 1e-10f);
                 float ratio = originalEnvelope_[k] / shiftedEnv;
-
-                // Clamp ratio to avoid extreme amplification (especially at extreme shifts)
                 ratio = std::min(ratio, 100.0f);
                 ratio = std::max(ratio, 0.01f);
-
-                // Apply ratio to shifted magnitude
-                float adjustedMag = shiftedMagnitude_[k] * ratio;
-
-                // Reconstruct Cartesian form with adjusted magnitude
-                float real = adjustedMag * std::cos(synthPhase_[k]);
-                float imag = adjustedMag * std::sin(synthPhase_[k]);
-                synthesis.setCartesian(k, real, imag);
+                shiftedMagnitude_[k] *= ratio;
             }
         }
+
+        // Step 4: Resynthesize the whole frame in one bulk polar -> Cartesian pass
+        auto* complexData = reinterpret_cast<float*>(synthesis.data());
+        reconstructCartesianBulk(shiftedMagnitude_.data(), synthPhase_.data(), mappedBins,
+                                 complexData);
+        std::fill(complexData + 2 * mappedBins, complexData + 2 * numBins, 0.0f);
     }
 
 }  // namespace Krate::DSP
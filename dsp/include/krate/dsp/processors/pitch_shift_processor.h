@@ -321,6 +321,18 @@ public:
     ///                  Must have numBins() == kFFTSize / 2 + 1 (2049).
     void synthesizePassthrough(const SpectralBuffer& analysis) noexcept;
 
+    /// @brief Process one shared-analysis frame and return its synthesis
+    ///        spectrum without inverse-transforming it.
+    ///
+    /// For callers that sum several voices in the spectral domain and run a
+    /// single IFFT/OLA themselves. Nothing is pushed to this processor's OLA
+    /// buffer.
+    ///
+    /// @return The synthesis spectrum (valid until the next frame), or nullptr
+    ///         if mode is not PhaseVocoder or the processor is not prepared.
+    [[nodiscard]] const SpectralBuffer* processSharedAnalysisSpectrum(
+        const SpectralBuffer& analysis, float pitchRatio) noexcept;
+
     /// @brief Pull output samples from the PhaseVocoder OLA buffer after
     ///        processWithSharedAnalysis() calls.
     ///
@@ -1009,6 +1021,25 @@ public:
         ola_.synthesize(analysis);
     }
 
+    /// @brief Process one shared-analysis frame without synthesizing it.
+    ///
+    /// Same phase rotation, phase locking, transient reset and formant
+    /// correction as processWithSharedAnalysis(), but the synthesis spectrum
+    /// is returned instead of being inverse-transformed into the internal OLA
+    /// buffer. Lets a caller sum several voices' spectra and run one IFFT.
+    ///
+    /// @return The synthesis spectrum (valid until the next frame), or nullptr
+    ///         in the degenerate conditions processWithSharedAnalysis() ignores.
+    [[nodiscard]] const SpectralBuffer* processSharedAnalysisSpectrum(
+        const SpectralBuffer& analysis, float pitchRatio) noexcept {
+        if (!ola_.isPrepared()) return nullptr;
+        constexpr std::size_t kExpectedBins = kFFTSize / 2 + 1;
+        if (analysis.numBins() != kExpectedBins) return nullptr;
+
+        processFrame(analysis, synthesisSpectrum_, std::clamp(pitchRatio, 0.25f, 4.0f));
+        return &synthesisSpectrum_;
+    }
+
     /// @brief Pull processed samples from the internal OLA buffer.
     ///
     /// @param output      Destination buffer. Must have room for at least
@@ -1093,7 +1124,6 @@ private:
     // Phase vocoder state
     std::vector<float> prevPhase_;      // Previous frame phases
     std::vector<float> synthPhase_;     // Accumulated synthesis phases
-    std::vector<float> magnitude_;      // Temporary magnitude storage
     std::vector<float> frequency_;      // Instantaneous frequencies
     std::vector<float> expectedPhaseInc_; // Expected phase increment per bin
 
@@ -1173,6 +1203,12 @@ struct PitchShiftProcessor::Impl {
         phaseVocoderShifter.synthesizePassthrough(analysis);
     }
 
+    const SpectralBuffer* processSharedAnalysisSpectrum(const SpectralBuffer& analysis,
+                                                        float pitchRatio) noexcept {
+        if (!prepared || mode != PitchMode::PhaseVocoder) return nullptr;
+        return phaseVocoderShifter.processSharedAnalysisSpectrum(analysis, pitchRatio);
+    }
+
     std::size_t pullSharedAnalysisOutput(float* output,
                                          std::size_t maxSamples) noexcept {
         if (!prepared || mode != PitchMode::PhaseVocoder) return 0;
@@ -1383,6 +1419,11 @@ inline void PitchShiftProcessor::synthesizePassthrough(
     pImpl_->synthesizePassthrough(analysis);
 }
 
+inline const SpectralBuffer* PitchShiftProcessor::processSharedAnalysisSpectrum(
+    const SpectralBuffer& analysis, float pitchRatio) noexcept {
+    return pImpl_->processSharedAnalysisSpectrum(analysis, pitchRatio);
+}
+
 inline void PitchShiftProcessor::processWithSharedPitch(
     const float* input, float* output, std::size_t numSamples,
     float sharedPeriod, float sharedConfidence) noexcept {
@@ -26,6 +26,7 @@
 
 // Layer 0: Core
 #include <krate/dsp/core/math_constants.h>
+#include <krate/dsp/core/spectral_simd.h>
 #include <krate/dsp/core/window_functions.h>
 
 // Layer 1: Primitives
@@ -154,6 +155,7 @@ public:
 
         // Pre-compute octave distances from tilt pivot (eliminates log2 from hot loop)
         octavesFromPivot_.resize(numBins, 0.0f);
+        tiltGains_.resize(numBins, 1.0f);
         const float binFreqStep = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
         for (std::size_t bin = 1; bin < numBins; ++bin) {
             const float binFreq = static_cast<float>(bin) * binFreqStep;
@@ -508,21 +510,7 @@ private:
         const float morph = morphSmoother_.process();
         const float tilt = tiltSmoother_.process();
 
-        // Step 1: Magnitude interpolation (FR-004)
-        applyMagnitudeInterpolation(spectrumA_, spectrumB_, outputSpectrum_, morph);
-
-        // Step 2: Phase selection (FR-005)
-        applyPhaseSelection(spectrumA_, spectrumB_, outputSpectrum_, morph, phaseSource_);
-
-        // Step 3: Spectral shift (FR-007)
-        if (std::abs(spectralShift_) > 0.001f) {
-            applySpectralShift(outputSpectrum_, spectralShift_);
-        }
-
-        // Step 4: Spectral tilt (FR-008)
-        if (std::abs(tilt) > 0.001f) {
-            applySpectralTilt(outputSpectrum_, tilt);
-        }
+        morphFrame(spectrumA_, spectrumB_, morph, tilt);
     }
 
     /// @brief Process a single spectral frame (snapshot mode)
@@ -530,19 +518,39 @@ private:
         const float morph = morphSmoother_.process();
         const float tilt = tiltSmoother_.process();
 
-        // Morph between live spectrum (A) and snapshot
-        applyMagnitudeInterpolation(spectrumA_, snapshotSpectrum_, outputSpectrum_, morph);
-
-        // Phase from live input (A) by default in snapshot mode
-        applyPhaseSelection(spectrumA_, snapshotSpectrum_, outputSpectrum_, morph, phaseSource_);
+        // Morph between live spectrum (A) and snapshot; phase from live input
+        // (A) by default in snapshot mode
+        morphFrame(spectrumA_, snapshotSpectrum_, morph, tilt);
+    }
 
-        // Apply spectral effects
-        if (std::abs(spectralShift_) > 0.001f) {
-            applySpectralShift(outputSpectrum_, spectralShift_);
+    /// @brief Magnitude interpolation (FR-004), phase selection (FR-005),
+    ///        spectral shift (FR-007) and tilt (FR-008) into outputSpectrum_
+    /// @note Without a shift the whole frame stays Cartesian: one
+    ///       morphSpectraBulk() pass with the tilt folded in as per-bin gains.
+    void morphFrame(const SpectralBuffer& specA, const SpectralBuffer& specB,
+                    float morph, float tilt) noexcept {
+        const bool shifting = std::abs(spectralShift_) > 0.001f;
+        const bool tilting = std::abs(tilt) > 0.001f;
+
+        const float* gains = nullptr;
+        if (tilting && !shifting) {
+            computeTiltGains(tilt);
+            gains = tiltGains_.data();
         }
 
-        if (std::abs(tilt) > 0.001f) {
-            applySpectralTilt(outputSpectrum_, tilt);
+        float phaseMorph = 0.0f;
+        if (phaseSource_ == PhaseSource::B) phaseMorph = 1.0f;
+        if (phaseSource_ == PhaseSource::Blend) phaseMorph = morph;
+
+        // reinterpret_cast is safe: Complex is standard-layout with two floats
+        morphSpectraBulk(reinterpret_cast<const float*>(specA.data()),
+                         reinterpret_cast<const float*>(specB.data()),
+                         outputSpectrum_.numBins(), morph, phaseMorph, gains,
+                         reinterpret_cast<float*>(outputSpectrum_.data()));
+
+        if (shifting) {
+            applySpectralShift(outputSpectrum_, spectralShift_);
+            if (tilting) applySpectralTilt(outputSpectrum_, tilt);
         }
     }
 
@@ -587,76 +595,6 @@ private:
         captureRequested_ = false;
     }
 
-    /// @brief Apply magnitude interpolation between two spectra
-    void applyMagnitudeInterpolation(
-        const SpectralBuffer& specA,
-        const SpectralBuffer& specB,
-        SpectralBuffer& output,
-        float morphAmount
-    ) noexcept {
-        const std::size_t numBins = output.numBins();
-        const float invMorph = 1.0f - morphAmount;
-
-        for (std::size_t bin = 0; bin < numBins; ++bin) {
-            const float magA = specA.getMagnitude(bin);
-            const float magB = specB.getMagnitude(bin);
-            const float blendedMag = magA * invMorph + magB * morphAmount;
-            output.setMagnitude(bin, blendedMag);
-        }
-    }
-
-    /// @brief Apply phase selection
-    void applyPhaseSelection(
-        const SpectralBuffer& specA,
-        const SpectralBuffer& specB,
-        SpectralBuffer& output,
-        float morphAmount,
-        PhaseSource source
-    ) noexcept {
-        const std::size_t numBins = output.numBins();
-
-        switch (source) {
-            case PhaseSource::A:
-                // Use phase from source A exclusively
-                for (std::size_t bin = 0; bin < numBins; ++bin) {
-                    output.setPhase(bin, specA.getPhase(bin));
-                }
-                break;
-
-            case PhaseSource::B:
-                // Use phase from source B exclusively
-                for (std::size_t bin = 0; bin < numBins; ++bin) {
-                    output.setPhase(bin, specB.getPhase(bin));
-                }
-                break;
-
-            case PhaseSource::Blend:
-                // Complex vector interpolation (FR-005)
-                // Interpolate real and imaginary components separately
-                {
-                    const float invMorph = 1.0f - morphAmount;
-                    for (std::size_t bin = 0; bin < numBins; ++bin) {
-                        // Get complex values from both sources
-                        const float realA = specA.getReal(bin);
-                        const float imagA = specA.getImag(bin);
-                        const float realB = specB.getReal(bin);
-                        const float imagB = specB.getImag(bin);
-
-                        // Interpolate complex values
-                        const float blendedReal = realA * invMorph + realB * morphAmount;
-                        const float blendedImag = imagA * invMorph + imagB * morphAmount;
-
-                        // Extract phase from blended complex
-                        const float blendedPhase = std::atan2(blendedImag, blendedReal);
-
-                        // Set phase (magnitude already set)
-                        output.setPhase(bin, blendedPhase);
-                    }
-                }
-                break;
-        }
-    }
-
     /// @brief Apply spectral shift via bin rotation
     /// @note Uses pre-computed bin mapping from setSpectralShift() to avoid
     ///       division and rounding in the hot loop.
@@ -686,23 +624,31 @@ private:
         }
     }
 
-    /// @brief Apply spectral tilt with 1 kHz pivot
+    /// @brief Fill tiltGains_ for a tilt with 1 kHz pivot
     /// @note Uses pre-computed octave distances from prepare() to avoid
-    ///       log2() in the hot loop. Only pow() remains per bin.
+    ///       log2() in the hot loop; the pow() runs as one batchPow10().
     /// @note Per-bin gain is clamped to ±24 dB to prevent extreme
     ///       attenuation (inaudible fundamentals) and boost (clipping artifacts)
     ///       at bins far from the pivot frequency.
-    void applySpectralTilt(SpectralBuffer& spectrum, float dBPerOctave) noexcept {
-        const std::size_t numBins = spectrum.numBins();
+    void computeTiltGains(float dBPerOctave) noexcept {
+        const std::size_t numBins = tiltGains_.size();
 
-        for (std::size_t bin = 1; bin < numBins; ++bin) {  // Skip DC bin
-            // octavesFromPivot_[bin] was pre-computed in prepare()
+        // Bin 0 (DC) has octavesFromPivot_[0] == 0, so its gain is unity
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
             const float gainDb = std::clamp(dBPerOctave * octavesFromPivot_[bin],
                                             kMinTiltGainDb, kMaxTiltGainDb);
-            const float gainLinear = std::pow(10.0f, gainDb / 20.0f);
+            tiltGains_[bin] = gainDb * 0.05f;
+        }
+        batchPow10(tiltGains_.data(), tiltGains_.data(), numBins);
+    }
 
-            const float currentMag = spectrum.getMagnitude(bin);
-            spectrum.setMagnitude(bin, currentMag * gainLinear);
+    /// @brief Apply spectral tilt to the magnitudes of a shifted spectrum
+    void applySpectralTilt(SpectralBuffer& spectrum, float dBPerOctave) noexcept {
+        computeTiltGains(dBPerOctave);
+
+        const std::size_t numBins = spectrum.numBins();
+        for (std::size_t bin = 1; bin < numBins; ++bin) {  // Skip DC bin
+            spectrum.setMagnitude(bin, spectrum.getMagnitude(bin) * tiltGains_[bin]);
         }
     }
 
@@ -782,6 +728,7 @@ private:
 
     // Pre-computed lookup tables (populated in prepare/setSpectralShift)
     std::vector<float> octavesFromPivot_;       // Tilt: octave distance per bin
+    std::vector<float> tiltGains_;              // Tilt: linear gain per bin (scratch)
     std::vector<std::size_t> shiftBinMapping_;  // Shift: source bin per output bin
 
     // Single-sample processing buffers
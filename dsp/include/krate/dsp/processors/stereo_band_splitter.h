@@ -0,0 +1,474 @@
+// ==============================================================================
+// Layer 2: DSP Processor - Stereo Band Splitter
+// ==============================================================================
+// Block-based N-band crossover for a stereo pair, writing each band to its own
+// contiguous buffer so downstream band processing can run block-wise.
+//
+// Two phase modes:
+// - Minimum: Linkwitz-Riley 4th-order cascade with D'Appolito allpass
+//   compensation (the topology of Disrumpo's CrossoverNetwork), zero latency.
+//   L and R share coefficients and run as one 2-lane vector through
+//   biquadCascadeStereo(), section by section over 32-frame chunks.
+// - Linear: FFT overlap-save with linear-phase FIR bands whose magnitudes are
+//   the LR4 responses. Band magnitudes telescope to exactly 1, so the band sum
+//   is a pure delay of latency() samples with no phase interaction between
+//   bands. Intended for mastering, where phase coherence matters more than
+//   latency.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (allocations only in prepare())
+// - Principle III: Modern C++ (C++20, RAII)
+// - Principle IV: SIMD & DSP Optimization (2-lane stereo biquads, BatchFFT)
+// - Principle IX: Layer 2 (depends on Layer 0/1 only)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/biquad_simd.h>
+#include <krate/dsp/core/window_functions.h>
+#include <krate/dsp/primitives/biquad.h>
+#include <krate/dsp/primitives/fft.h>
+#include <krate/dsp/primitives/smoother.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Phase behaviour of StereoBandSplitter.
+enum class CrossoverPhase : uint8_t {
+    Minimum = 0,  ///< LR4 IIR cascade, zero latency
+    Linear        ///< Linear-phase FFT bands, latency() samples of delay
+};
+
+/// @brief Stereo N-band crossover with block output and optional linear phase.
+///
+/// @code
+/// StereoBandSplitter splitter;
+/// splitter.prepare(48000.0);
+/// splitter.setNumBands(3);
+/// splitter.setCrossoverFrequency(0, 200.0f);
+/// splitter.setCrossoverFrequency(1, 2000.0f);
+/// splitter.process(inL, inR, bandsL, bandsR, numSamples);
+/// @endcode
+class StereoBandSplitter {
+public:
+    static constexpr int kMaxBands = 8;
+    static constexpr float kMinFrequency = 20.0f;
+    static constexpr float kMaxFrequencyRatio = 0.45f;
+    static constexpr float kSmoothingMs = 5.0f;           ///< Same as CrossoverLR4
+    static constexpr float kHysteresisHz = 0.1f;          ///< Same as CrossoverLR4
+    static constexpr float kAllpassQ = kButterworthQ;
+
+    /// Frames per minimum-phase chunk; coefficients follow the frequency
+    /// smoothers at this granularity
+    static constexpr size_t kChunkSize = 32;
+
+    static constexpr size_t kLinearPhaseFFTSize = 4096;
+    static constexpr size_t kLinearPhaseHop = kLinearPhaseFFTSize / 2;
+    /// Odd length gives an integer group delay; taps - 1 <= FFT - hop keeps
+    /// every output of the overlap-save frame alias-free
+    static constexpr size_t kLinearPhaseTaps = kLinearPhaseHop - 1;
+    static constexpr float kLinearPhaseKaiserBeta = 8.0f;
+
+    StereoBandSplitter() noexcept = default;
+
+    // =========================================================================
+    // Setup (NOT real-time safe)
+    // =========================================================================
+
+    /// @brief Configure for the sample rate and allocate the linear-phase
+    /// buffers, so either mode can be selected later without allocating.
+    void prepare(double sampleRate) {
+        sampleRate_ = sampleRate;
+        for (auto& split : splits_) {
+            split.smoother.configure(kSmoothingMs, static_cast<float>(sampleRate));
+            split.target = clampFrequency(split.target);
+            split.smoother.snapTo(split.target);
+            updateSplitCoefficients(split, split.target);
+        }
+        for (int j = 0; j < kMaxBands - 1; ++j) propagateAllpass(j);
+
+        fft_.prepare(kLinearPhaseFFTSize);
+        const size_t bins = fft_.numBins();
+        for (auto& kernel : kernels_) kernel.assign(bins, Complex{});
+        specL_.assign(bins, Complex{});
+        specR_.assign(bins, Complex{});
+        productL_.assign(bins, Complex{});
+        productR_.assign(bins, Complex{});
+        windowL_.assign(kLinearPhaseFFTSize, 0.0f);
+        windowR_.assign(kLinearPhaseFFTSize, 0.0f);
+        frameL_.assign(kLinearPhaseFFTSize, 0.0f);
+        frameR_.assign(kLinearPhaseFFTSize, 0.0f);
+        for (auto& buf : outL_) buf.assign(kLinearPhaseHop, 0.0f);
+        for (auto& buf : outR_) buf.assign(kLinearPhaseHop, 0.0f);
+        taper_.assign(kLinearPhaseTaps, 0.0f);
+        Window::generateKaiser(taper_.data(), kLinearPhaseTaps, kLinearPhaseKaiserBeta);
+
+        prepared_ = true;
+        reset();
+    }
+
+    /// @brief Clear all filter and frame history.
+    void reset() noexcept {
+        for (auto& split : splits_) {
+            split.lpState.fill(0.0f);
+            split.hpState.fill(0.0f);
+        }
+        for (auto& state : allpassState_) state.fill(0.0f);
+
+        std::fill(windowL_.begin(), windowL_.end(), 0.0f);
+        std::fill(windowR_.begin(), windowR_.end(), 0.0f);
+        for (auto& buf : outL_) std::fill(buf.begin(), buf.end(), 0.0f);
+        for (auto& buf : outR_) std::fill(buf.begin(), buf.end(), 0.0f);
+        hopPosition_ = 0;
+        designedBands_ = 0;  // force a kernel design on the first frame
+    }
+
+    // =========================================================================
+    // Parameters (real-time safe)
+    // =========================================================================
+
+    /// @brief Number of output bands [1, kMaxBands].
+    void setNumBands(int numBands) noexcept {
+        numBands_ = std::clamp(numBands, 1, kMaxBands);
+    }
+
+    /// @brief Split frequency between band index and index + 1 (smoothed in
+    /// minimum phase, applied at the next frame in linear phase).
+    void setCrossoverFrequency(int index, float hz) noexcept {
+        if (index < 0 || index >= kMaxBands - 1) return;
+        splits_[static_cast<size_t>(index)].target = clampFrequency(hz);
+        splits_[static_cast<size_t>(index)].smoother.setTarget(
+            splits_[static_cast<size_t>(index)].target);
+    }
+
+    /// @brief Switch phase mode. Clears history (the output restarts from
+    /// silence) since the two modes have different latency.
+    void setPhase(CrossoverPhase phase) noexcept {
+        if (phase == phase_) return;
+        phase_ = phase;
+        reset();
+    }
+
+    [[nodiscard]] int numBands() const noexcept { return numBands_; }
+    [[nodiscard]] float crossoverFrequency(int index) const noexcept {
+        if (index < 0 || index >= kMaxBands - 1) return 0.0f;
+        return splits_[static_cast<size_t>(index)].target;
+    }
+    [[nodiscard]] CrossoverPhase phase() const noexcept { return phase_; }
+    [[nodiscard]] bool isPrepared() const noexcept { return prepared_; }
+
+    /// @brief Delay of every band relative to the input, in samples.
+    [[nodiscard]] size_t latency() const noexcept {
+        return phase_ == CrossoverPhase::Linear ? linearPhaseLatency() : 0;
+    }
+
+    [[nodiscard]] static constexpr size_t linearPhaseLatency() noexcept {
+        return kLinearPhaseHop + (kLinearPhaseTaps - 1) / 2;
+    }
+
+    // =========================================================================
+    // Processing (real-time safe)
+    // =========================================================================
+
+    /// @brief Split a stereo block into numBands() band buffers per channel.
+    /// @param bandsL, bandsR numBands() pointers to numSamples floats each
+    /// @note Non-finite input samples are treated as silence.
+    void process(const float* inL, const float* inR, float* const* bandsL,
+                 float* const* bandsR, size_t numSamples) noexcept {
+        if (!prepared_) {
+            for (int b = 0; b < numBands_; ++b) {
+                std::memset(bandsL[b], 0, numSamples * sizeof(float));
+                std::memset(bandsR[b], 0, numSamples * sizeof(float));
+            }
+            return;
+        }
+        if (phase_ == CrossoverPhase::Linear) {
+            processLinear(inL, inR, bandsL, bandsR, numSamples);
+            return;
+        }
+        if (numBands_ == 1) {
+            std::memcpy(bandsL[0], inL, numSamples * sizeof(float));
+            std::memcpy(bandsR[0], inR, numSamples * sizeof(float));
+            return;
+        }
+        for (size_t done = 0; done < numSamples; done += kChunkSize) {
+            const size_t len = std::min(kChunkSize, numSamples - done);
+            processMinimumChunk(inL + done, inR + done, bandsL, bandsR, done, len);
+        }
+    }
+
+private:
+    /// One LR4 split: two identical Butterworth LP and HP sections, plus the
+    /// allpass that lower bands use to match its phase
+    struct Split {
+        OnePoleSmoother smoother;
+        float target = 1000.0f;
+        float coeffFrequency = 0.0f;
+        std::array<float, 2 * kBiquadStereoCoeffStride> lp{};
+        std::array<float, 2 * kBiquadStereoCoeffStride> hp{};
+        std::array<float, kBiquadStereoCoeffStride> allpass{};
+        std::array<float, 2 * kBiquadStereoStateStride> lpState{};
+        std::array<float, 2 * kBiquadStereoStateStride> hpState{};
+    };
+
+    static constexpr size_t kMaxAllpasses = kMaxBands - 2;
+
+    // =========================================================================
+    // Minimum phase
+    // =========================================================================
+
+    [[nodiscard]] float clampFrequency(float hz) const noexcept {
+        const float maxHz = static_cast<float>(sampleRate_) * kMaxFrequencyRatio;
+        return std::clamp(hz, kMinFrequency, std::max(maxHz, kMinFrequency));
+    }
+
+    static void storeCoefficients(const BiquadCoefficients& c, float* dst) noexcept {
+        dst[0] = c.b0;
+        dst[1] = c.b1;
+        dst[2] = c.b2;
+        dst[3] = c.a1;
+        dst[4] = c.a2;
+    }
+
+    void updateSplitCoefficients(Split& split, float hz) const noexcept {
+        const auto sr = static_cast<float>(sampleRate_);
+        const auto lp = BiquadCoefficients::calculate(FilterType::Lowpass, hz, kButterworthQ,
+                                                      0.0f, sr);
+        const auto hp = BiquadCoefficients::calculate(FilterType::Highpass, hz, kButterworthQ,
+                                                      0.0f, sr);
+        const auto ap = BiquadCoefficients::calculate(FilterType::Allpass, hz, kAllpassQ,
+                                                      0.0f, sr);
+        for (size_t s = 0; s < 2; ++s) {
+            storeCoefficients(lp, split.lp.data() + s * kBiquadStereoCoeffStride);
+            storeCoefficients(hp, split.hp.data() + s * kBiquadStereoCoeffStride);
+        }
+        storeCoefficients(ap, split.allpass.data());
+        split.coeffFrequency = hz;
+    }
+
+    /// Copy split j's allpass into every lower band's compensation chain.
+    /// Band b carries allpasses for splits b+1 .. numBands-2, in order.
+    void propagateAllpass(int j) noexcept {
+        const auto& ap = splits_[static_cast<size_t>(j)].allpass;
+        for (int band = 0; band < j; ++band) {
+            const auto section = static_cast<size_t>(j - band - 1);
+            std::copy(ap.begin(), ap.end(),
+                      allpassCoeffs_[static_cast<size_t>(band)].begin() +
+                          static_cast<std::ptrdiff_t>(section * kBiquadStereoCoeffStride));
+        }
+    }
+
+    /// Advance the smoothers by one chunk and refresh coefficients that moved
+    void advanceSmoothing(size_t len) noexcept {
+        for (int j = 0; j < numBands_ - 1; ++j) {
+            auto& split = splits_[static_cast<size_t>(j)];
+            float hz = split.target;
+            if (!split.smoother.isComplete()) {
+                split.smoother.advanceSamples(len);
+                hz = split.smoother.getCurrentValue();
+            }
+            // Settle exactly on the target once smoothing completes
+            if (hz == split.coeffFrequency) continue;
+            if (std::abs(hz - split.coeffFrequency) >= kHysteresisHz || hz == split.target) {
+                updateSplitCoefficients(split, hz);
+                propagateAllpass(j);
+            }
+        }
+    }
+
+    void processMinimumChunk(const float* inL, const float* inR, float* const* bandsL,
+                             float* const* bandsR, size_t offset, size_t len) noexcept {
+        advanceSmoothing(len);
+
+        float* rest = scratch_[static_cast<size_t>(numBands_ - 1)].data();
+        for (size_t i = 0; i < len; ++i) {
+            rest[2 * i] = detail::isFiniteBits(inL[i]) ? inL[i] : 0.0f;
+            rest[2 * i + 1] = detail::isFiniteBits(inR[i]) ? inR[i] : 0.0f;
+        }
+
+        // Input -> split 0 -> (band 0, rest) -> split 1 -> (band 1, rest) ...
+        for (int j = 0; j < numBands_ - 1; ++j) {
+            auto& split = splits_[static_cast<size_t>(j)];
+            float* low = scratch_[static_cast<size_t>(j)].data();
+            std::memcpy(low, rest, 2 * len * sizeof(float));
+            biquadCascadeStereo(low, len, split.lp.data(), split.lpState.data(), 2);
+            biquadCascadeStereo(rest, len, split.hp.data(), split.hpState.data(), 2);
+        }
+
+        // D'Appolito compensation: band b gets allpasses at splits b+1..N-2
+        for (int b = 0; b < numBands_ - 2; ++b) {
+            const auto band = static_cast<size_t>(b);
+            biquadCascadeStereo(scratch_[band].data(), len, allpassCoeffs_[band].data(),
+                                allpassState_[band].data(),
+                                static_cast<size_t>(numBands_ - 2 - b));
+        }
+
+        for (int b = 0; b < numBands_; ++b) {
+            const float* lr = scratch_[static_cast<size_t>(b)].data();
+            float* left = bandsL[b] + offset;
+            float* right = bandsR[b] + offset;
+            for (size_t i = 0; i < len; ++i) {
+                left[i] = lr[2 * i];
+                right[i] = lr[2 * i + 1];
+            }
+        }
+    }
+
+    // =========================================================================
+    // Linear phase
+    // =========================================================================
+
+    /// |LR4 lowpass| = 1 / (1 + (f/fc)^4); the highpass is its complement
+    [[nodiscard]] static float lowMagnitude(float hz, float fc) noexcept {
+        const float r = hz / fc;
+        const float r2 = r * r;
+        return 1.0f / (1.0f + r2 * r2);
+    }
+
+    [[nodiscard]] float bandMagnitude(int band, float hz) const noexcept {
+        float mag = 1.0f;
+        for (int j = 0; j < band; ++j) {
+            mag *= 1.0f - lowMagnitude(hz, splits_[static_cast<size_t>(j)].target);
+        }
+        if (band < numBands_ - 1) {
+            mag *= lowMagnitude(hz, splits_[static_cast<size_t>(band)].target);
+        }
+        return mag;
+    }
+
+    [[nodiscard]] bool kernelsOutdated() const noexcept {
+        if (designedBands_ != numBands_) return true;
+        for (int j = 0; j < numBands_ - 1; ++j) {
+            if (designedFrequencies_[static_cast<size_t>(j)] !=
+                splits_[static_cast<size_t>(j)].target) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Zero-phase magnitude -> impulse, centred and Kaiser-windowed to
+    /// kLinearPhaseTaps, -> frame spectrum. The windows all equal 1 at the
+    /// centre tap, so the bands still sum to a pure delay.
+    void designKernels() noexcept {
+        const size_t N = kLinearPhaseFFTSize;
+        const size_t centre = (kLinearPhaseTaps - 1) / 2;
+        const float binHz = static_cast<float>(sampleRate_) / static_cast<float>(N);
+
+        for (int b = 0; b < numBands_; ++b) {
+            for (size_t k = 0; k < fft_.numBins(); ++k) {
+                productL_[k] = {bandMagnitude(b, static_cast<float>(k) * binHz), 0.0f};
+            }
+            const Complex* spectrum[] = {productL_.data()};
+            float* impulse[] = {frameL_.data()};
+            fft_.inverse(spectrum, impulse, 1);
+
+            std::fill(frameR_.begin(), frameR_.end(), 0.0f);
+            for (size_t n = 0; n < kLinearPhaseTaps; ++n) {
+                frameR_[n] = frameL_[(n + N - centre) % N] * taper_[n];
+            }
+            const float* taps[] = {frameR_.data()};
+            Complex* kernel[] = {kernels_[static_cast<size_t>(b)].data()};
+            fft_.forward(taps, kernel, 1);
+        }
+
+        for (int j = 0; j < numBands_ - 1; ++j) {
+            designedFrequencies_[static_cast<size_t>(j)] = splits_[static_cast<size_t>(j)].target;
+        }
+        designedBands_ = numBands_;
+    }
+
+    /// Overlap-save frame: the window holds the previous and the new hop;
+    /// the last hop of each band's circular convolution is alias-free.
+    void runFrame() noexcept {
+        if (kernelsOutdated()) designKernels();
+
+        const size_t N = kLinearPhaseFFTSize;
+        fft_.forwardPair(windowL_.data(), windowR_.data(), specL_.data(), specR_.data());
+        for (int b = 0; b < numBands_; ++b) {
+            const auto& kernel = kernels_[static_cast<size_t>(b)];
+            for (size_t k = 0; k < fft_.numBins(); ++k) {
+                productL_[k] = specL_[k] * kernel[k];
+                productR_[k] = specR_[k] * kernel[k];
+            }
+            fft_.inversePair(productL_.data(), productR_.data(), frameL_.data(),
+                             frameR_.data());
+            std::memcpy(outL_[static_cast<size_t>(b)].data(), frameL_.data() + (N - kLinearPhaseHop),
+                        kLinearPhaseHop * sizeof(float));
+            std::memcpy(outR_[static_cast<size_t>(b)].data(), frameR_.data() + (N - kLinearPhaseHop),
+                        kLinearPhaseHop * sizeof(float));
+        }
+
+        std::memcpy(windowL_.data(), windowL_.data() + kLinearPhaseHop,
+                    kLinearPhaseHop * sizeof(float));
+        std::memcpy(windowR_.data(), windowR_.data() + kLinearPhaseHop,
+                    kLinearPhaseHop * sizeof(float));
+    }
+
+    void processLinear(const float* inL, const float* inR, float* const* bandsL,
+                       float* const* bandsR, size_t numSamples) noexcept {
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t len = std::min(numSamples - done, kLinearPhaseHop - hopPosition_);
+            float* newL = windowL_.data() + kLinearPhaseHop + hopPosition_;
+            float* newR = windowR_.data() + kLinearPhaseHop + hopPosition_;
+            for (size_t i = 0; i < len; ++i) {
+                newL[i] = detail::isFiniteBits(inL[done + i]) ? inL[done + i] : 0.0f;
+                newR[i] = detail::isFiniteBits(inR[done + i]) ? inR[done + i] : 0.0f;
+            }
+            for (int b = 0; b < numBands_; ++b) {
+                std::memcpy(bandsL[b] + done, outL_[static_cast<size_t>(b)].data() + hopPosition_,
+                            len * sizeof(float));
+                std::memcpy(bandsR[b] + done, outR_[static_cast<size_t>(b)].data() + hopPosition_,
+                            len * sizeof(float));
+            }
+
+            hopPosition_ += len;
+            done += len;
+            if (hopPosition_ == kLinearPhaseHop) {
+                runFrame();
+                hopPosition_ = 0;
+            }
+        }
+    }
+
+    // =========================================================================
+    // Members
+    // =========================================================================
+
+    double sampleRate_ = 44100.0;
+    int numBands_ = 2;
+    CrossoverPhase phase_ = CrossoverPhase::Minimum;
+    bool prepared_ = false;
+
+    // Minimum phase
+    std::array<Split, kMaxBands - 1> splits_{};
+    std::array<std::array<float, kMaxAllpasses * kBiquadStereoCoeffStride>, kMaxAllpasses>
+        allpassCoeffs_{};
+    std::array<std::array<float, kMaxAllpasses * kBiquadStereoStateStride>, kMaxAllpasses>
+        allpassState_{};
+    std::array<std::array<float, 2 * kChunkSize>, kMaxBands> scratch_{};  // interleaved L/R
+
+    // Linear phase
+    BatchFFT fft_;
+    std::array<std::vector<Complex>, kMaxBands> kernels_;
+    std::array<float, kMaxBands - 1> designedFrequencies_{};
+    int designedBands_ = 0;
+    std::vector<float> taper_;
+    std::vector<float> windowL_, windowR_;   // previous hop | new hop
+    std::vector<Complex> specL_, specR_, productL_, productR_;
+    std::vector<float> frameL_, frameR_;
+    std::array<std::vector<float>, kMaxBands> outL_, outR_;
+    size_t hopPosition_ = 0;
+};
+
+}  // namespace DSP
+}  // namespace Krate
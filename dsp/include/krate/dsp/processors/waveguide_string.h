@@ -450,6 +450,12 @@ public:
     /// @return true if prepare() has been called
     [[nodiscard]] bool isPrepared() const noexcept { return prepared_; }
 
+    /// @return Heap memory held by the two delay lines, in bytes
+    [[nodiscard]] size_t heapBytes() const noexcept
+    {
+        return nutSideDelay_.heapBytes() + bridgeSideDelay_.heapBytes();
+    }
+
     // Debug accessors (TEST ONLY -- will be removed after tuning calibration)
     size_t debugNutDelay_ = 0;
     size_t debugBridgeDelay_ = 0;
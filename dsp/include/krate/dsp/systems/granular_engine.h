@@ -20,7 +20,11 @@
 #include <krate/dsp/processors/grain_processor.h>
 #include <krate/dsp/processors/grain_scheduler.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 namespace Krate::DSP {
 
@@ -33,6 +37,10 @@ public:
     static constexpr float kDefaultSmoothTimeMs = 20.0f;
     static constexpr float kFreezeCrossfadeMs = 50.0f;
 
+    /// processBlock() works through the block in chunks of at most this many
+    /// samples (bounded further by the delay buffers' read headroom)
+    static constexpr size_t kBlockChunk = 128;
+
     /// Prepare engine for processing
     /// @param sampleRate Current sample rate
     /// @param maxDelaySeconds Maximum delay buffer length in seconds
@@ -60,6 +68,12 @@ public:
         // Configure freeze crossfade
         freezeCrossfade_.configure(kFreezeCrossfadeMs, static_cast<float>(sampleRate));
 
+        // Gain compensation per active grain count (block path)
+        invSqrtCount_[0] = 1.0f;
+        for (size_t n = 1; n < invSqrtCount_.size(); ++n) {
+            invSqrtCount_[n] = 1.0f / std::sqrt(static_cast<float>(n));
+        }
+
         reset();
     }
 
@@ -202,7 +216,8 @@ public:
 
         // Check if we should trigger a new grain
         if (scheduler_.process()) {
-            triggerNewGrain(smoothedGrainSize, smoothedPitch, smoothedPosition);
+            triggerNewGrain(smoothedGrainSize, smoothedPitch, smoothedPosition,
+                            currentSample_);
         }
 
         // Process all active grains
@@ -239,6 +254,34 @@ public:
         ++currentSample_;
     }
 
+    /// Process a block of stereo audio
+    ///
+    /// Same result as calling process() once per sample, organised for
+    /// throughput: each chunk of input is written to the delay buffers first,
+    /// grain triggers are located up front, and every active grain is then
+    /// rendered across the chunk (up to the next trigger) in one loop.
+    /// Grain-size, pitch and position smoothers advance at block rate and are
+    /// sampled only where a grain starts. In-place processing is supported.
+    /// @param inputL Left input buffer
+    /// @param inputR Right input buffer
+    /// @param outputL Left output buffer
+    /// @param outputR Right output buffer
+    /// @param numSamples Number of samples to process
+    void processBlock(const float* inputL, const float* inputR,
+                      float* outputL, float* outputR, size_t numSamples) noexcept {
+        const size_t chunkLimit = std::clamp<size_t>(
+            std::min(delayL_.blockReadHeadroom(), delayR_.blockReadHeadroom()),
+            1, kBlockChunk);
+
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t count = std::min(chunkLimit, numSamples - offset);
+            processChunk(inputL + offset, inputR + offset,
+                         outputL + offset, outputR + offset, count);
+            offset += count;
+        }
+    }
+
     /// Get current active grain count
     [[nodiscard]] size_t activeGrainCount() const noexcept {
         return pool_.activeCount();
@@ -251,9 +294,99 @@ public:
     }
 
 private:
+    void processChunk(const float* inputL, const float* inputR,
+                      float* outputL, float* outputR, size_t numSamples) noexcept {
+        // Write the chunk to the delay buffers (freeze crossfade per sample).
+        // frozen_ is fixed for the chunk and the ramp only moves towards it,
+        // so the samples that write always form a prefix of the chunk.
+        size_t numWritten = 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float freezeAmount = freezeCrossfade_.process();
+            if (freezeAmount < 1.0f) {
+                const float writeAmount = 1.0f - freezeAmount;
+                delayL_.write(inputL[i] * writeAmount);
+                delayR_.write(inputR[i] * writeAmount);
+                ++numWritten;
+            } else if (!frozen_) {
+                delayL_.write(inputL[i]);
+                delayR_.write(inputR[i]);
+                ++numWritten;
+            }
+        }
+
+        // Locate grain triggers
+        size_t numTriggers = 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            if (scheduler_.process()) {
+                triggers_[numTriggers++] = static_cast<uint16_t>(i);
+            }
+        }
+
+        std::fill_n(sumL_.begin(), numSamples, 0.0f);
+        std::fill_n(sumR_.begin(), numSamples, 0.0f);
+        std::fill_n(grainCount_.begin(), numSamples, uint8_t{0});
+
+        // Render segment by segment: a trigger starts (or steals) a grain at
+        // its sample, exactly where process() would have
+        size_t segmentStart = 0;
+        size_t smoothedUpTo = 0;  // samples the parameter smoothers have advanced
+        for (size_t t = 0; t <= numTriggers; ++t) {
+            const size_t segmentEnd = (t < numTriggers) ? triggers_[t] : numSamples;
+            renderGrains(segmentStart, segmentEnd, numWritten);
+
+            if (t < numTriggers) {
+                // process() reads the smoothers after stepping them for this sample
+                advanceParameterSmoothers(segmentEnd + 1 - smoothedUpTo);
+                smoothedUpTo = segmentEnd + 1;
+                triggerNewGrain(grainSizeSmoother_.getCurrentValue(),
+                                pitchSmoother_.getCurrentValue(),
+                                positionSmoother_.getCurrentValue(),
+                                currentSample_ + segmentEnd);
+            }
+            segmentStart = segmentEnd;
+        }
+        advanceParameterSmoothers(numSamples - smoothedUpTo);
+
+        // 1/sqrt(n) gain scaling, smoothed per sample as in process()
+        for (size_t i = 0; i < numSamples; ++i) {
+            gainScaleSmoother_.setTarget(invSqrtCount_[grainCount_[i]]);
+            const float smoothedGain = gainScaleSmoother_.process();
+            outputL[i] = sumL_[i] * smoothedGain;
+            outputR[i] = sumR_[i] * smoothedGain;
+        }
+
+        currentSample_ += numSamples;
+    }
+
+    /// Render every active grain over [begin, end) of the current chunk,
+    /// whose first numWritten samples were written to the delay buffers
+    void renderGrains(size_t begin, size_t end, size_t numWritten) noexcept {
+        if (begin >= end) return;
+        const size_t length = end - begin;
+        const size_t writesAfterFirst = (numWritten > begin) ? numWritten - 1 - begin : 0;
+
+        for (Grain* grain : pool_.activeGrains()) {
+            const size_t rendered = processor_.processGrainBlock(
+                *grain, delayL_, delayR_, sumL_.data() + begin, sumR_.data() + begin,
+                length, writesAfterFirst);
+            for (size_t i = 0; i < rendered; ++i) {
+                ++grainCount_[begin + i];
+            }
+            if (processor_.isGrainComplete(*grain)) {
+                pool_.releaseGrain(grain);
+            }
+        }
+    }
+
+    void advanceParameterSmoothers(size_t numSamples) noexcept {
+        grainSizeSmoother_.advanceSamples(numSamples);
+        pitchSmoother_.advanceSamples(numSamples);
+        positionSmoother_.advanceSamples(numSamples);
+    }
+
     void triggerNewGrain(float grainSizeMs, float pitchSemitones,
-                         float positionMs) noexcept {
-        Grain* grain = pool_.acquireGrain(currentSample_);
+                         float positionMs, size_t sampleIndex) noexcept {
+        Grain* grain = pool_.acquireGrain(sampleIndex);
         if (grain == nullptr) {
             return;  // No grain available (shouldn't happen with stealing)
         }
@@ -341,6 +474,13 @@ private:
 
     size_t currentSample_ = 0;
     double sampleRate_ = 44100.0;
+
+    // Block processing scratch (processBlock)
+    std::array<float, kBlockChunk> sumL_{};
+    std::array<float, kBlockChunk> sumR_{};
+    std::array<uint8_t, kBlockChunk> grainCount_{};
+    std::array<uint16_t, kBlockChunk> triggers_{};
+    std::array<float, GrainPool::kMaxGrains + 1> invSqrtCount_{};
 };
 
 }  // namespace Krate::DSP
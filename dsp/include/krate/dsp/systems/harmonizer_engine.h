@@ -35,6 +35,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <numbers>
 #include <vector>
 
 namespace Krate::DSP {
@@ -69,6 +70,20 @@ enum class HarmonyMode : uint8_t {
 /// (Simple, Granular, PitchSync), the standard per-voice process() path
 /// is used unchanged (FR-014).
 ///
+/// @par Spectral Summation (optional, PhaseVocoder mode)
+/// Voice level, pan and OLA are all linear, so with setSpectralSummation(true)
+/// each voice's synthesis spectrum is scaled by its left/right gains and
+/// accumulated into one spectrum per output channel; a single stereo IFFT +
+/// OLA then replaces the per-voice IFFTs. Onset delays up to
+/// kMaxSpectralDelaySamples become a per-bin phase ramp; voices with longer
+/// delays keep their own IFFT and post-pitch DelayLine. Detune is already
+/// part of each voice's pitch ratio. Trade-off: level, pan and fade-in are
+/// sampled once per block and reach the output through the synthesis window,
+/// so their changes are interpolated per hop and heard one PV latency later.
+/// With static parameters the summed output matches the per-voice output to
+/// about 1e-7 relative RMS. No plugin enables it yet; only the unit tests
+/// and the phase_vocoder_4_voices_summed bench do.
+///
 /// @par Real-Time Safety
 /// All processing methods are noexcept. Zero heap allocations after prepare().
 /// No locks, no I/O, no exceptions in the process path.
@@ -93,6 +108,12 @@ public:
     static constexpr float kMinDetuneCents = -50.0f;
     static constexpr float kMaxDetuneCents = 50.0f;
 
+    /// Longest onset delay applied as a spectral phase ramp in spectral
+    /// summation mode. The ramp is a circular shift of the synthesis frame;
+    /// past 1/16 of the FFT the wrapped tail is no longer negligible.
+    static constexpr float kMaxSpectralDelaySamples =
+        static_cast<float>(PitchShiftProcessor::getPhaseVocoderFFTSize() / 16);
+
     // Smoothing time constants (milliseconds)
     static constexpr float kPitchSmoothTimeMs = 10.0f;
     static constexpr float kLevelSmoothTimeMs = 5.0f;
@@ -152,6 +173,12 @@ public:
         sharedAnalysisSpectrum_.prepare(fftSize);
         pvVoiceScratch_.resize(maxBlockSize, 0.0f);
 
+        // Spectral summation: one stereo synthesis for all summed voices,
+        // windowed like the voices' own OLA so the two routings match
+        summedOla_.prepare(2, fftSize, hopSize, WindowType::Hann, 9.0f, true);
+        for (auto& spectrum : summedSpectrum_) spectrum.prepare(fftSize);
+        for (auto& scratch : summedScratch_) scratch.resize(maxBlockSize, 0.0f);
+
         prepared_ = true;
     }
 
@@ -190,6 +217,8 @@ public:
         sharedStft_.reset();
         sharedAnalysisSpectrum_.reset();
         std::fill(pvVoiceScratch_.begin(), pvVoiceScratch_.end(), 0.0f);
+        summedOla_.reset();
+        for (auto& spectrum : summedSpectrum_) spectrum.reset();
 
         // Reset pitch tracking state
         lastDetectedNote_ = -1;
@@ -272,16 +301,46 @@ public:
                     voice.pitchShifter.setSemitones(smoothedPitch);
                 }
 
+                // Step 2b: Spectral summation routing. Summed voices take
+                // their level/pan/fade gains once per block; voices whose
+                // delay is too long for a phase ramp stay on their own OLA.
+                std::array<bool, kMaxVoices> summed{};
+                std::array<float, kMaxVoices> summedGainL{};
+                std::array<float, kMaxVoices> summedGainR{};
+                if (spectralSummation_) {
+                    for (int v = 0; v < numActiveVoices_; ++v) {
+                        const auto vi = static_cast<std::size_t>(v);
+                        auto& voice = voices_[vi];
+                        if (voice.linearGain == 0.0f ||
+                            voice.delaySamples > kMaxSpectralDelaySamples) {
+                            continue;
+                        }
+                        summed[vi] = true;
+                        takeSummedVoiceGains(voice, numSamples, summedGainL[vi],
+                                             summedGainR[vi]);
+
+                        // Drop any tail left in the voice's own OLA from
+                        // per-voice routing so it cannot resurface later
+                        while (voice.pitchShifter.pullSharedAnalysisOutput(
+                                   pvVoiceScratch_.data(), pvVoiceScratch_.size()) > 0) {
+                        }
+                    }
+                }
+
                 // Step 3: Push input to shared STFT (once for all voices)
                 sharedStft_.pushSamples(input, numSamples);
 
                 // Step 4: Process all ready analysis frames
                 while (sharedStft_.canAnalyze()) {
                     sharedStft_.analyze(sharedAnalysisSpectrum_);
+                    if (spectralSummation_) {
+                        for (auto& spectrum : summedSpectrum_) spectrum.reset();
+                    }
 
                     // Pass shared spectrum to each active voice
                     for (int v = 0; v < numActiveVoices_; ++v) {
-                        auto& voice = voices_[static_cast<std::size_t>(v)];
+                        const auto vi = static_cast<std::size_t>(v);
+                        auto& voice = voices_[vi];
                         if (voice.linearGain == 0.0f) continue;
 
                         float pitchRatio = semitonesToRatio(
@@ -290,7 +349,18 @@ public:
                         // FR-025: Unity-pitch bypass at engine level
                         // Matches PhaseVocoderPitchShifter::processUnityPitch()
                         // behavior for SC-002 output equivalence
-                        if (std::abs(pitchRatio - 1.0f) < 0.0001f) {
+                        const bool unity = std::abs(pitchRatio - 1.0f) < 0.0001f;
+
+                        if (summed[vi]) {
+                            const SpectralBuffer* spectrum =
+                                unity ? &sharedAnalysisSpectrum_
+                                      : voice.pitchShifter.processSharedAnalysisSpectrum(
+                                            sharedAnalysisSpectrum_, pitchRatio);
+                            if (spectrum != nullptr) {
+                                accumulateSummedVoice(*spectrum, summedGainL[vi],
+                                                      summedGainR[vi], voice.delaySamples);
+                            }
+                        } else if (unity) {
                             voice.pitchShifter.synthesizePassthrough(
                                 sharedAnalysisSpectrum_);
                         } else {
@@ -298,12 +368,21 @@ public:
                                 sharedAnalysisSpectrum_, pitchRatio);
                         }
                     }
+
+                    // One stereo IFFT + OLA for every summed voice
+                    if (spectralSummation_) {
+                        const std::array<const SpectralBuffer*, 2> sums = {
+                            &summedSpectrum_[0], &summedSpectrum_[1]};
+                        summedOla_.synthesize(sums.data());
+                    }
                 }
 
                 // Step 5: Pull output from each voice and apply level/pan/delay
                 for (int v = 0; v < numActiveVoices_; ++v) {
                     auto& voice = voices_[static_cast<std::size_t>(v)];
-                    if (voice.linearGain == 0.0f) continue;
+                    if (voice.linearGain == 0.0f || summed[static_cast<std::size_t>(v)]) {
+                        continue;
+                    }
 
                     // Pull OLA output into pvVoiceScratch_
                     std::size_t available =
@@ -363,6 +442,21 @@ public:
                         }
                     }
                 }
+
+                // Step 5b: Add the summed voices' stereo OLA output
+                if (spectralSummation_) {
+                    const std::size_t toPull =
+                        std::min(numSamples, summedOla_.samplesAvailable());
+                    if (toPull > 0) {
+                        const std::array<float*, 2> pulled = {summedScratch_[0].data(),
+                                                              summedScratch_[1].data()};
+                        summedOla_.pullSamples(pulled.data(), toPull);
+                        for (std::size_t s = 0; s < toPull; ++s) {
+                            outputL[s] += summedScratch_[0][s];
+                            outputR[s] += summedScratch_[1][s];
+                        }
+                    }
+                }
             } else if (pitchShiftMode_ == PitchMode::PitchSync) {
                 // ====== SHARED PITCH DETECTION PATH (PitchSync optimization) ======
                 // Run a single PitchDetector on the input and pass results to all voices.
@@ -622,6 +716,23 @@ public:
         }
     }
 
+    /// @brief Sum PhaseVocoder voices in the spectral domain (one stereo IFFT
+    /// per frame instead of one per voice). Off by default. Switching clears
+    /// the voices' synthesis state, as a pitch-mode change does.
+    void setSpectralSummation(bool enabled) noexcept {
+        if (enabled == spectralSummation_) return;
+        spectralSummation_ = enabled;
+        summedOla_.reset();
+        for (auto& voice : voices_) {
+            voice.pitchShifter.reset();
+        }
+    }
+
+    /// @brief Get the spectral summation state.
+    [[nodiscard]] bool getSpectralSummation() const noexcept {
+        return spectralSummation_;
+    }
+
     /// @brief Enable or disable formant preservation for all voices.
     void setFormantPreserve(bool enable) noexcept {
         formantPreserve_ = enable;
@@ -796,6 +907,82 @@ private:
         voice.panSmoother.advanceSamples(numSamples);
     }
 
+    /// Block gains for a voice summed in the spectral domain. Level, pan and
+    /// fade-in are sampled at the block start and their ramps advanced past
+    /// the block, matching the per-sample path at block boundaries.
+    static void takeSummedVoiceGains(Voice& voice, std::size_t numSamples,
+                                     float& gainL, float& gainR) noexcept {
+        const float levelGain = voice.levelSmoother.process();
+        const float panVal = voice.panSmoother.process();
+        if (numSamples > 1) {
+            voice.levelSmoother.advanceSamples(numSamples - 1);
+            voice.panSmoother.advanceSamples(numSamples - 1);
+        }
+
+        // Constant-power pan (FR-005) with the quadratic fade-in curve
+        const float angle = (panVal + 1.0f) * kPi * 0.25f;
+        const float gain = levelGain * voice.fadeInGain * voice.fadeInGain;
+        gainL = gain * std::cos(angle);
+        gainR = gain * std::sin(angle);
+
+        if (voice.fadeInGain < 1.0f) {
+            voice.fadeInGain += voice.fadeInIncrement * static_cast<float>(numSamples);
+            if (voice.fadeInGain >= 1.0f) {
+                voice.fadeInGain = 1.0f;
+                voice.fadeInIncrement = 0.0f;
+            }
+        }
+    }
+
+    /// Add one voice's synthesis spectrum to the left/right sums, delayed by
+    /// delaySamples as a linear phase ramp exp(-j*2*pi*k*d/N).
+    void accumulateSummedVoice(const SpectralBuffer& spectrum, float gainL, float gainR,
+                               float delaySamples) noexcept {
+        const Complex* src = spectrum.data();
+        Complex* sumL = summedSpectrum_[0].data();
+        Complex* sumR = summedSpectrum_[1].data();
+        const std::size_t numBins = spectrum.numBins();
+
+        if (delaySamples <= 0.0f) {
+            for (std::size_t k = 0; k < numBins; ++k) {
+                sumL[k].real += gainL * src[k].real;
+                sumL[k].imag += gainL * src[k].imag;
+                sumR[k].real += gainR * src[k].real;
+                sumR[k].imag += gainR * src[k].imag;
+            }
+            return;
+        }
+
+        // The ramp circularly shifts the frame under the Hann synthesis
+        // window, which scales the Hann^2 overlap sum by (2 + cos w) / 3 for
+        // w = 2*pi*d/N; undo that so the voice level does not depend on delay
+        constexpr auto fftSize =
+            static_cast<double>(PitchShiftProcessor::getPhaseVocoderFFTSize());
+        const double step = -2.0 * std::numbers::pi * static_cast<double>(delaySamples) / fftSize;
+        const auto overlapGain = static_cast<float>(3.0 / (2.0 + std::cos(step)));
+        gainL *= overlapGain;
+        gainR *= overlapGain;
+
+        const double stepRe = std::cos(step);
+        const double stepIm = std::sin(step);
+        double rotRe = 1.0;
+        double rotIm = 0.0;
+        for (std::size_t k = 0; k < numBins; ++k) {
+            const auto re = static_cast<float>(rotRe);
+            const auto im = static_cast<float>(rotIm);
+            const float shiftedRe = src[k].real * re - src[k].imag * im;
+            const float shiftedIm = src[k].real * im + src[k].imag * re;
+            sumL[k].real += gainL * shiftedRe;
+            sumL[k].imag += gainL * shiftedIm;
+            sumR[k].real += gainR * shiftedRe;
+            sumR[k].imag += gainR * shiftedIm;
+
+            const double nextRe = rotRe * stepRe - rotIm * stepIm;
+            rotIm = rotRe * stepIm + rotIm * stepRe;
+            rotRe = nextRe;
+        }
+    }
+
     // =========================================================================
     // Members
     // =========================================================================
@@ -832,6 +1019,12 @@ private:
     SpectralBuffer sharedAnalysisSpectrum_;     ///< Shared analysis result; passed as const ref to all voices (FR-019)
     std::vector<float> pvVoiceScratch_;         ///< Per-voice OLA output scratch buffer; sized to maxBlockSize
 
+    // Spectral summation (PhaseVocoder mode, optional)
+    bool spectralSummation_ = false;
+    MultiChannelOverlapAdd summedOla_;                  ///< Stereo IFFT + OLA shared by summed voices
+    std::array<SpectralBuffer, 2> summedSpectrum_;      ///< Per-frame L/R spectral sums
+    std::array<std::vector<float>, 2> summedScratch_;   ///< L/R OLA output scratch; sized to maxBlockSize
+
     // State
     double      sampleRate_       = 44100.0;
     std::size_t maxBlockSize_     = 0;
@@ -65,7 +65,7 @@ namespace Krate::DSP {
 /// WavetableData and MinBlepTable are shared across all oscillator slots
 /// within a voice to avoid per-slot duplication.
 struct OscillatorResources {
-    WavetableData* wavetable{nullptr};
+    const WavetableData* wavetable{nullptr};
     const MinBlepTable* minBlepTable{nullptr};
 };
 
@@ -443,7 +443,7 @@ private:
 
     // Resource pointer for WavetableOscillator (non-owning, set at construction).
     // Unused by other oscillator types but only wastes 8 bytes per adapter.
-    WavetableData* wavetable_{nullptr};
+    const WavetableData* wavetable_{nullptr};
 };
 
 } // namespace Krate::DSP
@@ -37,7 +37,7 @@
 #include <memory>
 
 // For fallback resource creation
-#include <krate/dsp/primitives/wavetable_generator.h>
+#include <krate/dsp/primitives/wavetable_cache.h>
 #include <krate/dsp/primitives/minblep_table.h>
 
 namespace Krate::DSP {
@@ -245,8 +245,7 @@ private:
         } else {
             // Create fallback resources for standalone use
             if (!fallbackWavetable_) {
-                fallbackWavetable_ = std::make_unique<WavetableData>();
-                generateMipmappedSaw(*fallbackWavetable_);
+                fallbackWavetable_ = WavetableCache::instance().acquire(CachedWaveform::Saw);
             }
             if (!fallbackMinBlep_) {
                 fallbackMinBlep_ = std::make_unique<MinBlepTable>();
@@ -306,7 +305,7 @@ private:
 
     /// @brief Fallback resources created when no external resources are provided.
     /// Used for standalone SelectableOscillator instances (e.g., in unit tests).
-    std::unique_ptr<WavetableData> fallbackWavetable_;
+    WavetableCache::Handle fallbackWavetable_;
     std::unique_ptr<MinBlepTable> fallbackMinBlep_;
 };
 
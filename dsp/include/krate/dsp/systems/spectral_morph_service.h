@@ -0,0 +1,450 @@
+// ==============================================================================
+// Layer 3: System Component - Shared Multi-Voice Spectral Morph
+// ==============================================================================
+// One spectral morph (SpectralMorphFilter's dual-input mode) for a whole
+// synth engine. Each voice owns a slot with its own input history, overlap-add
+// accumulator and morph/tilt smoothers; the FFT plans, window, tilt tables and
+// frame scratch are shared.
+//
+// Work is batched across voices: every pending frame runs OSC A and OSC B
+// through one paired forward transform, and the morphed frames of two voices
+// share one paired inverse, so N voices cost 1.5N complex transforms per hop
+// instead of 3N real ones. The blend stays Cartesian (morphSpectraBulk), with
+// no per-bin atan2 or sin/cos.
+//
+// Memory is allocated lazily: prepare() only records the configuration, and
+// ensureSlots() allocates the shared state plus the first N slots' buffers.
+// An engine that never selects spectral mixing pays nothing beyond the slot
+// table. ensureSlots() is a setup call like prepare(): it must not overlap
+// processing.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept processing, allocation only in
+//   ensureSlots())
+// - Principle III: Modern C++ (C++20, RAII)
+// - Principle IX: Layer 3 (depends on Layer 0, 1, 2 only)
+// - Principle XII: Test-First Development
+//
+// Reference: specs/080-spectral-morph-filter/spec.md
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/spectral_simd.h>
+#include <krate/dsp/core/window_functions.h>
+#include <krate/dsp/primitives/fft.h>
+#include <krate/dsp/primitives/smoother.h>
+#include <krate/dsp/processors/spectral_morph_filter.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Spectral morph for many voices sharing transforms and tables
+///
+/// Per block: push() each voice's two sources into its slot, call process()
+/// once to run every pending frame batched across slots, then pull() each
+/// slot's output. Output lags input by getLatencySamples().
+class SpectralMorphService {
+public:
+    static constexpr std::size_t kDefaultFFTSize = 1024;
+
+    SpectralMorphService() noexcept = default;
+    ~SpectralMorphService() noexcept = default;
+
+    SpectralMorphService(const SpectralMorphService&) = delete;
+    SpectralMorphService& operator=(const SpectralMorphService&) = delete;
+    SpectralMorphService(SpectralMorphService&&) = delete;
+    SpectralMorphService& operator=(SpectralMorphService&&) = delete;
+
+    // =========================================================================
+    // Lifecycle
+    // =========================================================================
+
+    /// @brief Configure for up to maxSlots voices
+    /// @param fftSize Power of 2 in [SpectralMorphFilter::kMinFFTSize, kMaxFFTSize]
+    /// @note Only the small slot table is allocated here. Slots that were
+    ///       already allocated are reallocated for the new configuration.
+    ///       Must not run concurrently with any other call.
+    void prepare(double sampleRate, std::size_t maxBlockSize, std::size_t maxSlots,
+                 std::size_t fftSize = kDefaultFFTSize) noexcept {
+        const std::size_t previouslyAllocated = allocatedSlots();
+
+        sampleRate_ = sampleRate;
+        maxBlockSize_ = std::max<std::size_t>(maxBlockSize, 1);
+        fftSize_ = std::bit_ceil(std::clamp(fftSize, SpectralMorphFilter::kMinFFTSize,
+                                            SpectralMorphFilter::kMaxFFTSize));
+        hopSize_ = fftSize_ / 2;  // 50% overlap, COLA with Hann
+
+        // Input history must still hold the oldest pending frame after a full
+        // block has been pushed; the output FIFO holds the initial hop of
+        // latency padding plus every hop one block can produce.
+        inputCapacity_ = std::bit_ceil(fftSize_ + maxBlockSize_);
+        outputCapacity_ = std::bit_ceil(maxBlockSize_ + 2 * hopSize_);
+
+        slots_.clear();
+        slots_.resize(maxSlots);
+        allocatedSlots_ = 0;
+        sharedReady_ = false;
+
+        const float frameRate = static_cast<float>(sampleRate_) / static_cast<float>(hopSize_);
+        for (auto& slot : slots_) {
+            slot.morphSmoother.configure(SpectralMorphFilter::kSmoothingTimeMs, frameRate);
+            slot.morphSmoother.snapTo(slot.morphAmount);
+            slot.tiltSmoother.configure(SpectralMorphFilter::kSmoothingTimeMs, frameRate);
+            slot.tiltSmoother.snapTo(slot.spectralTilt);
+        }
+
+        prepared_ = true;
+        if (previouslyAllocated > 0) ensureSlots(previouslyAllocated);
+    }
+
+    /// @brief Allocate the shared state and the buffers of slots [0, numSlots)
+    /// @note NOT real-time safe (allocates on first use and when growing).
+    ///       A no-op once numSlots slots are allocated. Must not run
+    ///       concurrently with any other call.
+    void ensureSlots(std::size_t numSlots) noexcept {
+        if (!prepared_) return;
+        numSlots = std::min(numSlots, slots_.size());
+        const std::size_t firstNew = allocatedSlots();
+        if (numSlots <= firstNew) return;
+
+        // Nothing reads the shared state while no slot is published
+        if (!sharedReady_) allocateShared();
+
+        for (std::size_t s = firstNew; s < numSlots; ++s) {
+            Slot& st = slots_[s];
+            st.storage.assign(2 * inputCapacity_ + fftSize_ + outputCapacity_, 0.0f);
+            clearSlotPositions(st);
+            snapSmoothers(st);
+        }
+        allocatedSlots_ = numSlots;
+    }
+
+    /// @brief Clear every allocated slot's history and output
+    void reset() noexcept {
+        const std::size_t numSlots = allocatedSlots();
+        for (std::size_t s = 0; s < numSlots; ++s) resetSlot(s);
+    }
+
+    /// @brief Clear one slot's history and output; its output restarts with
+    ///        getLatencySamples() of silence
+    void resetSlot(std::size_t slot) noexcept {
+        if (!isSlotAllocated(slot)) return;
+        Slot& st = slots_[slot];
+        std::fill(st.storage.begin(), st.storage.end(), 0.0f);
+        clearSlotPositions(st);
+        snapSmoothers(st);
+    }
+
+    // =========================================================================
+    // Parameters (stored per slot whether or not it is allocated)
+    // =========================================================================
+
+    /// @brief Morph amount: 0 = source A only, 1 = source B only (smoothed)
+    void setMorphAmount(std::size_t slot, float amount) noexcept {
+        if (slot >= slots_.size()) return;
+        slots_[slot].morphAmount = std::clamp(amount, SpectralMorphFilter::kMinMorphAmount,
+                                              SpectralMorphFilter::kMaxMorphAmount);
+        slots_[slot].morphSmoother.setTarget(slots_[slot].morphAmount);
+    }
+
+    /// @brief Spectral tilt in dB/octave around 1 kHz (smoothed)
+    void setSpectralTilt(std::size_t slot, float dBPerOctave) noexcept {
+        if (slot >= slots_.size()) return;
+        slots_[slot].spectralTilt = std::clamp(dBPerOctave, SpectralMorphFilter::kMinSpectralTilt,
+                                               SpectralMorphFilter::kMaxSpectralTilt);
+        slots_[slot].tiltSmoother.setTarget(slots_[slot].spectralTilt);
+    }
+
+    /// @brief Phase source for every slot
+    void setPhaseSource(PhaseSource source) noexcept { phaseSource_ = source; }
+
+    // =========================================================================
+    // Processing
+    // =========================================================================
+
+    /// @brief Append numSamples of both sources to a slot's input history
+    /// @pre numSamples <= maxBlockSize since the slot's last process()
+    /// @note Non-finite input resets the slot (as SpectralMorphFilter does)
+    void push(std::size_t slot, const float* inputA, const float* inputB,
+              std::size_t numSamples) noexcept {
+        if (!isSlotAllocated(slot) || inputA == nullptr || inputB == nullptr) return;
+        numSamples = std::min(numSamples, maxBlockSize_);
+
+        for (std::size_t i = 0; i < numSamples; ++i) {
+            if (!std::isfinite(inputA[i]) || !std::isfinite(inputB[i])) {
+                resetSlot(slot);
+                return;
+            }
+        }
+
+        Slot& st = slots_[slot];
+        const std::size_t mask = inputCapacity_ - 1;
+        std::size_t done = 0;
+        while (done < numSamples) {
+            const std::size_t pos = st.written & mask;
+            const std::size_t chunk = std::min(numSamples - done, inputCapacity_ - pos);
+            std::memcpy(historyA(st) + pos, inputA + done, chunk * sizeof(float));
+            std::memcpy(historyB(st) + pos, inputB + done, chunk * sizeof(float));
+            st.written += chunk;
+            done += chunk;
+        }
+    }
+
+    /// @brief Run every pending frame of every slot, two slots per batch
+    /// @note Real-time safe, noexcept
+    void process() noexcept {
+        std::array<std::size_t, 2> batch{};
+        bool pending = true;
+        while (pending) {
+            pending = false;
+            std::size_t count = 0;
+            const std::size_t numSlots = allocatedSlots();
+            for (std::size_t s = 0; s < numSlots; ++s) {
+                if (!hasPendingFrame(slots_[s])) continue;
+                batch[count++] = s;
+                if (count == batch.size()) {
+                    runFrames(batch.data(), count);
+                    count = 0;
+                }
+                pending = true;
+            }
+            if (count > 0) runFrames(batch.data(), count);
+        }
+    }
+
+    /// @brief Run the pending frames of one slot only (single-voice use)
+    void process(std::size_t slot) noexcept {
+        if (!isSlotAllocated(slot)) return;
+        while (hasPendingFrame(slots_[slot])) runFrames(&slot, 1);
+    }
+
+    /// @brief Read numSamples of morphed output (zeros if none is ready)
+    void pull(std::size_t slot, float* output, std::size_t numSamples) noexcept {
+        if (output == nullptr) return;
+        if (!isSlotAllocated(slot)) {
+            std::fill(output, output + numSamples, 0.0f);
+            return;
+        }
+
+        Slot& st = slots_[slot];
+        const float* fifo = outputFifo(st);
+        const std::size_t mask = outputCapacity_ - 1;
+        const std::size_t available = std::min(numSamples, st.outputWritten - st.outputRead);
+        for (std::size_t i = 0; i < available; ++i) {
+            output[i] = fifo[(st.outputRead + i) & mask];
+        }
+        std::fill(output + available, output + numSamples, 0.0f);
+        st.outputRead += available;
+    }
+
+    // =========================================================================
+    // Query
+    // =========================================================================
+
+    [[nodiscard]] bool isPrepared() const noexcept { return prepared_; }
+    [[nodiscard]] std::size_t maxSlots() const noexcept { return slots_.size(); }
+    [[nodiscard]] std::size_t allocatedSlots() const noexcept { return allocatedSlots_; }
+    [[nodiscard]] bool isSlotAllocated(std::size_t slot) const noexcept {
+        return slot < allocatedSlots();
+    }
+    [[nodiscard]] std::size_t getFftSize() const noexcept { return fftSize_; }
+
+    /// @brief Delay from push() to pull() in samples (equals the FFT size)
+    [[nodiscard]] std::size_t getLatencySamples() const noexcept { return fftSize_; }
+
+private:
+    struct Slot {
+        std::vector<float> storage;  // history A | history B | overlap | output FIFO
+        std::size_t written = 0;       // samples pushed (plus the zero history)
+        std::size_t nextFrameEnd = 0;  // history position the next frame ends at
+        std::size_t outputRead = 0;
+        std::size_t outputWritten = 0;
+        float morphAmount = 0.0f;
+        float spectralTilt = 0.0f;
+        OnePoleSmoother morphSmoother;
+        OnePoleSmoother tiltSmoother;
+    };
+
+    /// The input history starts fftSize zeros deep, so the first frame
+    /// completes after one hop
+    void clearSlotPositions(Slot& st) const noexcept {
+        st.written = fftSize_;
+        st.nextFrameEnd = fftSize_ + hopSize_;
+        st.outputRead = 0;
+        st.outputWritten = hopSize_;
+    }
+
+    static void snapSmoothers(Slot& st) noexcept {
+        st.morphSmoother.reset();
+        st.morphSmoother.snapTo(st.morphAmount);
+        st.tiltSmoother.reset();
+        st.tiltSmoother.snapTo(st.spectralTilt);
+    }
+
+    [[nodiscard]] float* historyA(Slot& st) const noexcept { return st.storage.data(); }
+    [[nodiscard]] float* historyB(Slot& st) const noexcept {
+        return st.storage.data() + inputCapacity_;
+    }
+    [[nodiscard]] float* overlap(Slot& st) const noexcept {
+        return st.storage.data() + 2 * inputCapacity_;
+    }
+    [[nodiscard]] float* outputFifo(Slot& st) const noexcept {
+        return st.storage.data() + 2 * inputCapacity_ + fftSize_;
+    }
+
+    [[nodiscard]] static bool hasPendingFrame(const Slot& st) noexcept {
+        return !st.storage.empty() && st.written >= st.nextFrameEnd;
+    }
+
+    /// Shared window, transforms, tilt table and frame scratch for two slots
+    void allocateShared() noexcept {
+        fft_.prepare(fftSize_);
+        window_ = Window::generate(WindowType::Hann, fftSize_);
+
+        // Overlap-add gain: COLA normalization as in OverlapAdd (no synthesis window)
+        float colaSum = 0.0f;
+        for (std::size_t idx = 0; idx < fftSize_; idx += hopSize_) colaSum += window_[idx];
+        colaNormalization_ = (colaSum > 0.0f) ? (1.0f / colaSum) : 1.0f;
+
+        const std::size_t numBins = fftSize_ / 2 + 1;
+        octavesFromPivot_.assign(numBins, 0.0f);
+        const float binFreqStep = static_cast<float>(sampleRate_) / static_cast<float>(fftSize_);
+        for (std::size_t bin = 1; bin < numBins; ++bin) {
+            const float binFreq = static_cast<float>(bin) * binFreqStep;
+            octavesFromPivot_[bin] = std::log2(binFreq / SpectralMorphFilter::kTiltPivotHz);
+        }
+        tiltGains_.assign(numBins, 1.0f);
+
+        for (std::size_t j = 0; j < 2; ++j) {
+            frameA_[j].assign(fftSize_, 0.0f);
+            frameB_[j].assign(fftSize_, 0.0f);
+            spectrumA_[j].assign(numBins, Complex{});
+            spectrumB_[j].assign(numBins, Complex{});
+        }
+        sharedReady_ = true;
+    }
+
+    /// Window the slot's frame ending at nextFrameEnd into frame
+    void extractFrame(const float* history, std::size_t frameEnd, float* frame) const noexcept {
+        const std::size_t mask = inputCapacity_ - 1;
+        const std::size_t start = (frameEnd - fftSize_) & mask;
+        const std::size_t firstPart = std::min(fftSize_, inputCapacity_ - start);
+        for (std::size_t i = 0; i < firstPart; ++i) {
+            frame[i] = history[start + i] * window_[i];
+        }
+        for (std::size_t i = firstPart; i < fftSize_; ++i) {
+            frame[i] = history[i - firstPart] * window_[i];
+        }
+    }
+
+    /// Fill tiltGains_ (SpectralMorphFilter's clamped tilt curve)
+    void computeTiltGains(float dBPerOctave) noexcept {
+        const std::size_t numBins = tiltGains_.size();
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            const float gainDb = std::clamp(dBPerOctave * octavesFromPivot_[bin],
+                                            SpectralMorphFilter::kMinTiltGainDb,
+                                            SpectralMorphFilter::kMaxTiltGainDb);
+            tiltGains_[bin] = gainDb * 0.05f;
+        }
+        batchPow10(tiltGains_.data(), tiltGains_.data(), numBins);
+    }
+
+    /// Analyze, morph and resynthesize the next frame of count (1 or 2) slots
+    void runFrames(const std::size_t* slotIndices, std::size_t count) noexcept {
+        const std::size_t numBins = fftSize_ / 2 + 1;
+
+        for (std::size_t j = 0; j < count; ++j) {
+            Slot& st = slots_[slotIndices[j]];
+            extractFrame(historyA(st), st.nextFrameEnd, frameA_[j].data());
+            extractFrame(historyB(st), st.nextFrameEnd, frameB_[j].data());
+            fft_.forwardPair(frameA_[j].data(), frameB_[j].data(),
+                             spectrumA_[j].data(), spectrumB_[j].data());
+
+            const float morph = st.morphSmoother.process();
+            const float tilt = st.tiltSmoother.process();
+            const float* gains = nullptr;
+            if (std::abs(tilt) > 0.001f) {
+                computeTiltGains(tilt);
+                gains = tiltGains_.data();
+            }
+
+            float phaseMorph = 0.0f;
+            if (phaseSource_ == PhaseSource::B) phaseMorph = 1.0f;
+            if (phaseSource_ == PhaseSource::Blend) phaseMorph = morph;
+
+            // Morph in place into spectrum A
+            auto* spectrum = reinterpret_cast<float*>(spectrumA_[j].data());
+            morphSpectraBulk(spectrum, reinterpret_cast<const float*>(spectrumB_[j].data()),
+                             numBins, morph, phaseMorph, gains, spectrum);
+        }
+
+        // Inverse into the (now free) analysis frames of source A
+        if (count == 2) {
+            fft_.inversePair(spectrumA_[0].data(), spectrumA_[1].data(),
+                             frameA_[0].data(), frameA_[1].data());
+        } else {
+            const Complex* input = spectrumA_[0].data();
+            float* output = frameA_[0].data();
+            fft_.inverse(&input, &output, 1);
+        }
+
+        for (std::size_t j = 0; j < count; ++j) {
+            Slot& st = slots_[slotIndices[j]];
+            float* acc = overlap(st);
+            const float* frame = frameA_[j].data();
+            for (std::size_t i = 0; i < fftSize_; ++i) {
+                acc[i] += frame[i] * colaNormalization_;
+            }
+
+            // The first hop of the accumulator is complete: move it to the FIFO
+            float* fifo = outputFifo(st);
+            const std::size_t mask = outputCapacity_ - 1;
+            for (std::size_t i = 0; i < hopSize_; ++i) {
+                fifo[(st.outputWritten + i) & mask] = acc[i];
+            }
+            st.outputWritten += hopSize_;
+            std::memmove(acc, acc + hopSize_, (fftSize_ - hopSize_) * sizeof(float));
+            std::fill(acc + (fftSize_ - hopSize_), acc + fftSize_, 0.0f);
+
+            st.nextFrameEnd += hopSize_;
+        }
+    }
+
+    // Configuration
+    double sampleRate_ = 44100.0;
+    std::size_t maxBlockSize_ = 0;
+    std::size_t fftSize_ = kDefaultFFTSize;
+    std::size_t hopSize_ = kDefaultFFTSize / 2;
+    std::size_t inputCapacity_ = 0;   // power of 2
+    std::size_t outputCapacity_ = 0;  // power of 2
+    PhaseSource phaseSource_ = PhaseSource::A;
+    bool prepared_ = false;
+
+    // Slots (buffers allocated lazily, see ensureSlots())
+    std::vector<Slot> slots_;
+    std::size_t allocatedSlots_ = 0;  // slots [0, n) have buffers
+
+    // Shared state (allocated with the first slot)
+    bool sharedReady_ = false;
+    BatchFFT fft_;
+    std::vector<float> window_;
+    float colaNormalization_ = 1.0f;
+    std::vector<float> octavesFromPivot_;
+    std::vector<float> tiltGains_;
+    std::array<std::vector<float>, 2> frameA_;
+    std::array<std::vector<float>, 2> frameB_;
+    std::array<std::vector<Complex>, 2> spectrumA_;
+    std::array<std::vector<Complex>, 2> spectrumB_;
+};
+
+} // namespace DSP
+} // namespace Krate
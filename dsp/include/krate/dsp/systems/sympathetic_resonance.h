@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 namespace Krate {
@@ -91,8 +92,13 @@ struct SympatheticPartialInfo {
 /// Lifecycle:
 ///   1. prepare(sampleRate) -- compute coefficients, no allocations
 ///   2. noteOn/noteOff      -- manage resonator pool (from MIDI handler)
-///   3. process(input)      -- per-sample driven resonance + anti-mud HPF
+///   3. processBlock(...)   -- block driven resonance + anti-mud HPF
+///      (or process(input) per sample)
 ///   4. reset()             -- clear all state
+///
+/// Pool layout: active resonators always occupy slots [0, activeCount),
+/// packed by swap-removal when one is reclaimed or evicted. The SIMD kernels
+/// therefore only run over live resonators.
 class SympatheticResonance {
 public:
     SympatheticResonance() noexcept = default;
@@ -218,11 +224,11 @@ public:
                 rSquareds_[midx] = coeffs.rSquared;
             } else {
                 // Acquire new slot
-                int slot = findFreeSlot();
-                if (slot < 0) {
+                if (activeCount_ >= kMaxSympatheticResonators) {
                     // Pool is full -- evict quietest
-                    slot = evictQuietest();
+                    evictQuietest();
                 }
+                int slot = findFreeSlot();
                 if (slot < 0) continue; // Should not happen
 
                 auto idx = static_cast<size_t>(slot);
@@ -246,7 +252,6 @@ public:
                 voiceIds_[idx] = voiceId;
                 partialNumbers_[idx] = partialNumber;
                 refCounts_[idx] = 1;
-                actives_[idx] = true;
                 activeCount_++;
 
                 // Initialize owner list with this voice
@@ -262,9 +267,8 @@ public:
     /// Resonators are reclaimed only when amplitude drops below -96 dB.
     /// @param voiceId   Voice identifier that was released
     void noteOff(int32_t voiceId) noexcept {
-        for (int i = 0; i < kMaxSympatheticResonators; ++i) {
+        for (int i = 0; i < activeCount_; ++i) {
             auto idx = static_cast<size_t>(i);
-            if (!actives_[idx]) continue;
 
             // Check if this voice is an owner of this resonator
             bool isOwner = false;
@@ -298,7 +302,7 @@ public:
     }
 
     // =========================================================================
-    // Processing (called per sample in the audio loop)
+    // Processing
     // =========================================================================
 
     /// Process one sample of sympathetic resonance.
@@ -323,33 +327,15 @@ public:
 
         float sum = 0.0f;
 
-        // SIMD-accelerated resonator loop: processes ALL kMaxSympatheticResonators
-        // slots. Inactive slots have coeffs=0, gains=0, y1s=0, y2s=0 so they
-        // produce zero output and zero state change -- safe to process in bulk.
+        // SIMD-accelerated resonator loop over the packed active slots
         processSympatheticBankSIMD(
             y1s_.data(), y2s_.data(),
             coeffs_.data(), rSquareds_.data(), gains_.data(),
-            kMaxSympatheticResonators, scaledInput, &sum,
+            activeCount_, scaledInput, &sum,
             envelopeReleaseCoeff_, envelopes_.data());
 
-        // Scalar reclaim pass: check envelopes and reclaim dead resonators.
-        // This runs after SIMD to avoid branching inside the vectorized loop.
-        for (int i = 0; i < kMaxSympatheticResonators; ++i) {
-            auto idx = static_cast<size_t>(i);
-            if (!actives_[idx]) continue;
-
-            if (envelopes_[idx] < kReclaimThresholdLinear) {
-                actives_[idx] = false;
-                y1s_[idx] = 0.0f;
-                y2s_[idx] = 0.0f;
-                envelopes_[idx] = 0.0f;
-                gains_[idx] = 0.0f;
-                coeffs_[idx] = 0.0f;
-                rSquareds_[idx] = 0.0f;
-                ownerVoiceIds_[idx].fill(-1);
-                activeCount_--;
-            }
-        }
+        // Runs after SIMD to avoid branching inside the vectorized loop
+        reclaimDecayed();
 
         // Apply anti-mud HPF to summed output (FR-012)
         float output = antiMudHpf_.process(sum);
@@ -357,6 +343,49 @@ public:
         return output;
     }
 
+    /// Process a block of sympathetic resonance.
+    ///
+    /// Equivalent to calling process() per sample, except that decayed
+    /// resonators are reclaimed once per block instead of once per sample
+    /// (they ring on below -96 dB until the block ends). Each group of
+    /// resonators is advanced through the block with its state in registers.
+    ///
+    /// When bypassed, writes zeros.
+    ///
+    /// @param input       Mono input (global voice sum, post poly-gain comp)
+    /// @param output      Sympathetic output (to be added to master output).
+    ///                    May alias `input`.
+    /// @param numSamples  Number of samples
+    void processBlock(const float* input, float* output, size_t numSamples) noexcept {
+        // FR-014: Early-out when bypassed
+        if (isBypassed()) {
+            std::fill(output, output + numSamples, 0.0f);
+            return;
+        }
+
+        std::array<float, kBlockChunkSize> scaledInput;
+        for (size_t offset = 0; offset < numSamples; offset += kBlockChunkSize) {
+            const size_t n = std::min(kBlockChunkSize, numSamples - offset);
+
+            // Smoothed coupling gain per sample (FR-023), applied to the input
+            amountSmoother_.processBlock(scaledInput.data(), n);
+            for (size_t i = 0; i < n; ++i) {
+                scaledInput[i] *= input[offset + i];
+            }
+
+            processSympatheticBankBlockSIMD(
+                y1s_.data(), y2s_.data(),
+                coeffs_.data(), rSquareds_.data(), gains_.data(),
+                activeCount_, scaledInput.data(), output + offset, n,
+                envelopeReleaseCoeff_, envelopes_.data());
+        }
+
+        reclaimDecayed();
+
+        // Apply anti-mud HPF to summed output (FR-012)
+        antiMudHpf_.processBlock(output, numSamples);
+    }
+
     // =========================================================================
     // Query (for testing and diagnostics)
     // =========================================================================
@@ -374,13 +403,14 @@ public:
     /// Get the frequency of the resonator at the given pool index (for testing).
     /// Returns 0.0f if the slot is inactive or index is out of range.
     [[nodiscard]] float getResonatorFrequency(int index) const noexcept {
-        if (index < 0 || index >= kMaxSympatheticResonators) return 0.0f;
-        auto idx = static_cast<size_t>(index);
-        if (!actives_[idx]) return 0.0f;
-        return freqs_[idx];
+        if (index < 0 || index >= activeCount_) return 0.0f;
+        return freqs_[static_cast<size_t>(index)];
     }
 
 private:
+    /// Samples per processBlock() chunk (bounds the scaled-input scratch).
+    static constexpr size_t kBlockChunkSize = 256;
+
     // =========================================================================
     // Internal Types
     // =========================================================================
@@ -446,53 +476,79 @@ private:
     /// Find a merge candidate in the pool for the given frequency.
     /// @return Index of merge candidate, or -1 if none found.
     [[nodiscard]] int findMergeCandidate(float freq) const noexcept {
-        for (int i = 0; i < kMaxSympatheticResonators; ++i) {
-            auto idx = static_cast<size_t>(i);
-            if (actives_[idx]) {
-                if (std::abs(freqs_[idx] - freq) < kMergeThresholdHz) {
-                    return i;
-                }
+        for (int i = 0; i < activeCount_; ++i) {
+            if (std::abs(freqs_[static_cast<size_t>(i)] - freq) < kMergeThresholdHz) {
+                return i;
             }
         }
         return -1;
     }
 
-    /// Find a free (inactive) slot in the pool.
+    /// Find a free (inactive) slot in the pool: the first slot past the
+    /// packed active range.
     /// @return Index of free slot, or -1 if pool is full.
     [[nodiscard]] int findFreeSlot() const noexcept {
-        for (int i = 0; i < kMaxSympatheticResonators; ++i) {
-            if (!actives_[static_cast<size_t>(i)]) {
-                return i;
-            }
-        }
-        return -1;
+        return activeCount_ < kMaxSympatheticResonators ? activeCount_ : -1;
     }
 
-    /// Evict the quietest active resonator and return its slot index.
-    /// @return Index of evicted slot.
-    [[nodiscard]] int evictQuietest() noexcept {
+    /// Evict the quietest active resonator.
+    void evictQuietest() noexcept {
         int quietestIdx = -1;
         float quietestEnv = 1e30f;
-        for (int i = 0; i < kMaxSympatheticResonators; ++i) {
+        for (int i = 0; i < activeCount_; ++i) {
             auto idx = static_cast<size_t>(i);
-            if (actives_[idx] && envelopes_[idx] < quietestEnv) {
+            if (envelopes_[idx] < quietestEnv) {
                 quietestEnv = envelopes_[idx];
                 quietestIdx = i;
             }
         }
         if (quietestIdx >= 0) {
-            auto idx = static_cast<size_t>(quietestIdx);
-            actives_[idx] = false;
-            y1s_[idx] = 0.0f;
-            y2s_[idx] = 0.0f;
-            envelopes_[idx] = 0.0f;
-            coeffs_[idx] = 0.0f;
-            rSquareds_[idx] = 0.0f;
-            gains_[idx] = 0.0f;
-            ownerVoiceIds_[idx].fill(-1);
-            activeCount_--;
+            removeResonator(quietestIdx);
+        }
+    }
+
+    /// Reclaim every resonator whose envelope fell below -96 dB.
+    /// Walks downwards so the resonator swapped into a freed slot has
+    /// already been checked.
+    void reclaimDecayed() noexcept {
+        for (int i = activeCount_ - 1; i >= 0; --i) {
+            if (envelopes_[static_cast<size_t>(i)] < kReclaimThresholdLinear) {
+                removeResonator(i);
+            }
+        }
+    }
+
+    /// Deactivate the resonator at `index`, moving the last active resonator
+    /// into its slot to keep [0, activeCount) packed. The vacated slot is
+    /// zeroed so it contributes nothing if a kernel ever reads it.
+    void removeResonator(int index) noexcept {
+        auto idx = static_cast<size_t>(index);
+        auto last = static_cast<size_t>(activeCount_ - 1);
+        if (idx != last) {
+            freqs_[idx] = freqs_[last];
+            coeffs_[idx] = coeffs_[last];
+            rSquareds_[idx] = rSquareds_[last];
+            y1s_[idx] = y1s_[last];
+            y2s_[idx] = y2s_[last];
+            gains_[idx] = gains_[last];
+            envelopes_[idx] = envelopes_[last];
+            voiceIds_[idx] = voiceIds_[last];
+            partialNumbers_[idx] = partialNumbers_[last];
+            refCounts_[idx] = refCounts_[last];
+            ownerVoiceIds_[idx] = ownerVoiceIds_[last];
         }
-        return quietestIdx;
+        freqs_[last] = 0.0f;
+        coeffs_[last] = 0.0f;
+        rSquareds_[last] = 0.0f;
+        y1s_[last] = 0.0f;
+        y2s_[last] = 0.0f;
+        gains_[last] = 0.0f;
+        envelopes_[last] = 0.0f;
+        voiceIds_[last] = -1;
+        partialNumbers_[last] = 0;
+        refCounts_[last] = 0;
+        ownerVoiceIds_[last].fill(-1);
+        activeCount_--;
     }
 
     /// Reset the entire resonator pool to inactive.
@@ -507,7 +563,6 @@ private:
         voiceIds_.fill(-1);
         partialNumbers_.fill(0);
         refCounts_.fill(0);
-        actives_.fill(false);
         activeCount_ = 0;
 
         // Initialize all owner voice ID slots to -1
@@ -517,7 +572,7 @@ private:
     }
 
     // =========================================================================
-    // SoA Pool Arrays (SIMD-ready layout)
+    // SoA Pool Arrays (SIMD-ready layout, active slots packed at the front)
     // =========================================================================
 
     std::array<float, kMaxSympatheticResonators> freqs_{};
@@ -531,7 +586,6 @@ private:
     std::array<int, kMaxSympatheticResonators> partialNumbers_{};
     std::array<int, kMaxSympatheticResonators> refCounts_{};
     std::array<std::array<int32_t, kMaxOwnersPerResonator>, kMaxSympatheticResonators> ownerVoiceIds_{};
-    std::array<bool, kMaxSympatheticResonators> actives_{};
 
     // =========================================================================
     // Members
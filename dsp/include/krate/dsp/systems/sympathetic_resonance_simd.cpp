@@ -126,6 +126,110 @@ void ProcessSympatheticBankSIMDImpl(
     }
 }
 
+// -----------------------------------------------------------------------------
+// ProcessSympatheticBankBlockSIMDImpl: time-blocked variant.
+//
+// Loops resonator groups on the outside and samples on the inside, so each
+// group's y1/y2/envelope stay in registers for a whole chunk of samples. Per
+// sample, the group's outputs are added lane-wise into an accumulator row;
+// rows are reduced to one sum per sample once all groups are done.
+// -----------------------------------------------------------------------------
+
+/// Samples per accumulator chunk (stack scratch = chunk x lanes floats).
+constexpr size_t kSympatheticBlockChunk = 64;
+
+/// Lane cap for the block kernel, bounding the accumulator scratch.
+constexpr size_t kSympatheticBlockMaxLanes = 16;
+
+// NOLINTNEXTLINE(misc-use-internal-linkage) exported via HWY_EXPORT
+void ProcessSympatheticBankBlockSIMDImpl(
+    float* HWY_RESTRICT y1s,
+    float* HWY_RESTRICT y2s,
+    const float* HWY_RESTRICT coeffs,
+    const float* HWY_RESTRICT rSquareds,
+    const float* HWY_RESTRICT gains,
+    int count,
+    const float* HWY_RESTRICT scaledInput,
+    float* HWY_RESTRICT output,
+    size_t numSamples,
+    float releaseCoeff,
+    float* HWY_RESTRICT envelopes) {
+
+    const hn::CappedTag<float, kSympatheticBlockMaxLanes> d;
+    const size_t N = hn::Lanes(d);
+    const auto vReleaseCoeff = hn::Set(d, releaseCoeff);
+    const size_t total = static_cast<size_t>(count);
+    const size_t simdTotal = total - (total % N);
+
+    float acc[kSympatheticBlockChunk * kSympatheticBlockMaxLanes];
+
+    for (size_t base = 0; base < numSamples; base += kSympatheticBlockChunk) {
+        const size_t len = (numSamples - base < kSympatheticBlockChunk)
+                               ? numSamples - base : kSympatheticBlockChunk;
+        const float* in = scaledInput + base;
+        float* out = output + base;
+
+        for (size_t k = 0; k < len * N; ++k) acc[k] = 0.0f;
+
+        for (size_t i = 0; i < simdTotal; i += N) {
+            auto vY1 = hn::LoadU(d, y1s + i);
+            auto vY2 = hn::LoadU(d, y2s + i);
+            auto vEnv = hn::LoadU(d, envelopes + i);
+            const auto vCoeff = hn::LoadU(d, coeffs + i);
+            const auto vRSq = hn::LoadU(d, rSquareds + i);
+            const auto vGain = hn::LoadU(d, gains + i);
+
+            for (size_t s = 0; s < len; ++s) {
+                // y = coeff * y1 - rSquared * y2 + scaledInput * gain
+                const auto vCoeffY1 = hn::Mul(vCoeff, vY1);
+                const auto vRec = hn::NegMulAdd(vRSq, vY2, vCoeffY1);
+                const auto vY = hn::MulAdd(vGain, hn::Set(d, in[s]), vRec);
+                vY2 = vY1;
+                vY1 = vY;
+
+                vEnv = hn::Max(hn::Abs(vY), hn::Mul(vEnv, vReleaseCoeff));
+
+                float* row = acc + s * N;
+                hn::StoreU(hn::Add(hn::LoadU(d, row), vY), d, row);
+            }
+
+            hn::StoreU(vY1, d, y1s + i);
+            hn::StoreU(vY2, d, y2s + i);
+            hn::StoreU(vEnv, d, envelopes + i);
+        }
+
+        for (size_t s = 0; s < len; ++s) {
+            out[s] = (simdTotal > 0) ? hn::ReduceSum(d, hn::LoadU(d, acc + s * N)) : 0.0f;
+        }
+
+        // Scalar tail for remaining resonators
+        for (size_t i = simdTotal; i < total; ++i) {
+            float y1 = y1s[i];
+            float y2 = y2s[i];
+            float env = envelopes[i];
+            const float coeff = coeffs[i];
+            const float rSq = rSquareds[i];
+            const float gain = gains[i];
+
+            for (size_t s = 0; s < len; ++s) {
+                const float y = coeff * y1 - rSq * y2 + in[s] * gain;
+                y2 = y1;
+                y1 = y;
+
+                const float absY = (y >= 0.0f) ? y : -y;
+                const float envDecayed = env * releaseCoeff;
+                env = (absY > envDecayed) ? absY : envDecayed;
+
+                out[s] += y;
+            }
+
+            y1s[i] = y1;
+            y2s[i] = y2;
+            envelopes[i] = env;
+        }
+    }
+}
+
 }  // namespace HWY_NAMESPACE
 }  // namespace DSP
 }  // namespace Krate
@@ -145,6 +249,7 @@ namespace Krate {
 namespace DSP {
 
 HWY_EXPORT(ProcessSympatheticBankSIMDImpl);
+HWY_EXPORT(ProcessSympatheticBankBlockSIMDImpl);
 
 void processSympatheticBankSIMD(
     float* y1s,
@@ -163,6 +268,24 @@ void processSympatheticBankSIMD(
         count, scaledInput, sums, releaseCoeff, envelopes);
 }
 
+void processSympatheticBankBlockSIMD(
+    float* y1s,
+    float* y2s,
+    const float* coeffs,
+    const float* rSquareds,
+    const float* gains,
+    int count,
+    const float* scaledInput,
+    float* output,
+    size_t numSamples,
+    float releaseCoeff,
+    float* envelopes) noexcept {
+
+    HWY_DYNAMIC_DISPATCH(ProcessSympatheticBankBlockSIMDImpl)(
+        y1s, y2s, coeffs, rSquareds, gains, count,
+        scaledInput, output, numSamples, releaseCoeff, envelopes);
+}
+
 }  // namespace DSP
 }  // namespace Krate
 
@@ -2,8 +2,8 @@
 // Layer 3: SIMD-Accelerated Sympathetic Resonance Bank Kernel
 // ==============================================================================
 // Vectorized second-order driven resonator processing across resonators using
-// Google Highway. Called from SympatheticResonance::process() for the main
-// resonator loop.
+// Google Highway. Called from SympatheticResonance::process() (one sample) and
+// SympatheticResonance::processBlock() (time-blocked) for the resonator loop.
 //
 // Each resonator is independent (no cross-resonator feedback), so we vectorize
 // across resonators: process 4 (SSE/NEON) or 8 (AVX2) simultaneously.
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace Krate {
 namespace DSP {
 
@@ -48,5 +50,36 @@ void processSympatheticBankSIMD(
     float releaseCoeff,
     float* envelopes) noexcept;
 
+/// @brief SIMD-accelerated driven resonator processing for a block of samples.
+///
+/// Same recurrence and envelope follower as processSympatheticBankSIMD(), but
+/// time-blocked: each group of resonators keeps y1/y2/envelope in registers
+/// for the whole block and writes its state back once at the end.
+///
+/// @param y1s            In/out y[n-1] state array
+/// @param y2s            In/out y[n-2] state array
+/// @param coeffs         2*r*cos(omega) coefficient per resonator
+/// @param rSquareds      r^2 per resonator
+/// @param gains          Input gain per resonator
+/// @param count          Number of resonators to process
+/// @param scaledInput    Input samples scaled by the coupling gain [numSamples]
+/// @param output         Out: per-sample sum over all resonators [numSamples]
+///                       (overwritten; zero when count == 0)
+/// @param numSamples     Number of samples in the block
+/// @param releaseCoeff   Envelope follower release coefficient
+/// @param envelopes      In/out envelope follower state per resonator
+void processSympatheticBankBlockSIMD(
+    float* y1s,
+    float* y2s,
+    const float* coeffs,
+    const float* rSquareds,
+    const float* gains,
+    int count,
+    const float* scaledInput,
+    float* output,
+    size_t numSamples,
+    float releaseCoeff,
+    float* envelopes) noexcept;
+
 }  // namespace DSP
 }  // namespace Krate
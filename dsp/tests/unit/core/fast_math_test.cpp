@@ -13,6 +13,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
 #include <bit>
 #include <cmath>
 #include <array>
@@ -150,3 +151,83 @@ TEST_CASE("fastTanh monotonically increasing", "[fast_math][tanh]") {
         prev = curr;
     }
 }
+
+// =============================================================================
+// fastTan Tests (filter coefficient prewarp)
+// =============================================================================
+
+TEST_CASE("fastTan matches std::tan across the prewarp range", "[fast_math][tan]") {
+    // Covers pi * fc / fs for fc in (0, 0.495 * fs], i.e. every cutoff the
+    // SVF and ladder accept, including the reflected upper half.
+    constexpr float kHalfPi = 1.5707963267948966f;
+    for (int i = 1; i < 1000; ++i) {
+        const float x = kHalfPi * 0.99f * static_cast<float>(i) / 1000.0f;
+        INFO("x = " << x);
+        REQUIRE(relativeError(fastTan(x), std::tan(x)) < 1e-5f);
+    }
+}
+
+TEST_CASE("fastTan meets its documented error bound", "[fast_math][tan]") {
+    // Relative error against double-precision tan: < 2.3e-7 on [0, pi/4]
+    // (the unreflected half), < 3e-6 up to 0.99 * pi/2
+    constexpr float kQuarterPi = 0.78539816339744831f;
+    constexpr float kHalfPi = 1.5707963267948966f;
+    double worstLower = 0.0;
+    double worstUpper = 0.0;
+    for (int i = 1; i <= 100000; ++i) {
+        const float x = kHalfPi * 0.99f * static_cast<float>(i) / 100000.0f;
+        const double exact = std::tan(static_cast<double>(x));
+        const double err = std::abs((static_cast<double>(fastTan(x)) - exact) / exact);
+        if (x <= kQuarterPi) {
+            worstLower = std::max(worstLower, err);
+        } else {
+            worstUpper = std::max(worstUpper, err);
+        }
+    }
+    REQUIRE(worstLower < 2.3e-7);
+    REQUIRE(worstUpper < 3e-6);
+}
+
+TEST_CASE("fastTan is odd and exact at zero", "[fast_math][tan]") {
+    REQUIRE(fastTan(0.0f) == 0.0f);
+    for (float x = 0.05f; x < 1.5f; x += 0.05f) {
+        REQUIRE(fastTan(-x) == -fastTan(x));
+    }
+}
+
+TEST_CASE("fastTan is monotonically increasing", "[fast_math][tan]") {
+    float prev = fastTan(-1.55f);
+    for (float x = -1.54f; x < 1.55f; x += 0.01f) {
+        const float curr = fastTan(x);
+        REQUIRE(curr > prev);
+        prev = curr;
+    }
+}
+
+// =============================================================================
+// fastExp2 Tests (semitone-to-ratio)
+// =============================================================================
+
+TEST_CASE("fastExp2 matches std::exp2", "[fast_math][exp2]") {
+    for (float x = -24.0f; x <= 24.0f; x += 0.01f) {
+        INFO("x = " << x);
+        REQUIRE(relativeError(fastExp2(x), std::exp2(x)) < 1e-6f);
+    }
+}
+
+TEST_CASE("fastExp2 is exact at integers", "[fast_math][exp2]") {
+    REQUIRE(fastExp2(0.0f) == 1.0f);
+    REQUIRE(fastExp2(1.0f) == 2.0f);
+    REQUIRE(fastExp2(-1.0f) == 0.5f);
+    REQUIRE(fastExp2(10.0f) == 1024.0f);
+}
+
+TEST_CASE("fastExp2 edge cases", "[fast_math][exp2]") {
+    SECTION("NaN propagates") {
+        REQUIRE(isNaN(fastExp2(std::numeric_limits<float>::quiet_NaN())));
+    }
+    SECTION("Large exponents clamp instead of overflowing") {
+        REQUIRE(std::isfinite(fastExp2(1000.0f)));
+        REQUIRE(fastExp2(-1000.0f) > 0.0f);
+    }
+}
@@ -180,3 +180,36 @@ TEST_CASE("Xorshift32 distribution is approximately uniform", "[random][US1]") {
         CHECK(bins[i] < expected + tolerance);
     }
 }
+
+TEST_CASE("Xorshift32 discard() matches stepping with next()", "[random][discard]") {
+    for (uint64_t count : {0ull, 1ull, 2ull, 3ull, 31ull, 32ull, 1000ull, 65537ull, 1234567ull}) {
+        Xorshift32 jumped(48271);
+        Xorshift32 stepped(48271);
+        jumped.discard(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            (void)stepped.next();
+        }
+        INFO("count " << count);
+        REQUIRE(jumped.state() == stepped.state());
+    }
+}
+
+TEST_CASE("Xorshift32 discard() wraps at the 2^32-1 period", "[random][discard]") {
+    Xorshift32 full(7919);
+    full.discard(0xFFFFFFFFull);
+    REQUIRE(full.state() == 7919u);
+
+    Xorshift32 pastPeriod(7919);
+    pastPeriod.discard(0xFFFFFFFFull + 5);
+    Xorshift32 five(7919);
+    five.discard(5);
+    REQUIRE(pastPeriod.state() == five.state());
+
+    // Composes like repeated calls
+    Xorshift32 split(31337);
+    split.discard(123456789);
+    split.discard(987654321);
+    Xorshift32 once(31337);
+    once.discard(123456789ull + 987654321ull);
+    REQUIRE(split.state() == once.state());
+}
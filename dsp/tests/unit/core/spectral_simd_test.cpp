@@ -11,7 +11,9 @@
 #include <krate/dsp/core/spectral_simd.h>
 #include <krate/dsp/primitives/spectral_utils.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <numbers>
 #include <vector>
@@ -521,6 +523,165 @@ TEST_CASE("batchLog10 then batchPow10 round-trip", "[spectral_simd][roundtrip]")
     }
 }
 
+// ==============================================================================
+// Peak Detection / Region Assignment Tests (phase vocoder phase locking)
+// ==============================================================================
+
+namespace {
+
+/// Scalar reference: the per-bin loops PhaseVocoderPitchShifter used before
+/// detectSpectralPeaks()/assignPeakRegions()
+size_t referencePeaks(const std::vector<float>& mags, size_t maxPeaks,
+                      std::vector<uint16_t>& peaks, std::vector<uint16_t>& regions) {
+    const size_t numBins = mags.size();
+    peaks.clear();
+    for (size_t k = 1; k + 1 < numBins && peaks.size() < maxPeaks; ++k) {
+        if (mags[k] > mags[k - 1] && mags[k] > mags[k + 1]) {
+            peaks.push_back(static_cast<uint16_t>(k));
+        }
+    }
+    regions.assign(numBins, 0);
+    if (peaks.empty()) return 0;
+    size_t peakIdx = 0;
+    for (size_t k = 0; k < numBins; ++k) {
+        if (peakIdx + 1 < peaks.size()) {
+            const auto midpoint = static_cast<uint16_t>((peaks[peakIdx] + peaks[peakIdx + 1]) / 2);
+            if (k > midpoint) ++peakIdx;
+        }
+        regions[k] = peaks[peakIdx];
+    }
+    return peaks.size();
+}
+
+std::vector<float> peakyMagnitudes(size_t numBins, unsigned seed) {
+    // Deterministic LCG noise plus plateaus, so ties (which are not peaks) occur
+    std::vector<float> mags(numBins);
+    unsigned state = seed;
+    for (size_t k = 0; k < numBins; ++k) {
+        state = state * 1664525u + 1013904223u;
+        mags[k] = static_cast<float>(state >> 8) / 16777216.0f;
+        if (k % 37 == 5 && k > 0) mags[k] = mags[k - 1];
+    }
+    return mags;
+}
+
+} // anonymous namespace
+
+TEST_CASE("detectSpectralPeaks and assignPeakRegions match scalar reference",
+          "[spectral_simd][peaks]") {
+    for (size_t numBins : {size_t{3}, size_t{17}, size_t{130}, size_t{2049}}) {
+        for (size_t maxPeaks : {size_t{512}, size_t{7}}) {
+            CAPTURE(numBins, maxPeaks);
+            const auto mags = peakyMagnitudes(numBins, static_cast<unsigned>(numBins));
+
+            std::vector<uint16_t> expectedPeaks;
+            std::vector<uint16_t> expectedRegions;
+            const size_t expectedCount = referencePeaks(mags, maxPeaks, expectedPeaks,
+                                                        expectedRegions);
+
+            std::vector<uint16_t> peaks(maxPeaks, 0);
+            std::vector<uint16_t> regions(numBins, 0);
+            // bool flags stored as chars so stale values are visible
+            std::vector<char> isPeak(numBins, 1);
+            const size_t count = detectSpectralPeaks(mags.data(), numBins, peaks.data(),
+                                                     maxPeaks,
+                                                     reinterpret_cast<bool*>(isPeak.data()));
+            REQUIRE(count == expectedCount);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(peaks[i] == expectedPeaks[i]);
+            }
+            for (size_t k = 0; k < numBins; ++k) {
+                const bool flagged = std::find(expectedPeaks.begin(), expectedPeaks.end(),
+                                               static_cast<uint16_t>(k)) != expectedPeaks.end();
+                REQUIRE((isPeak[k] != 0) == flagged);
+            }
+
+            if (count > 0) {
+                assignPeakRegions(peaks.data(), count, numBins, regions.data());
+                REQUIRE(regions == expectedRegions);
+            }
+        }
+    }
+}
+
+TEST_CASE("detectSpectralPeaks finds nothing in flat or monotonic spectra",
+          "[spectral_simd][peaks][edge]") {
+    std::vector<uint16_t> peaks(16);
+    std::vector<char> isPeak(64, 1);
+
+    const std::vector<float> flat(64, 0.5f);
+    REQUIRE(detectSpectralPeaks(flat.data(), flat.size(), peaks.data(), peaks.size(),
+                                reinterpret_cast<bool*>(isPeak.data())) == 0);
+    REQUIRE(std::all_of(isPeak.begin(), isPeak.end(), [](char c) { return c == 0; }));
+
+    std::vector<float> rising(64);
+    for (size_t k = 0; k < rising.size(); ++k) rising[k] = static_cast<float>(k);
+    REQUIRE(detectSpectralPeaks(rising.data(), rising.size(), peaks.data(), peaks.size(),
+                                reinterpret_cast<bool*>(isPeak.data())) == 0);
+}
+
+// ==============================================================================
+// Spectral Morph Tests (SpectralMorphFilter / SpectralMorphService blend)
+// ==============================================================================
+
+TEST_CASE("morphSpectraBulk matches the polar magnitude/phase reference",
+          "[spectral_simd][morph]") {
+    const size_t numBins = 131;  // odd: exercises the scalar tail
+    std::vector<float> a(numBins * 2);
+    std::vector<float> b(numBins * 2);
+    std::vector<float> gains(numBins);
+    uint32_t state = 7u;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+    };
+    for (size_t k = 0; k < numBins * 2; ++k) {
+        a[k] = next();
+        b[k] = next();
+    }
+    for (auto& g : gains) g = 0.5f + 0.5f * std::abs(next());
+
+    for (float morph : {0.0f, 0.3f, 1.0f}) {
+        for (float phaseMorph : {0.0f, 1.0f, morph}) {
+            CAPTURE(morph, phaseMorph);
+            std::vector<float> out(numBins * 2);
+            morphSpectraBulk(a.data(), b.data(), numBins, morph, phaseMorph,
+                             gains.data(), out.data());
+
+            for (size_t k = 0; k < numBins; ++k) {
+                const float magA = std::hypot(a[2 * k], a[2 * k + 1]);
+                const float magB = std::hypot(b[2 * k], b[2 * k + 1]);
+                const float mag = (magA * (1.0f - morph) + magB * morph) * gains[k];
+                const float phase = std::atan2(
+                    a[2 * k + 1] * (1.0f - phaseMorph) + b[2 * k + 1] * phaseMorph,
+                    a[2 * k] * (1.0f - phaseMorph) + b[2 * k] * phaseMorph);
+                REQUIRE(out[2 * k] == Approx(mag * std::cos(phase)).margin(1e-5));
+                REQUIRE(out[2 * k + 1] == Approx(mag * std::sin(phase)).margin(1e-5));
+            }
+        }
+    }
+}
+
+TEST_CASE("morphSpectraBulk handles cancellation and in-place output",
+          "[spectral_simd][morph][edge]") {
+    // C = 0.5 A + 0.5 B cancels exactly: phase 0 like atan2(0, 0)
+    std::vector<float> a = {1.0f, 2.0f, 3.0f, -4.0f};
+    const std::vector<float> b = {-1.0f, -2.0f, -3.0f, 4.0f};
+    std::vector<float> out(4);
+    morphSpectraBulk(a.data(), b.data(), 2, 0.5f, 0.5f, nullptr, out.data());
+    REQUIRE(out[0] == Approx(std::sqrt(5.0f)));
+    REQUIRE(out[1] == 0.0f);
+    REQUIRE(out[2] == Approx(5.0f));
+    REQUIRE(out[3] == 0.0f);
+
+    // Morph 0 with A's phase and no gains is an in-place identity
+    const std::vector<float> original = a;
+    morphSpectraBulk(a.data(), b.data(), 2, 0.0f, 0.0f, nullptr, a.data());
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE(a[i] == Approx(original[i]).margin(1e-6));
+    }
+}
+
 // ==============================================================================
 // FormantPreserver Equivalence Tests (T035, T036)
 // ==============================================================================
@@ -1,7 +1,7 @@
 // ==============================================================================
 // Layer 4: FDN Reverb Tests
 // ==============================================================================
-// Tests for the 8-channel Feedback Delay Network reverb (FR-007 to FR-022).
+// Tests for the 8/16/32-channel Feedback Delay Network reverb (FR-007 to FR-022).
 //
 // Uses std::isnan/std::isfinite/std::isinf -- MUST be in the -fno-fast-math
 // list in dsp/tests/CMakeLists.txt.
@@ -12,6 +12,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <algorithm>
@@ -22,6 +23,7 @@
 #include <numeric>
 #include <random>
 #include <set>
+#include <utility>
 #include <vector>
 
 using Catch::Approx;
@@ -1003,3 +1005,304 @@ TEST_CASE("FDNReverb: LFO phasor stable after 1000 rate changes",
     REQUIRE(allFinite);
     REQUIRE(hasNonZero);
 }
+
+// =============================================================================
+// 16- and 32-line networks (FDNReverbN)
+// =============================================================================
+
+namespace {
+
+/// Feed noise, then silence; return tail RMS for two consecutive windows
+template <typename Reverb>
+std::pair<double, double> tailRmsPair(Reverb& reverb, const ReverbParams& params,
+                                      bool freezeAfterFeed, bool& allFinite) {
+    reverb.prepare(48000.0);
+    reverb.setParams(params);
+
+    std::mt19937 rng(123);
+    std::uniform_real_distribution<float> dist(-0.3f, 0.3f);
+    constexpr size_t blockSize = 512;
+    std::vector<float> left(blockSize), right(blockSize);
+
+    allFinite = true;
+    auto run = [&](size_t numSamples, bool noise) {
+        double sum = 0.0;
+        for (size_t offset = 0; offset < numSamples; offset += blockSize) {
+            size_t n = std::min(blockSize, numSamples - offset);
+            for (size_t i = 0; i < n; ++i) {
+                left[i] = noise ? dist(rng) : 0.0f;
+                right[i] = noise ? dist(rng) : 0.0f;
+            }
+            reverb.processBlock(left.data(), right.data(), n);
+            for (size_t i = 0; i < n; ++i) {
+                if (!std::isfinite(left[i]) || !std::isfinite(right[i])) allFinite = false;
+                sum += static_cast<double>(left[i]) * left[i];
+                sum += static_cast<double>(right[i]) * right[i];
+            }
+        }
+        return std::sqrt(sum / (2.0 * static_cast<double>(numSamples)));
+    };
+
+    run(48000, true);  // 1s of noise
+    if (freezeAfterFeed) {
+        ReverbParams frozen = params;
+        frozen.freeze = true;
+        reverb.setParams(frozen);
+    }
+    run(9600, false);  // settle 200ms
+    const double first = run(24000, false);
+    const double second = run(24000, false);
+    return {first, second};
+}
+
+/// Fraction of occupied 1ms windows in the first 50ms of the impulse response
+template <typename Reverb>
+double impulseEchoDensity() {
+    Reverb reverb;
+    reverb.prepare(48000.0);
+    ReverbParams params;
+    params.roomSize = 0.7f;
+    params.damping = 0.3f;
+    params.mix = 1.0f;
+    params.modRate = 0.0f;
+    params.modDepth = 0.0f;
+    reverb.setParams(params);
+
+    float impulseL = 1.0f;
+    float impulseR = 1.0f;
+    reverb.process(impulseL, impulseR);
+
+    constexpr size_t irLength = 2400;
+    constexpr size_t windowSize = 48;
+    std::vector<float> irL(irLength, 0.0f), irR(irLength, 0.0f);
+    reverb.processBlock(irL.data(), irR.data(), irLength);
+
+    std::vector<double> amplitude(irLength / windowSize);
+    double peakAmp = 0.0;
+    for (size_t w = 0; w < amplitude.size(); ++w) {
+        double sum = 0.0;
+        for (size_t i = 0; i < windowSize; ++i) {
+            double s = 0.5 * (static_cast<double>(irL[w * windowSize + i])
+                              + irR[w * windowSize + i]);
+            sum += s * s;
+        }
+        amplitude[w] = std::sqrt(sum / windowSize);
+        peakAmp = std::max(peakAmp, amplitude[w]);
+    }
+    size_t occupied = 0;
+    for (double a : amplitude) {
+        if (a > peakAmp * 0.01) occupied++;
+    }
+    return static_cast<double>(occupied) / static_cast<double>(amplitude.size());
+}
+
+template <size_t N>
+void checkDelayTable() {
+    const size_t* delays = fdn_detail::refDelays<N>();
+    for (size_t i = 0; i < N; ++i) {
+        // FR-009 rule 3 at 48kHz: 3ms..20ms
+        REQUIRE(delays[i] >= 144);
+        REQUIRE(delays[i] <= 960);
+        if (i > 0) REQUIRE(delays[i] > delays[i - 1]);
+        for (size_t k = 2; k * k <= delays[i]; ++k) {
+            INFO("delay " << delays[i] << " divisible by " << k);
+            REQUIRE(delays[i] % k != 0);
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST_CASE("FDNReverbN: 16/32-line delay tables are ascending primes in 3-20ms",
+          "[effects][fdn][lines]") {
+    checkDelayTable<8>();
+    checkDelayTable<16>();
+    checkDelayTable<32>();
+
+    // Diffuser primes are distinct within each step, and every network has
+    // the same mean diffuser path length as the 8-line one
+    constexpr auto diff8 = fdn_detail::makeDiffuserRefDelays<8, 4>();
+    constexpr auto diff16 = fdn_detail::makeDiffuserRefDelays<16, 4>();
+    constexpr auto diff32 = fdn_detail::makeDiffuserRefDelays<32, 4>();
+    for (size_t step = 0; step < 4; ++step) {
+        std::set<size_t> unique16(diff16.begin() + step * 16, diff16.begin() + (step + 1) * 16);
+        std::set<size_t> unique32(diff32.begin() + step * 32, diff32.begin() + (step + 1) * 32);
+        REQUIRE(unique16.size() == 16);
+        REQUIRE(unique32.size() == 32);
+    }
+    const size_t sum8 = std::accumulate(diff8.begin(), diff8.end(), size_t(0));
+    const size_t sum16 = std::accumulate(diff16.begin(), diff16.end(), size_t(0));
+    const size_t sum32 = std::accumulate(diff32.begin(), diff32.end(), size_t(0));
+    REQUIRE(sum16 == 2 * sum8);
+    REQUIRE(sum32 == 4 * sum8);
+
+    // The 8-line diffuser table is unchanged (13..157)
+    REQUIRE(diff8.front() == 13);
+    REQUIRE(diff8[8] == 43);
+    REQUIRE(diff8.back() == 157);
+}
+
+TEST_CASE("FDNReverbN: Hadamard kernel matches the normalized Sylvester matrix",
+          "[effects][fdn][lines]") {
+    for (size_t n : {size_t(8), size_t(16), size_t(32)}) {
+        std::vector<float> x(n);
+        std::mt19937 rng(static_cast<unsigned>(n));
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        for (auto& v : x) v = dist(rng);
+
+        // Sylvester Hadamard: H[i][j] = (-1)^popcount(i & j)
+        std::vector<double> expected(n, 0.0);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                unsigned bits = static_cast<unsigned>(i & j);
+                int parity = 0;
+                while (bits != 0) { parity ^= 1; bits &= bits - 1; }
+                expected[i] += (parity ? -1.0 : 1.0) * x[j];
+            }
+            expected[i] /= std::sqrt(static_cast<double>(n));
+        }
+
+        fdnApplyHadamardSIMD(x.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            INFO("N=" << n << " i=" << i);
+            REQUIRE(x[i] == Approx(expected[i]).margin(1e-5));
+        }
+    }
+}
+
+TEST_CASE("FDNReverbN: gather kernel reads one tap per channel from the ring",
+          "[effects][fdn][lines]") {
+    constexpr size_t kChannels = 16;
+    constexpr size_t kRows = 64;
+    std::vector<float> ring(kChannels * kRows);
+    for (size_t row = 0; row < kRows; ++row) {
+        for (size_t ch = 0; ch < kChannels; ++ch) {
+            ring[row * kChannels + ch] = static_cast<float>(row * 100 + ch);
+        }
+    }
+    int32_t delays[kChannels];
+    for (size_t ch = 0; ch < kChannels; ++ch) delays[ch] = static_cast<int32_t>(3 * ch + 1);
+
+    float taps[kChannels];
+    constexpr int32_t writePos = 5;  // forces wrap-around for most channels
+    fdnGatherTapsSIMD(ring.data(), delays, writePos, kRows - 1, taps, kChannels);
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+        size_t row = static_cast<size_t>((writePos - 1 - delays[ch]) & (kRows - 1));
+        REQUIRE(taps[ch] == static_cast<float>(row * 100 + ch));
+    }
+}
+
+TEST_CASE("FDNReverbN: fused damping kernel matches filter bank plus scalar DC blocker",
+          "[effects][fdn][lines]") {
+    // The block path used to run fdnApplyFilterBankSIMD, then the Jot gain
+    // and the DC blocker as scalar loops. The fused kernel must reproduce
+    // that exactly. volatile keeps the reference product from being
+    // contracted into an FMA.
+    const size_t numChannels = GENERATE(size_t{8}, size_t{13}, size_t{16}, size_t{32});
+    CAPTURE(numChannels);
+    constexpr float kR = 0.9995f;
+
+    std::vector<float> coeffs(numChannels);
+    std::vector<float> gains(numChannels);
+    for (size_t ch = 0; ch < numChannels; ++ch) {
+        coeffs[ch] = 0.2f + 0.05f * static_cast<float>(ch % 11);
+        gains[ch] = 0.95f - 0.01f * static_cast<float>(ch % 7);
+    }
+    std::vector<float> statesA(numChannels, 0.0f), statesB(numChannels, 0.0f);
+    std::vector<float> dcXA(numChannels, 0.0f), dcXB(numChannels, 0.0f);
+    std::vector<float> dcYA(numChannels, 0.0f), dcYB(numChannels, 0.0f);
+    std::vector<float> input(numChannels), outA(numChannels), outB(numChannels);
+
+    uint32_t seed = 12345;
+    for (int iter = 0; iter < 2000; ++iter) {
+        for (auto& v : input) {
+            seed = seed * 1664525u + 1013904223u;
+            v = static_cast<float>(seed >> 8) / 16777216.0f - 0.4f;
+        }
+
+        fdnApplyDampingSIMD(input.data(), statesA.data(), coeffs.data(), gains.data(),
+                            dcXA.data(), dcYA.data(), kR, outA.data(), numChannels);
+
+        fdnApplyFilterBankSIMD(input.data(), statesB.data(), coeffs.data(), outB.data(),
+                               numChannels);
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            const float x = outB[ch] * gains[ch];
+            const volatile float feedback = kR * dcYB[ch];
+            dcYB[ch] = (x - dcXB[ch]) + feedback;
+            dcXB[ch] = x;
+            outB[ch] = dcYB[ch];
+        }
+
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            REQUIRE(outA[ch] == outB[ch]);
+        }
+    }
+}
+
+TEST_CASE("FDNReverbN: 16 and 32 lines decay, freeze without growth, stay finite",
+          "[effects][fdn][lines]") {
+    ReverbParams params;
+    params.roomSize = 0.7f;
+    params.damping = 0.3f;
+    params.mix = 1.0f;
+    params.modRate = 0.5f;
+    params.modDepth = 0.5f;
+
+    auto check = [&](auto& reverb) {
+        bool finite = false;
+        auto [decay1, decay2] = tailRmsPair(reverb, params, false, finite);
+        INFO("decay windows: " << decay1 << " -> " << decay2);
+        REQUIRE(finite);
+        REQUIRE(decay1 > 0.0001);
+        REQUIRE(decay2 < decay1);
+
+        ReverbParams unmodulated = params;
+        unmodulated.modRate = 0.0f;
+        unmodulated.modDepth = 0.0f;
+        auto [frozen1, frozen2] = tailRmsPair(reverb, unmodulated, true, finite);
+        INFO("frozen windows: " << frozen1 << " -> " << frozen2);
+        REQUIRE(finite);
+        REQUIRE(frozen1 > 0.0001);
+        REQUIRE(frozen2 / frozen1 > 0.95);
+        REQUIRE(frozen2 / frozen1 < 1.05);
+    };
+
+    FDNReverb16 reverb16;
+    check(reverb16);
+    FDNReverb32 reverb32;
+    check(reverb32);
+}
+
+TEST_CASE("FDNReverbN: tail level comparable across 8/16/32 lines",
+          "[effects][fdn][lines]") {
+    ReverbParams params;
+    params.roomSize = 0.7f;
+    params.damping = 0.3f;
+    params.mix = 1.0f;
+    params.modRate = 0.0f;
+    params.modDepth = 0.0f;
+
+    bool finite = false;
+    FDNReverb reverb8;
+    FDNReverb16 reverb16;
+    FDNReverb32 reverb32;
+    const double rms8 = tailRmsPair(reverb8, params, false, finite).first;
+    const double rms16 = tailRmsPair(reverb16, params, false, finite).first;
+    const double rms32 = tailRmsPair(reverb32, params, false, finite).first;
+    INFO("tail RMS 8/16/32: " << rms8 << " / " << rms16 << " / " << rms32);
+
+    // 1/sqrt(2N) output gain: within 6dB of the 8-line reverb
+    REQUIRE(rms16 / rms8 > 0.5);
+    REQUIRE(rms16 / rms8 < 2.0);
+    REQUIRE(rms32 / rms8 > 0.5);
+    REQUIRE(rms32 / rms8 < 2.0);
+}
+
+TEST_CASE("FDNReverbN: echo density NED >= 0.8 within 50ms for 16/32 lines (SC-005)",
+          "[effects][fdn][lines]") {
+    const double ned16 = impulseEchoDensity<FDNReverb16>();
+    const double ned32 = impulseEchoDensity<FDNReverb32>();
+    INFO("NED 16 lines: " << ned16 << ", 32 lines: " << ned32);
+    REQUIRE(ned16 >= 0.8);
+    REQUIRE(ned32 >= 0.8);
+}
@@ -10,10 +10,14 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <krate/dsp/effects/spectral_delay.h>
 #include <krate/dsp/core/block_context.h>
+#include <krate/dsp/core/random.h>
+
+#include <krate/dsp/primitives/delay_line.h>
 
 #include <array>
 #include <cmath>
@@ -2551,3 +2555,90 @@ TEST_CASE("SpectralDelay feedback transition doesn't cause distortion",
         REQUIRE(finalPeak < peakBeforeDrop * 0.5f);  // Decayed significantly
     }
 }
+
+// =============================================================================
+// History Storage: frame-major ring vs per-bin delay lines
+// =============================================================================
+
+TEST_CASE("SpectralDelayHistory taps are bit-identical to per-bin delay lines",
+          "[spectral-delay][history]") {
+    // SpectralDelay used to keep one DelayLine per bin and component, read
+    // with readLinear() before that frame's write
+    struct Config {
+        const char* name;
+        std::size_t maxDelayFrames;
+        std::size_t numBins;
+    };
+    const auto config = GENERATE(
+        Config{"512-point FFT, 2 s at 44.1 kHz", 689, 257},
+        Config{"4096-point FFT, 2 s at 44.1 kHz", 86, 2049},
+        Config{"tiny ring", 3, 5});
+    INFO(config.name);
+
+    SpectralDelayHistory history;
+    history.prepare(config.maxDelayFrames, config.numBins);
+    REQUIRE(history.maxDelayFrames() == config.maxDelayFrames);
+
+    std::array<std::vector<DelayLine>, 4> lines;  // real/imag x L/R
+    for (auto& component : lines) {
+        component.resize(config.numBins);
+        for (auto& line : component) {
+            line.prepare(1.0, static_cast<float>(config.maxDelayFrames));
+        }
+    }
+
+    // Long enough for the ring to wrap three times, with a frozen stretch
+    // (reads continue, writes and advance() stop) in the middle
+    const std::size_t numFrames = 3 * (config.maxDelayFrames + 1) + 7;
+    const std::size_t freezeStart = numFrames / 3;
+    const std::size_t freezeEnd = freezeStart + config.maxDelayFrames / 2 + 2;
+    const float maxDelay = static_cast<float>(config.maxDelayFrames);
+
+    Xorshift32 rng(1234);
+    for (std::size_t frame = 0; frame < numFrames; ++frame) {
+        const bool frozen = frame >= freezeStart && frame < freezeEnd;
+        std::size_t mismatches = 0;
+
+        for (std::size_t bin = 0; bin < config.numBins; ++bin) {
+            // Fractional and whole delays, including taps clamped at both ends
+            float delayFrames = rng.nextUnipolar() * (maxDelay + 4.0f) - 2.0f;
+            if (bin % 4 == 0) delayFrames = std::round(delayFrames);
+
+            const SpectralDelayHistory::Bin tap = history.read(bin, delayFrames);
+            if (tap.realL != lines[0][bin].readLinear(delayFrames)) ++mismatches;
+            if (tap.imagL != lines[1][bin].readLinear(delayFrames)) ++mismatches;
+            if (tap.realR != lines[2][bin].readLinear(delayFrames)) ++mismatches;
+            if (tap.imagR != lines[3][bin].readLinear(delayFrames)) ++mismatches;
+
+            if (!frozen) {
+                const SpectralDelayHistory::Bin value{rng.nextFloat(), rng.nextFloat(),
+                                                      rng.nextFloat(), rng.nextFloat()};
+                history.write(bin, value);
+                lines[0][bin].write(value.realL);
+                lines[1][bin].write(value.imagL);
+                lines[2][bin].write(value.realR);
+                lines[3][bin].write(value.imagR);
+            }
+        }
+        if (!frozen) history.advance();
+
+        INFO("frame " << frame);
+        REQUIRE(mismatches == 0);
+    }
+
+    // reset() clears every frame and the write position
+    history.reset();
+    for (auto& component : lines) {
+        for (auto& line : component) line.reset();
+    }
+    for (std::size_t bin = 0; bin < config.numBins; ++bin) {
+        const SpectralDelayHistory::Bin value{1.0f, -1.0f, 0.5f, -0.5f};
+        history.write(bin, value);
+        lines[0][bin].write(value.realL);
+    }
+    history.advance();
+    for (std::size_t bin = 0; bin < config.numBins; ++bin) {
+        REQUIRE(history.read(bin, 0.5f).realL == lines[0][bin].readLinear(0.5f));
+        REQUIRE(history.read(bin, maxDelay).realL == 0.0f);
+    }
+}
@@ -1286,3 +1286,36 @@ TEST_CASE("DelayLine interpolation at buffer wraparound boundary",
     // Buffer wraparound should be seamless
     REQUIRE(clicks.empty());
 }
+
+TEST_CASE("DelayLine readLinearBehind matches readLinear from an earlier write",
+          "[delay][linear][block]") {
+    DelayLine reference;
+    DelayLine ahead;
+    reference.prepare(44100.0, 0.01f);
+    ahead.prepare(44100.0, 0.01f);
+    REQUIRE(ahead.blockReadHeadroom() >= 1);
+
+    const size_t headroom = ahead.blockReadHeadroom();
+    std::vector<float> expected(headroom);
+    std::vector<float> delays(headroom);
+    for (size_t block = 0; block < 40; ++block) {
+        for (size_t i = 0; i < headroom; ++i) {
+            const float x = std::sin(0.05f * static_cast<float>(block * headroom + i));
+            delays[i] = 3.25f + 200.0f * static_cast<float>(i) / static_cast<float>(headroom);
+            reference.write(x);
+            expected[i] = reference.readLinear(delays[i]);
+            ahead.write(x);
+        }
+        // Every read of the block happens after all of its writes
+        for (size_t i = 0; i < headroom; ++i) {
+            REQUIRE(ahead.readLinearBehind(headroom - 1 - i, delays[i]) == expected[i]);
+
+            float left = 0.0f;
+            float right = 0.0f;
+            DelayLine::readLinearBehindStereo(ahead, ahead, headroom - 1 - i, delays[i],
+                                              left, right);
+            REQUIRE(left == expected[i]);
+            REQUIRE(right == expected[i]);
+        }
+    }
+}
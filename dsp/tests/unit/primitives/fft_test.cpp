@@ -10,6 +10,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <krate/dsp/primitives/fft.h>
 #include <krate/dsp/primitives/spectral_buffer.h>
@@ -19,6 +20,7 @@
 #include <chrono>
 #include <cmath>
 #include <numbers>
+#include <utility>
 #include <vector>
 
 using namespace Krate::DSP;
@@ -479,3 +481,194 @@ TEST_CASE("FFT O(N log N) complexity verification", "[fft][performance]") {
         CHECK(ratio3 < kMaxRatioThreshold);
     }
 }
+
+// ==============================================================================
+// BatchFFT
+// ==============================================================================
+
+TEST_CASE("BatchFFT matches FFT per channel", "[fft][batch]") {
+    constexpr size_t fftSize = 512;
+    constexpr size_t kChannels = 3;  // one packed pair + one odd channel
+
+    FFT reference;
+    reference.prepare(fftSize);
+    BatchFFT batch;
+    batch.prepare(fftSize);
+    REQUIRE(batch.isPrepared());
+    REQUIRE(batch.numBins() == reference.numBins());
+
+    std::array<std::vector<float>, kChannels> signals;
+    const float freqs[kChannels] = {440.0f, 1234.5f, 5000.0f};
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+        signals[ch].resize(fftSize);
+        generateSine(signals[ch].data(), fftSize, freqs[ch], 44100.0f);
+        signals[ch][ch * 7] += 0.5f;  // asymmetric content: non-trivial phases
+    }
+
+    std::array<std::vector<Complex>, kChannels> spectra;
+    std::array<std::vector<Complex>, kChannels> expected;
+    const float* inputs[kChannels];
+    Complex* outputs[kChannels];
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+        spectra[ch].resize(batch.numBins());
+        expected[ch].resize(batch.numBins());
+        reference.forward(signals[ch].data(), expected[ch].data());
+        inputs[ch] = signals[ch].data();
+        outputs[ch] = spectra[ch].data();
+    }
+    batch.forward(inputs, outputs, kChannels);
+
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+        for (size_t k = 0; k < batch.numBins(); ++k) {
+            REQUIRE(spectra[ch][k].real == Approx(expected[ch][k].real).margin(1e-3));
+            REQUIRE(spectra[ch][k].imag == Approx(expected[ch][k].imag).margin(1e-3));
+        }
+    }
+
+    SECTION("inverse restores every channel") {
+        std::array<std::vector<float>, kChannels> restored;
+        const Complex* specIn[kChannels];
+        float* timeOut[kChannels];
+        for (size_t ch = 0; ch < kChannels; ++ch) {
+            restored[ch].assign(fftSize, 0.0f);
+            specIn[ch] = spectra[ch].data();
+            timeOut[ch] = restored[ch].data();
+        }
+        batch.inverse(specIn, timeOut, kChannels);
+
+        for (size_t ch = 0; ch < kChannels; ++ch) {
+            REQUIRE(calculateRMSError(signals[ch].data(), restored[ch].data(), fftSize) < 1e-5f);
+        }
+    }
+
+    SECTION("inverse matches FFT::inverse on modified spectra") {
+        // Non-Hermitian edits at DC/Nyquist are ignored, as in FFT::inverse
+        for (size_t ch = 0; ch < 2; ++ch) {
+            spectra[ch][0].imag = 3.0f;
+            spectra[ch][fftSize / 2].imag = -2.0f;
+            for (size_t k = 1; k < batch.numBins(); k += 3) {
+                spectra[ch][k] = spectra[ch][k] * Complex{0.0f, 1.0f};
+            }
+        }
+        std::vector<float> a(fftSize), b(fftSize), refA(fftSize), refB(fftSize);
+        batch.inversePair(spectra[0].data(), spectra[1].data(), a.data(), b.data());
+        reference.inverse(spectra[0].data(), refA.data());
+        reference.inverse(spectra[1].data(), refB.data());
+        REQUIRE(calculateRMSError(a.data(), refA.data(), fftSize) < 1e-5f);
+        REQUIRE(calculateRMSError(b.data(), refB.data(), fftSize) < 1e-5f);
+    }
+}
+
+// ==============================================================================
+// Extended Sizes and Plan Cache
+// ==============================================================================
+
+TEST_CASE("FFT size validation follows pffft", "[fft][prepare]") {
+    REQUIRE(isValidFFTSize(256));
+    REQUIRE(isValidFFTSize(640));      // 5 * 2^7
+    REQUIRE(isValidFFTSize(768));      // 3 * 2^8
+    REQUIRE(isValidFFTSize(16384));
+    REQUIRE(isValidFFTSize(65536));
+    REQUIRE(isValidFFTSize(kMaxAnalysisFFTSize));
+
+    REQUIRE_FALSE(isValidFFTSize(0));
+    REQUIRE_FALSE(isValidFFTSize(7 * 256)); // factor 7
+    REQUIRE_FALSE(isValidFFTSize(2 * kMaxAnalysisFFTSize));
+
+    // The multiple-of-32 rule comes from pffft's SIMD width; a scalar build
+    // only needs an even size and accepts 1000 (2^3 * 5^3) and 720
+    if (pffft_simd_size() == 4) {
+        REQUIRE_FALSE(isValidFFTSize(1000)); // not a multiple of 32
+        REQUIRE(nextValidFFTSize(1000) == 1024);
+        REQUIRE(nextValidFFTSize(700) == 768); // 704, 736 have factors 11, 23
+    }
+    REQUIRE(nextValidFFTSize(1537) == 1600); // 5^2 * 2^6
+    REQUIRE(nextValidFFTSize(768) == 768);
+    REQUIRE(nextValidFFTSize(2 * kMaxAnalysisFFTSize) == 0);
+
+    FFT fft;
+    fft.prepare(7 * 256);
+    REQUIRE_FALSE(fft.isPrepared());
+
+    fft.prepare(65536);
+    REQUIRE(fft.isPrepared());
+    REQUIRE(fft.numBins() == 32769);
+
+    // An invalid size unprepares a previously prepared FFT
+    fft.prepare(7 * 256);
+    REQUIRE_FALSE(fft.isPrepared());
+    REQUIRE(fft.size() == 0);
+}
+
+TEST_CASE("FFT non-power-of-2 sizes", "[fft][prepare]") {
+    const size_t fftSize = GENERATE(size_t{640}, size_t{768}, size_t{960});
+    CAPTURE(fftSize);
+
+    FFT fft;
+    fft.prepare(fftSize);
+    REQUIRE(fft.isPrepared());
+    REQUIRE(fft.size() == fftSize);
+
+    // Sine at exactly bin 10 puts all energy there
+    constexpr float sampleRate = 48000.0f;
+    const float binFreq = 10.0f * sampleRate / static_cast<float>(fftSize);
+    std::vector<float> input(fftSize);
+    generateSine(input.data(), fftSize, binFreq, sampleRate);
+
+    std::vector<Complex> spectrum(fft.numBins());
+    fft.forward(input.data(), spectrum.data());
+    REQUIRE(spectrum[10].magnitude() == Approx(static_cast<float>(fftSize) / 2.0f).epsilon(1e-3));
+    for (size_t k = 0; k < fft.numBins(); ++k) {
+        if (k != 10) REQUIRE(spectrum[k].magnitude() < 0.05f);
+    }
+
+    std::vector<float> restored(fftSize);
+    fft.inverse(spectrum.data(), restored.data());
+    REQUIRE(calculateRMSError(input.data(), restored.data(), fftSize) < 1e-5f);
+
+    SECTION("BatchFFT supports the same sizes") {
+        BatchFFT batch;
+        batch.prepare(fftSize);
+        REQUIRE(batch.isPrepared());
+
+        std::vector<Complex> a(batch.numBins()), b(batch.numBins());
+        batch.forwardPair(input.data(), restored.data(), a.data(), b.data());
+        for (size_t k = 0; k < batch.numBins(); ++k) {
+            REQUIRE(a[k].real == Approx(spectrum[k].real).margin(1e-3));
+            REQUIRE(a[k].imag == Approx(spectrum[k].imag).margin(1e-3));
+        }
+    }
+}
+
+TEST_CASE("FFT instances of one size share a plan", "[fft][prepare]") {
+    auto& cache = FFTPlanCache::instance();
+    const size_t before = cache.numPlans();
+
+    {
+        FFT a;
+        FFT b;
+        a.prepare(1536);  // 3 * 2^9, not used by other tests
+        b.prepare(1536);
+        REQUIRE(a.setup() != nullptr);
+        REQUIRE(a.setup() == b.setup());
+        REQUIRE(cache.numPlans() == before + 1);
+
+        // Re-preparing at the same size keeps the plan
+        const PFFFT_Setup* shared = a.setup();
+        a.prepare(1536);
+        REQUIRE(a.setup() == shared);
+
+        // Moving transfers the shared plan
+        FFT c = std::move(b);
+        REQUIRE(c.setup() == shared);
+        REQUIRE(cache.numPlans() == before + 1);
+
+        // Real and complex (BatchFFT pair) setups are separate plans
+        BatchFFT batch;
+        batch.prepare(1536);
+        REQUIRE(cache.numPlans() == before + 2);
+    }
+
+    // The last user frees the plan
+    REQUIRE(cache.numPlans() == before);
+}
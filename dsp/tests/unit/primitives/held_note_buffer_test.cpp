@@ -1432,3 +1432,73 @@ TEST_CASE("NoteSelector - Markov resets degree state on setMode",
     auto r = selector.advance(held);
     REQUIRE(r.count == 1);
 }
+
+TEST_CASE("NoteSelector - skip() matches repeated advance()",
+          "[note_selector]") {
+    HeldNoteBuffer held;
+    held.noteOn(60, 100);
+    held.noteOn(64, 100);
+    held.noteOn(67, 100);
+    held.noteOn(71, 100);
+    held.noteOn(74, 100);
+
+    const ArpMode modes[] = {ArpMode::Up, ArpMode::Down, ArpMode::UpDown,
+                             ArpMode::DownUp, ArpMode::Converge, ArpMode::Diverge,
+                             ArpMode::Random, ArpMode::AsPlayed, ArpMode::Chord,
+                             ArpMode::Gravity};
+    for (ArpMode mode : modes) {
+        for (OctaveMode octaveMode : {OctaveMode::Sequential, OctaveMode::Interleaved}) {
+            for (size_t steps : {size_t{1}, size_t{7}, size_t{40}, size_t{41}, size_t{1000003}}) {
+                INFO("mode " << static_cast<int>(mode) << " octave mode "
+                     << static_cast<int>(octaveMode) << " steps " << steps);
+                NoteSelector advanced(7);
+                NoteSelector skipped(7);
+                for (auto* selector : {&advanced, &skipped}) {
+                    selector->setMode(mode);
+                    selector->setOctaveRange(3);
+                    selector->setOctaveMode(octaveMode);
+                }
+                REQUIRE(skipped.isSkipExact());
+
+                for (size_t i = 0; i < steps; ++i) {
+                    (void)advanced.advance(held);
+                }
+                skipped.skip(steps, held);
+
+                REQUIRE(skipped.randomState() == advanced.randomState());
+                for (int i = 0; i < 24; ++i) {
+                    const auto expected = advanced.advance(held);
+                    const auto actual = skipped.advance(held);
+                    REQUIRE(actual.count == expected.count);
+                    REQUIRE(actual.notes[0] == expected.notes[0]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("NoteSelector - skip() keeps the Walk PRNG and octave in step",
+          "[note_selector]") {
+    HeldNoteBuffer held;
+    held.noteOn(60, 100);
+    held.noteOn(64, 100);
+    held.noteOn(67, 100);
+
+    NoteSelector advanced(3);
+    NoteSelector skipped(3);
+    for (auto* selector : {&advanced, &skipped}) {
+        selector->setMode(ArpMode::Walk);
+        selector->setOctaveRange(2);
+    }
+    REQUIRE_FALSE(skipped.isSkipExact());
+
+    for (int i = 0; i < 999; ++i) {
+        (void)advanced.advance(held);
+    }
+    skipped.skip(999, held);
+    REQUIRE(skipped.randomState() == advanced.randomState());
+
+    // Same octave: both notes are in the upper octave on the 1000th advance
+    REQUIRE(advanced.advance(held).notes[0] >= 72);
+    REQUIRE(skipped.advance(held).notes[0] >= 72);
+}
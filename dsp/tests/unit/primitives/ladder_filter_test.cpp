@@ -2600,6 +2600,56 @@ TEST_CASE("LadderFilter linear model doesn't generate harmonics (no aliasing sou
     REQUIRE(sar >= 40.0f);
 }
 
+TEST_CASE("LadderFilter fast coefficients match exact under cutoff sweep", "[ladder][fast_coefficients]") {
+    constexpr double kSampleRate = 48000.0;
+    constexpr size_t kNumSamples = 4800;
+
+    for (LadderModel model : {LadderModel::Linear, LadderModel::Nonlinear}) {
+        LadderFilter exact;
+        LadderFilter fast;
+        for (LadderFilter* f : {&exact, &fast}) {
+            f->prepare(kSampleRate, 512);
+            f->setModel(model);
+            f->setResonance(1.5f);
+        }
+        fast.setFastCoefficients(true);
+
+        float maxDiff = 0.0f;
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            const float phase = static_cast<float>(i) / static_cast<float>(kNumSamples);
+            // 40 Hz .. 8 kHz: the linear model is not stable right up to its
+            // 0.45 * fs clamp, which would swamp the comparison.
+            const float cutoff = 40.0f * std::pow(200.0f, phase);
+            exact.setCutoff(cutoff);
+            fast.setCutoff(cutoff);
+            const float x = 0.5f * std::sin(kTwoPi * 220.0f * static_cast<float>(i)
+                                            / static_cast<float>(kSampleRate));
+            maxDiff = std::max(maxDiff, std::abs(exact.process(x) - fast.process(x)));
+        }
+        INFO("model = " << static_cast<int>(model) << ", max diff = " << maxDiff);
+        REQUIRE(maxDiff < 1e-4f);
+    }
+}
+
+TEST_CASE("LadderFilter settled cutoff output is unchanged by coefficient caching", "[ladder][fast_coefficients]") {
+    // The g cache only skips recomputation for identical inputs, so a
+    // filter whose cutoff is re-set to the same value every sample must be
+    // bit-identical to one that is configured once.
+    LadderFilter once;
+    LadderFilter repeated;
+    for (LadderFilter* f : {&once, &repeated}) {
+        f->prepare(44100.0, 512);
+        f->setModel(LadderModel::Linear);
+        f->setCutoff(1500.0f);
+        f->setResonance(1.0f);
+    }
+    for (int i = 0; i < 2048; ++i) {
+        const float x = (i % 64 == 0) ? 1.0f : 0.0f;
+        repeated.setCutoff(1500.0f);
+        REQUIRE(once.process(x) == repeated.process(x));
+    }
+}
+
 // ==============================================================================
 // End of Ladder Filter Tests
 // ==============================================================================
@@ -20,6 +20,7 @@
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <vector>
 
 using Catch::Approx;
 using namespace Krate::DSP;
@@ -1542,3 +1543,88 @@ TEST_CASE("Oversampler compareAliasing: sample rate independence",
         }
     }
 }
+
+// =============================================================================
+// Polyphase Halfband Tests
+// =============================================================================
+
+namespace {
+
+template<size_t NumTaps, size_t NumCoeffs>
+void checkPolyphaseMatchesDirectForm(const std::array<float, NumCoeffs>& coeffs) {
+    HalfbandFilter<NumTaps> directUp;
+    HalfbandFilter<NumTaps> directDown;
+    HalfbandInterpolator<NumTaps> polyUp;
+    HalfbandDecimator<NumTaps> polyDown;
+    directUp.setCoefficients(coeffs.data(), coeffs.size());
+    directDown.setCoefficients(coeffs.data(), coeffs.size());
+    polyUp.setCoefficients(coeffs.data(), coeffs.size());
+    polyDown.setCoefficients(coeffs.data(), coeffs.size());
+
+    uint32_t seed = 12345;
+    auto noise = [&seed] {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    };
+
+    // Odd block sizes cross the internal chunk and history-ring boundaries
+    for (size_t blockSize : {1u, 7u, 64u, 100u, 333u, 5u}) {
+        std::vector<float> input(blockSize);
+        for (auto& x : input) x = noise();
+
+        // Interpolation: zero-stuff + direct-form filter vs polyphase
+        std::vector<float> expectedUp(2 * blockSize);
+        for (size_t i = 0; i < blockSize; ++i) {
+            expectedUp[2 * i] = directUp.process(input[i] * 2.0f);
+            expectedUp[2 * i + 1] = directUp.process(0.0f);
+        }
+        std::vector<float> up(2 * blockSize);
+        polyUp.process(input.data(), up.data(), blockSize);
+        for (size_t i = 0; i < up.size(); ++i) {
+            REQUIRE(up[i] == Approx(expectedUp[i]).margin(1e-6f));
+        }
+
+        // Decimation: direct-form filter + drop odd outputs vs polyphase
+        std::vector<float> expectedDown(blockSize);
+        for (size_t i = 0; i < blockSize; ++i) {
+            expectedDown[i] = directDown.process(up[2 * i]);
+            (void)directDown.process(up[2 * i + 1]);
+        }
+        std::vector<float> down(blockSize);
+        polyDown.process(up.data(), down.data(), blockSize);
+        for (size_t i = 0; i < blockSize; ++i) {
+            REQUIRE(down[i] == Approx(expectedDown[i]).margin(1e-6f));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("Polyphase halfband matches the direct-form HalfbandFilter",
+          "[oversampler][polyphase]") {
+    SECTION("Standard (31 taps)") {
+        checkPolyphaseMatchesDirectForm<detail::kStandardFirLength>(
+            detail::kStandardFirCoeffs);
+    }
+    SECTION("High (63 taps)") {
+        checkPolyphaseMatchesDirectForm<detail::kHighFirLength>(detail::kHighFirCoeffs);
+    }
+}
+
+TEST_CASE("Polyphase halfband reset clears history", "[oversampler][polyphase]") {
+    HalfbandInterpolator<detail::kHighFirLength> up;
+    up.setCoefficients(detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+
+    std::array<float, 16> impulse{};
+    impulse[0] = 1.0f;
+    std::array<float, 32> first{};
+    up.process(impulse.data(), first.data(), impulse.size());
+
+    up.reset();
+    std::array<float, 32> second{};
+    up.process(impulse.data(), second.data(), impulse.size());
+    REQUIRE(first == second);
+
+    // The centre tap passes the impulse through exactly at the latency
+    REQUIRE(first[detail::kHighFirLatency] == 1.0f);
+}
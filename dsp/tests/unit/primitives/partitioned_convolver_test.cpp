@@ -0,0 +1,206 @@
+// ==============================================================================
+// Tests: Partitioned Convolver
+// ==============================================================================
+// The head + partitioned FFT tail reproduces direct convolution at zero
+// latency for any host block size, with and without the background worker.
+// ==============================================================================
+
+#include <krate/dsp/core/convolution_simd.h>
+#include <krate/dsp/primitives/partitioned_convolver.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace Krate::DSP;
+
+namespace {
+
+std::vector<float> decayingNoise(size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> ir(length);
+    for (size_t i = 0; i < length; ++i) {
+        ir[i] = dist(rng) * std::exp(-3.0f * static_cast<float>(i) / static_cast<float>(length));
+    }
+    return ir;
+}
+
+std::vector<float> directConvolution(const std::vector<float>& x, const std::vector<float>& h) {
+    std::vector<float> y(x.size(), 0.0f);
+    for (size_t n = 0; n < x.size(); ++n) {
+        double acc = 0.0;
+        const size_t taps = std::min(h.size(), n + 1);
+        for (size_t k = 0; k < taps; ++k) acc += static_cast<double>(h[k]) * x[n - k];
+        y[n] = static_cast<float>(acc);
+    }
+    return y;
+}
+
+/// Run a mono convolver over x in host blocks of blockSize
+std::vector<float> runBlocks(PartitionedConvolver& conv, const std::vector<float>& x,
+                             size_t blockSize) {
+    std::vector<float> y(x.size(), 0.0f);
+    for (size_t pos = 0; pos < x.size(); pos += blockSize) {
+        const size_t n = std::min(blockSize, x.size() - pos);
+        conv.process(x.data() + pos, y.data() + pos, n);
+    }
+    return y;
+}
+
+float maxAbsDiff(const std::vector<float>& a, const std::vector<float>& b) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - b[i]));
+    return worst;
+}
+
+} // anonymous namespace
+
+TEST_CASE("convolveDirectFIR matches scalar FIR", "[partitioned_convolver]") {
+    const std::vector<float> taps = decayingNoise(37, 3);
+    std::vector<float> reversed(taps.rbegin(), taps.rend());
+    const std::vector<float> x = decayingNoise(36 + 53, 4);
+
+    std::vector<float> out(53, 0.0f);
+    convolveDirectFIR(x.data(), reversed.data(), taps.size(), out.data(), out.size());
+
+    for (size_t m = 0; m < out.size(); ++m) {
+        float expected = 0.0f;
+        for (size_t k = 0; k < taps.size(); ++k) expected += taps[k] * x[m + 36 - k];
+        REQUIRE(std::abs(out[m] - expected) < 1e-5f);
+    }
+}
+
+TEST_CASE("PartitionedConvolver stage layout covers the IR", "[partitioned_convolver]") {
+    const std::vector<float> ir = decayingNoise(20000, 1);
+    const float* channels[] = {ir.data()};
+    PartitionedConvolver conv;
+    REQUIRE(conv.setImpulseResponse(channels, 1, ir.size(), {64, 1024, false}));
+
+    REQUIRE(conv.numStages() > 0);
+    size_t expectedOffset = conv.headBlockSize();
+    for (size_t i = 0; i < conv.numStages(); ++i) {
+        const size_t n = conv.stageBlockSize(i);
+        REQUIRE(conv.stageOffset(i) == expectedOffset);
+        REQUIRE(conv.stageOffset(i) >= n);
+        REQUIRE(n <= 1024);
+        // Every stage after the first leaves a full block of slack
+        if (i > 0) REQUIRE(conv.stageOffset(i) >= 2 * n);
+        expectedOffset += conv.stagePartitions(i) * n;
+    }
+    REQUIRE(expectedOffset >= ir.size());
+    REQUIRE(conv.stageBlockSize(0) == 64);
+    REQUIRE(conv.stagePartitions(0) == 7);
+    REQUIRE(conv.stageBlockSize(conv.numStages() - 1) == 1024);
+}
+
+TEST_CASE("PartitionedConvolver matches direct convolution", "[partitioned_convolver]") {
+    const std::vector<float> ir = decayingNoise(3000, 7);
+    const std::vector<float> x = decayingNoise(9000, 11);
+    const std::vector<float> expected = directConvolution(x, ir);
+    const float* channels[] = {ir.data()};
+
+    const bool background = GENERATE(false, true);
+    const size_t blockSize = GENERATE(size_t{1}, size_t{17}, size_t{64}, size_t{333});
+    CAPTURE(background, blockSize);
+
+    PartitionedConvolver conv;
+    REQUIRE(conv.setImpulseResponse(channels, 1, ir.size(), {64, 512, background}));
+    REQUIRE(conv.hasBackgroundWorker() == background);
+
+    const std::vector<float> y = runBlocks(conv, x, blockSize);
+    REQUIRE(maxAbsDiff(y, expected) < 1e-3f);
+}
+
+TEST_CASE("PartitionedConvolver has zero latency", "[partitioned_convolver]") {
+    const std::vector<float> ir = decayingNoise(1500, 5);
+    const float* channels[] = {ir.data()};
+    PartitionedConvolver conv;
+    REQUIRE(conv.setImpulseResponse(channels, 1, ir.size(), {32, 256, true}));
+    REQUIRE(PartitionedConvolver::latency() == 0);
+
+    std::vector<float> x(2048, 0.0f);
+    x[0] = 1.0f;
+    const std::vector<float> y = runBlocks(conv, x, 64);
+
+    for (size_t i = 0; i < ir.size(); ++i) REQUIRE(std::abs(y[i] - ir[i]) < 1e-4f);
+    for (size_t i = ir.size(); i < y.size(); ++i) REQUIRE(std::abs(y[i]) < 1e-4f);
+}
+
+TEST_CASE("PartitionedConvolver keeps stereo channels independent",
+          "[partitioned_convolver]") {
+    const std::vector<float> irL = decayingNoise(1200, 21);
+    const std::vector<float> irR = decayingNoise(700, 22);
+    // Channels share one length: the shorter right IR is zero-padded
+    std::vector<float> paddedR(irL.size(), 0.0f);
+    std::copy(irR.begin(), irR.end(), paddedR.begin());
+    const float* irs[] = {irL.data(), paddedR.data()};
+    PartitionedConvolver conv;
+    REQUIRE(conv.setImpulseResponse(irs, 2, irL.size(), {64, 256, true}));
+    REQUIRE(conv.numChannels() == 2);
+
+    const std::vector<float> x = decayingNoise(4000, 23);
+    std::vector<float> silent(x.size(), 0.0f);
+    std::vector<float> left = x;   // processed in place
+    std::vector<float> right(x.size(), 0.0f);
+    for (size_t pos = 0; pos < x.size(); pos += 100) {
+        const size_t n = std::min<size_t>(100, x.size() - pos);
+        const float* in[] = {left.data() + pos, silent.data() + pos};
+        float* out[] = {left.data() + pos, right.data() + pos};
+        conv.process(in, out, n);
+    }
+
+    REQUIRE(maxAbsDiff(left, directConvolution(x, irL)) < 1e-3f);
+    for (float s : right) REQUIRE(s == 0.0f);
+}
+
+TEST_CASE("PartitionedConvolver reset clears the tail", "[partitioned_convolver]") {
+    const std::vector<float> ir = decayingNoise(2000, 31);
+    const float* channels[] = {ir.data()};
+    PartitionedConvolver conv;
+    REQUIRE(conv.setImpulseResponse(channels, 1, ir.size(), {64, 512, true}));
+
+    const std::vector<float> x = decayingNoise(1000, 32);
+    (void)runBlocks(conv, x, 64);
+    conv.reset();
+
+    const std::vector<float> silence(3000, 0.0f);
+    const std::vector<float> y = runBlocks(conv, silence, 64);
+    for (float s : y) REQUIRE(s == 0.0f);
+
+    // After reset the engine behaves like a fresh one
+    const std::vector<float> expected = directConvolution(x, ir);
+    REQUIRE(maxAbsDiff(runBlocks(conv, x, 48), expected) < 1e-3f);
+}
+
+TEST_CASE("PartitionedConvolver handles short and missing IRs", "[partitioned_convolver]") {
+    PartitionedConvolver conv;
+    std::vector<float> out(64, 1.0f);
+    const std::vector<float> in(64, 0.5f);
+    conv.process(in.data(), out.data(), out.size());
+    for (float s : out) REQUIRE(s == 0.0f);
+
+    // Shorter than the head: no FFT stages at all
+    const std::vector<float> ir = {0.5f, -0.25f, 0.125f};
+    const float* channels[] = {ir.data()};
+    REQUIRE(conv.setImpulseResponse(channels, 1, ir.size()));
+    REQUIRE(conv.numStages() == 0);
+    REQUIRE_FALSE(conv.hasBackgroundWorker());
+
+    std::vector<float> x(10, 0.0f);
+    x[2] = 1.0f;
+    std::vector<float> y(10, 0.0f);
+    conv.process(x.data(), y.data(), y.size());
+    REQUIRE(y[2] == 0.5f);
+    REQUIRE(y[3] == -0.25f);
+    REQUIRE(y[4] == 0.125f);
+    REQUIRE(y[5] == 0.0f);
+
+    REQUIRE_FALSE(conv.setImpulseResponse(channels, 3, ir.size()));
+    REQUIRE(conv.numChannels() == 0);
+}
@@ -2186,6 +2186,36 @@ TEST_CASE("SVF LP: snapToTarget() handles extreme cutoff jumps on retrigger",
     CHECK(clicks.size() <= 5);
 }
 
+TEST_CASE("SVF fast coefficients track std::tan under cutoff modulation", "[svf][fast_coefficients]") {
+    constexpr double kSampleRate = 48000.0;
+    constexpr size_t kNumSamples = 4800;
+
+    SVF exact;
+    SVF fast;
+    for (SVF* f : {&exact, &fast}) {
+        f->prepare(kSampleRate);
+        f->enableSmoothing(true);
+        f->setMode(SVFMode::Lowpass);
+        f->setResonance(4.0f);
+    }
+    fast.setFastCoefficients(true);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        // Sweep 30 Hz .. ~23.7 kHz, i.e. the full clamped cutoff range.
+        const float phase = static_cast<float>(i) / static_cast<float>(kNumSamples);
+        const float cutoff = 30.0f * std::pow(800.0f, phase);
+        exact.setCutoff(cutoff);
+        fast.setCutoff(cutoff);
+        const float x = dist(rng);
+        maxDiff = std::max(maxDiff, std::abs(exact.process(x) - fast.process(x)));
+    }
+    INFO("max |exact - fast| = " << maxDiff);
+    REQUIRE(maxDiff < 1e-4f);
+}
+
 // ==============================================================================
 // End of SVF Tests
 // ==============================================================================
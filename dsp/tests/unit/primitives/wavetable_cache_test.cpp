@@ -0,0 +1,109 @@
+// ==============================================================================
+// Tests: Wavetable Cache
+// ==============================================================================
+// Identical recipes share one table, tables match what the generator builds
+// directly, and a table is freed when its last handle goes away.
+// ==============================================================================
+
+#include <krate/dsp/primitives/wavetable_cache.h>
+#include <krate/dsp/primitives/wavetable_generator.h>
+#include <krate/dsp/processors/fm_operator.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <utility>
+
+using namespace Krate::DSP;
+
+namespace {
+
+bool sameContent(const WavetableData& a, const WavetableData& b) {
+    if (a.numLevels() != b.numLevels()) return false;
+    for (size_t level = 0; level < a.numLevels(); ++level) {
+        const float* x = a.getLevel(level);
+        const float* y = b.getLevel(level);
+        for (size_t i = 0; i < a.tableSize(); ++i) {
+            if (x[i] != y[i]) return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+TEST_CASE("WavetableCache shares one table per recipe", "[wavetable_cache]") {
+    auto& cache = WavetableCache::instance();
+    const size_t before = cache.numTables();
+
+    auto sawA = cache.acquire(CachedWaveform::Saw);
+    auto sawB = cache.acquire(CachedWaveform::Saw);
+    auto square = cache.acquire(CachedWaveform::Square);
+    REQUIRE(sawA.get() != nullptr);
+    REQUIRE(sawA.get() == sawB.get());
+    REQUIRE(square.get() != sawA.get());
+
+    const float odd[] = {1.0f, 0.0f, 0.33f};
+    const float even[] = {1.0f, 0.5f};
+    auto oddA = cache.acquireHarmonics(odd, 3);
+    auto oddB = cache.acquireHarmonics(odd, 3);
+    auto evenA = cache.acquireHarmonics(even, 2);
+    REQUIRE(oddA.get() == oddB.get());
+    REQUIRE(evenA.get() != oddA.get());
+    REQUIRE(cache.numTables() == before + 4);
+}
+
+TEST_CASE("WavetableCache tables match direct generation", "[wavetable_cache]") {
+    auto& cache = WavetableCache::instance();
+
+    WavetableData saw;
+    generateMipmappedSaw(saw);
+    auto cachedSaw = cache.acquire(CachedWaveform::Saw);
+    REQUIRE(sameContent(*cachedSaw.get(), saw));
+
+    WavetableData triangle;
+    generateMipmappedTriangle(triangle);
+    auto cachedTriangle = cache.acquire(CachedWaveform::Triangle);
+    REQUIRE(sameContent(*cachedTriangle.get(), triangle));
+
+    const float harmonics[] = {1.0f, 0.25f, 0.125f};
+    WavetableData custom;
+    generateMipmappedFromHarmonics(custom, harmonics, 3);
+    auto cachedCustom = cache.acquireHarmonics(harmonics, 3);
+    REQUIRE(sameContent(*cachedCustom.get(), custom));
+}
+
+TEST_CASE("WavetableCache frees a table with its last handle", "[wavetable_cache]") {
+    auto& cache = WavetableCache::instance();
+    const size_t before = cache.numTables();
+    const float harmonics[] = {1.0f, 0.0f, 0.0f, 0.7f};
+
+    auto a = cache.acquireHarmonics(harmonics, 4);
+    REQUIRE(cache.numTables() == before + 1);
+
+    WavetableCache::Handle copy = a;
+    REQUIRE(copy.get() == a.get());
+    WavetableCache::Handle moved = std::move(a);
+    REQUIRE_FALSE(a);
+    REQUIRE(moved.get() == copy.get());
+
+    copy.reset();
+    REQUIRE(cache.numTables() == before + 1);
+    moved.reset();
+    REQUIRE(cache.numTables() == before);
+}
+
+TEST_CASE("FMOperator instances read the same cached sine table", "[wavetable_cache]") {
+    auto& cache = WavetableCache::instance();
+    const size_t before = cache.numTables();
+
+    {
+        FMOperator a;
+        FMOperator b;
+        a.prepare(44100.0);
+        b.prepare(48000.0);
+        // At most one new table, however many operators are prepared
+        REQUIRE(cache.numTables() <= before + 1);
+    }
+    REQUIRE(cache.numTables() <= before);
+}
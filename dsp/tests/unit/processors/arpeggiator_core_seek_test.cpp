@@ -0,0 +1,644 @@
+// arpeggiator_core_seek_test.cpp
+// Host-transport seek: seekTo(ppq) must land on the state a linear playthrough
+// from PPQ 0 would have, checked against the SC-002 golden fixtures and against
+// linear playback of richer configurations. Solved seeks cost the same at any
+// song position; history-dependent ones replay from the nearest checkpoint,
+// never more than ArpeggiatorCore::kSeekReplayBudgetSteps steps.
+#include "arpeggiator_core_test_helpers.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+constexpr double kSeekSampleRate = 44100.0;
+constexpr size_t kSeekBlockSize = 512;
+
+BlockContext makeSeekContext(double bpm) {
+    BlockContext ctx;
+    ctx.sampleRate = kSeekSampleRate;
+    ctx.blockSize = kSeekBlockSize;
+    ctx.tempoBPM = bpm;
+    ctx.isPlaying = true;
+    ctx.transportPositionSamples = 0;
+    return ctx;
+}
+
+/// PPQ that maps exactly onto a block boundary, so the seeked and linear runs
+/// share one block grid (humanize clamps offsets to the block).
+double ppqForBlock(size_t block, double bpm) {
+    const double samplesPerBeat = 60.0 / bpm * kSeekSampleRate;
+    return static_cast<double>(block * kSeekBlockSize) / samplesPerBeat;
+}
+
+/// Events from seeking to `block` and playing `numBlocks`, in absolute samples.
+std::vector<ArpEvent> playFromSeek(ArpeggiatorCore& arp, double bpm, size_t block,
+                                   size_t numBlocks) {
+    BlockContext ctx = makeSeekContext(bpm);
+    arp.seekTo(ppqForBlock(block, bpm), ctx);
+    ctx.transportPositionSamples = static_cast<int64_t>(block * kSeekBlockSize);
+    auto events = collectEvents(arp, ctx, numBlocks);
+    for (auto& e : events) {
+        e.sampleOffset += static_cast<int32_t>(block * kSeekBlockSize);
+    }
+    return events;
+}
+
+/// NoteOns and skips at or after `fromSample` (NoteOffs depend on what the
+/// host heard before the seek, so they are not part of the comparison).
+std::vector<ArpEvent> stepEventsFrom(const std::vector<ArpEvent>& events,
+                                     int32_t fromSample) {
+    std::vector<ArpEvent> out;
+    for (const auto& e : events) {
+        if (e.type != ArpEvent::Type::NoteOff && e.sampleOffset >= fromSample) {
+            out.push_back(e);
+        }
+    }
+    return out;
+}
+
+void requireSameEvents(const std::vector<ArpEvent>& expected,
+                       const std::vector<ArpEvent>& actual) {
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        INFO("event " << i << " at sample " << expected[i].sampleOffset);
+        REQUIRE(actual[i].type == expected[i].type);
+        REQUIRE(actual[i].note == expected[i].note);
+        REQUIRE(actual[i].velocity == expected[i].velocity);
+        REQUIRE(actual[i].sampleOffset == expected[i].sampleOffset);
+    }
+}
+
+/// Seek to each block and compare against one linear playthrough.
+void requireSeekMatchesLinear(const std::function<void(ArpeggiatorCore&)>& configure,
+                              double bpm, std::initializer_list<size_t> seekBlocks,
+                              size_t windowBlocks = 400) {
+    const size_t lastBlock = *std::max_element(seekBlocks.begin(), seekBlocks.end());
+
+    ArpeggiatorCore linear;
+    linear.prepare(kSeekSampleRate, kSeekBlockSize);
+    configure(linear);
+    BlockContext ctx = makeSeekContext(bpm);
+    const auto linearEvents = collectEvents(linear, ctx, lastBlock + windowBlocks);
+
+    for (size_t block : seekBlocks) {
+        INFO("seek to block " << block);
+        ArpeggiatorCore seeked;
+        seeked.prepare(kSeekSampleRate, kSeekBlockSize);
+        configure(seeked);
+
+        // Some history first: seekTo() must not depend on it
+        BlockContext warmup = makeSeekContext(bpm);
+        (void)collectEvents(seeked, warmup, 37);
+
+        const auto from = static_cast<int32_t>(block * kSeekBlockSize);
+        const auto until = from + static_cast<int32_t>(windowBlocks * kSeekBlockSize);
+        auto expected = stepEventsFrom(linearEvents, from);
+        expected.erase(std::remove_if(expected.begin(), expected.end(),
+                           [until](const ArpEvent& e) { return e.sampleOffset >= until; }),
+                       expected.end());
+        REQUIRE_FALSE(expected.empty());
+
+        const auto actual = stepEventsFrom(playFromSeek(seeked, bpm, block, windowBlocks), from);
+        requireSameEvents(expected, actual);
+    }
+}
+
+/// Lane speeds and curves, per-lane swing, probability and ratchets: solved
+/// exactly, with at most one step replayed.
+void configureSolvedState(ArpeggiatorCore& arp) {
+    arp.setEnabled(true);
+    arp.setMode(ArpMode::UpDown);
+    arp.setOctaveRange(2);
+    arp.setNoteValue(NoteValue::Eighth, NoteModifier::Triplet);
+    arp.setGateLength(70.0f);
+    arp.setHumanize(0.3f);
+
+    arp.pitchLane().setLength(5);
+    for (size_t i = 0; i < 5; ++i) {
+        arp.pitchLane().setStep(i, static_cast<int8_t>(i));
+    }
+    arp.setLaneSpeed(2, 1.5f);
+    arp.velocityLane().setLength(3);
+    arp.velocityLane().setStep(1, 0.6f);
+    arp.setLaneSwing(0, 40.0f);
+    arp.gateLane().setLength(4);
+    arp.gateLane().setStep(2, 0.4f);
+    arp.setLaneSpeed(1, 0.75f);
+    arp.ratchetLane().setLength(5);
+    arp.ratchetLane().setStep(0, static_cast<uint8_t>(1));
+    arp.ratchetLane().setStep(3, static_cast<uint8_t>(3));
+    arp.conditionLane().setLength(4);
+    arp.conditionLane().setStep(1, static_cast<uint8_t>(TrigCondition::Prob50));
+    arp.conditionLane().setStep(3, static_cast<uint8_t>(TrigCondition::Prob75));
+    arp.setLaneSpeed(5, 1.25f);
+    arp.chordLane().setLength(3);
+    arp.chordLane().setStep(2, static_cast<uint8_t>(ChordType::Triad));
+
+    // Slow first half, fast second half: speed 0.75 / 1.25 at depth 0.5
+    std::array<float, 256> curve{};
+    for (size_t i = 0; i < curve.size(); ++i) {
+        curve[i] = (i < curve.size() / 2) ? 0.25f : 0.75f;
+    }
+    arp.setLaneSpeedCurveTable(3, curve);
+    arp.consumePendingCurveTables();
+    arp.setLaneSpeedCurveDepth(3, 0.5f);
+    arp.setLaneSpeedCurveEnabled(3, true);
+    arp.modifierLane().setLength(6);
+    arp.modifierLane().setStep(4, static_cast<uint8_t>(0));  // rest
+
+    arp.setEuclideanSteps(7);
+    arp.setEuclideanHits(5);
+    arp.setEuclideanEnabled(true);
+
+    arp.noteOn(48, 100);
+    arp.noteOn(55, 100);
+    arp.noteOn(62, 100);
+}
+
+/// Bar retrigger, length jitter and ratchets under swing together: history
+/// dependent, so seekTo() replays the playthrough.
+void configureReplayedState(ArpeggiatorCore& arp) {
+    arp.setEnabled(true);
+    arp.setMode(ArpMode::UpDown);
+    arp.setOctaveRange(2);
+    arp.setNoteValue(NoteValue::Eighth, NoteModifier::Triplet);
+    arp.setGateLength(70.0f);
+    arp.setSwing(20.0f);
+    arp.setRetrigger(ArpRetriggerMode::Beat);
+    arp.setHumanize(0.3f);
+
+    arp.pitchLane().setLength(5);
+    for (size_t i = 0; i < 5; ++i) {
+        arp.pitchLane().setStep(i, static_cast<int8_t>(i));
+    }
+    arp.setLaneSpeed(2, 1.5f);
+    arp.velocityLane().setLength(3);
+    arp.velocityLane().setStep(1, 0.6f);
+    arp.setLaneSwing(0, 40.0f);
+    arp.gateLane().setLength(4);
+    arp.gateLane().setStep(2, 0.4f);
+    arp.setLaneLengthJitter(1, 2);
+    arp.ratchetLane().setLength(5);
+    arp.ratchetLane().setStep(0, static_cast<uint8_t>(1));
+    arp.ratchetLane().setStep(3, static_cast<uint8_t>(3));
+    arp.conditionLane().setLength(4);
+    arp.conditionLane().setStep(1, static_cast<uint8_t>(TrigCondition::Prob50));
+    arp.conditionLane().setStep(3, static_cast<uint8_t>(TrigCondition::Prob75));
+
+    arp.noteOn(48, 100);
+    arp.noteOn(55, 100);
+    arp.noteOn(62, 100);
+}
+
+/// Common ground for the single history-dependent features below: humanize,
+/// a probability condition and polymetric lanes keep the other generators and
+/// lane phases in play.
+void configureHistoryBase(ArpeggiatorCore& arp) {
+    arp.setEnabled(true);
+    arp.setMode(ArpMode::UpDown);
+    arp.setOctaveRange(2);
+    arp.setNoteValue(NoteValue::Sixteenth, NoteModifier::None);
+    arp.setGateLength(60.0f);
+    arp.setHumanize(0.4f);
+    arp.pitchLane().setLength(5);
+    for (size_t i = 0; i < 5; ++i) {
+        arp.pitchLane().setStep(i, static_cast<int8_t>(i * 2));
+    }
+    arp.velocityLane().setLength(3);
+    arp.velocityLane().setStep(1, 0.6f);
+    arp.conditionLane().setLength(3);
+    arp.conditionLane().setStep(2, static_cast<uint8_t>(TrigCondition::Prob50));
+
+    arp.noteOn(48, 100);
+    arp.noteOn(55, 90);
+    arp.noteOn(60, 110);
+    arp.noteOn(63, 80);
+}
+
+/// A triad on two of every three steps, strummed over 15 ms
+void configureStrum(ArpeggiatorCore& arp, int direction) {
+    configureHistoryBase(arp);
+    arp.chordLane().setLength(3);
+    arp.chordLane().setStep(0, static_cast<uint8_t>(ChordType::Triad));
+    arp.chordLane().setStep(2, static_cast<uint8_t>(ChordType::Seventh));
+    arp.setStrumTime(15.0f);
+    arp.setStrumDirection(direction);
+}
+
+/// Samples a seek to `block` replays when nothing is cached
+size_t replayFromOrigin(size_t block) {
+    return block * kSeekBlockSize;
+}
+
+} // namespace
+
+TEST_CASE("ArpeggiatorCore: seekTo lands on the golden fixture timeline",
+          "[processors][arpeggiator_core][seek]") {
+    const std::string basePath = "dsp/tests/fixtures/";
+
+    for (double bpm : {120.0, 140.0, 180.0}) {
+        INFO("BPM " << bpm);
+        const auto fixture = readBaselineFixture(
+            basePath + "arp_baseline_" + std::to_string(static_cast<int>(bpm)) + "bpm.dat");
+        REQUIRE(fixture.size() >= 1000);
+
+        for (size_t block : {size_t{1}, size_t{97}, size_t{1000}, size_t{9000}, size_t{14000}}) {
+            INFO("seek to block " << block);
+            // Same configuration as generateAndWriteBaseline()
+            ArpeggiatorCore arp;
+            arp.prepare(kSeekSampleRate, kSeekBlockSize);
+            arp.setEnabled(true);
+            arp.setMode(ArpMode::Up);
+            arp.setNoteValue(NoteValue::Eighth, NoteModifier::None);
+            arp.setGateLength(80.0f);
+            arp.setSwing(0.0f);
+            arp.noteOn(60, 100);
+
+            const auto from = static_cast<int32_t>(block * kSeekBlockSize);
+            const auto firstExpected = std::find_if(fixture.begin(), fixture.end(),
+                [from](const ArpEvent& e) { return e.sampleOffset >= from; });
+            REQUIRE(fixture.end() - firstExpected >= 32);
+            const std::vector<ArpEvent> expected(firstExpected, firstExpected + 32);
+
+            auto actual = filterNoteOns(playFromSeek(arp, bpm, block, 800));
+            REQUIRE(actual.size() >= 32);
+            actual.resize(32);
+            requireSameEvents(expected, actual);
+        }
+    }
+}
+
+TEST_CASE("ArpeggiatorCore: seekTo matches linear playback for step-indexed state",
+          "[processors][arpeggiator_core][seek]") {
+    // Everything here is a function of the step index: polymetric lanes,
+    // Euclidean gating, loop-count conditions, swing, humanize and a random
+    // note order all have to land in phase.
+    auto configure = [](ArpeggiatorCore& arp) {
+        arp.setEnabled(true);
+        arp.setMode(ArpMode::Random);
+        arp.setNoteValue(NoteValue::Sixteenth, NoteModifier::None);
+        arp.setGateLength(60.0f);
+        arp.setSwing(30.0f);
+        arp.setHumanize(0.5f);
+
+        arp.velocityLane().setLength(5);
+        for (size_t i = 0; i < 5; ++i) {
+            arp.velocityLane().setStep(i, 0.5f + 0.1f * static_cast<float>(i));
+        }
+        arp.pitchLane().setLength(7);
+        for (size_t i = 0; i < 7; ++i) {
+            arp.pitchLane().setStep(i, static_cast<int8_t>(i * 2 - 6));
+        }
+        arp.modifierLane().setLength(6);
+        arp.modifierLane().setStep(0, static_cast<uint8_t>(kStepActive));
+        arp.modifierLane().setStep(1, static_cast<uint8_t>(kStepActive | kStepAccent));
+        arp.modifierLane().setStep(2, static_cast<uint8_t>(0));  // rest
+        arp.modifierLane().setStep(3, static_cast<uint8_t>(kStepActive));
+        arp.modifierLane().setStep(4, static_cast<uint8_t>(kStepActive | kStepTie));
+        arp.modifierLane().setStep(5, static_cast<uint8_t>(kStepActive));
+        arp.conditionLane().setLength(3);
+        arp.conditionLane().setStep(0, static_cast<uint8_t>(TrigCondition::Ratio_1_2));
+        arp.conditionLane().setStep(1, static_cast<uint8_t>(TrigCondition::Always));
+        arp.conditionLane().setStep(2, static_cast<uint8_t>(TrigCondition::Ratio_2_3));
+        arp.chordLane().setLength(4);
+        arp.chordLane().setStep(3, static_cast<uint8_t>(ChordType::Triad));
+
+        arp.setEuclideanSteps(8);
+        arp.setEuclideanHits(5);
+        arp.setEuclideanRotation(1);
+        arp.setEuclideanEnabled(true);
+
+        arp.noteOn(60, 100);
+        arp.noteOn(63, 90);
+        arp.noteOn(67, 80);
+        arp.noteOn(70, 110);
+    };
+
+    requireSeekMatchesLinear(configure, 128.0, {1, 50, 333, 2000, 9999});
+}
+
+TEST_CASE("ArpeggiatorCore: seekTo matches linear playback with solved lane motion",
+          "[processors][arpeggiator_core][seek]") {
+    // Bar ~1000 at 97 BPM is block 213000
+    requireSeekMatchesLinear(configureSolvedState, 97.0, {3, 256, 1500, 6000, 213000});
+}
+
+TEST_CASE("ArpeggiatorCore: seekTo releases notes that were sounding",
+          "[processors][arpeggiator_core][seek]") {
+    ArpeggiatorCore arp;
+    arp.prepare(kSeekSampleRate, kSeekBlockSize);
+    arp.setEnabled(true);
+    arp.setNoteValue(NoteValue::Quarter, NoteModifier::None);
+    arp.setGateLength(90.0f);
+    arp.noteOn(64, 100);
+
+    // Step 0 fires at sample 0; its gate is still open after one block
+    BlockContext ctx = makeSeekContext(120.0);
+    auto before = collectEvents(arp, ctx, 1);
+    REQUIRE(filterNoteOns(before).size() == 1);
+    REQUIRE(filterNoteOffs(before).empty());
+
+    // Seek mid-step: the old note is released at once, nothing else sounds
+    // until the next step boundary
+    arp.seekTo(2.5, ctx);
+    std::array<ArpEvent, 128> events{};
+    const size_t count = arp.processBlock(ctx, events);
+    REQUIRE(count == 1);
+    REQUIRE(events[0].type == ArpEvent::Type::NoteOff);
+    REQUIRE(events[0].note == 64);
+    REQUIRE(events[0].sampleOffset == 0);
+}
+
+TEST_CASE("ArpeggiatorCore: seekTo on a step boundary fires that step at once",
+          "[processors][arpeggiator_core][seek]") {
+    ArpeggiatorCore arp;
+    arp.prepare(kSeekSampleRate, kSeekBlockSize);
+    arp.setEnabled(true);
+    arp.setMode(ArpMode::Up);
+    arp.setNoteValue(NoteValue::Quarter, NoteModifier::None);
+    arp.noteOn(60, 100);
+    arp.noteOn(64, 100);
+    arp.noteOn(67, 100);
+
+    // Beat 4 is step 4: the fifth note of an Up pattern over three notes
+    BlockContext ctx = makeSeekContext(120.0);
+    arp.seekTo(4.0, ctx);
+    std::array<ArpEvent, 128> events{};
+    const size_t count = arp.processBlock(ctx, events);
+    REQUIRE(count >= 1);
+    REQUIRE(events[0].type == ArpEvent::Type::NoteOn);
+    REQUIRE(events[0].note == 64);
+    REQUIRE(events[0].sampleOffset == 0);
+}
+
+TEST_CASE("ArpeggiatorCore: solved seekTo cost does not grow with the song position",
+          "[processors][arpeggiator_core][seek]") {
+    // Eighth triplets at 97 BPM: 9093 samples per step, none longer
+    constexpr double kBpm = 97.0;
+    constexpr size_t kStepSamples = 9093;
+
+    ArpeggiatorCore solved;
+    solved.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureSolvedState(solved);
+    for (size_t block : {size_t{1000}, size_t{213000}, size_t{21300000}}) {
+        INFO("seek to block " << block);
+        (void)playFromSeek(solved, kBpm, block, 1);
+        REQUIRE(solved.lastSeekReplayedSamples() > 0);
+        REQUIRE(solved.lastSeekReplayedSamples() <= kStepSamples);
+    }
+
+}
+
+TEST_CASE("ArpeggiatorCore: seekTo matches linear playback for history-dependent settings",
+          "[processors][arpeggiator_core][seek]") {
+    // Each of these depends on every step before the target, so seekTo()
+    // replays the playthrough instead of solving it. Sixteenths at 97 BPM:
+    // the replay budget (64 steps) reaches block 852.
+    const std::initializer_list<size_t> blocks{3, 257, 700};
+
+    SECTION("beat retrigger") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            arp.setSwing(20.0f);
+            arp.setRetrigger(ArpRetriggerMode::Beat);
+        }, 97.0, blocks);
+    }
+    SECTION("length jitter") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            arp.setLaneLengthJitter(0, 1);
+            arp.setLaneLengthJitter(2, 2);
+            arp.setLaneLengthJitter(5, 1);
+        }, 97.0, blocks);
+    }
+    SECTION("random strum") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) { configureStrum(arp, 2); },
+                                 97.0, blocks);
+    }
+    SECTION("alternate strum") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) { configureStrum(arp, 3); },
+                                 97.0, blocks);
+    }
+    SECTION("walk note order") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            arp.setMode(ArpMode::Walk);
+        }, 97.0, blocks);
+    }
+    SECTION("markov note order") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            std::array<float, kMarkovMatrixSize> matrix{};
+            for (size_t row = 0; row < kMarkovMatrixDim; ++row) {
+                matrix[row * kMarkovMatrixDim + (row + 1) % kMarkovMatrixDim] = 0.6f;
+                matrix[row * kMarkovMatrixDim + (row + 3) % kMarkovMatrixDim] = 0.3f;
+                matrix[row * kMarkovMatrixDim + row] = 0.1f;
+            }
+            arp.setMarkovMatrix(matrix);
+            arp.setMode(ArpMode::Markov);
+        }, 97.0, blocks);
+    }
+    SECTION("ratchets under swing") {
+        requireSeekMatchesLinear([](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            arp.setSwing(30.0f);
+            arp.ratchetLane().setLength(3);
+            arp.ratchetLane().setStep(1, static_cast<uint8_t>(2));
+            arp.ratchetLane().setStep(2, static_cast<uint8_t>(4));
+        }, 97.0, blocks);
+    }
+    SECTION("lane cycle longer than the solver's budget") {
+        auto configure = [](ArpeggiatorCore& arp) {
+            configureHistoryBase(arp);
+            arp.velocityLane().setLength(31);
+            for (size_t i = 0; i < 31; ++i) {
+                arp.velocityLane().setStep(i, 0.3f + 0.02f * static_cast<float>(i));
+            }
+            arp.setLaneSpeed(0, 0.37f);
+        };
+        requireSeekMatchesLinear(configure, 97.0, blocks);
+
+        // Replayed, not solved: a solved seek plays at most one step
+        ArpeggiatorCore arp;
+        arp.prepare(kSeekSampleRate, kSeekBlockSize);
+        configure(arp);
+        (void)playFromSeek(arp, 97.0, 700, 1);
+        REQUIRE(arp.lastSeekReplayedSamples() == replayFromOrigin(700));
+    }
+    SECTION("all of them") {
+        requireSeekMatchesLinear(configureReplayedState, 97.0, {300, 1100});
+    }
+}
+
+TEST_CASE("ArpeggiatorCore: history-dependent seeks resume from checkpoints",
+          "[processors][arpeggiator_core][seek]") {
+    // One instance seeking around, every landing checked against one linear
+    // playthrough, with the replay cost each seek reports. Eighth triplets at
+    // 97 BPM: the replay budget (64 steps) spans 1136 blocks.
+    constexpr double kBpm = 97.0;
+    constexpr size_t kWindowBlocks = 200;
+    ArpeggiatorCore linear;
+    linear.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureReplayedState(linear);
+    BlockContext linearCtx = makeSeekContext(kBpm);
+    const auto linearEvents = collectEvents(linear, linearCtx, 2000 + kWindowBlocks);
+
+    ArpeggiatorCore arp;
+    arp.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureReplayedState(arp);
+    auto seekAndCompare = [&](size_t block) {
+        INFO("seek to block " << block);
+        const auto from = static_cast<int32_t>(block * kSeekBlockSize);
+        const auto until = from + static_cast<int32_t>(kWindowBlocks * kSeekBlockSize);
+        auto expected = stepEventsFrom(linearEvents, from);
+        expected.erase(std::remove_if(expected.begin(), expected.end(),
+                           [until](const ArpEvent& e) { return e.sampleOffset >= until; }),
+                       expected.end());
+        REQUIRE_FALSE(expected.empty());
+        requireSameEvents(expected,
+            stepEventsFrom(playFromSeek(arp, kBpm, block, kWindowBlocks), from));
+        return arp.lastSeekReplayedSamples();
+    };
+
+    // First visit replays from PPQ 0
+    REQUIRE(seekAndCompare(900) == replayFromOrigin(900));
+
+    // Loop wraps restore the checkpoint and replay nothing
+    for (int pass = 0; pass < 3; ++pass) {
+        REQUIRE(seekAndCompare(900) == 0);
+    }
+
+    // Forward scrub resumes from it; backward scrub has nothing earlier
+    REQUIRE(seekAndCompare(1500) == (1500 - 900) * kSeekBlockSize);
+    REQUIRE(seekAndCompare(300) == replayFromOrigin(300));
+    REQUIRE(seekAndCompare(700) == (700 - 300) * kSeekBlockSize);
+
+    // The least recently used checkpoint (900) gives way to the fifth
+    REQUIRE(seekAndCompare(2000) == (2000 - 1500) * kSeekBlockSize);
+    REQUIRE(seekAndCompare(1000) == (1000 - 700) * kSeekBlockSize);
+}
+
+TEST_CASE("ArpeggiatorCore: a checkpoint is not reused after a settings change",
+          "[processors][arpeggiator_core][seek]") {
+    constexpr double kBpm = 97.0;
+    constexpr size_t kBlock = 800;
+    auto configureEdited = [](ArpeggiatorCore& arp) {
+        configureReplayedState(arp);
+        arp.gateLane().setStep(1, 0.5f);
+    };
+
+    ArpeggiatorCore arp;
+    arp.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureReplayedState(arp);
+    (void)playFromSeek(arp, kBpm, kBlock, 1);
+    REQUIRE(arp.lastSeekReplayedSamples() == replayFromOrigin(kBlock));
+
+    // A lane edit: the next seek replays the new settings from PPQ 0 and
+    // lands where a playthrough with them would
+    arp.gateLane().setStep(1, 0.5f);
+    ArpeggiatorCore linear;
+    linear.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureEdited(linear);
+    BlockContext ctx = makeSeekContext(kBpm);
+    const auto from = static_cast<int32_t>(kBlock * kSeekBlockSize);
+    const auto expected = stepEventsFrom(collectEvents(linear, ctx, kBlock + 300), from);
+    requireSameEvents(expected, stepEventsFrom(playFromSeek(arp, kBpm, kBlock, 300), from));
+    REQUIRE(arp.lastSeekReplayedSamples() == replayFromOrigin(kBlock));
+
+    // A different tempo does not reuse it either
+    (void)playFromSeek(arp, 120.0, kBlock, 1);
+    REQUIRE(arp.lastSeekReplayedSamples() == replayFromOrigin(kBlock));
+}
+
+TEST_CASE("ArpeggiatorCore: history-dependent seek cost does not grow with the song position",
+          "[processors][arpeggiator_core][seek]") {
+    // Eighth triplets at 97 BPM: 9093 samples per step. Past the replay
+    // budget the seek solves the state 64 steps back and replays from there.
+    constexpr double kBpm = 97.0;
+    constexpr size_t kStepSamples = 9093;
+    constexpr size_t kMaxReplay = (ArpeggiatorCore::kSeekReplayBudgetSteps + 1) * kStepSamples;
+
+    ArpeggiatorCore arp;
+    arp.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureReplayedState(arp);
+    for (size_t block : {size_t{2000}, size_t{213000}, size_t{21300000}}) {
+        INFO("seek to block " << block);
+        const auto events = playFromSeek(arp, kBpm, block, 200);
+        REQUIRE(arp.lastSeekReplayedSamples() > 0);
+        REQUIRE(arp.lastSeekReplayedSamples() <= kMaxReplay);
+        REQUIRE_FALSE(filterNoteOns(events).empty());
+    }
+
+    // The landing is a checkpoint: loop passes repeat it and replay nothing
+    ArpeggiatorCore first;
+    first.prepare(kSeekSampleRate, kSeekBlockSize);
+    configureReplayedState(first);
+    const auto firstPass = stepEventsFrom(playFromSeek(first, kBpm, 213000, 200), 0);
+    for (int pass = 0; pass < 2; ++pass) {
+        requireSameEvents(firstPass,
+            stepEventsFrom(playFromSeek(first, kBpm, 213000, 200), 0));
+        REQUIRE(first.lastSeekReplayedSamples() == 0);
+    }
+}
+
+TEST_CASE("ArpeggiatorCore: a loop wrap resumes at the loop-start pattern phase",
+          "[processors][arpeggiator_core][seek]") {
+    // Gradus and Ruinae used to answer a backward PPQ jump with
+    // notifyTransportLoop(), which restarts the pattern at step 0. They now
+    // seekTo() the loop start, so the wrap plays what a straight run plays there.
+    // Quarter notes at 120 BPM: one step every 22050 samples; loop beats
+    // 5..8.5, so step 8 is still sounding at the loop end.
+    constexpr double kLoopStartPpq = 5.0;
+    constexpr size_t kLoopEndSample = 8 * 22050 + 11025;
+    auto configure = [](ArpeggiatorCore& arp) {
+        arp.prepare(kSeekSampleRate, kSeekBlockSize);
+        arp.setEnabled(true);
+        arp.setMode(ArpMode::Up);
+        arp.setNoteValue(NoteValue::Quarter, NoteModifier::None);
+        arp.setGateLength(90.0f);
+        arp.noteOn(60, 100);
+        arp.noteOn(64, 100);
+        arp.noteOn(67, 100);
+    };
+
+    // First pass: play up to the loop end
+    auto playToLoopEnd = [&](ArpeggiatorCore& arp) {
+        BlockContext ctx = makeSeekContext(120.0);
+        ctx.blockSize = 441;  // divides 11025, so the loop end is a block edge
+        (void)collectEvents(arp, ctx, kLoopEndSample / ctx.blockSize);
+        return ctx;
+    };
+    auto firstBlockAfterWrap = [](ArpeggiatorCore& arp, BlockContext ctx) {
+        std::array<ArpEvent, 128> events{};
+        const size_t count = arp.processBlock(ctx, events);
+        return std::vector<ArpEvent>(events.begin(), events.begin() + count);
+    };
+
+    // Beat 5 is step 5 of an Up pattern over three notes: 67, not step 0's 60
+    ArpeggiatorCore seeked;
+    configure(seeked);
+    BlockContext ctx = playToLoopEnd(seeked);
+    seeked.seekTo(kLoopStartPpq, ctx);
+    ctx.transportPositionSamples = static_cast<int64_t>(5 * 22050);
+    const auto afterSeek = firstBlockAfterWrap(seeked, ctx);
+    const auto seekOns = filterNoteOns(afterSeek);
+    REQUIRE(seekOns.size() == 1);
+    REQUIRE(seekOns[0].note == 67);
+    REQUIRE(seekOns[0].sampleOffset == 0);
+
+    // The note sounding at the loop end (step 8: 67 again) is released at once
+    const auto seekOffs = filterNoteOffs(afterSeek);
+    REQUIRE(seekOffs.size() == 1);
+    REQUIRE(seekOffs[0].note == 67);
+    REQUIRE(seekOffs[0].sampleOffset == 0);
+
+    // The old behaviour, still what notifyTransportLoop() does: step 0
+    ArpeggiatorCore restarted;
+    configure(restarted);
+    ctx = playToLoopEnd(restarted);
+    restarted.notifyTransportLoop();
+    const auto restartOns = filterNoteOns(firstBlockAfterWrap(restarted, ctx));
+    REQUIRE(restartOns.size() == 1);
+    REQUIRE(restartOns[0].note == 60);
+}
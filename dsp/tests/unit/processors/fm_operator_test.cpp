@@ -1130,6 +1130,40 @@ TEST_CASE("FR-003: After reset(), output matches freshly prepared operator",
     REQUIRE(allMatch);
 }
 
+TEST_CASE("FR-002: prepare() on a pinned sine table matches prepare()",
+          "[FMOperator][US5][lifecycle]") {
+    constexpr float kSampleRate = 44100.0f;
+    constexpr size_t kNumSamples = 1024;
+
+    const auto table = FMOperator::acquireSineTable();
+    REQUIRE(table);
+
+    FMOperator opPinned;
+    opPinned.prepare(kSampleRate, table.get());
+    FMOperator opOwned;
+    opOwned.prepare(kSampleRate);
+
+    for (auto* op : {&opPinned, &opOwned}) {
+        op->setFrequency(440.0f);
+        op->setRatio(1.0f);
+        op->setFeedback(0.3f);
+        op->setLevel(1.0f);
+    }
+
+    bool allMatch = true;
+    for (size_t i = 0; i < kNumSamples && allMatch; ++i) {
+        allMatch = opPinned.process() == opOwned.process();
+    }
+    REQUIRE(allMatch);
+
+    // Without a table the operator is prepared but silent
+    FMOperator opEmpty;
+    opEmpty.prepare(kSampleRate, nullptr);
+    opEmpty.setFrequency(440.0f);
+    opEmpty.setLevel(1.0f);
+    REQUIRE(opEmpty.process() == 0.0f);
+}
+
 // ==============================================================================
 // Phase 8: Edge Cases and Robustness
 // ==============================================================================
@@ -454,6 +454,21 @@ TEST_CASE("ImpactExciter position 0.0 and 0.5 produce different spectra", "[proc
     REQUIRE_FALSE(identical);
 }
 
+TEST_CASE("ImpactExciter without a comb buffer matches position 0.0 and ignores position",
+          "[processors][impact_exciter]")
+{
+    Krate::DSP::ImpactExciter withComb;
+    withComb.prepare(kSampleRate, 77);
+    auto bufferWithComb = generateExciterBlock(withComb, 0.7f, 0.5f, 0.3f, 0.0f, 0.0f, 440.0f);
+
+    Krate::DSP::ImpactExciter noComb;
+    noComb.prepare(kSampleRate, 77, 0.0f);
+    auto bufferNoComb = generateExciterBlock(noComb, 0.7f, 0.5f, 0.3f, 0.0f, 0.5f, 440.0f);
+
+    // Position 0.5 needs the comb; without a buffer it falls back to dry
+    REQUIRE(bufferNoComb == bufferWithComb);
+}
+
 TEST_CASE("ImpactExciter position 0.5 attenuates even harmonics (SC-008)", "[processors][impact_exciter]")
 {
     float f0 = 440.0f;
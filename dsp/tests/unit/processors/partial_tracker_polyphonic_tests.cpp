@@ -12,8 +12,11 @@
 #include <krate/dsp/primitives/spectral_buffer.h>
 #include <krate/dsp/processors/harmonic_types.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 using Catch::Approx;
 using namespace Krate::DSP;
@@ -260,3 +263,196 @@ TEST_CASE("PartialTracker: bandwidth estimation - wide peaks have higher bandwid
     }
     CHECK(foundWide);
 }
+
+// =============================================================================
+// Banded Matcher Tests
+// =============================================================================
+
+namespace {
+
+/// One frame of a test corpus: peaks (freq, amp) plus the F0 estimate.
+struct CorpusFrame {
+    std::vector<std::pair<float, float>> peaks;
+    F0Estimate f0{};
+};
+
+using CorpusFn = CorpusFrame (*)(int frame);
+
+/// Bowed-string style: 40 harmonics with 2% vibrato. Upper harmonics have
+/// overlapping match windows, so the matcher sees large clusters.
+CorpusFrame vibratoCorpus(int frame) {
+    CorpusFrame c;
+    const float f0 = 220.0f * (1.0f + 0.02f * std::sin(0.7f * static_cast<float>(frame)));
+    for (int h = 1; h <= 40; ++h) {
+        c.peaks.emplace_back(f0 * static_cast<float>(h), 0.8f / static_cast<float>(h));
+    }
+    c.f0 = F0Estimate{f0, 0.9f, true};
+    return c;
+}
+
+/// Two unvoiced notes gliding through each other with partials dropping in
+/// and out.
+CorpusFrame crossingCorpus(int frame) {
+    CorpusFrame c;
+    const float t = static_cast<float>(frame);
+    const float a = 300.0f + 4.0f * t;
+    const float b = 520.0f - 3.0f * t;
+    for (int h = 1; h <= 12; ++h) {
+        const auto hf = static_cast<float>(h);
+        if ((frame + h) % 7 != 0) c.peaks.emplace_back(a * hf, 0.6f / hf);
+        if ((frame * 3 + h) % 5 != 0) c.peaks.emplace_back(b * hf, 0.5f / hf);
+    }
+    c.f0 = F0Estimate{0.0f, 0.1f, false};
+    return c;
+}
+
+/// Three-note chord (C4 E4 G4), 16 harmonics each, with slow detune and a
+/// voiced F0 on the root. Neighbouring notes' upper harmonics share windows.
+CorpusFrame chordCorpus(int frame) {
+    CorpusFrame c;
+    const float detune = 1.0f + 0.004f * std::sin(0.4f * static_cast<float>(frame));
+    for (float f0 : {261.63f, 329.63f, 392.0f}) {
+        for (int h = 1; h <= 16; ++h) {
+            const auto hf = static_cast<float>(h);
+            c.peaks.emplace_back(f0 * detune * hf, 0.5f / hf);
+        }
+    }
+    c.f0 = F0Estimate{261.63f * detune, 0.8f, true};
+    return c;
+}
+
+/// Dense inharmonic cloud (more peaks than the matcher cap) drifting slowly.
+CorpusFrame denseCorpus(int frame) {
+    CorpusFrame c;
+    unsigned state = 12345u;
+    for (int i = 0; i < 160; ++i) {
+        state = state * 1664525u + 1013904223u;
+        const float base = 150.0f + static_cast<float>(state >> 8) / 16777216.0f * 15000.0f;
+        state = state * 1664525u + 1013904223u;
+        const float amp = 0.05f + static_cast<float>(state >> 8) / 16777216.0f * 0.5f;
+        const float drift = 1.0f + 0.002f * std::sin(0.3f * static_cast<float>(frame + i));
+        c.peaks.emplace_back(base * drift, amp);
+    }
+    c.f0 = F0Estimate{0.0f, 0.1f, false};
+    return c;
+}
+
+void fillCorpusSpectrum(SpectralBuffer& spectrum, const CorpusFrame& frame) {
+    const size_t numBins = kTestFFTSize / 2 + 1;
+    for (size_t b = 0; b < numBins; ++b) {
+        spectrum.setCartesian(b, 0.0f, 0.0f);
+    }
+    for (const auto& [freq, amp] : frame.peaks) {
+        addSinePeak(spectrum, freq, amp, kTestFFTSize, kTestSampleRate);
+    }
+}
+
+} // anonymous namespace
+
+TEST_CASE("PartialTracker: banded matcher reproduces Hungarian tracking",
+          "[partial_tracker][hungarian][banded]") {
+    const std::pair<const char*, CorpusFn> corpora[] = {
+        {"vibrato", &vibratoCorpus},
+        {"crossing", &crossingCorpus},
+        {"chord", &chordCorpus},
+    };
+
+    for (const auto& [name, corpus] : corpora) {
+        PartialTracker hungarian;
+        PartialTracker banded;
+        hungarian.prepare(kTestFFTSize, kTestSampleRate);
+        banded.prepare(kTestFFTSize, kTestSampleRate);
+        banded.setMatcher(PartialMatcher::Banded);
+        REQUIRE(banded.getMatcher() == PartialMatcher::Banded);
+
+        SpectralBuffer spectrum;
+        spectrum.prepare(kTestFFTSize);
+
+        int mismatches = 0;
+        int trackedFrames = 0;
+        for (int frame = 0; frame < 60; ++frame) {
+            const CorpusFrame c = corpus(frame);
+            fillCorpusSpectrum(spectrum, c);
+            hungarian.processFrame(spectrum, c.f0, kTestFFTSize, kTestSampleRate);
+            banded.processFrame(spectrum, c.f0, kTestFFTSize, kTestSampleRate);
+
+            if (hungarian.getActiveCount() != banded.getActiveCount()) {
+                ++mismatches;
+                continue;
+            }
+            if (hungarian.getActiveCount() > 0) ++trackedFrames;
+            for (int i = 0; i < hungarian.getActiveCount(); ++i) {
+                const auto& a = hungarian.getPartials()[static_cast<size_t>(i)];
+                const auto& b = banded.getPartials()[static_cast<size_t>(i)];
+                if (a.frequency != b.frequency || a.amplitude != b.amplitude ||
+                    a.age != b.age || a.harmonicIndex != b.harmonicIndex) {
+                    ++mismatches;
+                    break;
+                }
+            }
+        }
+
+        INFO("corpus: " << name);
+        REQUIRE(trackedFrames > 50);
+        REQUIRE(mismatches == 0);
+    }
+}
+
+TEST_CASE("PartialTracker: banded matcher keeps partials through a glide",
+          "[partial_tracker][banded]") {
+    PartialTracker tracker;
+    tracker.prepare(kTestFFTSize, kTestSampleRate);
+    tracker.setMatcher(PartialMatcher::Banded);
+
+    SpectralBuffer spectrum;
+    spectrum.prepare(kTestFFTSize);
+    F0Estimate f0{400.0f, 0.5f, false};
+
+    // 1% per frame glide: inside the 5% window, so the track must survive
+    for (int frame = 0; frame < 20; ++frame) {
+        const float freq = 400.0f * std::pow(1.01f, static_cast<float>(frame));
+        fillSineSpectrum(spectrum, freq, 0.8f, kTestFFTSize, kTestSampleRate);
+        tracker.processFrame(spectrum, f0, kTestFFTSize, kTestSampleRate);
+    }
+
+    REQUIRE(tracker.getActiveCount() >= 1);
+    int maxAge = 0;
+    for (int i = 0; i < tracker.getActiveCount(); ++i) {
+        maxAge = std::max(maxAge, tracker.getPartials()[static_cast<size_t>(i)].age);
+    }
+    REQUIRE(maxAge >= 15);
+}
+
+TEST_CASE("PartialTracker: banded matcher tracks a dense cloud like Hungarian",
+          "[partial_tracker][hungarian][banded]") {
+    // 160 drifting peaks at 5% windows form clusters beyond
+    // kMaxExactMatchCluster, which the banded matcher solves greedily. Exact
+    // equality is not expected there (the dense solve itself is subject to
+    // float ties), but continuity must be as good.
+    PartialTracker hungarian;
+    PartialTracker banded;
+    hungarian.prepare(kTestFFTSize, kTestSampleRate);
+    banded.prepare(kTestFFTSize, kTestSampleRate);
+    banded.setMatcher(PartialMatcher::Banded);
+
+    SpectralBuffer spectrum;
+    spectrum.prepare(kTestFFTSize);
+
+    long hungarianAge = 0;
+    long bandedAge = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        const CorpusFrame c = denseCorpus(frame);
+        fillCorpusSpectrum(spectrum, c);
+        hungarian.processFrame(spectrum, c.f0, kTestFFTSize, kTestSampleRate);
+        banded.processFrame(spectrum, c.f0, kTestFFTSize, kTestSampleRate);
+
+        REQUIRE(banded.getActiveCount() == hungarian.getActiveCount());
+        for (int i = 0; i < hungarian.getActiveCount(); ++i) {
+            hungarianAge += hungarian.getPartials()[static_cast<size_t>(i)].age;
+            bandedAge += banded.getPartials()[static_cast<size_t>(i)].age;
+        }
+    }
+
+    INFO("summed ages: hungarian " << hungarianAge << ", banded " << bandedAge);
+    REQUIRE(static_cast<double>(bandedAge) >= 0.98 * static_cast<double>(hungarianAge));
+}
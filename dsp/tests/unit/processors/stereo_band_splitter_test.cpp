@@ -0,0 +1,248 @@
+// ==============================================================================
+// Tests: Stereo Band Splitter
+// ==============================================================================
+// Minimum phase reproduces the scalar LR4 + D'Appolito cascade on both
+// channels; linear phase sums to a pure delay of latency() samples.
+// ==============================================================================
+
+#include <krate/dsp/core/biquad_simd.h>
+#include <krate/dsp/processors/crossover_filter.h>
+#include <krate/dsp/processors/stereo_band_splitter.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Krate::DSP;
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+
+std::vector<float> noise(size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> x(length);
+    for (auto& s : x) s = dist(rng);
+    return x;
+}
+
+struct BandBuffers {
+    std::array<std::vector<float>, StereoBandSplitter::kMaxBands> left, right;
+    std::array<float*, StereoBandSplitter::kMaxBands> leftPtrs{}, rightPtrs{};
+
+    explicit BandBuffers(size_t length) {
+        for (size_t b = 0; b < left.size(); ++b) {
+            left[b].assign(length, 0.0f);
+            right[b].assign(length, 0.0f);
+        }
+    }
+
+    /// Pointers into the buffers starting at sample offset
+    void at(size_t offset) {
+        for (size_t b = 0; b < left.size(); ++b) {
+            leftPtrs[b] = left[b].data() + offset;
+            rightPtrs[b] = right[b].data() + offset;
+        }
+    }
+};
+
+void runBlocks(StereoBandSplitter& splitter, const std::vector<float>& inL,
+               const std::vector<float>& inR, BandBuffers& bands, size_t blockSize) {
+    for (size_t pos = 0; pos < inL.size(); pos += blockSize) {
+        const size_t n = std::min(blockSize, inL.size() - pos);
+        bands.at(pos);
+        splitter.process(inL.data() + pos, inR.data() + pos, bands.leftPtrs.data(),
+                         bands.rightPtrs.data(), n);
+    }
+}
+
+/// Scalar reference: the CrossoverLR4 cascade with Biquad allpass compensation
+struct ReferenceNetwork {
+    std::vector<CrossoverLR4> splits;
+    std::vector<std::vector<Biquad>> allpasses;
+
+    explicit ReferenceNetwork(const std::vector<float>& freqs) {
+        splits.resize(freqs.size());
+        allpasses.resize(freqs.size());
+        for (size_t j = 0; j < freqs.size(); ++j) {
+            splits[j].setCrossoverFrequency(freqs[j]);
+            splits[j].prepare(kSampleRate);
+            for (size_t k = j + 1; k < freqs.size(); ++k) {
+                Biquad ap;
+                ap.configure(FilterType::Allpass, freqs[k], kButterworthQ, 0.0f,
+                             static_cast<float>(kSampleRate));
+                allpasses[j].push_back(ap);
+            }
+        }
+    }
+
+    void process(float x, std::vector<float>& bands) {
+        float rest = x;
+        for (size_t j = 0; j < splits.size(); ++j) {
+            const auto out = splits[j].process(rest);
+            bands[j] = out.low;
+            rest = out.high;
+        }
+        bands[splits.size()] = rest;
+        for (size_t j = 0; j < splits.size(); ++j) {
+            for (auto& ap : allpasses[j]) bands[j] = ap.process(bands[j]);
+        }
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("biquadCascadeStereo matches Biquad per channel", "[stereo_band_splitter]") {
+    const auto lp = BiquadCoefficients::calculate(FilterType::Lowpass, 800.0f, 0.9f, 0.0f, 48000.0f);
+    const auto pk = BiquadCoefficients::calculate(FilterType::Peak, 3000.0f, 2.0f, 6.0f, 48000.0f);
+    const float coeffs[] = {lp.b0, lp.b1, lp.b2, lp.a1, lp.a2,
+                            pk.b0, pk.b1, pk.b2, pk.a1, pk.a2};
+    float state[2 * kBiquadStereoStateStride] = {};
+
+    const auto left = noise(257, 1);
+    const auto right = noise(257, 2);
+    std::vector<float> lr(2 * left.size());
+    for (size_t i = 0; i < left.size(); ++i) {
+        lr[2 * i] = left[i];
+        lr[2 * i + 1] = right[i];
+    }
+    // Two calls: state must carry across
+    biquadCascadeStereo(lr.data(), 100, coeffs, state, 2);
+    biquadCascadeStereo(lr.data() + 200, left.size() - 100, coeffs, state, 2);
+
+    Biquad refL1(lp), refL2(pk), refR1(lp), refR2(pk);
+    for (size_t i = 0; i < left.size(); ++i) {
+        const float expectedL = refL2.process(refL1.process(left[i]));
+        const float expectedR = refR2.process(refR1.process(right[i]));
+        REQUIRE(std::abs(lr[2 * i] - expectedL) < 1e-5f);
+        REQUIRE(std::abs(lr[2 * i + 1] - expectedR) < 1e-5f);
+    }
+}
+
+TEST_CASE("StereoBandSplitter minimum phase matches the scalar LR4 network",
+          "[stereo_band_splitter]") {
+    const std::vector<float> freqs = {150.0f, 1200.0f, 6000.0f};
+    const size_t blockSize = GENERATE(size_t{1}, size_t{32}, size_t{100}, size_t{512});
+    CAPTURE(blockSize);
+
+    StereoBandSplitter splitter;
+    splitter.setNumBands(4);
+    for (size_t j = 0; j < freqs.size(); ++j) {
+        splitter.setCrossoverFrequency(static_cast<int>(j), freqs[j]);
+    }
+    splitter.prepare(kSampleRate);
+    REQUIRE(splitter.latency() == 0);
+
+    const auto inL = noise(2000, 3);
+    const auto inR = noise(2000, 4);
+    BandBuffers bands(inL.size());
+    runBlocks(splitter, inL, inR, bands, blockSize);
+
+    ReferenceNetwork refL(freqs), refR(freqs);
+    std::vector<float> expectedL(4), expectedR(4);
+    float worst = 0.0f;
+    for (size_t i = 0; i < inL.size(); ++i) {
+        refL.process(inL[i], expectedL);
+        refR.process(inR[i], expectedR);
+        for (size_t b = 0; b < 4; ++b) {
+            worst = std::max(worst, std::abs(bands.left[b][i] - expectedL[b]));
+            worst = std::max(worst, std::abs(bands.right[b][i] - expectedR[b]));
+        }
+    }
+    REQUIRE(worst < 1e-4f);
+}
+
+TEST_CASE("StereoBandSplitter keeps channels independent and sanitizes input",
+          "[stereo_band_splitter]") {
+    StereoBandSplitter splitter;
+    splitter.setNumBands(3);
+    splitter.prepare(kSampleRate);
+
+    auto inL = noise(512, 5);
+    inL[100] = std::numeric_limits<float>::quiet_NaN();
+    inL[101] = std::numeric_limits<float>::infinity();
+    const std::vector<float> inR(inL.size(), 0.0f);
+    BandBuffers bands(inL.size());
+    runBlocks(splitter, inL, inR, bands, 64);
+
+    for (size_t b = 0; b < 3; ++b) {
+        for (size_t i = 0; i < inL.size(); ++i) {
+            REQUIRE(std::isfinite(bands.left[b][i]));
+            REQUIRE(bands.right[b][i] == 0.0f);
+        }
+    }
+}
+
+TEST_CASE("StereoBandSplitter linear phase sums to a pure delay", "[stereo_band_splitter]") {
+    const int numBands = GENERATE(1, 2, 4);
+    CAPTURE(numBands);
+
+    StereoBandSplitter splitter;
+    splitter.prepare(kSampleRate);
+    splitter.setPhase(CrossoverPhase::Linear);
+    splitter.setNumBands(numBands);
+    splitter.setCrossoverFrequency(0, 250.0f);
+    splitter.setCrossoverFrequency(1, 2000.0f);
+    splitter.setCrossoverFrequency(2, 8000.0f);
+
+    const size_t latency = splitter.latency();
+    REQUIRE(latency == StereoBandSplitter::linearPhaseLatency());
+    REQUIRE(latency == 3071);
+
+    const auto inL = noise(3 * StereoBandSplitter::kLinearPhaseHop + 1000, 6);
+    const auto inR = noise(inL.size(), 7);
+    BandBuffers bands(inL.size());
+    runBlocks(splitter, inL, inR, bands, 300);
+
+    // Before the latency has elapsed the sum is silent (individual bands
+    // carry linear-phase pre-ringing that cancels)
+    float worst = 0.0f;
+    for (size_t i = 0; i < inL.size(); ++i) {
+        float sumL = 0.0f;
+        float sumR = 0.0f;
+        for (size_t b = 0; b < static_cast<size_t>(numBands); ++b) {
+            sumL += bands.left[b][i];
+            sumR += bands.right[b][i];
+        }
+        const float expectedL = i >= latency ? inL[i - latency] : 0.0f;
+        const float expectedR = i >= latency ? inR[i - latency] : 0.0f;
+        worst = std::max(worst, std::abs(sumL - expectedL));
+        worst = std::max(worst, std::abs(sumR - expectedR));
+    }
+    REQUIRE(worst < 1e-4f);
+}
+
+TEST_CASE("StereoBandSplitter linear phase separates bands", "[stereo_band_splitter]") {
+    StereoBandSplitter splitter;
+    splitter.prepare(kSampleRate);
+    splitter.setPhase(CrossoverPhase::Linear);
+    splitter.setNumBands(2);
+    splitter.setCrossoverFrequency(0, 1000.0f);
+
+    // 200 Hz belongs to the low band; LR4 puts the high band at
+    // (0.2)^4 / (1 + 0.2^4) ~ -54 dB there
+    std::vector<float> inL(4 * StereoBandSplitter::kLinearPhaseHop);
+    for (size_t i = 0; i < inL.size(); ++i) {
+        inL[i] = std::sin(6.2831853f * 200.0f * static_cast<float>(i) /
+                          static_cast<float>(kSampleRate));
+    }
+    BandBuffers bands(inL.size());
+    runBlocks(splitter, inL, inL, bands, 256);
+
+    float lowPeak = 0.0f;
+    float highPeak = 0.0f;
+    for (size_t i = splitter.latency() + 2048; i < inL.size(); ++i) {
+        lowPeak = std::max(lowPeak, std::abs(bands.left[0][i]));
+        highPeak = std::max(highPeak, std::abs(bands.left[1][i]));
+    }
+    REQUIRE(lowPeak > 0.99f);
+    REQUIRE(highPeak < 0.005f);
+}
@@ -1503,3 +1503,144 @@ TEST_CASE("ModalResonatorBank: multi-mode impulse response has harmonic content"
     REQUIRE(peak > 0.05f);
     REQUIRE(rms > 0.005f);
 }
+
+// =============================================================================
+// Time-Blocked Kernel and Active-Mode Compaction
+// =============================================================================
+// processBlock() runs the mode recurrence through processModalBankBlockSIMD on
+// the compacted live-mode set. It must match the per-sample paths that share
+// its block-rate smoothing (prepareBlockSmoothing + processSampleNoSmooth).
+
+namespace {
+
+/// Drive `bank` per sample the way processBlock() smooths: once per block.
+void processBlockReference(Krate::DSP::ModalResonatorBank& bank, const float* input,
+                           float* output, int numSamples, float decayScale)
+{
+    bank.prepareBlockSmoothing();
+    for (int i = 0; i < numSamples; ++i)
+        output[i] = bank.processSampleNoSmooth(input[i], decayScale);
+    bank.flushSilentModes();
+}
+
+} // anonymous namespace
+
+TEST_CASE("processModalBankBlockSIMD matches the per-sample kernel",
+          "[modal_resonator_bank][simd]")
+{
+    // 85 modes: four-group passes, single-group passes and a scalar tail at
+    // 4, 8 and 16 lanes; 150 samples spans three kernel runs
+    constexpr int kModes = 85;
+    constexpr int kSamples = 150;
+    std::array<float, kMaxModes> eps{}, radius{}, gain{};
+    for (int k = 0; k < kModes; ++k) {
+        const auto i = static_cast<size_t>(k);
+        eps[i] = 2.0f * std::sin(std::numbers::pi_v<float> * 110.0f * static_cast<float>(k + 1)
+                                 / static_cast<float>(kSampleRate));
+        radius[i] = 0.9995f - 0.00005f * static_cast<float>(k);
+        gain[i] = 1.0f / static_cast<float>(k + 1);
+    }
+    std::array<float, kSamples> excitation{};
+    excitation[0] = 1.0f;
+    excitation[70] = -0.5f;
+    excitation[140] = 0.25f;
+
+    std::array<float, kMaxModes> sinA{}, cosA{}, sinB{}, cosB{};
+    std::array<float, kSamples> blockOut{};
+    Krate::DSP::processModalBankBlockSIMD(sinA.data(), cosA.data(), eps.data(), radius.data(),
+                                          gain.data(), excitation.data(), blockOut.data(),
+                                          kSamples, kModes);
+
+    for (int i = 0; i < kSamples; ++i) {
+        const float expected = Krate::DSP::processModalBankSampleSIMD(
+            sinB.data(), cosB.data(), eps.data(), radius.data(), gain.data(),
+            excitation[static_cast<size_t>(i)], kModes);
+        REQUIRE(blockOut[static_cast<size_t>(i)] == Approx(expected).margin(1e-5f));
+    }
+    for (int k = 0; k < kModes; ++k) {
+        const auto i = static_cast<size_t>(k);
+        REQUIRE(sinA[i] == Approx(sinB[i]).margin(1e-6f));
+        REQUIRE(cosA[i] == Approx(cosB[i]).margin(1e-6f));
+    }
+}
+
+TEST_CASE("ModalResonatorBank processBlock matches the per-sample path",
+          "[modal_resonator_bank][simd]")
+{
+    // decayScale 1.0 exercises the unscaled kernel, 3.0 the SIMD choke path
+    // (previously a scalar loop with a pow per mode per sample)
+    for (const float decayScale : {1.0f, 3.0f}) {
+        INFO("decayScale = " << decayScale);
+        Krate::DSP::ModalResonatorBank blockBank;
+        Krate::DSP::ModalResonatorBank refBank;
+        blockBank.prepare(kSampleRate);
+        refBank.prepare(kSampleRate);
+        configureHarmonicModes(blockBank, 130.0f, 60, 0.3f, 0.4f);
+        configureHarmonicModes(refBank, 130.0f, 60, 0.3f, 0.4f);
+
+        constexpr int kBlockSize = 200;
+        std::array<float, kBlockSize> input{};
+        std::array<float, kBlockSize> blockOut{};
+        std::array<float, kBlockSize> refOut{};
+        float worst = 0.0f;
+        for (int block = 0; block < 20; ++block) {
+            input.fill(0.0f);
+            if (block % 5 == 0) {
+                input[3] = 0.8f;
+                input[4] = -0.3f;
+            }
+            blockBank.processBlock(input.data(), blockOut.data(), kBlockSize, decayScale);
+            processBlockReference(refBank, input.data(), refOut.data(), kBlockSize, decayScale);
+            for (size_t i = 0; i < input.size(); ++i)
+                worst = std::max(worst, std::abs(blockOut[i] - refOut[i]));
+        }
+        REQUIRE(worst < 1e-5f);
+        REQUIRE(blockBank.getNumActiveModes() == refBank.getNumActiveModes());
+    }
+}
+
+TEST_CASE("ModalResonatorBank processBlock re-excites flushed modes",
+          "[modal_resonator_bank][simd]")
+{
+    // Flushed modes leave the compacted live set but keep their coefficients:
+    // new excitation must bring them back exactly as the per-sample path does
+    Krate::DSP::ModalResonatorBank blockBank;
+    Krate::DSP::ModalResonatorBank refBank;
+    blockBank.prepare(kSampleRate);
+    refBank.prepare(kSampleRate);
+    configureHarmonicModes(blockBank, 440.0f, 24, 0.01f, 0.5f);
+    configureHarmonicModes(refBank, 440.0f, 24, 0.01f, 0.5f);
+
+    constexpr int kBlockSize = 256;
+    std::array<float, kBlockSize> input{};
+    std::array<float, kBlockSize> blockOut{};
+    std::array<float, kBlockSize> refOut{};
+    input[0] = 1.0f;
+    blockBank.processBlock(input.data(), blockOut.data(), kBlockSize);
+    processBlockReference(refBank, input.data(), refOut.data(), kBlockSize, 1.0f);
+
+    // Ring out until every mode has been flushed
+    input.fill(0.0f);
+    for (int block = 0; block < 200 && blockBank.getNumActiveModes() > 0; ++block) {
+        blockBank.processBlock(input.data(), blockOut.data(), kBlockSize);
+        processBlockReference(refBank, input.data(), refOut.data(), kBlockSize, 1.0f);
+    }
+    REQUIRE(blockBank.getNumActiveModes() == 0);
+    REQUIRE(blockBank.getModalEnergy() == 0.0f);
+
+    // Silent input on a fully flushed bank yields exact silence
+    blockBank.processBlock(input.data(), blockOut.data(), kBlockSize);
+    processBlockReference(refBank, input.data(), refOut.data(), kBlockSize, 1.0f);
+    for (float s : blockOut)
+        REQUIRE(s == 0.0f);
+
+    input[10] = 1.0f;
+    blockBank.processBlock(input.data(), blockOut.data(), kBlockSize);
+    processBlockReference(refBank, input.data(), refOut.data(), kBlockSize, 1.0f);
+    float peak = 0.0f;
+    for (size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(blockOut[i] == Approx(refOut[i]).margin(1e-5f));
+        peak = std::max(peak, std::abs(blockOut[i]));
+    }
+    REQUIRE(peak > 0.1f);
+}
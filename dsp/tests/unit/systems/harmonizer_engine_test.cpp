@@ -5401,3 +5401,131 @@ TEST_CASE("Unmuting a harmonizer voice ramps rather than jumping",
         CHECK(firstBlock < settled);
     }
 }
+
+// =============================================================================
+// Spectral summation (PhaseVocoder voices share one stereo IFFT)
+// =============================================================================
+// Level, pan and OLA are linear, so with static parameters the summed engine
+// must reproduce the per-voice engine. Short onset delays become a spectral
+// phase ramp; long ones fall back to the voice's own OLA + DelayLine.
+
+namespace {
+
+struct StereoRender {
+    std::vector<float> left;
+    std::vector<float> right;
+};
+
+StereoRender renderSummationCase(bool spectralSummation, const float* delaysMs,
+                                 std::size_t totalSamples) {
+    using namespace Krate::DSP;
+    constexpr std::size_t blockSize = 256;
+
+    HarmonizerEngine engine;
+    setupChromaticEngine(engine, 44100.0, blockSize);
+    engine.setSpectralSummation(spectralSummation);
+    engine.setNumVoices(4);
+    const int intervals[] = {0, 4, 7, -5};
+    for (int v = 0; v < 4; ++v) {
+        engine.setVoiceInterval(v, intervals[v]);
+        engine.setVoiceLevel(v, -3.0f * static_cast<float>(v));
+        engine.setVoicePan(v, -0.9f + 0.6f * static_cast<float>(v));
+        engine.setVoiceDetune(v, 7.0f * static_cast<float>(v));
+        engine.setVoiceDelay(v, delaysMs[v]);
+    }
+    engine.snapParameters();
+
+    std::vector<float> input(totalSamples);
+    for (std::size_t i = 0; i < totalSamples; ++i) {
+        const auto t = static_cast<float>(i) / 44100.0f;
+        input[i] = 0.4f * std::sin(2.0f * 3.14159265f * 220.0f * t) +
+                   0.2f * std::sin(2.0f * 3.14159265f * 1330.0f * t);
+    }
+
+    StereoRender out{std::vector<float>(totalSamples), std::vector<float>(totalSamples)};
+    for (std::size_t pos = 0; pos < totalSamples; pos += blockSize) {
+        engine.process(input.data() + pos, out.left.data() + pos,
+                       out.right.data() + pos, blockSize);
+    }
+    return out;
+}
+
+/// RMS of (a - b) over [start, end) relative to the RMS of b
+float relativeRmsError(const std::vector<float>& a, const std::vector<float>& b,
+                       std::size_t start) {
+    double err = 0.0;
+    double ref = 0.0;
+    for (std::size_t i = start; i < a.size(); ++i) {
+        const double d = static_cast<double>(a[i]) - b[i];
+        err += d * d;
+        ref += static_cast<double>(b[i]) * b[i];
+    }
+    return ref > 0.0 ? static_cast<float>(std::sqrt(err / ref)) : 0.0f;
+}
+
+} // namespace
+
+TEST_CASE("HarmonizerEngine spectral summation matches per-voice synthesis",
+          "[systems][harmonizer][spectral-summation]") {
+    constexpr std::size_t totalSamples = 172 * 256;  // ~1 s in whole blocks
+    constexpr std::size_t settle = 8192;
+    const float noDelay[] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    const auto perVoice = renderSummationCase(false, noDelay, totalSamples);
+    const auto summed = renderSummationCase(true, noDelay, totalSamples);
+
+    // Float rounding only: about 1e-7 here, with headroom for FMA contraction
+    const float errL = relativeRmsError(summed.left, perVoice.left, settle);
+    const float errR = relativeRmsError(summed.right, perVoice.right, settle);
+    INFO("relative RMS error L " << errL << " R " << errR);
+    REQUIRE(errL < 1e-6f);
+    REQUIRE(errR < 1e-6f);
+}
+
+TEST_CASE("HarmonizerEngine spectral summation applies short delays as a phase ramp",
+          "[systems][harmonizer][spectral-summation]") {
+    constexpr std::size_t totalSamples = 172 * 256;  // ~1 s in whole blocks
+    constexpr std::size_t settle = 8192;
+    // 2.5 ms = 110 samples: under kMaxSpectralDelaySamples, so summed
+    const float shortDelays[] = {2.5f, 0.0f, 1.0f, 2.5f};
+    REQUIRE(2.5f * 44.1f < Krate::DSP::HarmonizerEngine::kMaxSpectralDelaySamples);
+
+    const auto perVoice = renderSummationCase(false, shortDelays, totalSamples);
+    const auto summed = renderSummationCase(true, shortDelays, totalSamples);
+
+    // Not bit-identical: the ramp delays the frame before the synthesis
+    // window and the DelayLine interpolates after it
+    const float errL = relativeRmsError(summed.left, perVoice.left, settle);
+    const float errR = relativeRmsError(summed.right, perVoice.right, settle);
+    INFO("relative RMS error L " << errL << " R " << errR);
+    REQUIRE(errL < 0.05f);
+    REQUIRE(errR < 0.05f);
+}
+
+TEST_CASE("HarmonizerEngine spectral summation keeps long delays on the per-voice path",
+          "[systems][harmonizer][spectral-summation]") {
+    constexpr std::size_t totalSamples = 172 * 256;  // ~1 s in whole blocks
+    constexpr std::size_t settle = 8192;
+    // Voice 3 at 30 ms exceeds the phase-ramp limit and keeps its own OLA
+    const float mixedDelays[] = {0.0f, 0.0f, 0.0f, 30.0f};
+
+    const auto perVoice = renderSummationCase(false, mixedDelays, totalSamples);
+    const auto summed = renderSummationCase(true, mixedDelays, totalSamples);
+
+    const float errL = relativeRmsError(summed.left, perVoice.left, settle);
+    const float errR = relativeRmsError(summed.right, perVoice.right, settle);
+    INFO("relative RMS error L " << errL << " R " << errR);
+    REQUIRE(errL < 1e-6f);
+    REQUIRE(errR < 1e-6f);
+}
+
+TEST_CASE("HarmonizerEngine spectral summation toggle",
+          "[systems][harmonizer][spectral-summation]") {
+    Krate::DSP::HarmonizerEngine engine;
+    REQUIRE_FALSE(engine.getSpectralSummation());
+    engine.prepare(44100.0, 256);
+    engine.setSpectralSummation(true);
+    REQUIRE(engine.getSpectralSummation());
+    engine.setSpectralSummation(false);
+    REQUIRE_FALSE(engine.getSpectralSummation());
+}
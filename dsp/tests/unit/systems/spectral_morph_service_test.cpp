@@ -0,0 +1,230 @@
+// ==============================================================================
+// Tests: Spectral Morph Service
+// ==============================================================================
+// Morph endpoints reconstruct their source delayed by the latency, batching
+// across slots is equivalent to running each slot alone, and slot buffers are
+// only allocated on demand (also between blocks while other slots process).
+// ==============================================================================
+
+#include <krate/dsp/systems/spectral_morph_service.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Krate::DSP;
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+constexpr size_t kMaxBlock = 512;
+
+std::vector<float> noise(size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    std::vector<float> x(length);
+    for (auto& s : x) s = dist(rng);
+    return x;
+}
+
+/// Push/process/pull one slot through its own process(slot) in blocks
+std::vector<float> runSlot(SpectralMorphService& service, size_t slot,
+                           const std::vector<float>& a, const std::vector<float>& b,
+                           size_t blockSize) {
+    std::vector<float> out(a.size(), 0.0f);
+    for (size_t pos = 0; pos < a.size(); pos += blockSize) {
+        const size_t n = std::min(blockSize, a.size() - pos);
+        service.push(slot, a.data() + pos, b.data() + pos, n);
+        service.process(slot);
+        service.pull(slot, out.data() + pos, n);
+    }
+    return out;
+}
+
+float worstDelayedError(const std::vector<float>& out, const std::vector<float>& in,
+                        size_t latency) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < out.size(); ++i) {
+        const float expected = i >= latency ? in[i - latency] : 0.0f;
+        worst = std::max(worst, std::abs(out[i] - expected));
+    }
+    return worst;
+}
+
+} // anonymous namespace
+
+TEST_CASE("SpectralMorphService morph 0 reconstructs source A after the latency",
+          "[spectral_morph_service]") {
+    const size_t blockSize = GENERATE(size_t{1}, size_t{100}, size_t{512});
+    CAPTURE(blockSize);
+
+    SpectralMorphService service;
+    service.prepare(kSampleRate, kMaxBlock, 1);
+    service.setMorphAmount(0, 0.0f);
+    service.ensureSlots(1);
+    REQUIRE(service.getLatencySamples() == 1024);
+
+    const auto a = noise(8192, 1);
+    const auto b = noise(8192, 2);
+    const auto out = runSlot(service, 0, a, b, blockSize);
+    REQUIRE(worstDelayedError(out, a, service.getLatencySamples()) < 1e-4f);
+}
+
+TEST_CASE("SpectralMorphService morph 1 with phase from B reconstructs source B",
+          "[spectral_morph_service]") {
+    SpectralMorphService service;
+    service.prepare(kSampleRate, kMaxBlock, 1);
+    service.setMorphAmount(0, 1.0f);
+    service.setPhaseSource(PhaseSource::B);
+    service.ensureSlots(1);
+
+    const auto a = noise(8192, 3);
+    const auto b = noise(8192, 4);
+    const auto out = runSlot(service, 0, a, b, 256);
+    REQUIRE(worstDelayedError(out, b, service.getLatencySamples()) < 1e-4f);
+}
+
+TEST_CASE("SpectralMorphService batched process() matches per-slot processing",
+          "[spectral_morph_service]") {
+    constexpr size_t kSlots = 5;  // odd: one slot per round runs unpaired
+    constexpr size_t kLength = 6000;
+    constexpr size_t kBlock = 300;
+
+    SpectralMorphService batched;
+    SpectralMorphService single;
+    batched.prepare(kSampleRate, kMaxBlock, kSlots);
+    single.prepare(kSampleRate, kMaxBlock, kSlots);
+    batched.setPhaseSource(PhaseSource::Blend);
+    single.setPhaseSource(PhaseSource::Blend);
+    batched.ensureSlots(kSlots);
+    single.ensureSlots(kSlots);
+
+    std::vector<std::vector<float>> a(kSlots);
+    std::vector<std::vector<float>> b(kSlots);
+    for (size_t s = 0; s < kSlots; ++s) {
+        a[s] = noise(kLength, static_cast<unsigned>(10 + s));
+        b[s] = noise(kLength, static_cast<unsigned>(20 + s));
+        const float morph = 0.2f * static_cast<float>(s);
+        const float tilt = -6.0f + 3.0f * static_cast<float>(s);
+        batched.setMorphAmount(s, morph);
+        single.setMorphAmount(s, morph);
+        batched.setSpectralTilt(s, tilt);
+        single.setSpectralTilt(s, tilt);
+    }
+
+    std::vector<float> outBatched(kBlock);
+    std::vector<float> outSingle(kBlock);
+    float worst = 0.0f;
+    float peak = 0.0f;
+    for (size_t pos = 0; pos + kBlock <= kLength; pos += kBlock) {
+        // Slot 3 sits out one block, so the slots' frames fall out of step
+        const bool skipSlot3 = pos == 3 * kBlock;
+        for (size_t s = 0; s < kSlots; ++s) {
+            if (s == 3 && skipSlot3) continue;
+            batched.push(s, a[s].data() + pos, b[s].data() + pos, kBlock);
+            single.push(s, a[s].data() + pos, b[s].data() + pos, kBlock);
+        }
+        batched.process();
+        for (size_t s = 0; s < kSlots; ++s) {
+            if (s == 3 && skipSlot3) continue;
+            single.process(s);
+            batched.pull(s, outBatched.data(), kBlock);
+            single.pull(s, outSingle.data(), kBlock);
+            for (size_t i = 0; i < kBlock; ++i) {
+                worst = std::max(worst, std::abs(outBatched[i] - outSingle[i]));
+                peak = std::max(peak, std::abs(outSingle[i]));
+            }
+        }
+    }
+    REQUIRE(peak > 0.1f);
+    // Paired transforms only differ in float rounding
+    REQUIRE(worst < 1e-5f);
+}
+
+TEST_CASE("SpectralMorphService allocates slot buffers lazily",
+          "[spectral_morph_service]") {
+    SpectralMorphService service;
+    service.prepare(kSampleRate, kMaxBlock, 16);
+    REQUIRE(service.maxSlots() == 16);
+    REQUIRE(service.allocatedSlots() == 0);
+
+    // Unallocated slots accept parameters and produce silence
+    service.setMorphAmount(1, 1.0f);
+    service.setPhaseSource(PhaseSource::B);
+    const auto a = noise(4096, 5);
+    const auto b = noise(4096, 6);
+    auto silent = runSlot(service, 1, a, b, 512);
+    REQUIRE(std::all_of(silent.begin(), silent.end(), [](float s) { return s == 0.0f; }));
+
+    service.ensureSlots(2);
+    REQUIRE(service.allocatedSlots() == 2);
+    REQUIRE_FALSE(service.isSlotAllocated(2));
+    service.ensureSlots(1);
+    REQUIRE(service.allocatedSlots() == 2);
+
+    // The parameter set before allocation is in effect
+    const auto out = runSlot(service, 1, a, b, 512);
+    REQUIRE(worstDelayedError(out, b, service.getLatencySamples()) < 1e-4f);
+
+    // Re-preparing keeps the allocated slots
+    service.prepare(kSampleRate, 256, 16);
+    REQUIRE(service.allocatedSlots() == 2);
+}
+
+TEST_CASE("SpectralMorphService grows slots between blocks while slot 0 runs",
+          "[spectral_morph_service]") {
+    const auto a = noise(16384, 7);
+    const auto b = noise(16384, 8);
+
+    SpectralMorphService reference;
+    reference.prepare(kSampleRate, kMaxBlock, 16);
+    reference.setMorphAmount(0, 0.3f);
+    reference.ensureSlots(1);
+    const auto expected = runSlot(reference, 0, a, b, 256);
+
+    SpectralMorphService service;
+    service.prepare(kSampleRate, kMaxBlock, 16);
+    service.setMorphAmount(0, 0.3f);
+    service.ensureSlots(1);
+
+    // Slot 0 keeps streaming while the rest are allocated halfway through;
+    // the parameters of the new slots are set before they exist
+    std::vector<float> out(a.size(), 0.0f);
+    for (size_t pos = 0; pos < a.size(); pos += 256) {
+        service.setMorphAmount(5, 0.8f);
+        if (pos == a.size() / 2) service.ensureSlots(16);
+        service.push(0, a.data() + pos, b.data() + pos, 256);
+        service.process();
+        service.pull(0, out.data() + pos, 256);
+    }
+
+    REQUIRE(service.allocatedSlots() == 16);
+    REQUIRE(out == expected);
+
+    // The new slots pick up parameters set before they were published
+    const auto slot5 = runSlot(service, 5, a, b, 256);
+    SpectralMorphService single;
+    single.prepare(kSampleRate, kMaxBlock, 1);
+    single.setMorphAmount(0, 0.8f);
+    single.ensureSlots(1);
+    REQUIRE(slot5 == runSlot(single, 0, a, b, 256));
+}
+
+TEST_CASE("SpectralMorphService resets a slot on non-finite input",
+          "[spectral_morph_service]") {
+    SpectralMorphService service;
+    service.prepare(kSampleRate, kMaxBlock, 1);
+    service.ensureSlots(1);
+
+    auto a = noise(4096, 7);
+    const auto b = noise(4096, 8);
+    a[2100] = std::numeric_limits<float>::quiet_NaN();
+    const auto out = runSlot(service, 0, a, b, 512);
+    for (float s : out) REQUIRE(std::isfinite(s));
+}
@@ -2445,6 +2445,167 @@ TEST_CASE("SympatheticResonance SIMD correctness: direct kernel vs process() pat
     }
 }
 
+// =============================================================================
+// Block Processing and Active-Resonator Compaction
+// =============================================================================
+
+TEST_CASE("SympatheticResonance block kernel matches the per-sample kernel",
+          "[systems][sympathetic][simd]") {
+    // Odd counts exercise the scalar tail; lengths above 64 cross chunks
+    for (int count : {3, 13, 32, 64}) {
+        constexpr float sampleRate = 44100.0f;
+        constexpr size_t numSamples = 200;
+        const auto n = static_cast<size_t>(count);
+
+        std::vector<float> coeffs(n), rSquareds(n), gains(n);
+        for (size_t i = 0; i < n; ++i) {
+            float freq = 120.0f + static_cast<float>(i) * 37.0f;
+            float r = std::exp(-kPi * (freq / 300.0f) / sampleRate);
+            coeffs[i] = 2.0f * r * std::cos(kTwoPi * freq / sampleRate);
+            rSquareds[i] = r * r;
+            gains[i] = 1.0f / std::sqrt(static_cast<float>((i % 4) + 1));
+        }
+        const float releaseCoeff = std::exp(-1.0f / (0.010f * sampleRate));
+
+        std::vector<float> input(numSamples);
+        for (size_t s = 0; s < numSamples; ++s) {
+            input[s] = 0.05f * std::sin(kTwoPi * 300.0f * static_cast<float>(s) / sampleRate);
+        }
+
+        std::vector<float> y1(n, 0.0f), y2(n, 0.0f), env(n, 0.0f);
+        std::vector<float> expected(numSamples);
+        for (size_t s = 0; s < numSamples; ++s) {
+            processSympatheticBankSIMD(y1.data(), y2.data(), coeffs.data(),
+                                       rSquareds.data(), gains.data(), count,
+                                       input[s], &expected[s], releaseCoeff,
+                                       env.data());
+        }
+
+        std::vector<float> by1(n, 0.0f), by2(n, 0.0f), benv(n, 0.0f);
+        std::vector<float> actual(numSamples);
+        processSympatheticBankBlockSIMD(by1.data(), by2.data(), coeffs.data(),
+                                        rSquareds.data(), gains.data(), count,
+                                        input.data(), actual.data(), numSamples,
+                                        releaseCoeff, benv.data());
+
+        INFO("count = " << count);
+        float maxDiff = 0.0f;
+        for (size_t s = 0; s < numSamples; ++s) {
+            maxDiff = std::max(maxDiff, std::abs(actual[s] - expected[s]));
+        }
+        REQUIRE(maxDiff < 1e-4f);
+        for (size_t i = 0; i < n; ++i) {
+            REQUIRE(by1[i] == Approx(y1[i]).margin(1e-5f));
+            REQUIRE(by2[i] == Approx(y2[i]).margin(1e-5f));
+            REQUIRE(benv[i] == Approx(env[i]).margin(1e-5f));
+        }
+    }
+}
+
+TEST_CASE("SympatheticResonance processBlock matches per-sample process",
+          "[systems][sympathetic]") {
+    constexpr float sampleRate = 44100.0f;
+
+    auto setup = [](SympatheticResonance& sr) {
+        sr.prepare(sampleRate);
+        sr.setAmount(0.8f);
+        sr.setDecay(0.5f);
+        sr.noteOn(0, makeHarmonicPartials(220.0f));
+        sr.noteOn(1, makeHarmonicPartials(329.63f));
+        sr.noteOn(2, makeHarmonicPartials(440.0f));
+    };
+
+    SympatheticResonance perSample;
+    SympatheticResonance block;
+    setup(perSample);
+    setup(block);
+
+    // Irregular block sizes, including one larger than the internal chunk
+    constexpr size_t kBlockSizes[] = {1, 64, 300, 17, 512};
+    std::vector<float> input(512);
+    std::vector<float> output(512);
+    size_t t = 0;
+    float maxDiff = 0.0f;
+    for (size_t blockSize : kBlockSizes) {
+        for (size_t s = 0; s < blockSize; ++s, ++t) {
+            input[s] = 0.2f * std::sin(kTwoPi * 440.0f * static_cast<float>(t) / sampleRate);
+        }
+        block.processBlock(input.data(), output.data(), blockSize);
+        for (size_t s = 0; s < blockSize; ++s) {
+            const float expected = perSample.process(input[s]);
+            maxDiff = std::max(maxDiff, std::abs(output[s] - expected));
+        }
+    }
+    INFO("Max difference: " << maxDiff);
+    REQUIRE(maxDiff < 1e-5f);
+    REQUIRE(block.getActiveResonatorCount() == perSample.getActiveResonatorCount());
+}
+
+TEST_CASE("SympatheticResonance processBlock works in place and bypasses to zero",
+          "[systems][sympathetic]") {
+    SympatheticResonance sr;
+    sr.prepare(44100.0);
+
+    std::vector<float> buffer(128, 0.5f);
+    sr.processBlock(buffer.data(), buffer.data(), buffer.size());
+    for (float x : buffer) REQUIRE(x == 0.0f);
+
+    sr.setAmount(1.0f);
+    sr.noteOn(0, makeHarmonicPartials(440.0f));
+    for (size_t s = 0; s < buffer.size(); ++s) {
+        buffer[s] = std::sin(kTwoPi * 440.0f * static_cast<float>(s) / 44100.0f);
+    }
+    sr.processBlock(buffer.data(), buffer.data(), buffer.size());
+    REQUIRE(computePeak(buffer.data(), static_cast<int>(buffer.size())) > 0.0f);
+}
+
+TEST_CASE("SympatheticResonance reclaim keeps surviving resonators intact",
+          "[systems][sympathetic]") {
+    SympatheticResonance sr;
+    sr.prepare(44100.0);
+    sr.setAmount(0.5f);
+
+    // Voice 0 rings out fast (Q=100), voice 1 slowly (Q=1000); their
+    // resonators interleave in the pool, so reclaiming voice 0 compacts it
+    sr.setDecay(0.0f);
+    sr.noteOn(0, makeHarmonicPartials(1000.0f));
+    sr.setDecay(1.0f);
+    sr.noteOn(1, makeHarmonicPartials(220.0f));
+    REQUIRE(sr.getActiveResonatorCount() == 8);
+
+    // Drive every partial for ~1 s, then let the pool ring for ~0.5 s
+    std::vector<float> buffer(512);
+    size_t t = 0;
+    for (int b = 0; b < 86; ++b) {
+        for (auto& x : buffer) {
+            const float time = static_cast<float>(t++) / 44100.0f;
+            x = 0.0f;
+            for (float f : {220.0f, 440.0f, 660.0f, 880.0f, 1000.0f, 2000.0f, 3000.0f, 4000.0f}) {
+                x += 0.1f * std::sin(kTwoPi * f * time);
+            }
+        }
+        sr.processBlock(buffer.data(), buffer.data(), buffer.size());
+    }
+    for (int b = 0; b < 43; ++b) {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        sr.processBlock(buffer.data(), buffer.data(), buffer.size());
+    }
+
+    REQUIRE(sr.getActiveResonatorCount() == 4);
+    for (float expected : {220.0f, 440.0f, 660.0f, 880.0f}) {
+        bool found = false;
+        for (int i = 0; i < sr.getActiveResonatorCount(); ++i) {
+            if (sr.getResonatorFrequency(i) == expected) found = true;
+        }
+        REQUIRE(found);
+    }
+    REQUIRE(sr.getResonatorFrequency(sr.getActiveResonatorCount()) == 0.0f);
+
+    // Freed slots are reused
+    sr.noteOn(2, makeHarmonicPartials(1500.0f));
+    REQUIRE(sr.getActiveResonatorCount() == 8);
+}
+
 // =============================================================================
 // SIMD Performance Benchmark (T042b)
 // =============================================================================
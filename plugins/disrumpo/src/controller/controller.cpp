@@ -613,6 +613,16 @@ bool Controller::parseComponentState(Steinberg::IBStreamer& streamer, int32_t ve
         }
     }
 
+    // v13: Crossover mode; older states load as minimum phase
+    {
+        Steinberg::int8 crossoverMode = 0;
+        if (version >= 13) {
+            streamer.readInt8(crossoverMode);
+        }
+        setter(makeGlobalParamId(GlobalParamType::kGlobalCrossoverMode),
+               crossoverMode != 0 ? 1.0 : 0.0);
+    }
+
     return true;
 }
 
@@ -900,6 +910,40 @@ Steinberg::tresult PLUGIN_API Controller::getParamValueByString(
     return EditControllerEx1::getParamValueByString(id, string, valueNormalized);
 }
 
+Steinberg::tresult PLUGIN_API Controller::setParamNormalized(
+    Steinberg::Vst::ParamID tag,
+    Steinberg::Vst::ParamValue value) {
+    const auto crossoverModeId = makeGlobalParamId(GlobalParamType::kGlobalCrossoverMode);
+    const bool modeChanged = tag == crossoverModeId &&
+        (getParamNormalized(tag) >= 0.5) != (value >= 0.5);
+
+    const auto result = EditControllerEx1::setParamNormalized(tag, value);
+
+    // Linear-phase crossovers add latency. The host must only re-query it once
+    // the processor reports the new mode, so hand the mode over and restart
+    // when its "LatencyChanged" reply arrives (see notify()).
+    if (modeChanged && result == Steinberg::kResultOk) {
+        sendCrossoverModeMessage(value >= 0.5);
+    }
+    return result;
+}
+
+void Controller::sendCrossoverModeMessage(bool linearPhase) {
+    auto msg = Steinberg::owned(allocateMessage());
+    if (msg) {
+        msg->setMessageID("CrossoverMode");
+        if (auto* attrs = msg->getAttributes()) {
+            attrs->setInt("linear", linearPhase ? 1 : 0);
+        }
+        if (sendMessage(msg) == Steinberg::kResultOk) return;
+    }
+
+    // No connected processor to answer: restart directly
+    if (componentHandler) {
+        componentHandler->restartComponent(Steinberg::Vst::kLatencyChanged);
+    }
+}
+
 // ==============================================================================
 // VST3EditorDelegate - Custom Views, Sub-Controllers, didOpen, willClose
 // ==============================================================================
@@ -1875,6 +1919,9 @@ Steinberg::MemoryStream* Controller::createComponentStateStream() {
         }
     }
 
+    // v13: Crossover mode
+    streamer.writeInt8(getBoolInt8(makeGlobalParamId(GlobalParamType::kGlobalCrossoverMode)));
+
     return stream;
 }
 
@@ -1972,6 +2019,14 @@ void PLUGIN_API Controller::onDataExchangeBlocksReceived(
 
 Steinberg::tresult PLUGIN_API Controller::notify(Steinberg::Vst::IMessage* message) {
     if (!message) return Steinberg::kInvalidArgument;
+
+    // The processor has applied a crossover mode switch: latency is now valid
+    if (strcmp(message->getMessageID(), "LatencyChanged") == 0) {
+        if (componentHandler)
+            componentHandler->restartComponent(Steinberg::Vst::kLatencyChanged);
+        return Steinberg::kResultOk;
+    }
+
     if (editorClosing_.load(std::memory_order_acquire))
         return Steinberg::Vst::EditControllerEx1::notify(message);
     if (dataExchangeReceiver_.onMessage(message)) return Steinberg::kResultOk;
@@ -96,6 +96,13 @@ public:
     Steinberg::IPlugView* PLUGIN_API createView(
         Steinberg::FIDString name) override;
 
+    /// Apply a parameter value; crossover mode changes are handed to the
+    /// processor, and the host is told of the new latency (kLatencyChanged)
+    /// once the processor confirms it
+    Steinberg::tresult PLUGIN_API setParamNormalized(
+        Steinberg::Vst::ParamID tag,
+        Steinberg::Vst::ParamValue value) override;
+
     /// Convert normalized parameter value to string for display
     /// FR-027: Custom formatting for Drive, Mix, Gain, Type, Pan
     Steinberg::tresult PLUGIN_API getParamStringByValue(
@@ -239,6 +246,10 @@ public:
     [[nodiscard]] Krate::DSP::SpectrumFIFO<8192>& getLocalOutputFIFO() { return localOutputFIFO_; }
 
 private:
+    /// Send the crossover mode to the processor ("CrossoverMode"); restarts
+    /// directly when no processor is connected
+    void sendCrossoverModeMessage(bool linearPhase);
+
     // ==========================================================================
     // Parameter Registration Helpers
     // ==========================================================================
@@ -90,6 +90,19 @@ void Controller::registerGlobalParams() {
     oversampleParam->setNormalized(2.0 / 3.0);  // Default to index 2 = "4x"
     parameters.addParameter(oversampleParam);
 
+    // Crossover Mode: StringListParameter ["Minimum Phase","Linear Phase"]
+    // Linear phase adds StereoCrossoverNetwork latency (reported to the host)
+    auto* crossoverModeParam = new Steinberg::Vst::StringListParameter(
+        STR16("Crossover Mode"),
+        makeGlobalParamId(GlobalParamType::kGlobalCrossoverMode),
+        nullptr,
+        Steinberg::Vst::ParameterInfo::kIsList  // Latency change: not automatable
+    );
+    crossoverModeParam->appendString(STR16("Minimum Phase"));
+    crossoverModeParam->appendString(STR16("Linear Phase"));
+    crossoverModeParam->setNormalized(0.0);  // Default: Minimum Phase
+    parameters.addParameter(crossoverModeParam);
+
     // Spectrum View Mode: StringListParameter ["Wet","Dry","Both"], default "Wet"
     auto* spectrumModeParam = new Steinberg::Vst::StringListParameter(
         STR16("Spectrum Mode"),
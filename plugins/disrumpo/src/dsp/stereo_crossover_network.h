@@ -0,0 +1,260 @@
+// ==============================================================================
+// Stereo Crossover Network for Block Processing
+// ==============================================================================
+// Block-based stereo replacement for a pair of per-sample CrossoverNetworks.
+// Splits L/R together through Krate::DSP::StereoBandSplitter (L/R as a 2-lane
+// pair through the LR4 cascade) and writes each band to its own buffer, so
+// band processing runs on contiguous blocks.
+//
+// Band layout rules (FR-009 logarithmic defaults, FR-011a/b redistribution on
+// band count changes, frequency clamping) stay in CrossoverNetwork, which is
+// kept here as the layout model only and never processes audio.
+//
+// Crossover Modes:
+// - Minimum phase (default): zero latency, identical topology to
+//   CrossoverNetwork (LR4 + D'Appolito allpass compensation).
+// - Linear phase: FFT crossover for mastering; bands sum to a pure delay of
+//   getLatencySamples(). delayDry() aligns the dry path for the global mix.
+//
+// Mode switches clear the crossover history. While running, requestLinearPhase()
+// hides that: the output fades out over kSwitchFadeMs, the mode switches,
+// the output stays muted until the new path has filled its latency, then fades
+// back in. applySwitchFade() applies that envelope to the final mix.
+//
+// References:
+// - specs/002-band-management/spec.md FR-001 to FR-014
+// - Constitution Principle XIV: Reuse Krate::DSP components
+// ==============================================================================
+
+#pragma once
+
+#include "crossover_network.h"
+
+#include <krate/dsp/processors/stereo_band_splitter.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Disrumpo {
+
+/// @brief Stereo, block-based crossover with optional linear-phase mode.
+/// Real-time safe: allocations only in prepare().
+class StereoCrossoverNetwork {
+public:
+    static constexpr int kMaxBands = CrossoverNetwork::kMaxBands;
+
+    /// Fade-out / fade-in time around a running crossover mode switch
+    static constexpr double kSwitchFadeMs = 5.0;
+
+    StereoCrossoverNetwork() noexcept = default;
+
+    StereoCrossoverNetwork(const StereoCrossoverNetwork&) = delete;
+    StereoCrossoverNetwork& operator=(const StereoCrossoverNetwork&) = delete;
+
+    // =========================================================================
+    // Initialization
+    // =========================================================================
+
+    /// @brief Initialize for the sample rate and band count.
+    /// @note NOT real-time safe (allocates the linear-phase and dry buffers)
+    void prepare(double sampleRate, int numBands) {
+        layout_.prepare(sampleRate, numBands);
+        splitter_.prepare(sampleRate);
+        syncLayout();
+
+        const size_t maxDelay = Krate::DSP::StereoBandSplitter::linearPhaseLatency();
+        dryDelayL_.assign(maxDelay, 0.0f);
+        dryDelayR_.assign(maxDelay, 0.0f);
+        dryPosition_ = 0;
+
+        switchFadeStep_ = static_cast<float>(1000.0 / (kSwitchFadeMs * sampleRate));
+        finishSwitch();
+    }
+
+    /// @brief Reset all filter state and the dry delay. A pending mode switch
+    /// is applied at once, since there is no history left to fade.
+    void reset() noexcept {
+        finishSwitch();
+        splitter_.reset();
+        std::fill(dryDelayL_.begin(), dryDelayL_.end(), 0.0f);
+        std::fill(dryDelayR_.begin(), dryDelayR_.end(), 0.0f);
+        dryPosition_ = 0;
+    }
+
+    // =========================================================================
+    // Configuration
+    // =========================================================================
+
+    /// @brief Change band count (preserves crossover positions, FR-011a/b).
+    void setBandCount(int numBands) noexcept {
+        layout_.setBandCount(numBands);
+        syncLayout();
+    }
+
+    /// @brief Set crossover frequency for a split point (0 to numBands-2).
+    void setCrossoverFrequency(int index, float hz) noexcept {
+        layout_.setCrossoverFrequency(index, hz);
+        syncLayout();
+    }
+
+    /// @brief Select linear-phase (true) or minimum-phase (false) crossovers
+    /// immediately. Switching clears the crossover history, so use this while
+    /// stopped; requestLinearPhase() switches without a click while running.
+    void setLinearPhase(bool enabled) noexcept {
+        requestedLinear_ = enabled;
+        finishSwitch();
+    }
+
+    /// @brief Switch modes while running: the switch happens once the output
+    /// has faded out (see applySwitchFade()).
+    void requestLinearPhase(bool enabled) noexcept {
+        requestedLinear_ = enabled;
+        if (switchState_ == SwitchState::Idle && enabled != isLinearPhase()) {
+            switchState_ = SwitchState::FadingOut;
+        }
+    }
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    [[nodiscard]] int getBandCount() const noexcept { return layout_.getBandCount(); }
+
+    [[nodiscard]] float getCrossoverFrequency(int index) const noexcept {
+        return layout_.getCrossoverFrequency(index);
+    }
+
+    [[nodiscard]] bool isLinearPhase() const noexcept {
+        return splitter_.phase() == Krate::DSP::CrossoverPhase::Linear;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept { return splitter_.isPrepared(); }
+
+    /// @brief Delay of the band outputs relative to the input (0 in minimum phase).
+    [[nodiscard]] size_t getLatencySamples() const noexcept { return splitter_.latency(); }
+
+    // =========================================================================
+    // Processing
+    // =========================================================================
+
+    /// @brief Start of a processing block: performs a requested mode switch
+    /// once the fade-out has reached silence. Call before process().
+    void beginBlock() noexcept {
+        if (switchState_ != SwitchState::FadingOut || switchGain_ > 0.0f) return;
+        applyPhase(requestedLinear_);
+        switchHoldRemaining_ = getLatencySamples();
+        switchState_ = SwitchState::Holding;
+    }
+
+    /// @brief Scale the final stereo output by the mode-switch envelope.
+    /// A no-op unless a switch is in progress.
+    void applySwitchFade(float* outL, float* outR, size_t numSamples) noexcept {
+        if (switchState_ == SwitchState::Idle) return;
+        for (size_t i = 0; i < numSamples; ++i) {
+            switch (switchState_) {
+                case SwitchState::FadingOut:
+                    switchGain_ = std::max(0.0f, switchGain_ - switchFadeStep_);
+                    break;
+                case SwitchState::Holding:
+                    if (switchHoldRemaining_ > 0) {
+                        --switchHoldRemaining_;
+                    } else {
+                        switchState_ = SwitchState::FadingIn;
+                    }
+                    break;
+                case SwitchState::FadingIn:
+                    switchGain_ = std::min(1.0f, switchGain_ + switchFadeStep_);
+                    if (switchGain_ >= 1.0f) {
+                        // Pick up a request that arrived mid-switch
+                        switchState_ = (requestedLinear_ != isLinearPhase())
+                            ? SwitchState::FadingOut : SwitchState::Idle;
+                    }
+                    break;
+                case SwitchState::Idle:
+                    break;
+            }
+            outL[i] *= switchGain_;
+            outR[i] *= switchGain_;
+        }
+    }
+
+    /// @brief True while a mode switch is fading or muted.
+    [[nodiscard]] bool isSwitching() const noexcept {
+        return switchState_ != SwitchState::Idle;
+    }
+
+    /// @brief Split a stereo block into getBandCount() band buffers per channel.
+    /// @param bandsL, bandsR getBandCount() pointers to numSamples floats each
+    void process(const float* inL, const float* inR, float* const* bandsL,
+                 float* const* bandsR, size_t numSamples) noexcept {
+        splitter_.process(inL, inR, bandsL, bandsR, numSamples);
+    }
+
+    /// @brief Delay a dry signal by getLatencySamples() so it lines up with
+    /// the bands. In minimum phase this is a plain copy.
+    void delayDry(const float* inL, const float* inR, float* outL, float* outR,
+                  size_t numSamples) noexcept {
+        const size_t delay = getLatencySamples();
+        if (delay == 0 || dryDelayL_.size() < delay) {
+            std::memcpy(outL, inL, numSamples * sizeof(float));
+            std::memcpy(outR, inR, numSamples * sizeof(float));
+            return;
+        }
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float l = inL[i];
+            const float r = inR[i];
+            outL[i] = dryDelayL_[dryPosition_];
+            outR[i] = dryDelayR_[dryPosition_];
+            dryDelayL_[dryPosition_] = l;
+            dryDelayR_[dryPosition_] = r;
+            if (++dryPosition_ == delay) dryPosition_ = 0;
+        }
+    }
+
+private:
+    enum class SwitchState { Idle, FadingOut, Holding, FadingIn };
+
+    void applyPhase(bool linear) noexcept {
+        const auto phase = linear ? Krate::DSP::CrossoverPhase::Linear
+                                  : Krate::DSP::CrossoverPhase::Minimum;
+        if (phase == splitter_.phase()) return;
+        splitter_.setPhase(phase);
+        std::fill(dryDelayL_.begin(), dryDelayL_.end(), 0.0f);
+        std::fill(dryDelayR_.begin(), dryDelayR_.end(), 0.0f);
+        dryPosition_ = 0;
+    }
+
+    /// Apply the requested mode now and drop any fade in progress
+    void finishSwitch() noexcept {
+        applyPhase(requestedLinear_);
+        switchState_ = SwitchState::Idle;
+        switchGain_ = 1.0f;
+        switchHoldRemaining_ = 0;
+    }
+
+    /// Push the layout model's band count and targets into the splitter
+    void syncLayout() noexcept {
+        const int numBands = layout_.getBandCount();
+        splitter_.setNumBands(numBands);
+        for (int i = 0; i < numBands - 1; ++i) {
+            splitter_.setCrossoverFrequency(i, layout_.getCrossoverFrequency(i));
+        }
+    }
+
+    CrossoverNetwork layout_;  // band-layout rules only
+    Krate::DSP::StereoBandSplitter splitter_;
+
+    std::vector<float> dryDelayL_;
+    std::vector<float> dryDelayR_;
+    size_t dryPosition_ = 0;
+
+    bool requestedLinear_ = false;
+    SwitchState switchState_ = SwitchState::Idle;
+    float switchGain_ = 1.0f;
+    float switchFadeStep_ = 1.0f;
+    size_t switchHoldRemaining_ = 0;
+};
+
+} // namespace Disrumpo
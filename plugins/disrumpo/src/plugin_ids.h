@@ -68,6 +68,7 @@ enum class GlobalParamType : uint8_t {
     kGlobalModPanelVisible = 0x06,  ///< Modulation panel visibility [on/off] (Spec 012)
     kGlobalMidiLearnActive = 0x07,  ///< MIDI Learn mode active [on/off] (Spec 012)
     kGlobalMidiLearnTarget = 0x08,  ///< MIDI Learn target parameter ID (Spec 012)
+    kGlobalCrossoverMode   = 0x09,  ///< Crossover phase [Minimum, Linear]
 };
 
 /// @brief Create parameter ID for global parameters.
@@ -380,6 +381,7 @@ enum ParameterIDs : Steinberg::Vst::ParamID {
     kGlobalMixId     = 0x0F02,  // 3842 - Global dry/wet mix
     kBandCountId     = 0x0F03,  // 3843 - Band count (1-8)
     kOversampleMaxId = 0x0F04,  // 3844 - Max oversample factor
+    kCrossoverModeId = 0x0F09,  // 3849 - Crossover phase mode
 };
 
 // =============================================================================
@@ -684,8 +686,10 @@ constexpr const char* getMorphLinkModeName(MorphLinkMode mode) noexcept {
 // - v8: Reduced max bands from 8 to 4 (stream format: 4 bands, 3 crossovers, 4 morph)
 // - v9: Shape parameter slots (10 generic slots per node for type-specific UI controls)
 // - v12: Band Tone/Bias modulation targets (kParamsPerBand 6→8, dest index migration)
+// - v13: Crossover mode (int8 after the morph node state; older states load as
+//        minimum phase)
 // ==============================================================================
-constexpr int32_t kPresetVersion = 12;
+constexpr int32_t kPresetVersion = 13;
 
 /// Migration table: old note index (v9, 15 entries) -> new dropdown index (v10, 21 entries).
 /// Old encoding: NoteValue * 3 + NoteModifier (Whole→Sixteenth, None/Dotted/Triplet).
@@ -96,10 +96,20 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
 
     // Constitution Principle II: Pre-allocate ALL buffers HERE
 
-    // Initialize crossover networks for both channels (FR-001b)
+    // Initialize the stereo crossover (FR-001b) and its block buffers
     const int numBands = bandCount_.load(std::memory_order_relaxed);
-    crossoverL_.prepare(sampleRate_, numBands);
-    crossoverR_.prepare(sampleRate_, numBands);
+    crossover_.prepare(sampleRate_, numBands);
+    crossover_.setLinearPhase(linearPhase_.load(std::memory_order_relaxed));
+
+    maxBlockSize_ = static_cast<size_t>(std::max(setup.maxSamplesPerBlock, Steinberg::int32{1}));
+    for (int b = 0; b < kMaxBands; ++b) {
+        bandBufferL_[b].assign(maxBlockSize_, 0.0f);
+        bandBufferR_[b].assign(maxBlockSize_, 0.0f);
+    }
+    scaledInputL_.assign(maxBlockSize_, 0.0f);
+    scaledInputR_.assign(maxBlockSize_, 0.0f);
+    dryL_.assign(maxBlockSize_, 0.0f);
+    dryR_.assign(maxBlockSize_, 0.0f);
 
     // Initialize band processors
     for (int i = 0; i < kMaxBands; ++i) {
@@ -146,8 +156,7 @@ Steinberg::tresult PLUGIN_API Processor::setActive(Steinberg::TBool state) {
         state ? "true" : "false");
     if (state) {
         // Activating: reset processing state
-        crossoverL_.reset();
-        crossoverR_.reset();
+        crossover_.reset();
         for (auto& proc : bandProcessors_) {
             proc.reset();
         }
@@ -215,6 +224,11 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
         return Steinberg::kResultTrue;
     }
 
+    // Block buffers are sized in setupProcessing()
+    if (maxBlockSize_ == 0) {
+        return Steinberg::kResultTrue;
+    }
+
     // ==========================================================================
     // Spectrum Analyzer: Prepare pre-distortion mono mixdown for DataExchange
     // ==========================================================================
@@ -441,7 +455,7 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     }
 
     // ==========================================================================
-    // Band Processing (FR-001a: sample-by-sample processing)
+    // Band Processing (FR-001a: per-sample band processors on block buffers)
     // ==========================================================================
 
     // Denormalize global gain/mix parameters
@@ -455,52 +469,80 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     // Mix: normalized [0,1] maps directly to dry/wet fraction
     const float wetMix = modGlobalMix;
     const float dryMix = 1.0f - wetMix;
+    const float wetGain = outputGainLinear * wetMix;
 
-    std::array<float, kMaxBands> bandsL{};
-    std::array<float, kMaxBands> bandsR{};
+    // Crossover mode switches fade the output out, switch at a block
+    // boundary (clearing crossover history) and fade back in
+    crossover_.requestLinearPhase(linearPhase_.load(std::memory_order_relaxed));
+
+    // Solo/mute state is block-rate; resolve it once
+    std::array<bool, kMaxBands> contributes{};
+    for (int b = 0; b < numBands; ++b) {
+        contributes[b] = shouldBandContribute(b);
+    }
 
     // Apply block-rate drive/mix modulation to non-morph distortion adapters
     for (int b = 0; b < numBands; ++b) {
         bandProcessors_[b].beginBlockModulation();
     }
 
-    for (Steinberg::int32 n = 0; n < data.numSamples; ++n) {
+    std::array<float*, kMaxBands> bandsL{};
+    std::array<float*, kMaxBands> bandsR{};
+    for (int b = 0; b < kMaxBands; ++b) {
+        bandsL[b] = bandBufferL_[b].data();
+        bandsR[b] = bandBufferR_[b].data();
+    }
+
+    const auto totalSamples = static_cast<size_t>(data.numSamples);
+    for (size_t offset = 0; offset < totalSamples; offset += maxBlockSize_) {
+        const size_t count = std::min(maxBlockSize_, totalSamples - offset);
+        const float* blockInL = inputL + offset;
+        const float* blockInR = inputR + offset;
+
         // Apply input gain before crossover
-        const float inL = inputL[n] * inputGainLinear;
-        const float inR = inputR[n] * inputGainLinear;
+        for (size_t n = 0; n < count; ++n) {
+            scaledInputL_[n] = blockInL[n] * inputGainLinear;
+            scaledInputR_[n] = blockInR[n] * inputGainLinear;
+        }
 
-        // Split input through crossover networks (FR-001b: independent L/R)
-        crossoverL_.process(inL, bandsL);
-        crossoverR_.process(inR, bandsR);
+        // Split the block into band buffers (FR-001b: independent L/R lanes)
+        crossover_.beginBlock();
+        crossover_.process(scaledInputL_.data(), scaledInputR_.data(),
+                           bandsL.data(), bandsR.data(), count);
 
-        // Initialize output accumulators
-        float sumL = 0.0f;
-        float sumR = 0.0f;
+        // Dry path delayed by the crossover latency (a copy in minimum phase);
+        // read before the outputs are written since they may alias the inputs
+        crossover_.delayDry(blockInL, blockInR, dryL_.data(), dryR_.data(), count);
 
-        // Process each band and sum (FR-013: sample-by-sample summation)
+        // Per-band processing on contiguous buffers. Band processors carry no
+        // cross-band state, so band-major order matches the per-sample loop.
         for (int b = 0; b < numBands; ++b) {
-            // Check solo/mute logic (FR-025, FR-025a)
-            if (!shouldBandContribute(b)) {
-                // Process to keep smoothers running, but don't add to output
-                float discardL = bandsL[b];
-                float discardR = bandsR[b];
-                bandProcessors_[b].process(discardL, discardR);
-                continue;
+            float* bandL = bandsL[b];
+            float* bandR = bandsR[b];
+            for (size_t n = 0; n < count; ++n) {
+                // Apply per-band processing (gain, pan, mute with smoothing)
+                bandProcessors_[b].process(bandL[n], bandR[n]);
             }
-
-            // Apply per-band processing (gain, pan, mute with smoothing)
-            float bandL = bandsL[b];
-            float bandR = bandsR[b];
-            bandProcessors_[b].process(bandL, bandR);
-
-            // Sum to output
-            sumL += bandL;
-            sumR += bandR;
         }
 
-        // Apply output gain and dry/wet mix
-        outputL[n] = inputL[n] * dryMix + sumL * outputGainLinear * wetMix;
-        outputR[n] = inputR[n] * dryMix + sumR * outputGainLinear * wetMix;
+        // Sum contributing bands (FR-013, FR-025/FR-025a: soloed-out and muted
+        // bands are processed to keep smoothers running, but not added)
+        float* blockOutL = outputL + offset;
+        float* blockOutR = outputR + offset;
+        for (size_t n = 0; n < count; ++n) {
+            float sumL = 0.0f;
+            float sumR = 0.0f;
+            for (int b = 0; b < numBands; ++b) {
+                if (contributes[b]) {
+                    sumL += bandsL[b][n];
+                    sumR += bandsR[b][n];
+                }
+            }
+            // Apply output gain and dry/wet mix
+            blockOutL[n] = dryL_[n] * dryMix + sumL * wetGain;
+            blockOutR[n] = dryR_[n] * dryMix + sumR * wetGain;
+        }
+        crossover_.applySwitchFade(blockOutL, blockOutR, count);
     }
 
     // Restore base distortion params after per-sample processing
@@ -535,6 +577,12 @@ Steinberg::tresult PLUGIN_API Processor::setBusArrangements(
     return Steinberg::kResultFalse;
 }
 
+Steinberg::uint32 PLUGIN_API Processor::getLatencySamples() {
+    return linearPhase_.load(std::memory_order_relaxed)
+        ? static_cast<Steinberg::uint32>(Krate::DSP::StereoBandSplitter::linearPhaseLatency())
+        : 0;
+}
+
 // ==============================================================================
 // Parameter Handling
 // ==============================================================================
@@ -16,7 +16,7 @@
 
 #include "public.sdk/source/vst/vstaudioeffect.h"
 #include "public.sdk/source/vst/utility/dataexchange.h"
-#include "dsp/crossover_network.h"
+#include "dsp/stereo_crossover_network.h"
 #include "dsp/band_processor.h"
 #include "dsp/band_state.h"
 #include "dsp/sweep_processor.h"
@@ -33,6 +33,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace Disrumpo {
 
@@ -78,6 +79,9 @@ public:
         Steinberg::Vst::SpeakerArrangement* inputs, Steinberg::int32 numIns,
         Steinberg::Vst::SpeakerArrangement* outputs, Steinberg::int32 numOuts) override;
 
+    /// Report crossover latency (non-zero in linear-phase mode)
+    Steinberg::uint32 PLUGIN_API getLatencySamples() override;
+
     // ===========================================================================
     // IConnectionPoint (DataExchange lifecycle)
     // ===========================================================================
@@ -87,6 +91,10 @@ public:
     Steinberg::tresult PLUGIN_API disconnect(
         Steinberg::Vst::IConnectionPoint* other) override;
 
+    /// Apply a "CrossoverMode" message from the controller and reply with
+    /// "LatencyChanged" once getLatencySamples() reports the new mode
+    Steinberg::tresult PLUGIN_API notify(Steinberg::Vst::IMessage* message) override;
+
     // ===========================================================================
     // IComponent
     // ===========================================================================
@@ -152,9 +160,24 @@ private:
     /// @brief Current band count (1-8)
     std::atomic<int> bandCount_{kDefaultBands};
 
-    /// @brief Crossover networks for L/R channels (FR-001b)
-    CrossoverNetwork crossoverL_;
-    CrossoverNetwork crossoverR_;
+    /// @brief Block-based stereo crossover (FR-001b: independent L/R lanes)
+    StereoCrossoverNetwork crossover_;
+
+    /// @brief Crossover phase mode: false = minimum phase, true = linear phase
+    std::atomic<bool> linearPhase_{false};
+
+    /// @brief Per-band block buffers written by crossover_ (sized in setupProcessing)
+    std::array<std::vector<float>, kMaxBands> bandBufferL_;
+    std::array<std::vector<float>, kMaxBands> bandBufferR_;
+
+    /// @brief Gain-scaled crossover input and latency-aligned dry signal
+    std::vector<float> scaledInputL_;
+    std::vector<float> scaledInputR_;
+    std::vector<float> dryL_;
+    std::vector<float> dryR_;
+
+    /// @brief Block size the buffers above were sized for
+    size_t maxBlockSize_ = 0;
 
     /// @brief Per-band state (gain, pan, solo, bypass, mute)
     std::array<BandState, kMaxBands> bandStates_{};
@@ -73,6 +73,36 @@ Steinberg::tresult PLUGIN_API Processor::disconnect(
     return AudioEffect::disconnect(other);
 }
 
+Steinberg::tresult PLUGIN_API Processor::notify(Steinberg::Vst::IMessage* message)
+{
+    if (!message)
+        return Steinberg::kInvalidArgument;
+
+    if (strcmp(message->getMessageID(), "CrossoverMode") == 0)
+    {
+        auto* attrs = message->getAttributes();
+        Steinberg::int64 linear = 0;
+        if (!attrs || attrs->getInt("linear", linear) != Steinberg::kResultOk)
+            return Steinberg::kResultFalse;
+
+        // process() picks the mode up at its next block and fades across the
+        // switch; the latency it reports changes from here on
+        linearPhase_.store(linear != 0, std::memory_order_relaxed);
+
+        auto reply = Steinberg::owned(allocateMessage());
+        if (reply)
+        {
+            reply->setMessageID("LatencyChanged");
+            if (auto* replyAttrs = reply->getAttributes())
+                replyAttrs->setInt("latency", static_cast<Steinberg::int64>(getLatencySamples()));
+            sendMessage(reply);
+        }
+        return Steinberg::kResultOk;
+    }
+
+    return AudioEffect::notify(message);
+}
+
 // ==============================================================================
 // sendSpectrumBlock -- send audio samples via DataExchange
 // ==============================================================================
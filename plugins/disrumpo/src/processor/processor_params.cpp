@@ -341,8 +341,7 @@ void Processor::processParameterChanges(Steinberg::Vst::IParameterChanges* chang
                 const int newBandCount = 1 + static_cast<int>(value * 3.0 + 0.5);
                 const int clamped = std::clamp(newBandCount, kMinBands, 4);
                 bandCount_.store(clamped, std::memory_order_relaxed);
-                crossoverL_.setBandCount(clamped);
-                crossoverR_.setBandCount(clamped);
+                crossover_.setBandCount(clamped);
                 break;
             }
 
@@ -362,6 +361,12 @@ void Processor::processParameterChanges(Steinberg::Vst::IParameterChanges* chang
                 break;
             }
 
+            case kCrossoverModeId:
+                // StringListParameter with 2 items: 0 = Minimum Phase, 1 = Linear Phase
+                // Applied to crossover_ at the start of the next block in process()
+                linearPhase_.store(value >= 0.5, std::memory_order_relaxed);
+                break;
+
             default:
                 // =================================================================
                 // Sweep Parameters (spec 007-sweep-system)
@@ -989,8 +994,7 @@ void Processor::processParameterChanges(Steinberg::Vst::IParameterChanges* chang
                         const float logMax = std::log10(kMaxCrossoverHz);
                         const float logFreq = logMin + static_cast<float>(value) * (logMax - logMin);
                         const float freqHz = std::pow(10.0f, logFreq);
-                        crossoverL_.setCrossoverFrequency(static_cast<int>(index), freqHz);
-                        crossoverR_.setCrossoverFrequency(static_cast<int>(index), freqHz);
+                        crossover_.setCrossoverFrequency(static_cast<int>(index), freqHz);
                     }
                 }
                 break;
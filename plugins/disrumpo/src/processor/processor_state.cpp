@@ -73,7 +73,7 @@ Steinberg::tresult PLUGIN_API Processor::getState(Steinberg::IBStream* state) {
 
     // Crossover frequencies (7 floats)
     for (int c = 0; c < kMaxBands - 1; ++c) {
-        float freq = crossoverL_.getCrossoverFrequency(c);
+        float freq = crossover_.getCrossoverFrequency(c);
         if (!streamer.writeFloat(freq)) return Steinberg::kResultFalse;
     }
 
@@ -351,6 +351,11 @@ Steinberg::tresult PLUGIN_API Processor::getState(Steinberg::IBStream* state) {
         }
     }
 
+    // v13: Crossover mode (0 = minimum phase, 1 = linear phase)
+    if (!streamer.writeInt8(static_cast<Steinberg::int8>(
+            linearPhase_.load(std::memory_order_relaxed) ? 1 : 0)))
+        return Steinberg::kResultFalse;
+
     // SharedDisplayBridge: append instance ID for Tier 3 fallback
     streamer.writeInt32(kInstanceIdMarker);
     streamer.writeInt64(static_cast<Steinberg::int64>(instanceId_));
@@ -452,15 +457,13 @@ Steinberg::tresult PLUGIN_API Processor::setState(Steinberg::IBStream* state) {
             if (!streamer.readFloat(freq)) break;
 
             if (c < kMaxBands - 1) {
-                crossoverL_.setCrossoverFrequency(c, freq);
-                crossoverR_.setCrossoverFrequency(c, freq);
+                crossover_.setCrossoverFrequency(c, freq);
             }
             // else: discard crossovers 3-6 (v7 migration)
         }
 
         // Update band counts in crossover networks
-        crossoverL_.setBandCount(bandCount);
-        crossoverR_.setBandCount(bandCount);
+        crossover_.setBandCount(bandCount);
     }
 
     // =========================================================================
@@ -900,6 +903,15 @@ Steinberg::tresult PLUGIN_API Processor::setState(Steinberg::IBStream* state) {
         }
     }
 
+    // v13: Crossover mode; states written before it existed load as minimum phase
+    {
+        Steinberg::int8 crossoverMode = 0;
+        if (version >= 13) {
+            streamer.readInt8(crossoverMode);
+        }
+        linearPhase_.store(crossoverMode != 0, std::memory_order_relaxed);
+    }
+
     // SharedDisplayBridge: try to read instance ID from state trailer
     {
         Steinberg::int32 marker = 0;
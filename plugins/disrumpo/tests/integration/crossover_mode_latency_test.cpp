@@ -0,0 +1,105 @@
+// ==============================================================================
+// Crossover Mode Latency Integration Test
+// ==============================================================================
+// Linear-phase crossovers add latency. When the Crossover Mode parameter
+// changes on the controller, the host must only be asked to re-query latency
+// (restartComponent(kLatencyChanged)) after the processor has applied the new
+// mode, otherwise it reads the old value. The controller hands the mode to the
+// processor via a "CrossoverMode" message and restarts on the "LatencyChanged"
+// reply.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "controller/controller.h"
+#include "processor/processor.h"
+#include "plugin_ids.h"
+
+#include "public.sdk/source/vst/hosting/hostclasses.h"
+
+#include <memory>
+#include <vector>
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+namespace {
+
+/// Records the processor latency at the moment the host is asked to restart
+class LatencyRecordingHandler : public IComponentHandler {
+public:
+    explicit LatencyRecordingHandler(Disrumpo::Processor& processor)
+        : processor_(processor) {}
+
+    tresult PLUGIN_API beginEdit(ParamID /*id*/) override { return kResultOk; }
+    tresult PLUGIN_API performEdit(ParamID /*id*/, ParamValue /*value*/) override {
+        return kResultOk;
+    }
+    tresult PLUGIN_API endEdit(ParamID /*id*/) override { return kResultOk; }
+
+    tresult PLUGIN_API restartComponent(int32 flags) override {
+        if ((flags & kLatencyChanged) != 0) {
+            latencyAtRestart.push_back(processor_.getLatencySamples());
+        }
+        return kResultOk;
+    }
+
+    tresult PLUGIN_API queryInterface(const TUID /*iid*/, void** obj) override {
+        *obj = nullptr;
+        return kNoInterface;
+    }
+    uint32 PLUGIN_API addRef() override { return 1; }
+    uint32 PLUGIN_API release() override { return 1; }
+
+    std::vector<uint32> latencyAtRestart;
+
+private:
+    Disrumpo::Processor& processor_;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Crossover mode change restarts the host after the processor applies it",
+          "[disrumpo][crossover][latency]")
+{
+    HostApplication host;
+    auto proc = std::make_unique<Disrumpo::Processor>();
+    auto ctrl = std::make_unique<Disrumpo::Controller>();
+    REQUIRE(proc->initialize(&host) == kResultOk);
+    REQUIRE(ctrl->initialize(&host) == kResultOk);
+
+    auto* procConn = static_cast<IConnectionPoint*>(static_cast<AudioEffect*>(proc.get()));
+    auto* ctrlConn = static_cast<IConnectionPoint*>(static_cast<EditControllerEx1*>(ctrl.get()));
+    proc->connect(ctrlConn);
+    ctrl->connect(procConn);
+
+    ProcessSetup setup{};
+    setup.sampleRate = 44100.0;
+    setup.maxSamplesPerBlock = 512;
+    setup.symbolicSampleSize = kSample32;
+    setup.processMode = kRealtime;
+    proc->setupProcessing(setup);
+
+    LatencyRecordingHandler handler(*proc);
+    ctrl->setComponentHandler(&handler);
+    REQUIRE(proc->getLatencySamples() == 0);
+
+    ctrl->setParamNormalized(Disrumpo::kCrossoverModeId, 1.0);
+    REQUIRE(handler.latencyAtRestart.size() == 1);
+    REQUIRE(handler.latencyAtRestart[0] > 0);
+    REQUIRE(handler.latencyAtRestart[0] == proc->getLatencySamples());
+
+    // Same mode again: no restart
+    ctrl->setParamNormalized(Disrumpo::kCrossoverModeId, 1.0);
+    REQUIRE(handler.latencyAtRestart.size() == 1);
+
+    ctrl->setParamNormalized(Disrumpo::kCrossoverModeId, 0.0);
+    REQUIRE(handler.latencyAtRestart.size() == 2);
+    REQUIRE(handler.latencyAtRestart[1] == 0);
+
+    ctrl->setComponentHandler(nullptr);
+    proc->disconnect(ctrlConn);
+    ctrl->disconnect(procConn);
+    ctrl->terminate();
+    proc->terminate();
+}
@@ -1302,3 +1302,68 @@ TEST_CASE("Version migration: future version v99 loads known params", "[preset][
     REQUIRE(version == kPresetVersion);
     REQUIRE_THAT(ig, Catch::Matchers::WithinAbs(0.6f, 1e-6f));
 }
+
+// =============================================================================
+// v13: Crossover mode
+// =============================================================================
+
+/// Copy a stream's bytes into a vector
+static std::vector<uint8_t> streamBytes(MemoryStream& stream) {
+    Steinberg::int64 size = 0;
+    stream.seek(0, IBStream::kIBSeekEnd, &size);
+    stream.seek(0, IBStream::kIBSeekSet, nullptr);
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    Steinberg::int32 numRead = 0;
+    stream.read(bytes.data(), static_cast<Steinberg::int32>(size), &numRead);
+    return bytes;
+}
+
+/// Build a rewound stream from bytes
+static Steinberg::IPtr<MemoryStream> makeStream(const std::vector<uint8_t>& bytes) {
+    auto stream = Steinberg::owned(new MemoryStream());
+    Steinberg::int32 numWritten = 0;
+    stream->write(const_cast<uint8_t*>(bytes.data()),
+                  static_cast<Steinberg::int32>(bytes.size()), &numWritten);
+    stream->seek(0, IBStream::kIBSeekSet, nullptr);
+    return stream;
+}
+
+TEST_CASE("Serialization: crossover mode persists and older states load as minimum phase",
+          "[preset][serialization][crossover]") {
+    // The mode byte sits just before the instance-ID trailer (int32 + int64)
+    constexpr size_t kTrailerBytes = 4 + 8;
+
+    auto procA = createTestProcessor();
+    auto defaultStream = Steinberg::owned(new MemoryStream());
+    REQUIRE(procA->getState(defaultStream) == Steinberg::kResultOk);
+    auto bytes = streamBytes(*defaultStream);
+    REQUIRE(bytes.size() > kTrailerBytes + 1);
+    const size_t modeOffset = bytes.size() - kTrailerBytes - 1;
+    REQUIRE(bytes[modeOffset] == 0);
+
+    SECTION("linear phase round-trips") {
+        bytes[modeOffset] = 1;
+        auto procB = createTestProcessor();
+        REQUIRE(procB->setState(makeStream(bytes)) == Steinberg::kResultOk);
+        REQUIRE(procB->getLatencySamples() > 0);
+
+        auto saved = Steinberg::owned(new MemoryStream());
+        REQUIRE(procB->getState(saved) == Steinberg::kResultOk);
+        REQUIRE(streamBytes(*saved)[modeOffset] == 1);
+    }
+
+    SECTION("v12 state without the mode byte loads as minimum phase") {
+        // A linear-phase processor must fall back to minimum phase
+        bytes[modeOffset] = 1;
+        auto procB = createTestProcessor();
+        REQUIRE(procB->setState(makeStream(bytes)) == Steinberg::kResultOk);
+        REQUIRE(procB->getLatencySamples() > 0);
+
+        auto v12 = bytes;
+        v12.erase(v12.begin() + static_cast<std::ptrdiff_t>(modeOffset));
+        const int32_t version = 12;
+        std::memcpy(v12.data(), &version, sizeof(version));
+        REQUIRE(procB->setState(makeStream(v12)) == Steinberg::kResultOk);
+        REQUIRE(procB->getLatencySamples() == 0);
+    }
+}
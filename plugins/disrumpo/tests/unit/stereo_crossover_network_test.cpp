@@ -0,0 +1,211 @@
+// ==============================================================================
+// StereoCrossoverNetwork Unit Tests
+// ==============================================================================
+// The block stereo crossover must reproduce the per-sample CrossoverNetwork in
+// minimum phase, keep its band-layout rules, and in linear phase report a
+// latency that delayDry() matches.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/crossover_network.h"
+#include "dsp/stereo_crossover_network.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+
+std::vector<float> makeSignal(size_t length, float freq, float phase) {
+    std::vector<float> x(length);
+    for (size_t i = 0; i < length; ++i) {
+        const double t = static_cast<double>(i) / kSampleRate;
+        x[i] = static_cast<float>(0.5 * std::sin(6.283185307179586 * freq * t + phase) +
+                                  0.3 * std::sin(6.283185307179586 * 7.3 * freq * t));
+    }
+    return x;
+}
+
+} // anonymous namespace
+
+TEST_CASE("StereoCrossoverNetwork minimum phase matches two CrossoverNetworks",
+          "[crossover][stereo]") {
+    constexpr size_t kLength = 16384;
+    constexpr size_t kBlock = 256;
+    constexpr size_t kSettleSamples = 8192;
+    const auto inL = makeSignal(kLength, 90.0f, 0.0f);
+    const auto inR = makeSignal(kLength, 310.0f, 1.0f);
+
+    Disrumpo::StereoCrossoverNetwork stereo;
+    stereo.prepare(kSampleRate, 4);
+    Disrumpo::CrossoverNetwork refL;
+    Disrumpo::CrossoverNetwork refR;
+    refL.prepare(kSampleRate, 4);
+    refR.prepare(kSampleRate, 4);
+
+    REQUIRE(stereo.getLatencySamples() == 0);
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(stereo.getCrossoverFrequency(i) == refL.getCrossoverFrequency(i));
+    }
+
+    std::array<std::vector<float>, 4> bandL;
+    std::array<std::vector<float>, 4> bandR;
+    std::array<float*, 4> ptrL{};
+    std::array<float*, 4> ptrR{};
+    for (int b = 0; b < 4; ++b) {
+        bandL[b].resize(kBlock);
+        bandR[b].resize(kBlock);
+        ptrL[b] = bandL[b].data();
+        ptrR[b] = bandR[b].data();
+    }
+
+    float worst = 0.0f;
+    std::array<float, Disrumpo::CrossoverNetwork::kMaxBands> expectedL{};
+    std::array<float, Disrumpo::CrossoverNetwork::kMaxBands> expectedR{};
+    for (size_t pos = 0; pos < kLength; pos += kBlock) {
+        stereo.process(inL.data() + pos, inR.data() + pos, ptrL.data(), ptrR.data(), kBlock);
+        for (size_t n = 0; n < kBlock; ++n) {
+            refL.process(inL[pos + n], expectedL);
+            refR.process(inR[pos + n], expectedR);
+            // CrossoverNetwork ramps its crossovers in from 1 kHz after
+            // prepare(); compare once both have settled
+            if (pos < kSettleSamples) continue;
+            for (int b = 0; b < 4; ++b) {
+                worst = std::max(worst, std::abs(bandL[b][n] - expectedL[b]));
+                worst = std::max(worst, std::abs(bandR[b][n] - expectedR[b]));
+            }
+        }
+    }
+    // CrossoverNetwork's allpasses use Q = 0.7071 rather than exactly 1/sqrt(2)
+    REQUIRE(worst < 1e-3f);
+}
+
+TEST_CASE("StereoCrossoverNetwork keeps CrossoverNetwork band-count rules",
+          "[crossover][stereo]") {
+    Disrumpo::StereoCrossoverNetwork stereo;
+    Disrumpo::CrossoverNetwork ref;
+    stereo.prepare(kSampleRate, 2);
+    ref.prepare(kSampleRate, 2);
+
+    stereo.setCrossoverFrequency(0, 800.0f);
+    ref.setCrossoverFrequency(0, 800.0f);
+    stereo.setBandCount(4);
+    ref.setBandCount(4);
+
+    REQUIRE(stereo.getBandCount() == 4);
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(stereo.getCrossoverFrequency(i) == ref.getCrossoverFrequency(i));
+    }
+}
+
+TEST_CASE("StereoCrossoverNetwork linear phase aligns bands with the delayed dry path",
+          "[crossover][stereo]") {
+    constexpr size_t kLength = 12000;
+    constexpr size_t kBlock = 512;
+    const auto inL = makeSignal(kLength, 120.0f, 0.0f);
+    const auto inR = makeSignal(kLength, 900.0f, 2.0f);
+
+    Disrumpo::StereoCrossoverNetwork stereo;
+    stereo.prepare(kSampleRate, 3);
+    stereo.setLinearPhase(true);
+    REQUIRE(stereo.isLinearPhase());
+    const size_t latency = stereo.getLatencySamples();
+    REQUIRE(latency > 0);
+
+    std::array<std::vector<float>, 3> bandL;
+    std::array<std::vector<float>, 3> bandR;
+    std::array<float*, 3> ptrL{};
+    std::array<float*, 3> ptrR{};
+    for (int b = 0; b < 3; ++b) {
+        bandL[b].resize(kBlock);
+        bandR[b].resize(kBlock);
+        ptrL[b] = bandL[b].data();
+        ptrR[b] = bandR[b].data();
+    }
+    std::vector<float> dryL(kBlock);
+    std::vector<float> dryR(kBlock);
+
+    float worst = 0.0f;
+    for (size_t pos = 0; pos + kBlock <= kLength; pos += kBlock) {
+        stereo.process(inL.data() + pos, inR.data() + pos, ptrL.data(), ptrR.data(), kBlock);
+        stereo.delayDry(inL.data() + pos, inR.data() + pos, dryL.data(), dryR.data(), kBlock);
+        for (size_t n = 0; n < kBlock; ++n) {
+            const float sumL = bandL[0][n] + bandL[1][n] + bandL[2][n];
+            const float sumR = bandR[0][n] + bandR[1][n] + bandR[2][n];
+            worst = std::max(worst, std::abs(sumL - dryL[n]));
+            worst = std::max(worst, std::abs(sumR - dryR[n]));
+        }
+    }
+    REQUIRE(worst < 1e-4f);
+
+    stereo.setLinearPhase(false);
+    REQUIRE(stereo.getLatencySamples() == 0);
+}
+
+TEST_CASE("StereoCrossoverNetwork running mode switches fade instead of clicking",
+          "[crossover][stereo]") {
+    constexpr size_t kBlock = 256;
+    constexpr size_t kLength = 32768;
+    const auto inL = makeSignal(kLength, 120.0f, 0.0f);
+    const auto inR = makeSignal(kLength, 120.0f, 0.0f);
+
+    Disrumpo::StereoCrossoverNetwork stereo;
+    stereo.prepare(kSampleRate, 3);
+
+    std::array<std::vector<float>, 3> bandL;
+    std::array<std::vector<float>, 3> bandR;
+    std::array<float*, 3> ptrL{};
+    std::array<float*, 3> ptrR{};
+    for (int b = 0; b < 3; ++b) {
+        bandL[b].resize(kBlock);
+        bandR[b].resize(kBlock);
+        ptrL[b] = bandL[b].data();
+        ptrR[b] = bandR[b].data();
+    }
+    std::vector<float> outL(kBlock);
+    std::vector<float> outR(kBlock);
+
+    // Largest step of the input itself; a click is a step well beyond it
+    float inputStep = 0.0f;
+    for (size_t i = 1; i < kLength; ++i) {
+        inputStep = std::max(inputStep, std::abs(inL[i] - inL[i - 1]));
+    }
+
+    float worstStep = 0.0f;
+    float previous = 0.0f;
+    bool sawLinear = false;
+    for (size_t pos = 0; pos + kBlock <= kLength; pos += kBlock) {
+        if (pos == 4 * kBlock) stereo.requestLinearPhase(true);
+        if (pos == 80 * kBlock) stereo.requestLinearPhase(false);
+
+        stereo.beginBlock();
+        stereo.process(inL.data() + pos, inR.data() + pos, ptrL.data(), ptrR.data(), kBlock);
+        for (size_t n = 0; n < kBlock; ++n) {
+            outL[n] = bandL[0][n] + bandL[1][n] + bandL[2][n];
+            outR[n] = bandR[0][n] + bandR[1][n] + bandR[2][n];
+        }
+        stereo.applySwitchFade(outL.data(), outR.data(), kBlock);
+        for (size_t n = 0; n < kBlock; ++n) {
+            worstStep = std::max(worstStep, std::abs(outL[n] - previous));
+            previous = outL[n];
+        }
+        sawLinear = sawLinear || stereo.isLinearPhase();
+    }
+
+    REQUIRE(sawLinear);
+    REQUIRE_FALSE(stereo.isLinearPhase());
+    REQUIRE_FALSE(stereo.isSwitching());
+    REQUIRE(worstStep < 2.0f * inputStep);
+
+    SECTION("reset applies a pending switch at once") {
+        stereo.requestLinearPhase(true);
+        REQUIRE(stereo.isSwitching());
+        stereo.reset();
+        REQUIRE(stereo.isLinearPhase());
+        REQUIRE_FALSE(stereo.isSwitching());
+    }
+}
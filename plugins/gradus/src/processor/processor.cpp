@@ -16,6 +16,7 @@
 #include "pluginterfaces/vst/ivstparameterchanges.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 
@@ -25,6 +26,13 @@ using namespace Krate::DSP;
 
 namespace Gradus {
 
+namespace {
+
+/// Host PPQ drift (rounding, tempo ramps) below this is not a relocation
+constexpr double kTransportJumpBeats = 0.01;
+
+}  // namespace
+
 Processor::Processor()
 {
     setControllerClass(kControllerUID);
@@ -149,17 +157,6 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
             hostSupportsTransport_ = true;
         }
 
-        // Detect transport start/loop
-        if (hasMusicalPos) {
-            if (isPlaying && ctx.projectTimeMusic < prevProjectTimeMusic_) {
-                arpCore_.notifyTransportLoop();
-            }
-            if (isPlaying) {
-                arpCore_.syncToMusicalPosition(ctx.projectTimeMusic);
-            }
-            prevProjectTimeMusic_ = ctx.projectTimeMusic;
-        }
-
         // Restart the pattern on the rising transport-play edge -- but ONLY in
         // Sequencer mode. The sequencer is transport-gated, so it is silent
         // while stopped and a reset here is a clean pattern restart.
@@ -174,6 +171,28 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
             arpCore_.reset();  // Also resets midiDelayLane_ inside
             midiDelay_.reset();
         }
+
+        // Seek the arp whenever the host position is not where the last
+        // block ended: loop wraps, scrubs in either direction, and the first
+        // block after Play (which may start mid-song, as offline bounces from
+        // a marker do). Lanes and random state then match a straight
+        // playthrough of the song; seekTo() releases whatever was sounding.
+        if (hasMusicalPos && isPlaying) {
+            const double tempo = ctx.tempo > 0 ? ctx.tempo : 120.0;
+            if (expectedProjectTimeMusic_ < 0.0 ||
+                std::abs(ctx.projectTimeMusic - expectedProjectTimeMusic_) >
+                    kTransportJumpBeats) {
+                BlockContext seekCtx{};
+                seekCtx.sampleRate = sampleRate_;
+                seekCtx.tempoBPM = tempo;
+                arpCore_.seekTo(ctx.projectTimeMusic, seekCtx);
+            }
+            arpCore_.syncToMusicalPosition(ctx.projectTimeMusic);
+            expectedProjectTimeMusic_ = ctx.projectTimeMusic +
+                static_cast<double>(data.numSamples) * tempo / (60.0 * sampleRate_);
+        } else {
+            expectedProjectTimeMusic_ = -1.0;
+        }
         wasTransportPlaying_ = isPlaying;
     }
 
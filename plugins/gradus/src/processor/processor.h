@@ -84,7 +84,7 @@ private:
     // Transport state
     bool wasTransportPlaying_{false};
     bool hostSupportsTransport_{false};
-    double prevProjectTimeMusic_{-1.0};
+    double expectedProjectTimeMusic_{-1.0};  // PPQ the next block should start at; < 0 = unknown
 
     // Audition voice
     AuditionVoice auditionVoice_;
@@ -0,0 +1,219 @@
+// ==============================================================================
+// Host relocations seek the arp to the new pattern phase
+// ==============================================================================
+// On a backward PPQ jump (DAW loop wrap) the processor used to call
+// arpCore_.notifyTransportLoop(), which restarts the pattern at step 0 on
+// every pass. It now calls arpCore_.seekTo() whenever the reported PPQ is not
+// where the last block ended -- loop wraps, forward scrubs, and the first
+// block after Play -- so playback resumes at the step a straight run of the
+// song plays there.
+// ==============================================================================
+
+#include "processor/processor.h"
+#include "plugin_ids.h"
+
+#include "pluginterfaces/vst/ivstevents.h"
+#include "pluginterfaces/vst/ivstparameterchanges.h"
+#include "pluginterfaces/vst/ivstprocesscontext.h"
+
+#include <krate/dsp/core/note_value.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "vst_param_changes.h"
+#include "vst_event_list.h"
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+using namespace Gradus;
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+constexpr int32  kBlockSize  = 512;
+constexpr double kTempo      = 120.0;
+constexpr double kBeatsPerBlock = kBlockSize * kTempo / (60.0 * kSampleRate);
+
+/// Drives a Gradus::Processor with a playing transport and a musical position.
+struct LoopHarness {
+    std::unique_ptr<Gradus::Processor> proc;
+
+    std::vector<float> outL;
+    std::vector<float> outR;
+    float* channels[2]{};
+    AudioBusBuffers outputBus{};
+
+    Krate::Test::EventList inEvents;
+    Krate::Test::EventList outEvents;
+    Krate::Test::ParameterChanges noParams;
+
+    ProcessContext ctx{};
+    ProcessData data{};
+
+    LoopHarness()
+    {
+        proc = std::make_unique<Gradus::Processor>();
+        proc->initialize(nullptr);
+
+        ProcessSetup setup{};
+        setup.processMode = kRealtime;
+        setup.symbolicSampleSize = kSample32;
+        setup.sampleRate = kSampleRate;
+        setup.maxSamplesPerBlock = kBlockSize;
+        proc->setupProcessing(setup);
+        proc->setActive(true);
+
+        outL.assign(static_cast<size_t>(kBlockSize), 0.0f);
+        outR.assign(static_cast<size_t>(kBlockSize), 0.0f);
+        channels[0] = outL.data();
+        channels[1] = outR.data();
+        outputBus.numChannels = 2;
+        outputBus.channelBuffers32 = channels;
+
+        ctx.state = ProcessContext::kPlaying | ProcessContext::kTempoValid
+                  | ProcessContext::kTimeSigValid | ProcessContext::kProjectTimeMusicValid;
+        ctx.tempo = kTempo;
+        ctx.timeSigNumerator = 4;
+        ctx.timeSigDenominator = 4;
+        ctx.sampleRate = kSampleRate;
+        ctx.projectTimeMusic = 0.0;
+        ctx.projectTimeSamples = 0;
+
+        data.processMode = kRealtime;
+        data.symbolicSampleSize = kSample32;
+        data.numSamples = kBlockSize;
+        data.numInputs = 0;
+        data.inputs = nullptr;
+        data.numOutputs = 1;
+        data.outputs = &outputBus;
+        data.outputParameterChanges = nullptr;
+        data.inputEvents = &inEvents;
+        data.outputEvents = &outEvents;
+        data.processContext = &ctx;
+    }
+
+    ~LoopHarness()
+    {
+        proc->setActive(false);
+        proc->terminate();
+    }
+
+    void noteOn(int16 pitch)
+    {
+        Event e{};
+        e.type = Event::kNoteOnEvent;
+        e.sampleOffset = 0;
+        e.noteOn.channel = 0;
+        e.noteOn.pitch = pitch;
+        e.noteOn.velocity = 100.0f / 127.0f;
+        e.noteOn.noteId = -1;
+        inEvents.addEvent(e);
+    }
+
+    /// Run one block at the current position; returns its NoteOn pitches in order.
+    std::vector<int16> runBlock(IParameterChanges* params = nullptr)
+    {
+        outEvents.clear();
+        data.inputParameterChanges = params ? params : &noParams;
+        proc->process(data);
+        inEvents.clear();
+
+        std::vector<int16> noteOns;
+        const int32 count = outEvents.getEventCount();
+        for (int32 i = 0; i < count; ++i) {
+            Event e{};
+            if (outEvents.getEvent(i, e) == kResultTrue && e.type == Event::kNoteOnEvent) {
+                noteOns.push_back(e.noteOn.pitch);
+            }
+        }
+        ctx.projectTimeSamples += kBlockSize;
+        ctx.projectTimeMusic += kBeatsPerBlock;
+        return noteOns;
+    }
+
+    /// Relocate the transport, as a host does on a loop wrap or a scrub
+    void wrapTo(double ppq)
+    {
+        ctx.projectTimeMusic = ppq;
+        ctx.projectTimeSamples = static_cast<TSamples>(ppq * 60.0 / kTempo * kSampleRate);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Transport loop wrap seeks the arp to the loop start",
+          "[processor][gradus][transport][loop]")
+{
+    LoopHarness h;
+
+    // Live mode (default), Up (default), tempo-synced quarter notes: step n
+    // starts on beat n and plays chord note n % 3.
+    Krate::Test::ParameterChanges setupParams;
+    setupParams.add(kArpTempoSyncId, 1.0);
+    setupParams.add(kArpNoteValueId, 13.0 / (Krate::DSP::kNoteValueDropdownCount - 1));
+    h.noteOn(60);
+    h.noteOn(64);
+    h.noteOn(67);
+    (void)h.runBlock(&setupParams);
+
+    // Loop beats 5..8.5. Beat 5 is step 5: 67, where a pattern restart
+    // (the old notifyTransportLoop() behaviour) would play step 0's 60.
+    constexpr double kLoopStart = 5.0;
+    constexpr double kLoopEnd = 8.5;
+    for (int pass = 0; pass < 3; ++pass) {
+        INFO("pass " << pass);
+        while (h.ctx.projectTimeMusic + kBeatsPerBlock <= kLoopEnd) {
+            (void)h.runBlock();
+        }
+        h.wrapTo(kLoopStart);
+        const auto noteOns = h.runBlock();
+        REQUIRE_FALSE(noteOns.empty());
+        REQUIRE(noteOns.front() == 67);
+    }
+}
+
+TEST_CASE("Forward scrub seeks the arp to the new position",
+          "[processor][gradus][transport][loop]")
+{
+    LoopHarness h;
+
+    Krate::Test::ParameterChanges setupParams;
+    setupParams.add(kArpTempoSyncId, 1.0);
+    setupParams.add(kArpNoteValueId, 13.0 / (Krate::DSP::kNoteValueDropdownCount - 1));
+    h.noteOn(60);
+    h.noteOn(64);
+    h.noteOn(67);
+    (void)h.runBlock(&setupParams);
+
+    // Steps 0..2 play; then jump ahead to beat 10. Carrying on from where the
+    // arp was would play step 3 (60); beat 10 is step 10: 64.
+    while (h.ctx.projectTimeMusic + kBeatsPerBlock <= 2.5) {
+        (void)h.runBlock();
+    }
+    h.wrapTo(10.0);
+    const auto noteOns = h.runBlock();
+    REQUIRE_FALSE(noteOns.empty());
+    REQUIRE(noteOns.front() == 64);
+}
+
+TEST_CASE("Transport start mid-song seeks the arp to that position",
+          "[processor][gradus][transport][loop]")
+{
+    // An offline bounce (or Play) from beat 7: the first block is step 7 of
+    // the pattern (64), not step 0 (60).
+    LoopHarness h;
+    h.wrapTo(7.0);
+
+    Krate::Test::ParameterChanges setupParams;
+    setupParams.add(kArpTempoSyncId, 1.0);
+    setupParams.add(kArpNoteValueId, 13.0 / (Krate::DSP::kNoteValueDropdownCount - 1));
+    h.noteOn(60);
+    h.noteOn(64);
+    h.noteOn(67);
+    const auto noteOns = h.runBlock(&setupParams);
+    REQUIRE_FALSE(noteOns.empty());
+    REQUIRE(noteOns.front() == 64);
+}
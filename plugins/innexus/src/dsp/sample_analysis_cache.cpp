@@ -0,0 +1,305 @@
+// ==============================================================================
+// Innexus - Sample Analysis Cache Implementation
+// ==============================================================================
+// Entry layout (native endianness, which the settings hash records):
+//   EntryHeader
+//   HarmonicFrame[frameCount]
+//   ResidualFrame[residualFrameCount]
+//
+// All three are trivially copyable, so frames are written and read in single
+// bulk transfers straight into the SampleAnalysis vectors.
+//
+// Eviction is least-recently-used by file modification time: load() touches
+// the entries it serves and store() prunes the oldest beyond the size cap.
+// ==============================================================================
+
+#include "sample_analysis_cache.h"
+#include "dual_stft_config.h"
+
+#include "platform/preset_paths.h"
+
+#include <krate/dsp/processors/harmonic_types.h>
+#include <krate/dsp/processors/residual_types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Innexus {
+
+namespace {
+
+constexpr std::array<char, 4> kMagic{'I', 'X', 'A', 'C'};
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+struct EntryHeader {
+    std::array<char, 4> magic;
+    uint32_t formatVersion;
+    uint64_t settingsHash;
+    uint64_t contentHash;
+    float sampleRate;
+    float hopTimeSec;
+    uint64_t analysisFFTSize;
+    uint64_t analysisHopSize;
+    uint64_t frameCount;
+    uint64_t residualFrameCount;
+    DetectedADSR detectedADSR;
+};
+
+static_assert(std::is_trivially_copyable_v<EntryHeader>);
+static_assert(std::is_trivially_copyable_v<Krate::DSP::HarmonicFrame>);
+static_assert(std::is_trivially_copyable_v<Krate::DSP::ResidualFrame>);
+
+uint64_t fnv1a(uint64_t hash, const void* data, size_t numBytes) noexcept
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < numBytes; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t fnv1a(uint64_t hash, const T& value) noexcept
+{
+    return fnv1a(hash, &value, sizeof(T));
+}
+
+} // anonymous namespace
+
+// ==============================================================================
+// Keys
+// ==============================================================================
+std::filesystem::path SampleAnalysisCache::defaultDirectory()
+{
+    auto settingsDir = Krate::Plugins::Platform::getAppSettingsDirectory("Innexus");
+    if (settingsDir.empty()) {
+        return {};
+    }
+    return settingsDir / "AnalysisCache";
+}
+
+uint64_t SampleAnalysisCache::contentHash(const float* samples, size_t numSamples,
+                                          float sampleRate) noexcept
+{
+    uint64_t hash = fnv1a(kFnvOffsetBasis, sampleRate);
+    hash = fnv1a(hash, static_cast<uint64_t>(numSamples));
+    if (samples != nullptr) {
+        hash = fnv1a(hash, samples, numSamples * sizeof(float));
+    }
+    return hash;
+}
+
+uint64_t SampleAnalysisCache::settingsHash() noexcept
+{
+    uint64_t hash = fnv1a(kFnvOffsetBasis, kAnalysisVersion);
+    hash = fnv1a(hash, std::endian::native == std::endian::little);
+    for (const auto& config : {kShortWindowConfig, kLongWindowConfig}) {
+        hash = fnv1a(hash, static_cast<uint64_t>(config.fftSize));
+        hash = fnv1a(hash, static_cast<uint64_t>(config.hopSize));
+        hash = fnv1a(hash, static_cast<uint32_t>(config.windowType));
+    }
+    hash = fnv1a(hash, static_cast<uint64_t>(kHighPrecisionYinWindowSize));
+    hash = fnv1a(hash, static_cast<uint64_t>(Krate::DSP::kMaxPartials));
+    hash = fnv1a(hash, static_cast<uint64_t>(Krate::DSP::kResidualBands));
+    hash = fnv1a(hash, static_cast<uint64_t>(sizeof(Krate::DSP::HarmonicFrame)));
+    hash = fnv1a(hash, static_cast<uint64_t>(sizeof(Krate::DSP::ResidualFrame)));
+    hash = fnv1a(hash, static_cast<uint64_t>(sizeof(DetectedADSR)));
+    return hash;
+}
+
+std::filesystem::path SampleAnalysisCache::entryPath(uint64_t contentHash) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.ixa",
+                  static_cast<unsigned long long>(contentHash));
+    return directory_ / name;
+}
+
+// ==============================================================================
+// Load
+// ==============================================================================
+std::unique_ptr<SampleAnalysis> SampleAnalysisCache::load(uint64_t contentHash) const
+{
+    if (!isEnabled()) {
+        return nullptr;
+    }
+
+    const auto path = entryPath(contentHash);
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec || fileSize < sizeof(EntryHeader)) {
+        return nullptr;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+
+    EntryHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != kMagic || header.formatVersion != kFormatVersion
+        || header.settingsHash != settingsHash() || header.contentHash != contentHash) {
+        return nullptr;
+    }
+
+    // Reject truncated or padded entries before allocating from the counts.
+    // Bound each count by what the file could hold first, so a damaged count
+    // can neither overflow the size sum nor request a huge allocation.
+    const uint64_t payloadSize = fileSize - sizeof(EntryHeader);
+    if (header.frameCount > payloadSize / sizeof(Krate::DSP::HarmonicFrame)
+        || header.residualFrameCount > payloadSize / sizeof(Krate::DSP::ResidualFrame)) {
+        return nullptr;
+    }
+    const uint64_t expectedSize = header.frameCount * sizeof(Krate::DSP::HarmonicFrame)
+        + header.residualFrameCount * sizeof(Krate::DSP::ResidualFrame);
+    if (payloadSize != expectedSize) {
+        return nullptr;
+    }
+
+    auto analysis = std::make_unique<SampleAnalysis>();
+    analysis->sampleRate = header.sampleRate;
+    analysis->hopTimeSec = header.hopTimeSec;
+    analysis->analysisFFTSize = static_cast<size_t>(header.analysisFFTSize);
+    analysis->analysisHopSize = static_cast<size_t>(header.analysisHopSize);
+    analysis->detectedADSR = header.detectedADSR;
+    analysis->frames.resize(static_cast<size_t>(header.frameCount));
+    analysis->residualFrames.resize(static_cast<size_t>(header.residualFrameCount));
+    analysis->totalFrames = analysis->frames.size();
+
+    file.read(reinterpret_cast<char*>(analysis->frames.data()),
+              static_cast<std::streamsize>(analysis->frames.size()
+                                           * sizeof(Krate::DSP::HarmonicFrame)));
+    file.read(reinterpret_cast<char*>(analysis->residualFrames.data()),
+              static_cast<std::streamsize>(analysis->residualFrames.size()
+                                           * sizeof(Krate::DSP::ResidualFrame)));
+    if (!file) {
+        return nullptr;
+    }
+    file.close();
+
+    // Mark the entry recently used for prune()
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+    return analysis;
+}
+
+// ==============================================================================
+// Store
+// ==============================================================================
+bool SampleAnalysisCache::store(uint64_t contentHash, const SampleAnalysis& analysis) const
+{
+    if (!isEnabled() || !Krate::Plugins::Platform::ensureDirectoryExists(directory_)) {
+        return false;
+    }
+
+    EntryHeader header{};
+    header.magic = kMagic;
+    header.formatVersion = kFormatVersion;
+    header.settingsHash = settingsHash();
+    header.contentHash = contentHash;
+    header.sampleRate = analysis.sampleRate;
+    header.hopTimeSec = analysis.hopTimeSec;
+    header.analysisFFTSize = analysis.analysisFFTSize;
+    header.analysisHopSize = analysis.analysisHopSize;
+    header.frameCount = analysis.frames.size();
+    header.residualFrameCount = analysis.residualFrames.size();
+    header.detectedADSR = analysis.detectedADSR;
+
+    // Write under a per-thread temporary name, then rename into place: other
+    // instances analysing the same sample never read a partial entry
+    const auto path = entryPath(contentHash);
+    auto tempPath = path;
+    tempPath += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+        + ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(analysis.frames.data()),
+                   static_cast<std::streamsize>(analysis.frames.size()
+                                                * sizeof(Krate::DSP::HarmonicFrame)));
+        file.write(reinterpret_cast<const char*>(analysis.residualFrames.data()),
+                   static_cast<std::streamsize>(analysis.residualFrames.size()
+                                                * sizeof(Krate::DSP::ResidualFrame)));
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+
+    prune(path);
+    return true;
+}
+
+// ==============================================================================
+// Prune
+// ==============================================================================
+void SampleAnalysisCache::prune(const std::filesystem::path& keep) const
+{
+    struct Entry {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type lastUsed;
+    };
+
+    std::vector<Entry> entries;
+    std::uintmax_t totalSize = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(directory_, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        if (it->path().extension() != ".ixa") {
+            continue;
+        }
+        std::error_code entryEc;
+        const auto size = it->file_size(entryEc);
+        const auto lastUsed = it->last_write_time(entryEc);
+        if (entryEc) {
+            continue;  // removed by another instance meanwhile
+        }
+        totalSize += size;
+        entries.push_back({it->path(), size, lastUsed});
+    }
+    if (totalSize <= maxBytes_) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.lastUsed < b.lastUsed; });
+    for (const auto& entry : entries) {
+        if (totalSize <= maxBytes_) {
+            break;
+        }
+        if (entry.path == keep) {
+            continue;
+        }
+        std::error_code removeEc;
+        if (std::filesystem::remove(entry.path, removeEc) || !removeEc) {
+            totalSize -= entry.size;
+        }
+    }
+}
+
+} // namespace Innexus
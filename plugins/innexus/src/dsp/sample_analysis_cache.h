@@ -0,0 +1,101 @@
+#pragma once
+
+// ==============================================================================
+// Innexus - Sample Analysis Cache
+// ==============================================================================
+// Persists completed SampleAnalysis results on disk, keyed by a hash of the
+// decoded audio, so reloading a project does not re-run the full analysis
+// pipeline for every sample.
+//
+// One file per sample content (<hash>.ixa). Each entry records the cache
+// format version and a fingerprint of the analysis settings; an entry written
+// with different settings is treated as a miss and overwritten by the next
+// store(). Entries are written to a temporary file and renamed into place, so
+// concurrent readers only ever see complete entries.
+//
+// The directory is capped at getMaxBytes(): after each store() the least
+// recently used entries are deleted until it fits. load() refreshes an entry's
+// modification time, so mtime order is least-recently-used order.
+//
+// Constitution Compliance:
+// - Principle II: Background thread only (file I/O never on the audio thread)
+// - Principle VI: Cross-platform (std::filesystem + std::fstream)
+// ==============================================================================
+
+#include "sample_analysis.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace Innexus {
+
+/// @brief On-disk cache of SampleAnalysis results keyed by audio content.
+///
+/// Usage (analysis thread):
+///   const auto key = SampleAnalysisCache::contentHash(audio, n, sampleRate);
+///   if (auto cached = cache.load(key)) { ... }      // hit
+///   else { ...analyze...; cache.store(key, *analysis); }
+class SampleAnalysisCache {
+public:
+    /// Binary layout version of a cache entry. Bump when the header or the
+    /// frame serialization changes.
+    static constexpr uint32_t kFormatVersion = 1;
+
+    /// Version of the analysis algorithm. Bump whenever SampleAnalyzer would
+    /// produce different frames for the same audio, so stale entries miss.
+    static constexpr uint32_t kAnalysisVersion = 1;
+
+    /// Default size cap of the cache directory.
+    static constexpr std::uintmax_t kDefaultMaxBytes = 256ull * 1024 * 1024;
+
+    SampleAnalysisCache() = default;
+    explicit SampleAnalysisCache(std::filesystem::path directory)
+        : directory_(std::move(directory)) {}
+
+    /// @brief Set the cache directory. An empty path disables the cache.
+    void setDirectory(std::filesystem::path directory) { directory_ = std::move(directory); }
+
+    [[nodiscard]] const std::filesystem::path& getDirectory() const noexcept { return directory_; }
+    [[nodiscard]] bool isEnabled() const noexcept { return !directory_.empty(); }
+
+    /// @brief Set the total size the cache entries may occupy on disk.
+    void setMaxBytes(std::uintmax_t maxBytes) noexcept { maxBytes_ = maxBytes; }
+    [[nodiscard]] std::uintmax_t getMaxBytes() const noexcept { return maxBytes_; }
+
+    /// @brief Default per-user cache location (app settings dir / AnalysisCache).
+    /// @return Empty path if the platform directory cannot be determined
+    [[nodiscard]] static std::filesystem::path defaultDirectory();
+
+    /// @brief Hash of the decoded mono audio and its sample rate (FNV-1a, 64-bit).
+    [[nodiscard]] static uint64_t contentHash(const float* samples, size_t numSamples,
+                                              float sampleRate) noexcept;
+
+    /// @brief Fingerprint of everything besides the audio that shapes the
+    /// analysis: algorithm version, STFT/YIN configuration and frame layout.
+    [[nodiscard]] static uint64_t settingsHash() noexcept;
+
+    /// @brief Path of the entry for a content hash.
+    [[nodiscard]] std::filesystem::path entryPath(uint64_t contentHash) const;
+
+    /// @brief Load the entry for a content hash, marking it recently used.
+    /// @return The cached analysis (filePath left empty), or nullptr on a miss,
+    ///         a version/settings mismatch or a truncated or damaged entry
+    [[nodiscard]] std::unique_ptr<SampleAnalysis> load(uint64_t contentHash) const;
+
+    /// @brief Write (or replace) the entry for a content hash, then prune the
+    /// least recently used entries beyond getMaxBytes().
+    /// @return true if the entry was written
+    bool store(uint64_t contentHash, const SampleAnalysis& analysis) const;
+
+private:
+    /// Delete the oldest entries (by mtime) until the total fits maxBytes_.
+    /// The entry at @p keep is never deleted.
+    void prune(const std::filesystem::path& keep) const;
+
+    std::filesystem::path directory_;
+    std::uintmax_t maxBytes_ = kDefaultMaxBytes;
+};
+
+} // namespace Innexus
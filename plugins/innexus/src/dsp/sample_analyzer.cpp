@@ -15,6 +15,9 @@
 //   6. PartialTracker (peak detection + harmonic sieve + tracking)
 //   7. HarmonicModelBuilder (smoothing, L2 norm, centroid, noisiness)
 //
+// Steps 3-7 are skipped when the SampleAnalysisCache holds an entry for the
+// decoded audio; fresh results are stored there before publication.
+//
 // Reference: spec.md FR-043 to FR-047, FR-058
 // ==============================================================================
 
@@ -147,6 +150,14 @@ void SampleAnalyzer::cancel()
     cancelled_.store(true, std::memory_order_release);
 }
 
+// ==============================================================================
+// Set Cache Directory
+// ==============================================================================
+void SampleAnalyzer::setCacheDirectory(std::filesystem::path directory)
+{
+    cache_.setDirectory(std::move(directory));
+}
+
 // ==============================================================================
 // Join Thread
 // ==============================================================================
@@ -172,6 +183,20 @@ void SampleAnalyzer::analyzeOnThread(
         return;
     }
 
+    // --- Analysis cache lookup ---
+    // Keyed by the decoded audio, so a renamed or moved file still hits
+    const uint64_t cacheKey = cache_.isEnabled()
+        ? SampleAnalysisCache::contentHash(audioData.data(), totalSamples, sampleRate)
+        : 0;
+    if (cache_.isEnabled()) {
+        if (auto cached = cache_.load(cacheKey)) {
+            cached->filePath = std::move(filePath);
+            result_ = std::move(cached);
+            complete_.store(true, std::memory_order_release);
+            return;
+        }
+    }
+
     // --- Initialize pipeline components (FR-045: same code path) ---
 
     // Pre-processing (FR-005 to FR-009)
@@ -637,6 +662,12 @@ void SampleAnalyzer::analyzeOnThread(
             analysis->frames, analysis->hopTimeSec);
     }
 
+    // Store before publishing: once published the result belongs to the
+    // audio thread. A failed write only costs the next load a re-analysis.
+    if (cache_.isEnabled()) {
+        cache_.store(cacheKey, *analysis);
+    }
+
     // Publish result
     result_ = std::move(analysis);
     complete_.store(true, std::memory_order_release);
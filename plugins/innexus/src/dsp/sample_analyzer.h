@@ -10,6 +10,10 @@
 // The completed SampleAnalysis is transferred to the audio thread via
 // std::atomic<SampleAnalysis*> with release/acquire semantics (FR-058).
 //
+// With a cache directory set, results are looked up in and written to a
+// SampleAnalysisCache keyed by the decoded audio, so reloading a project
+// skips the pipeline for samples that were analysed before.
+//
 // Constitution Compliance:
 // - Principle II: Background thread only, never blocks audio thread (FR-044)
 // - Principle III: Modern C++ (std::thread, std::atomic, std::unique_ptr)
@@ -19,10 +23,12 @@
 // ==============================================================================
 
 #include "sample_analysis.h"
+#include "sample_analysis_cache.h"
 
 #include <krate/dsp/processors/residual_analyzer.h>
 
 #include <atomic>
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <thread>
@@ -65,6 +71,15 @@ public:
     /// @brief Cancel ongoing analysis without crash.
     void cancel();
 
+    /// @brief Enable the on-disk analysis cache in `directory` (empty disables).
+    /// @note Not thread-safe against a running analysis; call before startAnalysis().
+    void setCacheDirectory(std::filesystem::path directory);
+
+    [[nodiscard]] const std::filesystem::path& getCacheDirectory() const noexcept
+    {
+        return cache_.getDirectory();
+    }
+
 private:
     /// @brief Run the full analysis pipeline on the background thread (FR-045).
     /// @param audioData Loaded audio samples (mono, float32)
@@ -80,6 +95,7 @@ private:
     std::atomic<bool> complete_{false};
     std::atomic<bool> cancelled_{false};
     std::unique_ptr<SampleAnalysis> result_;
+    SampleAnalysisCache cache_; ///< Disabled until setCacheDirectory()
 };
 
 } // namespace Innexus
@@ -79,6 +79,9 @@ Steinberg::tresult PLUGIN_API Processor::initialize(Steinberg::FUnknown* context
     // Spec 124 FR-012: Explicitly set hard retrigger mode for ADSR envelope
     voice_.adsr.setRetriggerMode(Krate::DSP::RetriggerMode::Hard);
 
+    // Reuse earlier analyses of the same audio across sessions and instances
+    sampleAnalyzer_.setCacheDirectory(SampleAnalysisCache::defaultDirectory());
+
     // Sidechain audio input (FR-001: auxiliary stereo bus, NOT default-active)
     // Must be inactive by default so AU wrapper can initialize without inputs.
     // Host activates this bus when user routes audio to the sidechain.
@@ -1892,64 +1895,88 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
             manualFreezeRecoverySamplesRemaining_--;
         }
 
-        // --- Spec 132: Sympathetic resonance (post-voice-sum, pre-master-gain) ---
-        {
-            float monoSum = (sampleL + sampleR) * 0.5f;
-            float sympatheticOut = sympatheticResonance_.process(monoSum);
-            sampleL += sympatheticOut;
-            sampleR += sympatheticOut;
+        // --- Pre-resonance mix ---
+        // Sympathetic resonance, master gain and the safety limiter run as a
+        // second pass over the block (below). Stereo keeps L/R; mono keeps
+        // L+R, the sum the mono limiter sees.
+        if (numOutputChannels >= 2) {
+            out[0][s] = sampleL;
+            out[1][s] = sampleR;
+        } else {
+            out[0][s] = sampleL + sampleR;
         }
+    }
 
-        // --- Master gain ---
-        sampleL *= gain;
-        sampleR *= gain;
-
-        // --- Safety soft limiter (always on, no UI control) ---
-        // Prevents output from exceeding [-1, 1] to protect speakers.
-        // Only engages above ±kKnee to stay transparent at normal levels.
-        // tanh at signal levels below the knee adds measurable intermodulation
-        // noise between harmonics (~5 dB SNR degradation at RMS 0.5).
+    // --- Spec 132: Sympathetic resonance (post-voice-sum, pre-master-gain) ---
+    // Runs a chunk at a time so the resonator bank uses its block kernel
+    // instead of one SIMD pass per sample. Followed by master gain and the
+    // safety soft limiter (always on, no UI control), which prevents output
+    // from exceeding [-1, 1] to protect speakers. It only engages above
+    // ±kKnee to stay transparent at normal levels: tanh at signal levels
+    // below the knee adds measurable intermodulation noise between harmonics
+    // (~5 dB SNR degradation at RMS 0.5).
+    {
+        // WI-17: final non-finite guard (defense in depth). std::clamp and the
+        // soft limiter both pass NaN straight through, so a single pathological
+        // sample (corrupt WAV, degenerate analysis) would otherwise reach the
+        // host. Uses a bit test because -ffast-math makes std::isfinite()
+        // unreliable on some CI toolchains.
+        auto sanitize = [](float x) noexcept -> float {
+            std::uint32_t b = 0;
+            std::memcpy(&b, &x, sizeof(b));
+            return ((b & 0x7F800000u) == 0x7F800000u) ? 0.0f : x; // Inf/NaN -> 0
+        };
+        auto softLimit = [&sanitize](float x) noexcept -> float {
+            x = sanitize(x);
+            constexpr float k = 0.85f;
+            float ax = std::abs(x);
+            if (ax <= k) return x;
+            // Cubic soft-clip: maps [knee, inf) to [knee, 1) smoothly
+            float excess = ax - k;
+            float limited = k + (1.0f - k) * Krate::DSP::Sigmoid::tanh(
+                excess / (1.0f - k));
+            return (x >= 0.0f) ? limited : -limited;
+        };
+        std::array<float, 256> sympathetic;
+        const auto total = static_cast<size_t>(numSamples);
+        for (size_t offset = 0; offset < total; offset += sympathetic.size())
         {
-            // WI-17: final non-finite guard (defense in depth). std::clamp and the
-            // soft limiter both pass NaN straight through, so a single pathological
-            // sample (corrupt WAV, degenerate analysis) would otherwise reach the
-            // host. Uses a bit test because -ffast-math makes std::isfinite()
-            // unreliable on some CI toolchains.
-            auto sanitize = [](float x) noexcept -> float {
-                std::uint32_t b = 0;
-                std::memcpy(&b, &x, sizeof(b));
-                return ((b & 0x7F800000u) == 0x7F800000u) ? 0.0f : x; // Inf/NaN -> 0
-            };
-            auto softLimit = [&sanitize](float x) noexcept -> float {
-                x = sanitize(x);
-                constexpr float k = 0.85f;
-                float ax = std::abs(x);
-                if (ax <= k) return x;
-                // Cubic soft-clip: maps [knee, inf) to [knee, 1) smoothly
-                float excess = ax - k;
-                float limited = k + (1.0f - k) * Krate::DSP::Sigmoid::tanh(
-                    excess / (1.0f - k));
-                return (x >= 0.0f) ? limited : -limited;
-            };
-            // Write stereo output (M6: FR-007), or sum to mono (FR-013).
-            // QS-16: the mono bus must limit the SUM once. Limiting L and R
-            // independently and then adding lets two sub-1.0 samples reach ~2.0,
-            // defeating the safety limiter on the mono output.
-            if (numOutputChannels >= 2) {
-                sampleL = softLimit(sampleL);
-                sampleR = softLimit(sampleR);
-                out[0][s] = sampleL;
-                out[1][s] = sampleR;
-            } else {
-                const float mono = softLimit(sampleL + sampleR);
-                sampleL = mono;
-                sampleR = mono;
-                out[0][s] = mono;
+            const size_t n = std::min(sympathetic.size(), total - offset);
+            float* outL = out[0] + offset;
+            float* outR = numOutputChannels >= 2 ? out[1] + offset : nullptr;
+
+            // Mono voice sum, (L + R) / 2 on both layouts
+            for (size_t i = 0; i < n; ++i)
+                sympathetic[i] = (outR ? outL[i] + outR[i] : outL[i]) * 0.5f;
+            sympatheticResonance_.processBlock(
+                sympathetic.data(), sympathetic.data(), n);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                float sampleL = 0.0f;
+                float sampleR = 0.0f;
+                // Write stereo output (M6: FR-007), or sum to mono (FR-013).
+                // QS-16: the mono bus must limit the SUM once. Limiting L and R
+                // independently and then adding lets two sub-1.0 samples reach
+                // ~2.0, defeating the safety limiter on the mono output.
+                if (outR) {
+                    sampleL = softLimit((outL[i] + sympathetic[i]) * gain);
+                    sampleR = softLimit((outR[i] + sympathetic[i]) * gain);
+                    outL[i] = sampleL;
+                    outR[i] = sampleR;
+                } else {
+                    // (L + sym) * gain + (R + sym) * gain, limited once
+                    const float mono =
+                        softLimit((outL[i] + 2.0f * sympathetic[i]) * gain);
+                    sampleL = mono;
+                    sampleR = mono;
+                    outL[i] = mono;
+                }
+
+                if (sampleL != 0.0f || sampleR != 0.0f)
+                    hasSoundOutput = true;
             }
         }
-
-        if (sampleL != 0.0f || sampleR != 0.0f)
-            hasSoundOutput = true;
     }
 
     // Spec B FR-002, FR-006, FR-014: Capture mono output into feedback buffer
@@ -0,0 +1,282 @@
+// ==============================================================================
+// Sample Analysis Cache Tests
+// ==============================================================================
+// Entries round-trip a SampleAnalysis exactly, stale or damaged entries miss,
+// the directory is pruned least-recently-used first, and SampleAnalyzer serves
+// a second load of the same audio from the cache.
+// ==============================================================================
+
+#include "dsp/sample_analysis.h"
+#include "dsp/sample_analysis_cache.h"
+#include "dsp/sample_analyzer.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Fresh cache directory under the temp dir, removed on scope exit
+struct TempCacheDir {
+    std::filesystem::path path;
+    explicit TempCacheDir(const std::string& name)
+        : path(std::filesystem::temp_directory_path() / name)
+    {
+        std::filesystem::remove_all(path);
+    }
+    ~TempCacheDir() { std::filesystem::remove_all(path); }
+};
+
+Innexus::SampleAnalysis makeAnalysis(size_t numFrames)
+{
+    Innexus::SampleAnalysis analysis;
+    analysis.sampleRate = 48000.0f;
+    analysis.hopTimeSec = 512.0f / 48000.0f;
+    analysis.analysisFFTSize = 1024;
+    analysis.analysisHopSize = 512;
+    analysis.detectedADSR.attackMs = 12.5f;
+    analysis.detectedADSR.sustainStartFrame = 3;
+    analysis.detectedADSR.sustainEndFrame = 7;
+    for (size_t i = 0; i < numFrames; ++i) {
+        Krate::DSP::HarmonicFrame frame{};
+        frame.f0 = 110.0f + static_cast<float>(i);
+        frame.numPartials = 2;
+        frame.partials[1].harmonicIndex = 2;
+        frame.partials[1].amplitude = 0.25f * static_cast<float>(i);
+        analysis.frames.push_back(frame);
+
+        Krate::DSP::ResidualFrame residual{};
+        residual.bandEnergies[4] = 0.01f * static_cast<float>(i);
+        residual.transientFlag = (i == 0);
+        analysis.residualFrames.push_back(residual);
+    }
+    analysis.totalFrames = analysis.frames.size();
+    return analysis;
+}
+
+std::string writeSineWav(const std::string& filename, float frequency, float durationSec)
+{
+    constexpr uint32_t kSampleRate = 44100;
+    const auto numFrames = static_cast<uint32_t>(kSampleRate * durationSec);
+    std::vector<float> samples(numFrames);
+    for (uint32_t i = 0; i < numFrames; ++i) {
+        samples[i] = 0.8f * std::sin(6.283185307179586f * frequency
+                                     * static_cast<float>(i) / kSampleRate);
+    }
+
+    const auto path = (std::filesystem::temp_directory_path() / filename).string();
+    std::ofstream file(path, std::ios::binary);
+    const auto write32 = [&file](uint32_t v) { file.write(reinterpret_cast<const char*>(&v), 4); };
+    const auto write16 = [&file](uint16_t v) { file.write(reinterpret_cast<const char*>(&v), 2); };
+    const uint32_t dataSize = numFrames * 4;
+    file.write("RIFF", 4);
+    write32(36 + dataSize);
+    file.write("WAVEfmt ", 8);
+    write32(16);
+    write16(3); // IEEE float
+    write16(1);
+    write32(kSampleRate);
+    write32(kSampleRate * 4);
+    write16(4);
+    write16(32);
+    file.write("data", 4);
+    write32(dataSize);
+    file.write(reinterpret_cast<const char*>(samples.data()), dataSize);
+    return path;
+}
+
+std::unique_ptr<Innexus::SampleAnalysis> analyze(Innexus::SampleAnalyzer& analyzer,
+                                                 const std::string& path)
+{
+    analyzer.startAnalysis(path);
+    while (!analyzer.isComplete()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return analyzer.takeResult();
+}
+
+} // anonymous namespace
+
+TEST_CASE("SampleAnalysisCache: store and load round-trip an analysis",
+          "[innexus][sample_analysis_cache]")
+{
+    TempCacheDir dir("innexus_cache_roundtrip");
+    Innexus::SampleAnalysisCache cache(dir.path);
+    const auto original = makeAnalysis(9);
+    constexpr uint64_t kKey = 0x1234abcdULL;
+
+    REQUIRE(cache.load(kKey) == nullptr);
+    REQUIRE(cache.store(kKey, original));
+
+    const auto loaded = cache.load(kKey);
+    REQUIRE(loaded != nullptr);
+    REQUIRE(loaded->filePath.empty());
+    REQUIRE(loaded->sampleRate == original.sampleRate);
+    REQUIRE(loaded->hopTimeSec == original.hopTimeSec);
+    REQUIRE(loaded->analysisFFTSize == original.analysisFFTSize);
+    REQUIRE(loaded->analysisHopSize == original.analysisHopSize);
+    REQUIRE(loaded->totalFrames == original.totalFrames);
+    REQUIRE(loaded->detectedADSR.attackMs == original.detectedADSR.attackMs);
+    REQUIRE(loaded->detectedADSR.sustainEndFrame == original.detectedADSR.sustainEndFrame);
+    REQUIRE(loaded->frames.size() == original.frames.size());
+    REQUIRE(loaded->residualFrames.size() == original.residualFrames.size());
+    REQUIRE(std::memcmp(loaded->frames.data(), original.frames.data(),
+                        original.frames.size() * sizeof(Krate::DSP::HarmonicFrame)) == 0);
+    for (size_t i = 0; i < original.residualFrames.size(); ++i) {
+        REQUIRE(loaded->residualFrames[i].bandEnergies == original.residualFrames[i].bandEnergies);
+        REQUIRE(loaded->residualFrames[i].transientFlag == original.residualFrames[i].transientFlag);
+    }
+
+    // Other keys miss
+    REQUIRE(cache.load(kKey + 1) == nullptr);
+}
+
+TEST_CASE("SampleAnalysisCache: damaged or stale entries miss",
+          "[innexus][sample_analysis_cache]")
+{
+    TempCacheDir dir("innexus_cache_invalid");
+    Innexus::SampleAnalysisCache cache(dir.path);
+    constexpr uint64_t kKey = 42;
+    REQUIRE(cache.store(kKey, makeAnalysis(4)));
+    const auto entry = cache.entryPath(kKey);
+
+    SECTION("truncated entry")
+    {
+        std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 1);
+        REQUIRE(cache.load(kKey) == nullptr);
+    }
+
+    SECTION("entry written with different analysis settings")
+    {
+        // settingsHash sits after the 4-byte magic and 4-byte format version
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        const uint64_t otherSettings = Innexus::SampleAnalysisCache::settingsHash() ^ 1u;
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&otherSettings), sizeof(otherSettings));
+        file.close();
+        REQUIRE(cache.load(kKey) == nullptr);
+
+        // The next store replaces the stale entry
+        REQUIRE(cache.store(kKey, makeAnalysis(4)));
+        REQUIRE(cache.load(kKey) != nullptr);
+    }
+
+    SECTION("frame count that overflows the size check")
+    {
+        // frameCount sits at byte 48 of the header. Adding 2^64 / (largest
+        // power of two dividing the frame size) leaves count * sizeof unchanged
+        // modulo 2^64, so only the per-count bound can reject it.
+        constexpr auto kFrameSize = sizeof(Krate::DSP::HarmonicFrame);
+        const uint64_t wrap = uint64_t{1} << (64 - std::countr_zero(kFrameSize));
+        const uint64_t bogusCount = 4 + wrap;
+        REQUIRE(bogusCount * kFrameSize == 4 * kFrameSize);
+
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(48);
+        file.write(reinterpret_cast<const char*>(&bogusCount), sizeof(bogusCount));
+        file.close();
+        std::unique_ptr<Innexus::SampleAnalysis> loaded;
+        REQUIRE_NOTHROW(loaded = cache.load(kKey));
+        REQUIRE(loaded == nullptr);
+    }
+
+    SECTION("disabled cache")
+    {
+        Innexus::SampleAnalysisCache disabled;
+        REQUIRE_FALSE(disabled.isEnabled());
+        REQUIRE(disabled.load(kKey) == nullptr);
+        REQUIRE_FALSE(disabled.store(kKey, makeAnalysis(1)));
+    }
+}
+
+TEST_CASE("SampleAnalysisCache: store prunes least recently used entries beyond the cap",
+          "[innexus][sample_analysis_cache]")
+{
+    TempCacheDir dir("innexus_cache_prune");
+    Innexus::SampleAnalysisCache cache(dir.path);
+    REQUIRE(cache.getMaxBytes() == Innexus::SampleAnalysisCache::kDefaultMaxBytes);
+
+    REQUIRE(cache.store(1, makeAnalysis(4)));
+    REQUIRE(cache.store(2, makeAnalysis(4)));
+    REQUIRE(cache.store(3, makeAnalysis(4)));
+    const auto entrySize = std::filesystem::file_size(cache.entryPath(1));
+
+    // Room for three and a half entries; 1 is oldest, then 2, then 3
+    cache.setMaxBytes(entrySize * 7 / 2);
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(cache.entryPath(1), now - std::chrono::hours(3));
+    std::filesystem::last_write_time(cache.entryPath(2), now - std::chrono::hours(2));
+    std::filesystem::last_write_time(cache.entryPath(3), now - std::chrono::hours(1));
+
+    // Using entry 1 makes 2 the least recently used
+    REQUIRE(cache.load(1) != nullptr);
+    REQUIRE(cache.store(4, makeAnalysis(4)));
+
+    REQUIRE(std::filesystem::exists(cache.entryPath(1)));
+    REQUIRE_FALSE(std::filesystem::exists(cache.entryPath(2)));
+    REQUIRE(std::filesystem::exists(cache.entryPath(3)));
+    REQUIRE(std::filesystem::exists(cache.entryPath(4)));
+
+    SECTION("an entry larger than the cap still stores, evicting the rest")
+    {
+        cache.setMaxBytes(entrySize / 2);
+        REQUIRE(cache.store(5, makeAnalysis(4)));
+        REQUIRE(cache.load(5) != nullptr);
+        REQUIRE(std::distance(std::filesystem::directory_iterator(dir.path),
+                              std::filesystem::directory_iterator{}) == 1);
+    }
+}
+
+TEST_CASE("SampleAnalysisCache: content hash depends on samples and rate",
+          "[innexus][sample_analysis_cache]")
+{
+    std::vector<float> a(4096, 0.25f);
+    auto b = a;
+    b[2048] = 0.5f;
+    const auto hashA = Innexus::SampleAnalysisCache::contentHash(a.data(), a.size(), 44100.0f);
+    REQUIRE(hashA == Innexus::SampleAnalysisCache::contentHash(a.data(), a.size(), 44100.0f));
+    REQUIRE(hashA != Innexus::SampleAnalysisCache::contentHash(b.data(), b.size(), 44100.0f));
+    REQUIRE(hashA != Innexus::SampleAnalysisCache::contentHash(a.data(), a.size(), 48000.0f));
+    REQUIRE(hashA != Innexus::SampleAnalysisCache::contentHash(a.data(), a.size() - 1, 44100.0f));
+}
+
+TEST_CASE("SampleAnalyzer: second load of the same audio is served from the cache",
+          "[innexus][sample_analyzer][sample_analysis_cache]")
+{
+    TempCacheDir dir("innexus_cache_analyzer");
+    const auto pathA = writeSineWav("innexus_cache_a.wav", 220.0f, 0.5f);
+    const auto pathB = writeSineWav("innexus_cache_b.wav", 220.0f, 0.5f);
+
+    Innexus::SampleAnalyzer analyzer;
+    analyzer.setCacheDirectory(dir.path);
+    REQUIRE(analyzer.getCacheDirectory() == dir.path);
+
+    const auto fresh = analyze(analyzer, pathA);
+    REQUIRE(fresh != nullptr);
+    REQUIRE(fresh->totalFrames > 0);
+    REQUIRE(std::filesystem::exists(dir.path));
+    REQUIRE(std::distance(std::filesystem::directory_iterator(dir.path),
+                          std::filesystem::directory_iterator{}) == 1);
+
+    // Same audio under another path: the cached entry, with the new path
+    const auto cached = analyze(analyzer, pathB);
+    REQUIRE(cached != nullptr);
+    REQUIRE(cached->filePath == pathB);
+    REQUIRE(cached->totalFrames == fresh->totalFrames);
+    REQUIRE(cached->detectedADSR.attackMs == fresh->detectedADSR.attackMs);
+    REQUIRE(std::memcmp(cached->frames.data(), fresh->frames.data(),
+                        fresh->frames.size() * sizeof(Krate::DSP::HarmonicFrame)) == 0);
+
+    std::filesystem::remove(pathA);
+    std::filesystem::remove(pathB);
+}
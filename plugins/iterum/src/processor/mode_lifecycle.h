@@ -0,0 +1,240 @@
+#pragma once
+
+// ==============================================================================
+// Delay Mode Lifecycle
+// ==============================================================================
+// Tracks which delay mode engines are materialised and prepares/releases them
+// on a background thread, so only the modes actually in use hold memory.
+//
+// Per-mode state machine (one atomic per mode):
+//
+//   Idle --request()--> PrepareRequested --worker--> Preparing --> Ready
+//   Ready --retire()--> ReleaseRequested --worker--> Releasing --> Idle
+//   ReleaseRequested --request()--> Ready   (reclaimed before the worker ran)
+//   PrepareRequested --retire()--> Idle     (cancelled before the worker ran)
+//
+// The worker only touches a mode's engine while it owns the mode (Preparing or
+// Releasing); the audio thread only touches it while it is Ready or
+// ReleaseRequested. The release store of Ready / Idle publishes the engine.
+//
+// Constitution Principle II: request(), retire() and isReady() are lock-free
+// and allocation-free; all preparation happens on the worker thread, except
+// prepareBlocking(), which offline rendering uses to switch modes on the block
+// they were selected.
+//
+// This header has NO VST3 SDK dependencies to allow use in pure C++ tests.
+// ==============================================================================
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace Iterum {
+
+class ModeLifecycle {
+public:
+    /// Prepare or release the engine for one mode. Runs on the worker thread
+    /// (or the caller of prepareNow()/releaseAll()); never on the audio thread.
+    using ModeJob = void (*)(void* context, int mode);
+
+    static constexpr int kMaxModes = 16;
+
+    enum class State : std::uint8_t {
+        Idle,
+        PrepareRequested,
+        Preparing,
+        Ready,
+        ReleaseRequested,
+        Releasing
+    };
+
+    ModeLifecycle() = default;
+    ~ModeLifecycle() { stop(); }
+
+    ModeLifecycle(const ModeLifecycle&) = delete;
+    ModeLifecycle& operator=(const ModeLifecycle&) = delete;
+
+    /// Set the jobs used to materialise and drop a mode. Call while stopped.
+    void configure(int numModes, ModeJob prepare, ModeJob release, void* context) noexcept {
+        numModes_ = (numModes < 0) ? 0 : (numModes > kMaxModes ? kMaxModes : numModes);
+        prepare_ = prepare;
+        release_ = release;
+        context_ = context;
+    }
+
+    /// Start the background worker. Restarts it if already running.
+    void start() {
+        stop();
+        stopping_.store(false, std::memory_order_relaxed);
+        worker_ = std::thread([this] { workerLoop(); });
+    }
+
+    /// Stop and join the worker. Pending requests stay pending.
+    void stop() noexcept {
+        if (!worker_.joinable()) return;
+        stopping_.store(true, std::memory_order_seq_cst);
+        wake();
+        worker_.join();
+    }
+
+    /// Prepare a mode synchronously on the calling thread (worker stopped,
+    /// audio thread idle). Out-of-range modes are ignored.
+    void prepareNow(int mode) {
+        if (!inRange(mode)) return;
+        auto& state = states_[static_cast<size_t>(mode)];
+        if (state.load(std::memory_order_acquire) == State::Ready) return;
+        if (prepare_ != nullptr) prepare_(context_, mode);
+        state.store(State::Ready, std::memory_order_release);
+    }
+
+    /// Make a mode Ready on the calling thread while the worker may be running.
+    /// Claims a pending or idle mode, reclaims one waiting to be released, and
+    /// waits out a job the worker already has in flight. Blocks and allocates:
+    /// only for offline rendering, where the host waits for process().
+    void prepareBlocking(int mode) {
+        if (!inRange(mode)) return;
+        auto& state = states_[static_cast<size_t>(mode)];
+        for (;;) {
+            State s = state.load(std::memory_order_acquire);
+            if (s == State::Ready) return;
+            if (s == State::ReleaseRequested) {
+                if (state.compare_exchange_strong(s, State::Ready,
+                                                  std::memory_order_acq_rel)) {
+                    return;
+                }
+                continue;
+            }
+            if (s == State::Idle || s == State::PrepareRequested) {
+                if (state.compare_exchange_strong(s, State::Preparing,
+                                                  std::memory_order_acq_rel)) {
+                    if (prepare_ != nullptr) prepare_(context_, mode);
+                    state.store(State::Ready, std::memory_order_release);
+                    return;
+                }
+                continue;
+            }
+            // Preparing / Releasing: the worker owns the engine until it finishes
+            std::this_thread::yield();
+        }
+    }
+
+    /// Release every materialised mode synchronously (worker stopped, audio
+    /// thread idle), including ones with a request still pending.
+    void releaseAll() noexcept {
+        for (int mode = 0; mode < numModes_; ++mode) {
+            auto& state = states_[static_cast<size_t>(mode)];
+            if (state.load(std::memory_order_acquire) != State::Idle) {
+                if (release_ != nullptr) release_(context_, mode);
+                state.store(State::Idle, std::memory_order_release);
+            }
+        }
+    }
+
+    /// Ask for a mode to be available. Returns true once it is Ready; call
+    /// again on later blocks until it is. Modes without a slot (out of range)
+    /// have nothing to prepare and are always ready.
+    /// Real-time safe.
+    bool request(int mode) noexcept {
+        if (!inRange(mode)) return true;
+        auto& state = states_[static_cast<size_t>(mode)];
+        State s = state.load(std::memory_order_acquire);
+        if (s == State::Ready) return true;
+        if (s == State::ReleaseRequested &&
+            state.compare_exchange_strong(s, State::Ready, std::memory_order_acq_rel)) {
+            return true;
+        }
+        if (s == State::Idle &&
+            state.compare_exchange_strong(s, State::PrepareRequested,
+                                          std::memory_order_acq_rel)) {
+            wake();
+        }
+        // Preparing / Releasing: the worker owns the engine; retry next block
+        return false;
+    }
+
+    /// Give a mode's memory back, or cancel a pending preparation. The engine
+    /// stays usable until the worker picks it up, so a quick request()
+    /// reclaims it without re-preparing. Returns false while the mode is
+    /// still being prepared (call again later), true once nothing is left to do.
+    /// Real-time safe.
+    bool retire(int mode) noexcept {
+        if (!inRange(mode)) return true;
+        auto& state = states_[static_cast<size_t>(mode)];
+        State s = state.load(std::memory_order_acquire);
+        if (s == State::Ready &&
+            state.compare_exchange_strong(s, State::ReleaseRequested,
+                                          std::memory_order_acq_rel)) {
+            wake();
+            return true;
+        }
+        if (s == State::PrepareRequested &&
+            state.compare_exchange_strong(s, State::Idle, std::memory_order_acq_rel)) {
+            return true;
+        }
+        // A failed exchange left the current state in s
+        return s != State::Preparing && s != State::PrepareRequested &&
+               s != State::Ready;
+    }
+
+    /// True while the mode's engine may be processed.
+    [[nodiscard]] bool isReady(int mode) const noexcept {
+        const State s = state(mode);
+        return s == State::Ready || s == State::ReleaseRequested;
+    }
+
+    [[nodiscard]] State state(int mode) const noexcept {
+        if (!inRange(mode)) return State::Idle;
+        return states_[static_cast<size_t>(mode)].load(std::memory_order_acquire);
+    }
+
+private:
+    [[nodiscard]] bool inRange(int mode) const noexcept {
+        return mode >= 0 && mode < numModes_;
+    }
+
+    void wake() noexcept {
+        generation_.fetch_add(1, std::memory_order_seq_cst);
+        generation_.notify_one();
+    }
+
+    void workerLoop() noexcept {
+        std::uint32_t seen = generation_.load(std::memory_order_acquire);
+        for (;;) {
+            if (stopping_.load(std::memory_order_acquire)) return;
+
+            // Run every pending job before sleeping again
+            for (int mode = 0; mode < numModes_; ++mode) {
+                auto& state = states_[static_cast<size_t>(mode)];
+                State expected = State::PrepareRequested;
+                if (state.compare_exchange_strong(expected, State::Preparing,
+                                                  std::memory_order_acq_rel)) {
+                    if (prepare_ != nullptr) prepare_(context_, mode);
+                    state.store(State::Ready, std::memory_order_release);
+                    continue;
+                }
+                expected = State::ReleaseRequested;
+                if (state.compare_exchange_strong(expected, State::Releasing,
+                                                  std::memory_order_acq_rel)) {
+                    if (release_ != nullptr) release_(context_, mode);
+                    state.store(State::Idle, std::memory_order_release);
+                }
+            }
+
+            generation_.wait(seen, std::memory_order_acquire);
+            seen = generation_.load(std::memory_order_acquire);
+        }
+    }
+
+    std::array<std::atomic<State>, kMaxModes> states_{};
+    std::atomic<std::uint32_t> generation_{0};
+    std::atomic<bool> stopping_{false};
+    std::thread worker_;
+
+    int numModes_ = 0;
+    ModeJob prepare_ = nullptr;
+    ModeJob release_ = nullptr;
+    void* context_ = nullptr;
+};
+
+} // namespace Iterum
@@ -11,7 +11,9 @@
 #include "pluginterfaces/vst/ivstprocesscontext.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 
 namespace Iterum {
 
@@ -23,6 +25,16 @@ Processor::Processor() {
     // Set the controller class ID for host to create the correct controller
     // Constitution Principle I: Processor/Controller separation
     setControllerClass(kControllerUID);
+
+    modes_.configure(static_cast<int>(DelayMode::NumModes),
+        [](void* self, int mode) { static_cast<Processor*>(self)->prepareMode(mode); },
+        [](void* self, int mode) { static_cast<Processor*>(self)->releaseMode(mode); },
+        this);
+}
+
+Processor::~Processor() {
+    // Join the preparation thread before any engine is destroyed
+    modes_.stop();
 }
 
 // ==============================================================================
@@ -46,7 +58,9 @@ Steinberg::tresult PLUGIN_API Processor::initialize(FUnknown* context) {
 }
 
 Steinberg::tresult PLUGIN_API Processor::terminate() {
-    // Cleanup any resources allocated in initialize()
+    // Cleanup any resources allocated in initialize() or setupProcessing()
+    modes_.stop();
+    modes_.releaseAll();
     return AudioEffect::terminate();
 }
 
@@ -57,43 +71,24 @@ Steinberg::tresult PLUGIN_API Processor::terminate() {
 Steinberg::tresult PLUGIN_API Processor::setupProcessing(
     Steinberg::Vst::ProcessSetup& setup) {
 
+    // Stop background preparation before touching what it reads, and drop
+    // every engine prepared for the previous setup
+    modes_.stop();
+    modes_.releaseAll();
+
     // Store processing parameters
     sampleRate_ = setup.sampleRate;
     maxBlockSize_ = setup.maxSamplesPerBlock;
+    offlineRendering_ = (setup.processMode == Steinberg::Vst::kOffline);
 
     // ==========================================================================
     // Constitution Principle II & VI: Pre-allocate ALL buffers HERE
     // ==========================================================================
 
-    // Prepare GranularDelay (spec 034)
-    granularDelay_.prepare(sampleRate_);
-
-    // Prepare SpectralDelay (spec 033)
-    spectralDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_));
-
-    // Prepare ShimmerDelay (spec 029)
-    shimmerDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
-
-    // Prepare PatternFreezeMode (spec 069)
-    patternFreezeMode_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
-
-    // Prepare ReverseDelay (spec 030)
-    reverseDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 2000.0f);
-
-    // Prepare TapeDelay (spec 024)
-    tapeDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 2000.0f);
-
-    // Prepare BBDDelay (spec 025)
-    bbdDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 1000.0f);
-
-    // Prepare DigitalDelay (spec 026)
-    digitalDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 10000.0f);
-
-    // Prepare PingPongDelay (spec 027)
-    pingPongDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 10000.0f);
-
-    // Prepare MultiTapDelay (spec 028)
-    multiTapDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
+    // Only the active mode is prepared here. Other modes are materialised by
+    // the lifecycle worker when selected (see process()).
+    const int activeMode = mode_.load(std::memory_order_relaxed);
+    modes_.prepareNow(activeMode);
 
     // ==========================================================================
     // Allocate Mode Crossfade Buffers (spec 041-mode-switch-clicks)
@@ -112,8 +107,12 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
     // Initialize crossfade state as complete (no crossfade in progress)
     crossfadePosition_ = 1.0f;
     crossfadeActive_ = false;
-    currentProcessingMode_ = mode_.load(std::memory_order_relaxed);
+    currentProcessingMode_ = activeMode;
     previousMode_ = currentProcessingMode_;
+    pendingMode_ = -1;
+    strayModes_ = 0;
+
+    modes_.start();
 
     return AudioEffect::setupProcessing(setup);
 }
@@ -121,16 +120,13 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
 Steinberg::tresult PLUGIN_API Processor::setActive(Steinberg::TBool state) {
     if (state) {
         // Activating: reset any processing state
-        granularDelay_.reset();
-        spectralDelay_.reset();
-        patternFreezeMode_.reset();
-        reverseDelay_.reset();
-        shimmerDelay_.reset();
-        tapeDelay_.reset();
-        bbdDelay_.reset();
-        digitalDelay_.reset();
-        pingPongDelay_.reset();
-        multiTapDelay_.reset();
+        for (int mode = 0; mode < static_cast<int>(DelayMode::NumModes); ++mode) {
+            // Engines with a release pending belong to the worker; they are
+            // reset on reclaim anyway (process() resets the mode it switches to)
+            if (modes_.state(mode) == ModeLifecycle::State::Ready) {
+                resetMode(mode);
+            }
+        }
         // Reset pattern tracking so next activation uses immediate load
         lastMultiTapPattern_ = -1;
         lastMultiTapTapCount_ = -1;
@@ -214,13 +210,48 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     const int requestedMode = mode_.load(std::memory_order_relaxed);
     const size_t numSamples = static_cast<size_t>(data.numSamples);
 
-    // Check for mode change and initiate crossfade if needed
-    if (requestedMode != currentProcessingMode_) {
+    // Check for mode change and initiate crossfade if needed. A mode that is
+    // not materialised yet is prepared in the background; the current mode
+    // keeps playing until it is ready, then the crossfade hands over.
+    if (pendingMode_ >= 0 && pendingMode_ != requestedMode) {
+        // Selection moved on before the pending mode was ready
+        strayModes_ |= 1u << static_cast<unsigned>(pendingMode_);
+        pendingMode_ = -1;
+    }
+    if (requestedMode != currentProcessingMode_ &&
+        requestedMode >= 0 && requestedMode < ModeLifecycle::kMaxModes) {
+        pendingMode_ = requestedMode;
+        strayModes_ &= ~(1u << static_cast<unsigned>(requestedMode));
+    }
+    for (std::uint32_t stray = strayModes_; stray != 0; stray &= stray - 1) {
+        const int mode = std::countr_zero(stray);
+        if (modes_.retire(mode)) {
+            strayModes_ &= ~(1u << static_cast<unsigned>(mode));
+        }
+    }
+
+    // Offline, the host waits for process(): prepare the mode here so the
+    // switch lands on this block no matter how fast the worker is, and
+    // bounces are reproducible
+    if (offlineRendering_ && requestedMode != currentProcessingMode_) {
+        modes_.prepareBlocking(requestedMode);
+    }
+
+    if (requestedMode != currentProcessingMode_ && modes_.request(requestedMode)) {
+        pendingMode_ = -1;
+
+        // A switch mid-crossfade drops the mode that was fading out
+        const int droppedMode = crossfadeActive_ ? previousMode_ : currentProcessingMode_;
+
         previousMode_ = currentProcessingMode_;
         currentProcessingMode_ = requestedMode;
         crossfadePosition_ = 0.0f;
         crossfadeActive_ = true;
 
+        if (droppedMode != previousMode_ && droppedMode != currentProcessingMode_) {
+            modes_.retire(droppedMode);
+        }
+
         // Clear stale delay buffers in the NEW mode so dormant audio
         // from a previous session doesn't play back as "ghost" echoes.
         resetMode(currentProcessingMode_);
@@ -257,6 +288,11 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
                 // (already in outputL/outputR from processMode)
             }
         }
+
+        // The faded-out mode is idle now: give its memory back
+        if (!crossfadeActive_ && previousMode_ != currentProcessingMode_) {
+            modes_.retire(previousMode_);
+        }
     } else {
         // =======================================================================
         // No Crossfade: Process single mode directly
@@ -466,201 +502,201 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
     switch (static_cast<DelayMode>(mode)) {
         case DelayMode::Granular:
             // Update Granular parameters
-            granularDelay_.setGrainSize(granularParams_.grainSize.load(std::memory_order_relaxed));
-            granularDelay_.setDensity(granularParams_.density.load(std::memory_order_relaxed));
-            granularDelay_.setDelayTime(granularParams_.delayTime.load(std::memory_order_relaxed));
-            granularDelay_.setPitch(granularParams_.pitch.load(std::memory_order_relaxed));
-            granularDelay_.setPitchSpray(granularParams_.pitchSpray.load(std::memory_order_relaxed));
-            granularDelay_.setPositionSpray(granularParams_.positionSpray.load(std::memory_order_relaxed));
-            granularDelay_.setPanSpray(granularParams_.panSpray.load(std::memory_order_relaxed));
-            granularDelay_.setReverseProbability(granularParams_.reverseProb.load(std::memory_order_relaxed));
-            granularDelay_.setFreeze(granularParams_.freeze.load(std::memory_order_relaxed));
-            granularDelay_.setFeedback(granularParams_.feedback.load(std::memory_order_relaxed));
-            granularDelay_.setDryWet(granularParams_.dryWet.load(std::memory_order_relaxed));
-            granularDelay_.setEnvelopeType(static_cast<Krate::DSP::GrainEnvelopeType>(
+            granularDelay_->setGrainSize(granularParams_.grainSize.load(std::memory_order_relaxed));
+            granularDelay_->setDensity(granularParams_.density.load(std::memory_order_relaxed));
+            granularDelay_->setDelayTime(granularParams_.delayTime.load(std::memory_order_relaxed));
+            granularDelay_->setPitch(granularParams_.pitch.load(std::memory_order_relaxed));
+            granularDelay_->setPitchSpray(granularParams_.pitchSpray.load(std::memory_order_relaxed));
+            granularDelay_->setPositionSpray(granularParams_.positionSpray.load(std::memory_order_relaxed));
+            granularDelay_->setPanSpray(granularParams_.panSpray.load(std::memory_order_relaxed));
+            granularDelay_->setReverseProbability(granularParams_.reverseProb.load(std::memory_order_relaxed));
+            granularDelay_->setFreeze(granularParams_.freeze.load(std::memory_order_relaxed));
+            granularDelay_->setFeedback(granularParams_.feedback.load(std::memory_order_relaxed));
+            granularDelay_->setDryWet(granularParams_.dryWet.load(std::memory_order_relaxed));
+            granularDelay_->setEnvelopeType(static_cast<Krate::DSP::GrainEnvelopeType>(
                 granularParams_.envelopeType.load(std::memory_order_relaxed)));
             // Tempo sync parameters (spec 038)
-            granularDelay_.setTimeMode(granularParams_.timeMode.load(std::memory_order_relaxed));
-            granularDelay_.setNoteValue(granularParams_.noteValue.load(std::memory_order_relaxed));
+            granularDelay_->setTimeMode(granularParams_.timeMode.load(std::memory_order_relaxed));
+            granularDelay_->setNoteValue(granularParams_.noteValue.load(std::memory_order_relaxed));
             // Phase 2 parameters
-            granularDelay_.setJitter(granularParams_.jitter.load(std::memory_order_relaxed));
-            granularDelay_.setPitchQuantMode(static_cast<Krate::DSP::PitchQuantMode>(
+            granularDelay_->setJitter(granularParams_.jitter.load(std::memory_order_relaxed));
+            granularDelay_->setPitchQuantMode(static_cast<Krate::DSP::PitchQuantMode>(
                 granularParams_.pitchQuantMode.load(std::memory_order_relaxed)));
-            granularDelay_.setTexture(granularParams_.texture.load(std::memory_order_relaxed));
-            granularDelay_.setStereoWidth(granularParams_.stereoWidth.load(std::memory_order_relaxed));
+            granularDelay_->setTexture(granularParams_.texture.load(std::memory_order_relaxed));
+            granularDelay_->setStereoWidth(granularParams_.stereoWidth.load(std::memory_order_relaxed));
             // GranularDelay takes separate input/output buffers
-            granularDelay_.process(inputL, inputR, outputL, outputR, numSamples, ctx);
+            granularDelay_->process(inputL, inputR, outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Spectral:
             // Update Spectral parameters
-            spectralDelay_.setFFTSize(static_cast<size_t>(
+            spectralDelay_->setFFTSize(static_cast<size_t>(
                 spectralParams_.fftSize.load(std::memory_order_relaxed)));
-            spectralDelay_.setBaseDelayMs(spectralParams_.baseDelay.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadMs(spectralParams_.spread.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadDirection(static_cast<Krate::DSP::SpreadDirection>(
+            spectralDelay_->setBaseDelayMs(spectralParams_.baseDelay.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadMs(spectralParams_.spread.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadDirection(static_cast<Krate::DSP::SpreadDirection>(
                 spectralParams_.spreadDirection.load(std::memory_order_relaxed)));
-            spectralDelay_.setFeedback(spectralParams_.feedback.load(std::memory_order_relaxed));
-            spectralDelay_.setFeedbackTilt(spectralParams_.feedbackTilt.load(std::memory_order_relaxed));
-            spectralDelay_.setFreezeEnabled(spectralParams_.freeze.load(std::memory_order_relaxed));
-            spectralDelay_.setDiffusion(spectralParams_.diffusion.load(std::memory_order_relaxed));
-            spectralDelay_.setDryWetMix(spectralParams_.dryWet.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadCurve(static_cast<Krate::DSP::SpreadCurve>(
+            spectralDelay_->setFeedback(spectralParams_.feedback.load(std::memory_order_relaxed));
+            spectralDelay_->setFeedbackTilt(spectralParams_.feedbackTilt.load(std::memory_order_relaxed));
+            spectralDelay_->setFreezeEnabled(spectralParams_.freeze.load(std::memory_order_relaxed));
+            spectralDelay_->setDiffusion(spectralParams_.diffusion.load(std::memory_order_relaxed));
+            spectralDelay_->setDryWetMix(spectralParams_.dryWet.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadCurve(static_cast<Krate::DSP::SpreadCurve>(
                 spectralParams_.spreadCurve.load(std::memory_order_relaxed)));
-            spectralDelay_.setStereoWidth(spectralParams_.stereoWidth.load(std::memory_order_relaxed));
+            spectralDelay_->setStereoWidth(spectralParams_.stereoWidth.load(std::memory_order_relaxed));
             // Tempo Sync (spec 041)
-            spectralDelay_.setTimeMode(spectralParams_.timeMode.load(std::memory_order_relaxed));
-            spectralDelay_.setNoteValue(spectralParams_.noteValue.load(std::memory_order_relaxed));
-            spectralDelay_.process(outputL, outputR, numSamples, ctx);
+            spectralDelay_->setTimeMode(spectralParams_.timeMode.load(std::memory_order_relaxed));
+            spectralDelay_->setNoteValue(spectralParams_.noteValue.load(std::memory_order_relaxed));
+            spectralDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Shimmer:
             // Update Shimmer parameters
-            shimmerDelay_.setDelayTimeMs(shimmerParams_.delayTime.load(std::memory_order_relaxed));
-            shimmerDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            shimmerDelay_->setDelayTimeMs(shimmerParams_.delayTime.load(std::memory_order_relaxed));
+            shimmerDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 shimmerParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = shimmerParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                shimmerDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                shimmerDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            shimmerDelay_.setPitchSemitones(shimmerParams_.pitchSemitones.load(std::memory_order_relaxed));
-            shimmerDelay_.setPitchCents(shimmerParams_.pitchCents.load(std::memory_order_relaxed));
-            shimmerDelay_.setShimmerMix(shimmerParams_.shimmerMix.load(std::memory_order_relaxed) * 100.0f);
-            shimmerDelay_.setFeedbackAmount(shimmerParams_.feedback.load(std::memory_order_relaxed));
+            shimmerDelay_->setPitchSemitones(shimmerParams_.pitchSemitones.load(std::memory_order_relaxed));
+            shimmerDelay_->setPitchCents(shimmerParams_.pitchCents.load(std::memory_order_relaxed));
+            shimmerDelay_->setShimmerMix(shimmerParams_.shimmerMix.load(std::memory_order_relaxed) * 100.0f);
+            shimmerDelay_->setFeedbackAmount(shimmerParams_.feedback.load(std::memory_order_relaxed));
             // Note: diffusionAmount removed - diffusion is always 100%
-            shimmerDelay_.setDiffusionSize(shimmerParams_.diffusionSize.load(std::memory_order_relaxed));
-            shimmerDelay_.setFilterEnabled(shimmerParams_.filterEnabled.load(std::memory_order_relaxed));
-            shimmerDelay_.setFilterCutoff(shimmerParams_.filterCutoff.load(std::memory_order_relaxed));
-            shimmerDelay_.setDryWetMix(shimmerParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
-            shimmerDelay_.process(outputL, outputR, numSamples, ctx);
+            shimmerDelay_->setDiffusionSize(shimmerParams_.diffusionSize.load(std::memory_order_relaxed));
+            shimmerDelay_->setFilterEnabled(shimmerParams_.filterEnabled.load(std::memory_order_relaxed));
+            shimmerDelay_->setFilterCutoff(shimmerParams_.filterCutoff.load(std::memory_order_relaxed));
+            shimmerDelay_->setDryWetMix(shimmerParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            shimmerDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Tape:
             // Update Tape parameters
-            tapeDelay_.setMotorSpeed(tapeParams_.motorSpeed.load(std::memory_order_relaxed));
-            tapeDelay_.setMotorInertia(tapeParams_.motorInertia.load(std::memory_order_relaxed));
-            tapeDelay_.setWear(tapeParams_.wear.load(std::memory_order_relaxed));
-            tapeDelay_.setSaturation(tapeParams_.saturation.load(std::memory_order_relaxed));
-            tapeDelay_.setAge(tapeParams_.age.load(std::memory_order_relaxed));
-            tapeDelay_.setSpliceEnabled(tapeParams_.spliceEnabled.load(std::memory_order_relaxed));
-            tapeDelay_.setSpliceIntensity(tapeParams_.spliceIntensity.load(std::memory_order_relaxed));
-            tapeDelay_.setFeedback(tapeParams_.feedback.load(std::memory_order_relaxed));
-            tapeDelay_.setMix(tapeParams_.mix.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(0, tapeParams_.head1Enabled.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(1, tapeParams_.head2Enabled.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(2, tapeParams_.head3Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setMotorSpeed(tapeParams_.motorSpeed.load(std::memory_order_relaxed));
+            tapeDelay_->setMotorInertia(tapeParams_.motorInertia.load(std::memory_order_relaxed));
+            tapeDelay_->setWear(tapeParams_.wear.load(std::memory_order_relaxed));
+            tapeDelay_->setSaturation(tapeParams_.saturation.load(std::memory_order_relaxed));
+            tapeDelay_->setAge(tapeParams_.age.load(std::memory_order_relaxed));
+            tapeDelay_->setSpliceEnabled(tapeParams_.spliceEnabled.load(std::memory_order_relaxed));
+            tapeDelay_->setSpliceIntensity(tapeParams_.spliceIntensity.load(std::memory_order_relaxed));
+            tapeDelay_->setFeedback(tapeParams_.feedback.load(std::memory_order_relaxed));
+            tapeDelay_->setMix(tapeParams_.mix.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(0, tapeParams_.head1Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(1, tapeParams_.head2Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(2, tapeParams_.head3Enabled.load(std::memory_order_relaxed));
             {
                 float linearGain = tapeParams_.head1Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(0, dB);
+                tapeDelay_->setHeadLevel(0, dB);
             }
             {
                 float linearGain = tapeParams_.head2Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(1, dB);
+                tapeDelay_->setHeadLevel(1, dB);
             }
             {
                 float linearGain = tapeParams_.head3Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(2, dB);
+                tapeDelay_->setHeadLevel(2, dB);
             }
-            tapeDelay_.setHeadPan(0, tapeParams_.head1Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.setHeadPan(1, tapeParams_.head2Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.setHeadPan(2, tapeParams_.head3Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.process(outputL, outputR, numSamples);
+            tapeDelay_->setHeadPan(0, tapeParams_.head1Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->setHeadPan(1, tapeParams_.head2Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->setHeadPan(2, tapeParams_.head3Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->process(outputL, outputR, numSamples);
             break;
 
         case DelayMode::BBD:
             // Update BBD parameters
-            bbdDelay_.setTime(bbdParams_.delayTime.load(std::memory_order_relaxed));
-            bbdDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            bbdDelay_->setTime(bbdParams_.delayTime.load(std::memory_order_relaxed));
+            bbdDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 bbdParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = bbdParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                bbdDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                bbdDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            bbdDelay_.setFeedback(bbdParams_.feedback.load(std::memory_order_relaxed));
-            bbdDelay_.setModulation(bbdParams_.modulationDepth.load(std::memory_order_relaxed));
-            bbdDelay_.setModulationRate(bbdParams_.modulationRate.load(std::memory_order_relaxed));
-            bbdDelay_.setAge(bbdParams_.age.load(std::memory_order_relaxed));
-            bbdDelay_.setEra(Parameters::getBBDEraFromDropdown(
+            bbdDelay_->setFeedback(bbdParams_.feedback.load(std::memory_order_relaxed));
+            bbdDelay_->setModulation(bbdParams_.modulationDepth.load(std::memory_order_relaxed));
+            bbdDelay_->setModulationRate(bbdParams_.modulationRate.load(std::memory_order_relaxed));
+            bbdDelay_->setAge(bbdParams_.age.load(std::memory_order_relaxed));
+            bbdDelay_->setEra(Parameters::getBBDEraFromDropdown(
                 bbdParams_.era.load(std::memory_order_relaxed)));
-            bbdDelay_.setMix(bbdParams_.mix.load(std::memory_order_relaxed));
-            bbdDelay_.process(outputL, outputR, numSamples, ctx);
+            bbdDelay_->setMix(bbdParams_.mix.load(std::memory_order_relaxed));
+            bbdDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Digital:
             // Update Digital parameters
-            digitalDelay_.setTime(digitalParams_.delayTime.load(std::memory_order_relaxed));
-            digitalDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            digitalDelay_->setTime(digitalParams_.delayTime.load(std::memory_order_relaxed));
+            digitalDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 digitalParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = digitalParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                digitalDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                digitalDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            digitalDelay_.setFeedback(digitalParams_.feedback.load(std::memory_order_relaxed));
-            digitalDelay_.setLimiterCharacter(static_cast<Krate::DSP::LimiterCharacter>(
+            digitalDelay_->setFeedback(digitalParams_.feedback.load(std::memory_order_relaxed));
+            digitalDelay_->setLimiterCharacter(static_cast<Krate::DSP::LimiterCharacter>(
                 digitalParams_.limiterCharacter.load(std::memory_order_relaxed)));
-            digitalDelay_.setEra(static_cast<Krate::DSP::DigitalEra>(
+            digitalDelay_->setEra(static_cast<Krate::DSP::DigitalEra>(
                 digitalParams_.era.load(std::memory_order_relaxed)));
-            digitalDelay_.setAge(digitalParams_.age.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationDepth(digitalParams_.modulationDepth.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationRate(digitalParams_.modulationRate.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationWaveform(static_cast<Krate::DSP::Waveform>(
+            digitalDelay_->setAge(digitalParams_.age.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationDepth(digitalParams_.modulationDepth.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationRate(digitalParams_.modulationRate.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationWaveform(static_cast<Krate::DSP::Waveform>(
                 digitalParams_.modulationWaveform.load(std::memory_order_relaxed)));
-            digitalDelay_.setMix(digitalParams_.mix.load(std::memory_order_relaxed));
-            digitalDelay_.setWidth(digitalParams_.width.load(std::memory_order_relaxed));
-            digitalDelay_.setWavefoldAmount(digitalParams_.wavefoldAmount.load(std::memory_order_relaxed));
-            digitalDelay_.setWavefoldModel(static_cast<Krate::DSP::WavefolderModel>(
+            digitalDelay_->setMix(digitalParams_.mix.load(std::memory_order_relaxed));
+            digitalDelay_->setWidth(digitalParams_.width.load(std::memory_order_relaxed));
+            digitalDelay_->setWavefoldAmount(digitalParams_.wavefoldAmount.load(std::memory_order_relaxed));
+            digitalDelay_->setWavefoldModel(static_cast<Krate::DSP::WavefolderModel>(
                 digitalParams_.wavefoldType.load(std::memory_order_relaxed)));
-            digitalDelay_.setWavefoldSymmetry(digitalParams_.wavefoldSymmetry.load(std::memory_order_relaxed));
-            digitalDelay_.process(outputL, outputR, numSamples, ctx);
+            digitalDelay_->setWavefoldSymmetry(digitalParams_.wavefoldSymmetry.load(std::memory_order_relaxed));
+            digitalDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::PingPong:
             // Update PingPong parameters
-            pingPongDelay_.setDelayTimeMs(pingPongParams_.delayTime.load(std::memory_order_relaxed));
-            pingPongDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            pingPongDelay_->setDelayTimeMs(pingPongParams_.delayTime.load(std::memory_order_relaxed));
+            pingPongDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 pingPongParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = pingPongParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                pingPongDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                pingPongDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            pingPongDelay_.setLRRatio(Parameters::getLRRatioFromDropdown(
+            pingPongDelay_->setLRRatio(Parameters::getLRRatioFromDropdown(
                 pingPongParams_.lrRatio.load(std::memory_order_relaxed)));
-            pingPongDelay_.setFeedback(pingPongParams_.feedback.load(std::memory_order_relaxed));
-            pingPongDelay_.setCrossFeedback(pingPongParams_.crossFeedback.load(std::memory_order_relaxed));
-            pingPongDelay_.setWidth(pingPongParams_.width.load(std::memory_order_relaxed));
-            pingPongDelay_.setModulationDepth(pingPongParams_.modulationDepth.load(std::memory_order_relaxed));
-            pingPongDelay_.setModulationRate(pingPongParams_.modulationRate.load(std::memory_order_relaxed));
-            pingPongDelay_.setMix(pingPongParams_.mix.load(std::memory_order_relaxed));
-            pingPongDelay_.process(outputL, outputR, numSamples, ctx);
+            pingPongDelay_->setFeedback(pingPongParams_.feedback.load(std::memory_order_relaxed));
+            pingPongDelay_->setCrossFeedback(pingPongParams_.crossFeedback.load(std::memory_order_relaxed));
+            pingPongDelay_->setWidth(pingPongParams_.width.load(std::memory_order_relaxed));
+            pingPongDelay_->setModulationDepth(pingPongParams_.modulationDepth.load(std::memory_order_relaxed));
+            pingPongDelay_->setModulationRate(pingPongParams_.modulationRate.load(std::memory_order_relaxed));
+            pingPongDelay_->setMix(pingPongParams_.mix.load(std::memory_order_relaxed));
+            pingPongDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Reverse:
             // Update Reverse parameters
-            reverseDelay_.setChunkSizeMs(reverseParams_.chunkSize.load(std::memory_order_relaxed));
-            reverseDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            reverseDelay_->setChunkSizeMs(reverseParams_.chunkSize.load(std::memory_order_relaxed));
+            reverseDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 reverseParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = reverseParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                reverseDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                reverseDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            reverseDelay_.setCrossfadePercent(reverseParams_.crossfade.load(std::memory_order_relaxed));
-            reverseDelay_.setPlaybackMode(static_cast<Krate::DSP::PlaybackMode>(
+            reverseDelay_->setCrossfadePercent(reverseParams_.crossfade.load(std::memory_order_relaxed));
+            reverseDelay_->setPlaybackMode(static_cast<Krate::DSP::PlaybackMode>(
                 reverseParams_.playbackMode.load(std::memory_order_relaxed)));
-            reverseDelay_.setFeedbackAmount(reverseParams_.feedback.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterEnabled(reverseParams_.filterEnabled.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterCutoff(reverseParams_.filterCutoff.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterType(static_cast<Krate::DSP::FilterType>(
+            reverseDelay_->setFeedbackAmount(reverseParams_.feedback.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterEnabled(reverseParams_.filterEnabled.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterCutoff(reverseParams_.filterCutoff.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterType(static_cast<Krate::DSP::FilterType>(
                 reverseParams_.filterType.load(std::memory_order_relaxed)));
-            reverseDelay_.setDryWetMix(reverseParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
-            reverseDelay_.process(outputL, outputR, numSamples, ctx);
+            reverseDelay_->setDryWetMix(reverseParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            reverseDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::MultiTap:
@@ -690,7 +726,7 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
                 };
                 const auto note = noteValues[std::min(noteIdx, 9)];
                 const auto modifier = modifiers[std::min(modifierIdx, 2)];
-                multiTapDelay_.setNoteValue(note, modifier);
+                multiTapDelay_->setNoteValue(note, modifier);
             }
             // Pattern morphing: detect pattern/tap count changes and morph smoothly
             {
@@ -699,7 +735,7 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
                 const float morphTime = multiTapParams_.morphTime.load(std::memory_order_relaxed);
 
                 // Set morph time before checking for changes (used by morphToPattern)
-                multiTapDelay_.setMorphTime(morphTime);
+                multiTapDelay_->setMorphTime(morphTime);
 
                 const bool patternChanged = (currentPattern != lastMultiTapPattern_);
                 const bool tapCountChanged = (currentTapCount != lastMultiTapTapCount_);
@@ -707,21 +743,21 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
                 if (lastMultiTapPattern_ < 0 || tapCountChanged) {
                     // First call OR tap count changed: use immediate load
                     // (morphing only works for pattern changes with same tap count)
-                    multiTapDelay_.loadTimingPattern(
+                    multiTapDelay_->loadTimingPattern(
                         Parameters::getTimingPatternFromDropdown(currentPattern),
                         static_cast<size_t>(currentTapCount));
                     lastMultiTapPattern_ = currentPattern;
                     lastMultiTapTapCount_ = currentTapCount;
                 } else if (patternChanged) {
                     // Only pattern changed (same tap count): use smooth morph transition
-                    multiTapDelay_.morphToPattern(
+                    multiTapDelay_->morphToPattern(
                         Parameters::getTimingPatternFromDropdown(currentPattern),
                         morphTime);
                     lastMultiTapPattern_ = currentPattern;
                 }
                 // else: no change, let any in-progress morph continue
             }
-            multiTapDelay_.applySpatialPattern(Parameters::getSpatialPatternFromDropdown(
+            multiTapDelay_->applySpatialPattern(Parameters::getSpatialPatternFromDropdown(
                 multiTapParams_.spatialPattern.load(std::memory_order_relaxed)));
 
             // Custom pattern wiring (spec 046): when pattern is Custom (index 19),
@@ -731,9 +767,9 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
                 if (currentPattern == 19) {  // Custom pattern index
                     // Transfer custom time ratios and levels from params to DSP
                     for (size_t i = 0; i < kCustomPatternMaxTaps; ++i) {
-                        multiTapDelay_.setCustomTimeRatio(i,
+                        multiTapDelay_->setCustomTimeRatio(i,
                             multiTapParams_.customTimeRatios[i].load(std::memory_order_relaxed));
-                        multiTapDelay_.setCustomLevelRatio(i,
+                        multiTapDelay_->setCustomLevelRatio(i,
                             multiTapParams_.customLevels[i].load(std::memory_order_relaxed));
                     }
                 }
@@ -741,71 +777,71 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
 
             // Note: baseTimeMs is derived from Note Value + host tempo in process() for mathematical patterns
             // Rhythmic patterns derive timing from pattern name + host tempo directly
-            multiTapDelay_.setFeedbackAmount(multiTapParams_.feedback.load(std::memory_order_relaxed));
-            multiTapDelay_.setFeedbackLPCutoff(multiTapParams_.feedbackLPCutoff.load(std::memory_order_relaxed));
-            multiTapDelay_.setFeedbackHPCutoff(multiTapParams_.feedbackHPCutoff.load(std::memory_order_relaxed));
-            multiTapDelay_.setDryWetMix(multiTapParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
-            multiTapDelay_.process(outputL, outputR, numSamples, ctx);
+            multiTapDelay_->setFeedbackAmount(multiTapParams_.feedback.load(std::memory_order_relaxed));
+            multiTapDelay_->setFeedbackLPCutoff(multiTapParams_.feedbackLPCutoff.load(std::memory_order_relaxed));
+            multiTapDelay_->setFeedbackHPCutoff(multiTapParams_.feedbackHPCutoff.load(std::memory_order_relaxed));
+            multiTapDelay_->setDryWetMix(multiTapParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            multiTapDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Freeze:
             // Pattern Freeze is always active when in Freeze mode (no checkbox needed)
-            patternFreezeMode_.setFreezeEnabled(true);
-            patternFreezeMode_.setPatternType(static_cast<Krate::DSP::PatternType>(
+            patternFreezeMode_->setFreezeEnabled(true);
+            patternFreezeMode_->setPatternType(static_cast<Krate::DSP::PatternType>(
                 freezeParams_.patternType.load(std::memory_order_relaxed)));
 
             // Slice parameters
-            patternFreezeMode_.setSliceLengthMs(freezeParams_.sliceLengthMs.load(std::memory_order_relaxed));
-            patternFreezeMode_.setSliceMode(static_cast<Krate::DSP::SliceMode>(
+            patternFreezeMode_->setSliceLengthMs(freezeParams_.sliceLengthMs.load(std::memory_order_relaxed));
+            patternFreezeMode_->setSliceMode(static_cast<Krate::DSP::SliceMode>(
                 freezeParams_.sliceMode.load(std::memory_order_relaxed)));
 
             // Euclidean parameters
-            patternFreezeMode_.setEuclideanSteps(freezeParams_.euclideanSteps.load(std::memory_order_relaxed));
-            patternFreezeMode_.setEuclideanHits(freezeParams_.euclideanHits.load(std::memory_order_relaxed));
-            patternFreezeMode_.setEuclideanRotation(freezeParams_.euclideanRotation.load(std::memory_order_relaxed));
+            patternFreezeMode_->setEuclideanSteps(freezeParams_.euclideanSteps.load(std::memory_order_relaxed));
+            patternFreezeMode_->setEuclideanHits(freezeParams_.euclideanHits.load(std::memory_order_relaxed));
+            patternFreezeMode_->setEuclideanRotation(freezeParams_.euclideanRotation.load(std::memory_order_relaxed));
             {
                 const int patternRateIdx = freezeParams_.patternRate.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(patternRateIdx);
-                patternFreezeMode_.setNoteValue(noteMapping.note);
-                patternFreezeMode_.setNoteModifier(noteMapping.modifier);
+                patternFreezeMode_->setNoteValue(noteMapping.note);
+                patternFreezeMode_->setNoteModifier(noteMapping.modifier);
             }
 
             // Granular Scatter parameters
-            patternFreezeMode_.setGranularDensity(freezeParams_.granularDensity.load(std::memory_order_relaxed));
-            patternFreezeMode_.setGranularPositionJitter(freezeParams_.granularPositionJitter.load(std::memory_order_relaxed));
-            patternFreezeMode_.setGranularSizeJitter(freezeParams_.granularSizeJitter.load(std::memory_order_relaxed));
-            patternFreezeMode_.setGranularGrainSize(freezeParams_.granularGrainSize.load(std::memory_order_relaxed));
+            patternFreezeMode_->setGranularDensity(freezeParams_.granularDensity.load(std::memory_order_relaxed));
+            patternFreezeMode_->setGranularPositionJitter(freezeParams_.granularPositionJitter.load(std::memory_order_relaxed));
+            patternFreezeMode_->setGranularSizeJitter(freezeParams_.granularSizeJitter.load(std::memory_order_relaxed));
+            patternFreezeMode_->setGranularGrainSize(freezeParams_.granularGrainSize.load(std::memory_order_relaxed));
 
             // Harmonic Drones parameters
-            patternFreezeMode_.setDroneVoiceCount(freezeParams_.droneVoiceCount.load(std::memory_order_relaxed));
-            patternFreezeMode_.setDroneInterval(static_cast<Krate::DSP::PitchInterval>(
+            patternFreezeMode_->setDroneVoiceCount(freezeParams_.droneVoiceCount.load(std::memory_order_relaxed));
+            patternFreezeMode_->setDroneInterval(static_cast<Krate::DSP::PitchInterval>(
                 freezeParams_.droneInterval.load(std::memory_order_relaxed)));
-            patternFreezeMode_.setDroneDrift(freezeParams_.droneDrift.load(std::memory_order_relaxed));
-            patternFreezeMode_.setDroneDriftRate(freezeParams_.droneDriftRate.load(std::memory_order_relaxed));
+            patternFreezeMode_->setDroneDrift(freezeParams_.droneDrift.load(std::memory_order_relaxed));
+            patternFreezeMode_->setDroneDriftRate(freezeParams_.droneDriftRate.load(std::memory_order_relaxed));
 
             // Noise Bursts parameters
-            patternFreezeMode_.setNoiseColor(static_cast<Krate::DSP::NoiseColor>(
+            patternFreezeMode_->setNoiseColor(static_cast<Krate::DSP::NoiseColor>(
                 freezeParams_.noiseColor.load(std::memory_order_relaxed)));
             {
                 const int burstRateIdx = freezeParams_.noiseBurstRate.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(burstRateIdx);
-                patternFreezeMode_.setNoiseBurstRate(noteMapping.note, noteMapping.modifier);
+                patternFreezeMode_->setNoiseBurstRate(noteMapping.note, noteMapping.modifier);
             }
-            patternFreezeMode_.setNoiseFilterType(static_cast<Krate::DSP::FilterType>(
+            patternFreezeMode_->setNoiseFilterType(static_cast<Krate::DSP::FilterType>(
                 freezeParams_.noiseFilterType.load(std::memory_order_relaxed)));
-            patternFreezeMode_.setNoiseFilterCutoff(freezeParams_.noiseFilterCutoff.load(std::memory_order_relaxed));
-            patternFreezeMode_.setNoiseFilterSweep(freezeParams_.noiseFilterSweep.load(std::memory_order_relaxed));
+            patternFreezeMode_->setNoiseFilterCutoff(freezeParams_.noiseFilterCutoff.load(std::memory_order_relaxed));
+            patternFreezeMode_->setNoiseFilterSweep(freezeParams_.noiseFilterSweep.load(std::memory_order_relaxed));
 
             // Envelope parameters
-            patternFreezeMode_.setEnvelopeAttackMs(freezeParams_.envelopeAttackMs.load(std::memory_order_relaxed));
-            patternFreezeMode_.setEnvelopeReleaseMs(freezeParams_.envelopeReleaseMs.load(std::memory_order_relaxed));
-            patternFreezeMode_.setEnvelopeShape(static_cast<Krate::DSP::EnvelopeShape>(
+            patternFreezeMode_->setEnvelopeAttackMs(freezeParams_.envelopeAttackMs.load(std::memory_order_relaxed));
+            patternFreezeMode_->setEnvelopeReleaseMs(freezeParams_.envelopeReleaseMs.load(std::memory_order_relaxed));
+            patternFreezeMode_->setEnvelopeShape(static_cast<Krate::DSP::EnvelopeShape>(
                 freezeParams_.envelopeShape.load(std::memory_order_relaxed)));
 
             // Mix parameter
-            patternFreezeMode_.setDryWetMix(freezeParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            patternFreezeMode_->setDryWetMix(freezeParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
 
-            patternFreezeMode_.process(outputL, outputR, numSamples, ctx);
+            patternFreezeMode_->process(outputL, outputR, numSamples, ctx);
             break;
 
         default:
@@ -819,17 +855,104 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
 // ==============================================================================
 
 void Processor::resetMode(int mode) noexcept {
+    switch (static_cast<DelayMode>(mode)) {
+        case DelayMode::Granular:  granularDelay_->reset();      break;
+        case DelayMode::Spectral:  spectralDelay_->reset();      break;
+        case DelayMode::Shimmer:   shimmerDelay_->reset();        break;
+        case DelayMode::Tape:      tapeDelay_->reset();           break;
+        case DelayMode::BBD:       bbdDelay_->reset();            break;
+        case DelayMode::Digital:   digitalDelay_->reset();        break;
+        case DelayMode::PingPong:  pingPongDelay_->reset();       break;
+        case DelayMode::Reverse:   reverseDelay_->reset();        break;
+        case DelayMode::MultiTap:
+            multiTapDelay_->reset();
+            // The engine may be freshly prepared: load the pattern immediately
+            lastMultiTapPattern_ = -1;
+            lastMultiTapTapCount_ = -1;
+            break;
+        case DelayMode::Freeze:    patternFreezeMode_->reset();   break;
+        default: break;
+    }
+}
+
+// ==============================================================================
+// On-Demand Mode Preparation (ModeLifecycle jobs)
+// ==============================================================================
+// Run on the lifecycle worker thread (or in setupProcessing() for the active
+// mode). sampleRate_ and maxBlockSize_ are only written while the worker is
+// stopped, so they are stable here.
+
+void Processor::prepareMode(int mode) {
+    const auto blockSize = static_cast<size_t>(maxBlockSize_);
+
+    switch (static_cast<DelayMode>(mode)) {
+        case DelayMode::Granular:
+            // spec 034
+            granularDelay_ = std::make_unique<Krate::DSP::GranularDelay>();
+            granularDelay_->prepare(sampleRate_);
+            break;
+        case DelayMode::Spectral:
+            // spec 033
+            spectralDelay_ = std::make_unique<Krate::DSP::SpectralDelay>();
+            spectralDelay_->prepare(sampleRate_, blockSize);
+            break;
+        case DelayMode::Shimmer:
+            // spec 029
+            shimmerDelay_ = std::make_unique<Krate::DSP::ShimmerDelay>();
+            shimmerDelay_->prepare(sampleRate_, blockSize, 5000.0f);
+            break;
+        case DelayMode::Tape:
+            // spec 024
+            tapeDelay_ = std::make_unique<Krate::DSP::TapeDelay>();
+            tapeDelay_->prepare(sampleRate_, blockSize, 2000.0f);
+            break;
+        case DelayMode::BBD:
+            // spec 025
+            bbdDelay_ = std::make_unique<Krate::DSP::BBDDelay>();
+            bbdDelay_->prepare(sampleRate_, blockSize, 1000.0f);
+            break;
+        case DelayMode::Digital:
+            // spec 026
+            digitalDelay_ = std::make_unique<Krate::DSP::DigitalDelay>();
+            digitalDelay_->prepare(sampleRate_, blockSize, 10000.0f);
+            break;
+        case DelayMode::PingPong:
+            // spec 027
+            pingPongDelay_ = std::make_unique<Krate::DSP::PingPongDelay>();
+            pingPongDelay_->prepare(sampleRate_, blockSize, 10000.0f);
+            break;
+        case DelayMode::Reverse:
+            // spec 030
+            reverseDelay_ = std::make_unique<Krate::DSP::ReverseDelay>();
+            reverseDelay_->prepare(sampleRate_, blockSize, 2000.0f);
+            break;
+        case DelayMode::MultiTap:
+            // spec 028
+            multiTapDelay_ = std::make_unique<Krate::DSP::MultiTapDelay>();
+            multiTapDelay_->prepare(sampleRate_, blockSize, 5000.0f);
+            break;
+        case DelayMode::Freeze:
+            // spec 069
+            patternFreezeMode_ = std::make_unique<Krate::DSP::PatternFreezeMode>();
+            patternFreezeMode_->prepare(sampleRate_, blockSize, 5000.0f);
+            break;
+        default:
+            break;
+    }
+}
+
+void Processor::releaseMode(int mode) noexcept {
     switch (static_cast<DelayMode>(mode)) {
         case DelayMode::Granular:  granularDelay_.reset();      break;
         case DelayMode::Spectral:  spectralDelay_.reset();      break;
-        case DelayMode::Shimmer:   shimmerDelay_.reset();        break;
-        case DelayMode::Tape:      tapeDelay_.reset();           break;
-        case DelayMode::BBD:       bbdDelay_.reset();            break;
-        case DelayMode::Digital:   digitalDelay_.reset();        break;
-        case DelayMode::PingPong:  pingPongDelay_.reset();       break;
-        case DelayMode::Reverse:   reverseDelay_.reset();        break;
-        case DelayMode::MultiTap:  multiTapDelay_.reset();       break;
-        case DelayMode::Freeze:    patternFreezeMode_.reset();   break;
+        case DelayMode::Shimmer:   shimmerDelay_.reset();       break;
+        case DelayMode::Tape:      tapeDelay_.reset();          break;
+        case DelayMode::BBD:       bbdDelay_.reset();           break;
+        case DelayMode::Digital:   digitalDelay_.reset();       break;
+        case DelayMode::PingPong:  pingPongDelay_.reset();      break;
+        case DelayMode::Reverse:   reverseDelay_.reset();       break;
+        case DelayMode::MultiTap:  multiTapDelay_.reset();      break;
+        case DelayMode::Freeze:    patternFreezeMode_.reset();  break;
         default: break;
     }
 }
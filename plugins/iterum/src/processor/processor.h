@@ -12,6 +12,13 @@
 // - NEVER allocate memory in process()
 // - NEVER use locks/mutexes
 // - Pre-allocate ALL buffers in setupProcessing()
+//
+// Delay mode engines are materialised on demand (ModeLifecycle): the active
+// mode is prepared in setupProcessing(), a newly selected mode is prepared on
+// a background thread while the current one keeps playing, and a mode that
+// has been crossfaded out hands its memory back. When rendering offline the
+// selected mode is prepared inside process() instead, so a bounce switches on
+// the same block every time.
 // ==============================================================================
 
 #include "public.sdk/source/vst/vstaudioeffect.h"
@@ -38,8 +45,11 @@
 #include "parameters/spectral_params.h"
 #include "parameters/tape_params.h"
 #include "parameters/dropdown_mappings.h"
+#include "processor/mode_lifecycle.h"
 
 #include <atomic>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace Iterum {
@@ -51,7 +61,7 @@ namespace Iterum {
 class Processor : public Steinberg::Vst::AudioEffect {
 public:
     Processor();
-    ~Processor() override = default;
+    ~Processor() override;
 
     // ===========================================================================
     // IPluginBase
@@ -129,6 +139,13 @@ protected:
     /// Called when switching TO a mode to prevent stale buffer playback
     void resetMode(int mode) noexcept;
 
+    /// Create and prepare a mode's engine (ModeLifecycle job, never on the
+    /// audio thread)
+    void prepareMode(int mode);
+
+    /// Destroy a mode's engine, freeing its buffers (ModeLifecycle job)
+    void releaseMode(int mode) noexcept;
+
 private:
     // ==========================================================================
     // Processing State
@@ -140,6 +157,9 @@ private:
     // Maximum expected block size (for buffer pre-allocation)
     Steinberg::int32 maxBlockSize_ = 0;
 
+    // Host renders offline (kOffline): mode switches are prepared synchronously
+    bool offlineRendering_ = false;
+
     // ==========================================================================
     // Mode Crossfade State (spec 041-mode-switch-clicks)
     // Constitution Principle II: All buffers pre-allocated in setupProcessing()
@@ -163,6 +183,13 @@ private:
     /// True while crossfade is in progress
     bool crossfadeActive_ = false;
 
+    /// Mode selected by the user whose engine is still being prepared (-1 = none)
+    int pendingMode_ = -1;
+
+    /// Bitmask of modes requested and then abandoned before they became ready;
+    /// retired as soon as their preparation settles
+    std::uint32_t strayModes_ = 0;
+
     /// Work buffer for previous mode's left channel output during crossfade
     std::vector<float> crossfadeBufferL_;
 
@@ -195,18 +222,23 @@ private:
 
     // ==========================================================================
     // DSP Components
+    // Only modes that are Ready in modes_ hold an engine; the rest are null.
     // ==========================================================================
 
-    Krate::DSP::GranularDelay granularDelay_;
-    Krate::DSP::SpectralDelay spectralDelay_;
-    Krate::DSP::PatternFreezeMode patternFreezeMode_;
-    Krate::DSP::ReverseDelay reverseDelay_;
-    Krate::DSP::ShimmerDelay shimmerDelay_;
-    Krate::DSP::TapeDelay tapeDelay_;
-    Krate::DSP::BBDDelay bbdDelay_;
-    Krate::DSP::DigitalDelay digitalDelay_;
-    Krate::DSP::PingPongDelay pingPongDelay_;
-    Krate::DSP::MultiTapDelay multiTapDelay_;
+    std::unique_ptr<Krate::DSP::GranularDelay> granularDelay_;
+    std::unique_ptr<Krate::DSP::SpectralDelay> spectralDelay_;
+    std::unique_ptr<Krate::DSP::PatternFreezeMode> patternFreezeMode_;
+    std::unique_ptr<Krate::DSP::ReverseDelay> reverseDelay_;
+    std::unique_ptr<Krate::DSP::ShimmerDelay> shimmerDelay_;
+    std::unique_ptr<Krate::DSP::TapeDelay> tapeDelay_;
+    std::unique_ptr<Krate::DSP::BBDDelay> bbdDelay_;
+    std::unique_ptr<Krate::DSP::DigitalDelay> digitalDelay_;
+    std::unique_ptr<Krate::DSP::PingPongDelay> pingPongDelay_;
+    std::unique_ptr<Krate::DSP::MultiTapDelay> multiTapDelay_;
+
+    /// Which engines exist, plus the background thread that builds them.
+    /// Declared after the engines so its worker is joined before they die.
+    ModeLifecycle modes_;
 
     // ==========================================================================
     // MultiTap pattern change tracking (for morphing)
@@ -0,0 +1,243 @@
+// ==============================================================================
+// Processor Tests: Delay Mode Lifecycle
+// ==============================================================================
+// Verifies on-demand mode materialisation: requested modes are prepared on the
+// background worker, retired modes are released, a retired mode can be
+// reclaimed before the worker gets to it, a pending preparation can be
+// cancelled, and offline rendering can prepare a mode synchronously.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processor/mode_lifecycle.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using Iterum::ModeLifecycle;
+
+namespace {
+
+constexpr int kNumModes = 10;
+
+/// Stands in for the Processor: counts jobs and tracks which engines exist
+struct FakeEngines {
+    std::array<std::atomic<bool>, kNumModes> alive{};
+    std::array<std::atomic<int>, kNumModes> prepares{};
+    std::array<std::atomic<int>, kNumModes> releases{};
+    std::atomic<bool> gate{true};  // prepare blocks while false
+
+    static void prepare(void* context, int mode) {
+        auto* self = static_cast<FakeEngines*>(context);
+        while (!self->gate.load()) std::this_thread::yield();
+        self->alive[static_cast<size_t>(mode)] = true;
+        ++self->prepares[static_cast<size_t>(mode)];
+    }
+
+    static void release(void* context, int mode) noexcept {
+        auto* self = static_cast<FakeEngines*>(context);
+        self->alive[static_cast<size_t>(mode)] = false;
+        ++self->releases[static_cast<size_t>(mode)];
+    }
+};
+
+/// Poll like the audio thread does, once per "block", until ready
+bool requestUntilReady(ModeLifecycle& modes, int mode) {
+    for (int block = 0; block < 5000; ++block) {
+        if (modes.request(mode)) return true;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return false;
+}
+
+bool waitForState(const ModeLifecycle& modes, int mode, ModeLifecycle::State state) {
+    for (int i = 0; i < 5000; ++i) {
+        if (modes.state(mode) == state) return true;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("ModeLifecycle prepares only the active mode up front",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+
+    modes.prepareNow(5);
+    REQUIRE(modes.state(5) == ModeLifecycle::State::Ready);
+    for (int mode = 0; mode < kNumModes; ++mode) {
+        REQUIRE(engines.alive[static_cast<size_t>(mode)] == (mode == 5));
+    }
+
+    modes.releaseAll();
+    REQUIRE_FALSE(engines.alive[5]);
+    REQUIRE(modes.state(5) == ModeLifecycle::State::Idle);
+}
+
+TEST_CASE("ModeLifecycle prepares requested modes in the background",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+    modes.start();
+
+    // Hold the worker inside prepare(): the caller keeps getting "not yet"
+    engines.gate = false;
+    REQUIRE_FALSE(modes.request(3));
+    REQUIRE(waitForState(modes, 3, ModeLifecycle::State::Preparing));
+    REQUIRE_FALSE(modes.request(3));
+    REQUIRE_FALSE(modes.isReady(3));
+
+    engines.gate = true;
+    REQUIRE(requestUntilReady(modes, 3));
+    REQUIRE(engines.alive[3]);
+    REQUIRE(engines.prepares[3] == 1);
+    modes.stop();
+}
+
+TEST_CASE("ModeLifecycle releases retired modes and reclaims them on request",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+
+    SECTION("retired mode is released by the worker") {
+        modes.prepareNow(2);
+        modes.start();
+        REQUIRE(modes.retire(2));
+        REQUIRE(waitForState(modes, 2, ModeLifecycle::State::Idle));
+        REQUIRE_FALSE(engines.alive[2]);
+        REQUIRE(engines.releases[2] == 1);
+
+        // Asking again prepares a fresh engine
+        REQUIRE(requestUntilReady(modes, 2));
+        REQUIRE(engines.prepares[2] == 2);
+    }
+
+    SECTION("retired mode reclaimed before the worker runs keeps its engine") {
+        modes.prepareNow(2);
+        // Worker not started: the release cannot have happened yet
+        REQUIRE(modes.retire(2));
+        REQUIRE(modes.isReady(2));
+        REQUIRE(modes.request(2));
+        REQUIRE(modes.state(2) == ModeLifecycle::State::Ready);
+
+        modes.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        REQUIRE(engines.alive[2]);
+        REQUIRE(engines.releases[2] == 0);
+        REQUIRE(engines.prepares[2] == 1);
+    }
+    modes.stop();
+}
+
+TEST_CASE("ModeLifecycle cancels abandoned preparations",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+
+    SECTION("pending request cancelled before the worker runs") {
+        REQUIRE_FALSE(modes.request(7));
+        REQUIRE(modes.retire(7));
+        REQUIRE(modes.state(7) == ModeLifecycle::State::Idle);
+
+        modes.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        REQUIRE(engines.prepares[7] == 0);
+    }
+
+    SECTION("preparation in flight is retired once it completes") {
+        modes.start();
+        engines.gate = false;
+        REQUIRE_FALSE(modes.request(7));
+        REQUIRE(waitForState(modes, 7, ModeLifecycle::State::Preparing));
+
+        // Cannot cancel mid-preparation: keep retrying like the audio thread
+        REQUIRE_FALSE(modes.retire(7));
+        engines.gate = true;
+        bool retired = false;
+        for (int block = 0; block < 5000 && !retired; ++block) {
+            retired = modes.retire(7);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        REQUIRE(retired);
+        REQUIRE(waitForState(modes, 7, ModeLifecycle::State::Idle));
+        REQUIRE_FALSE(engines.alive[7]);
+    }
+    modes.stop();
+}
+
+TEST_CASE("ModeLifecycle treats modes without a slot as always ready",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+
+    REQUIRE(modes.request(-1));
+    REQUIRE(modes.request(kNumModes));
+    REQUIRE(modes.retire(kNumModes + 3));
+    modes.prepareNow(42);
+    for (auto& count : engines.prepares) REQUIRE(count == 0);
+}
+
+TEST_CASE("ModeLifecycle prepareBlocking readies a mode on the calling thread",
+          "[processor][mode_lifecycle]") {
+    FakeEngines engines;
+    ModeLifecycle modes;
+    modes.configure(kNumModes, &FakeEngines::prepare, &FakeEngines::release, &engines);
+
+    SECTION("idle mode is prepared without the worker") {
+        modes.prepareBlocking(4);
+        REQUIRE(modes.state(4) == ModeLifecycle::State::Ready);
+        REQUIRE(engines.alive[4]);
+        REQUIRE(engines.prepares[4] == 1);
+        REQUIRE(modes.request(4));
+    }
+
+    SECTION("pending request is claimed from the worker") {
+        // Worker not started: the request stays pending until we take it
+        REQUIRE_FALSE(modes.request(4));
+        modes.prepareBlocking(4);
+        REQUIRE(modes.request(4));
+
+        modes.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        REQUIRE(engines.prepares[4] == 1);
+    }
+
+    SECTION("preparation in flight on the worker is waited out") {
+        modes.start();
+        engines.gate = false;
+        REQUIRE_FALSE(modes.request(4));
+        REQUIRE(waitForState(modes, 4, ModeLifecycle::State::Preparing));
+
+        std::thread opener([&engines] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            engines.gate = true;
+        });
+        modes.prepareBlocking(4);
+        opener.join();
+        REQUIRE(modes.state(4) == ModeLifecycle::State::Ready);
+        REQUIRE(engines.prepares[4] == 1);
+    }
+
+    SECTION("mode waiting for release is reclaimed without re-preparing") {
+        modes.prepareNow(4);
+        REQUIRE(modes.retire(4));
+        modes.prepareBlocking(4);
+        REQUIRE(modes.state(4) == ModeLifecycle::State::Ready);
+
+        modes.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        REQUIRE(engines.alive[4]);
+        REQUIRE(engines.prepares[4] == 1);
+        REQUIRE(engines.releases[4] == 0);
+    }
+    modes.stop();
+}
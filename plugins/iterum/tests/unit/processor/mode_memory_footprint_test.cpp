@@ -0,0 +1,217 @@
+// ==============================================================================
+// Processor Tests: Delay Mode Memory Footprint
+// ==============================================================================
+// Measures the heap the real Processor holds (glibc mallinfo2) while it plays
+// one mode and while it crossfades between two, driving mode switches through
+// kModeId automation in process(). Offline rendering is used so every switch
+// lands on the block it was automated.
+//
+// Budgets: at rest the processor holds one engine, during a crossfade two, and
+// once a crossfade ends the faded-out engine is released. Absolute ceilings
+// sit ~10% above the figures measured for the on-demand change (largest single
+// engine 8.3 MB / 33.0 MB and worst crossfade pair 14.9 MB / 56.5 MB, at
+// 48 kHz / 192 kHz with 512-sample blocks), against 37.3 MB / 138.7 MB with
+// every mode resident.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processor/processor.h"
+#include "plugin_ids.h"
+#include "delay_mode.h"
+
+#include "pluginterfaces/vst/ivstaudioprocessor.h"
+#include "pluginterfaces/vst/ivstparameterchanges.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "vst_param_changes.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define ITERUM_HAS_MALLINFO2 1
+#endif
+
+using Iterum::DelayMode;
+
+namespace {
+
+constexpr int kNumModes = static_cast<int>(DelayMode::NumModes);
+constexpr Steinberg::int32 kBlockSize = 512;
+
+/// Allocator noise between two readings (Catch bookkeeping, SDK objects)
+constexpr size_t kSlackBytes = 256 * 1024;
+
+constexpr size_t kMB = 1000 * 1000;
+
+#ifdef ITERUM_HAS_MALLINFO2
+
+/// Bytes in use from the arenas plus large blocks glibc served with mmap
+size_t heapInUse() {
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+/// A Processor rendering offline, fed silence
+class OfflineProcessor {
+public:
+    explicit OfflineProcessor(double sampleRate) : sampleRate_(sampleRate) {
+        processor_ = std::make_unique<Iterum::Processor>();
+        REQUIRE(processor_->initialize(nullptr) == Steinberg::kResultTrue);
+        setup();
+        REQUIRE(processor_->setActive(true) == Steinberg::kResultTrue);
+    }
+
+    ~OfflineProcessor() {
+        processor_->setActive(false);
+        processor_->terminate();
+    }
+
+    /// Re-run setupProcessing(): drops every engine and prepares only the
+    /// active mode, synchronously
+    void setup() {
+        Steinberg::Vst::ProcessSetup setup{};
+        setup.processMode = Steinberg::Vst::kOffline;
+        setup.symbolicSampleSize = Steinberg::Vst::kSample32;
+        setup.sampleRate = sampleRate_;
+        setup.maxSamplesPerBlock = kBlockSize;
+        REQUIRE(processor_->setupProcessing(setup) == Steinberg::kResultTrue);
+    }
+
+    /// Process one block, automating the mode first if mode >= 0
+    void block(int mode = -1) {
+        Krate::Test::ParameterChanges changes;
+        if (mode >= 0) {
+            changes.addChange(Iterum::kModeId, static_cast<double>(mode) / 9.0);
+        }
+
+        float* inChannels[2] = {inL_.data(), inR_.data()};
+        float* outChannels[2] = {outL_.data(), outR_.data()};
+        Steinberg::Vst::AudioBusBuffers inputBus{};
+        inputBus.numChannels = 2;
+        inputBus.channelBuffers32 = inChannels;
+        Steinberg::Vst::AudioBusBuffers outputBus{};
+        outputBus.numChannels = 2;
+        outputBus.channelBuffers32 = outChannels;
+
+        Steinberg::Vst::ProcessData data{};
+        data.processMode = Steinberg::Vst::kOffline;
+        data.symbolicSampleSize = Steinberg::Vst::kSample32;
+        data.numSamples = kBlockSize;
+        data.numInputs = 1;
+        data.numOutputs = 1;
+        data.inputs = &inputBus;
+        data.outputs = &outputBus;
+        data.inputParameterChanges = &changes;
+        REQUIRE(processor_->process(data) == Steinberg::kResultTrue);
+    }
+
+    /// Process past the end of a 50 ms crossfade
+    void finishCrossfade() {
+        const auto blocks = static_cast<int>(std::ceil(0.05 * sampleRate_ / kBlockSize)) + 1;
+        for (int i = 0; i < blocks; ++i) block();
+    }
+
+    /// Switch to a mode and let the crossfade complete
+    void switchTo(int mode) {
+        block(mode);
+        finishCrossfade();
+    }
+
+private:
+    double sampleRate_;
+    std::unique_ptr<Iterum::Processor> processor_;
+    std::array<float, kBlockSize> inL_{}, inR_{}, outL_{}, outR_{};
+};
+
+/// The faded-out engine is released by the lifecycle worker: give it time
+bool waitForHeapAtMost(size_t base, size_t limit) {
+    for (int i = 0; i < 2000; ++i) {
+        if (heapInUse() - base <= limit) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+#endif
+
+} // anonymous namespace
+
+TEST_CASE("Processor holds one delay engine at rest and two while crossfading",
+          "[processor][modes][memory]") {
+#ifndef ITERUM_HAS_MALLINFO2
+    SKIP("Heap measurement needs glibc mallinfo2");
+#else
+    struct Budget {
+        double sampleRate;
+        size_t restingBytes;     // processor with its largest single engine
+        size_t crossfadeBytes;   // processor with its worst pair of engines
+    };
+    const std::array<Budget, 2> budgets{{
+        {48000.0, 10 * kMB, 17 * kMB},
+        {192000.0, 37 * kMB, 63 * kMB},
+    }};
+
+    for (const auto& budget : budgets) {
+        INFO(budget.sampleRate << " Hz");
+
+        // Heap held with exactly one mode materialised, per mode, and with none
+        const size_t base = heapInUse();
+        std::array<size_t, kNumModes> resting{};
+        size_t shell = 0;
+        {
+            OfflineProcessor processor(budget.sampleRate);
+            for (int mode = 0; mode < kNumModes; ++mode) {
+                processor.switchTo(mode);
+                processor.setup();
+                resting[static_cast<size_t>(mode)] = heapInUse() - base;
+            }
+        }
+        {
+            auto processor = std::make_unique<Iterum::Processor>();
+            REQUIRE(processor->initialize(nullptr) == Steinberg::kResultTrue);
+            shell = heapInUse() - base;
+            processor->terminate();
+        }
+
+        size_t allResident = shell;
+        for (const size_t bytes : resting) {
+            CHECK(bytes <= budget.restingBytes);
+            allResident += bytes - std::min(bytes, shell);
+        }
+        INFO("all modes resident: " << allResident / kMB << " MB");
+
+        // Walk every mode through automation on one processor
+        const size_t walkBase = heapInUse();
+        OfflineProcessor processor(budget.sampleRate);
+        int current = static_cast<int>(DelayMode::Digital);
+        REQUIRE(heapInUse() - walkBase <= resting[static_cast<size_t>(current)] + kSlackBytes);
+
+        for (int next = 0; next < kNumModes; ++next) {
+            if (next == current) continue;
+            INFO("switch " << current << " -> " << next);
+            const size_t pair = resting[static_cast<size_t>(current)] +
+                                resting[static_cast<size_t>(next)] - shell;
+
+            // Mid-crossfade both engines exist, nothing else
+            processor.block(next);
+            const size_t crossfading = heapInUse() - walkBase;
+            CHECK(crossfading <= pair + kSlackBytes);
+            CHECK(crossfading <= budget.crossfadeBytes);
+            CHECK(crossfading < allResident / 2);
+
+            // Once the crossfade ends the old engine's memory goes back
+            processor.finishCrossfade();
+            CHECK(waitForHeapAtMost(walkBase,
+                                    resting[static_cast<size_t>(next)] + kSlackBytes));
+            current = next;
+        }
+    }
+#endif
+}
@@ -2,8 +2,9 @@
 // Integration Test: Mode Switch Buffer Reset
 // ==============================================================================
 // Regression tests verifying that delay mode buffers are properly cleared when
-// switching modes. The processor keeps all 10 effect instances alive, but only
-// calls process() on the active mode. When switching to a new mode,
+// switching modes. A mode's engine can stay alive while it is not being
+// processed (e.g. reclaimed before its memory was handed back), so when
+// switching to a new mode,
 // Processor::resetMode() clears the target effect's delay buffers so stale
 // audio from a previous session doesn't play back as "ghost" echoes.
 //
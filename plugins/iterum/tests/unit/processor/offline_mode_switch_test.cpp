@@ -0,0 +1,128 @@
+// ==============================================================================
+// Processor Tests: Offline Mode Switching
+// ==============================================================================
+// When the host renders offline, a mode selected by automation must take over
+// on the block it was selected, not whenever the background worker finishes
+// preparing it. Two bounces of the same session must be bit-identical.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processor/processor.h"
+#include "plugin_ids.h"
+#include "delay_mode.h"
+
+#include "pluginterfaces/vst/ivstaudioprocessor.h"
+#include "pluginterfaces/vst/ivstparameterchanges.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "vst_param_changes.h"
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+constexpr Steinberg::int32 kBlockSize = 512;
+constexpr int kNumBlocks = 96;
+constexpr int kSwitchBlock = 64;  // late enough for Digital's echoes to sound
+
+double modeToNormalized(Iterum::DelayMode mode) {
+    return static_cast<double>(mode) / 9.0;
+}
+
+/// Render a fixed session offline, optionally automating the mode at
+/// kSwitchBlock. Returns the left output of every block, concatenated.
+std::vector<float> renderOffline(bool switchMode) {
+    auto processor = std::make_unique<Iterum::Processor>();
+    REQUIRE(processor->initialize(nullptr) == Steinberg::kResultTrue);
+
+    Steinberg::Vst::ProcessSetup setup{};
+    setup.processMode = Steinberg::Vst::kOffline;
+    setup.symbolicSampleSize = Steinberg::Vst::kSample32;
+    setup.sampleRate = kSampleRate;
+    setup.maxSamplesPerBlock = kBlockSize;
+    REQUIRE(processor->setupProcessing(setup) == Steinberg::kResultTrue);
+    REQUIRE(processor->setActive(true) == Steinberg::kResultTrue);
+
+    std::vector<float> inL(kBlockSize), inR(kBlockSize);
+    std::vector<float> outL(kBlockSize), outR(kBlockSize);
+    std::vector<float> rendered;
+    rendered.reserve(static_cast<size_t>(kNumBlocks * kBlockSize));
+
+    for (int block = 0; block < kNumBlocks; ++block) {
+        // Short bursts so the delay lines carry audible echoes
+        for (Steinberg::int32 i = 0; i < kBlockSize; ++i) {
+            const int n = block * kBlockSize + i;
+            const bool burst = (n % 22050) < 2205;
+            inL[static_cast<size_t>(i)] = burst
+                ? static_cast<float>(0.5 * std::sin(6.283185307179586 * 440.0 * n / kSampleRate))
+                : 0.0f;
+            inR[static_cast<size_t>(i)] = inL[static_cast<size_t>(i)];
+        }
+
+        Krate::Test::ParameterChanges changes;
+        if (switchMode && block == kSwitchBlock) {
+            changes.addChange(Iterum::kModeId,
+                              modeToNormalized(Iterum::DelayMode::PingPong));
+        }
+
+        float* inChannels[2] = {inL.data(), inR.data()};
+        float* outChannels[2] = {outL.data(), outR.data()};
+        Steinberg::Vst::AudioBusBuffers inputBus{};
+        inputBus.numChannels = 2;
+        inputBus.channelBuffers32 = inChannels;
+        Steinberg::Vst::AudioBusBuffers outputBus{};
+        outputBus.numChannels = 2;
+        outputBus.channelBuffers32 = outChannels;
+
+        Steinberg::Vst::ProcessData data{};
+        data.processMode = Steinberg::Vst::kOffline;
+        data.symbolicSampleSize = Steinberg::Vst::kSample32;
+        data.numSamples = kBlockSize;
+        data.numInputs = 1;
+        data.numOutputs = 1;
+        data.inputs = &inputBus;
+        data.outputs = &outputBus;
+        data.inputParameterChanges = &changes;
+        REQUIRE(processor->process(data) == Steinberg::kResultTrue);
+
+        rendered.insert(rendered.end(), outL.begin(), outL.end());
+    }
+
+    processor->setActive(false);
+    processor->terminate();
+    return rendered;
+}
+
+bool blockDiffers(const std::vector<float>& a, const std::vector<float>& b, int block) {
+    const auto begin = static_cast<size_t>(block * kBlockSize);
+    for (size_t i = begin; i < begin + static_cast<size_t>(kBlockSize); ++i) {
+        if (a[i] != b[i]) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("Offline mode switch takes over on the block it was automated",
+          "[processor][modes][offline]") {
+    const auto reference = renderOffline(false);
+    const auto switched = renderOffline(true);
+
+    for (int block = 0; block < kSwitchBlock; ++block) {
+        INFO("block " << block);
+        REQUIRE_FALSE(blockDiffers(reference, switched, block));
+    }
+    // The crossfade starts immediately: Digital's echoes begin fading out
+    REQUIRE(blockDiffers(reference, switched, kSwitchBlock));
+}
+
+TEST_CASE("Offline bounces with mode automation are bit-identical",
+          "[processor][modes][offline]") {
+    const auto first = renderOffline(true);
+    for (int bounce = 0; bounce < 3; ++bounce) {
+        const auto again = renderOffline(true);
+        REQUIRE(again == first);
+    }
+}
@@ -778,6 +778,19 @@ tresult PLUGIN_API Controller::initialize(FUnknown* context)
     return kResultOk;
 }
 
+// ==============================================================================
+// requestStringBodies -- "PrepareStringBodies" IMessage to the processor
+// ==============================================================================
+
+void Controller::requestStringBodies()
+{
+    auto* msg = allocateMessage();
+    if (msg == nullptr) return;
+    Steinberg::IPtr<Steinberg::Vst::IMessage> owned(msg, false);
+    owned->setMessageID("PrepareStringBodies");
+    sendMessage(owned);
+}
+
 // ==============================================================================
 // setParamNormalized override -- Phase 4 proxy logic
 // ==============================================================================
@@ -807,6 +820,21 @@ tresult PLUGIN_API Controller::setParamNormalized(ParamID tag, ParamValue value)
         requestViewRefresh(kRefreshPitchEnvControls | kRefreshMorphToggleVis);
     }
 
+    // The processor's voice pool holds the String body's waveguides only while
+    // a pad uses that body and never allocates them on the audio thread, so a
+    // String selection (global proxy or per-pad param, from any source) asks
+    // it to allocate them now. Until they arrive the pad plays a modal
+    // approximation.
+    if (tag == static_cast<ParamID>(kBodyModelId)
+        || padOffsetFromParamId(static_cast<int>(tag)) == kPadBodyModel)
+    {
+        const int body = std::clamp(
+            static_cast<int>(value * static_cast<double>(BodyModelType::kCount)),
+            0, static_cast<int>(BodyModelType::kCount) - 1);
+        if (body == static_cast<int>(BodyModelType::String))
+            requestStringBodies();
+    }
+
     // Tone Shaper filter-envelope display: repaint the curve whenever any of
     // the four A/D/S/R parameters moves, regardless of source (knob edit,
     // automation, preset load, or the direct-setter pad-switch sync path).
@@ -329,6 +329,10 @@ private:
     /// Invoke the helper for each set bit. Always runs on the UI thread.
     void applyViewRefresh(std::uint32_t flags) noexcept;
 
+    /// Ask the processor to allocate its voice pool's String body waveguides
+    /// ("PrepareStringBodies" message) once a pad is switched to String.
+    void requestStringBodies();
+
     /// Phase 8F: push the per-pad enable flags from a freshly-loaded
     /// KitSnapshot into the PadGridView mirror. Both load paths
     /// (setComponentState, kitPresetLoadProvider) write through setters
@@ -59,7 +59,7 @@ struct MembraneBody
 
     // Block-rate fast path (Phase 9 SIMD emergency fallback / plan.md §SIMD).
     // Delegates to ModalResonatorBank::processBlock, which uses the Highway
-    // SIMD kernel (processModalBankSampleSIMD) for the per-mode inner loop.
+    // SIMD kernel (processModalBankBlockSIMD) for the per-mode inner loop.
     void processBlock(Krate::DSP::ModalResonatorBank& sharedBank,
                       const float* excitation,
                       float* out,
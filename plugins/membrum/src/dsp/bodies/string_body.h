@@ -3,8 +3,18 @@
 // ==============================================================================
 // StringBody -- Phase 2 (data-model.md §3.6)
 // ==============================================================================
-// Owns a Krate::DSP::WaveguideString. Ignores the shared ModalResonatorBank
-// entirely (FR-023, first body model to break out of the shared bank).
+// Drives a Krate::DSP::WaveguideString. Ignores the shared ModalResonatorBank
+// entirely (FR-023, first body model to break out of the shared bank) --
+// except while no waveguide is bound, see below.
+//
+// The waveguide itself is owned by BodyBank (or by the VoicePool, through
+// BodyBank::setExternalString) and prepared there (its delay lines allocate),
+// the same way the modal bodies borrow the shared bank. This body only holds a
+// pointer bound by BodyBank, so swapping it in on the audio thread just
+// re-seeds and silences the string -- no allocation. While no waveguide is
+// bound (a pooled voice whose owner has not allocated them yet) the body plays
+// StringMapper::mapModes() through the shared bank instead, so a String pad
+// never drops a hit.
 //
 // The waveguide lifecycle used here is:
 //   configureForNoteOn()
@@ -27,65 +37,87 @@ namespace Membrum {
 
 struct StringBody
 {
-    Krate::DSP::WaveguideString string_;
+    /// Bank-bound waveguide, already prepared at the voice's sample rate.
+    Krate::DSP::WaveguideString* string_ = nullptr;
 
-    void prepare(double sampleRate, std::uint32_t voiceId) noexcept
+    void prepare(double /*sampleRate*/, std::uint32_t voiceId) noexcept
     {
-        string_.prepare(sampleRate);
-        string_.prepareVoice(voiceId);
+        if (string_ == nullptr)
+            return;
+        string_->prepareVoice(voiceId);
+        string_->silence();
     }
 
-    void reset(Krate::DSP::ModalResonatorBank& /*sharedBank*/) noexcept
+    void reset(Krate::DSP::ModalResonatorBank& sharedBank) noexcept
     {
-        string_.silence();
+        if (string_ != nullptr)
+            string_->silence();
+        else
+            sharedBank.reset();
     }
 
-    void configureForNoteOn(Krate::DSP::ModalResonatorBank& /*sharedBank*/,
+    void configureForNoteOn(Krate::DSP::ModalResonatorBank& sharedBank,
                             const VoiceCommonParams& params,
                             float pitchHz) noexcept
     {
+        if (string_ == nullptr)
+        {
+            const auto r = Bodies::StringMapper::mapModes(params, pitchHz);
+            sharedBank.setModes(r.frequencies, r.amplitudes, r.numPartials,
+                                r.damping, r.stretch, r.scatter);
+            return;
+        }
+
         const auto r = Bodies::StringMapper::map(params, pitchHz);
 
-        string_.setFrequency(r.frequencyHz);
-        string_.setDecay(r.decayTime);
-        string_.setBrightness(r.brightness);
-        string_.setPickPosition(r.pickPosition);
+        string_->setFrequency(r.frequencyHz);
+        string_->setDecay(r.decayTime);
+        string_->setBrightness(r.brightness);
+        string_->setPickPosition(r.pickPosition);
 
         // Initialize delay lines and loop state at the target frequency.
         // The excitation noise burst it writes is fine; once the exciter
         // starts feeding samples through processSample, that transient
         // plus the external excitation drives the waveguide.
-        string_.noteOn(r.frequencyHz, 1.0f);
+        string_->noteOn(r.frequencyHz, 1.0f);
     }
 
-    // IMPORTANT: IGNORES sharedBank (FR-023, shared-bank isolation contract).
+    // IMPORTANT: IGNORES sharedBank while the waveguide is bound (FR-023,
+    // shared-bank isolation contract).
     [[nodiscard]] float processSample(
-        Krate::DSP::ModalResonatorBank& /*sharedBank*/,
+        Krate::DSP::ModalResonatorBank& sharedBank,
         float excitation) noexcept
     {
-        return string_.process(excitation);
+        return string_ != nullptr ? string_->process(excitation)
+                                  : sharedBank.processSample(excitation);
     }
 
     /// String body doesn't use the modal bank, so the no-smooth variant is
     /// just the same per-sample call. Symmetric API for the slow-path caller.
     [[nodiscard]] float processSampleNoSmooth(
-        Krate::DSP::ModalResonatorBank& /*sharedBank*/,
+        Krate::DSP::ModalResonatorBank& sharedBank,
         float excitation) noexcept
     {
-        return string_.process(excitation);
+        return string_ != nullptr ? string_->process(excitation)
+                                  : sharedBank.processSampleNoSmooth(excitation);
     }
 
     // Block-rate entry point (Phase 9 SIMD emergency fallback / plan.md §SIMD).
     // WaveguideString has no SIMD block entry, so we loop per-sample. The
     // real win here is that the outer per-sample chain (unnatural + tone
     // shaper + env) can still be block-free of std::variant dispatch.
-    void processBlock(Krate::DSP::ModalResonatorBank& /*sharedBank*/,
+    void processBlock(Krate::DSP::ModalResonatorBank& sharedBank,
                       const float* excitation,
                       float* out,
                       int numSamples) noexcept
     {
+        if (string_ == nullptr)
+        {
+            sharedBank.processBlock(excitation, out, numSamples);
+            return;
+        }
         for (int i = 0; i < numSamples; ++i)
-            out[i] = string_.process(excitation[i]);
+            out[i] = string_->process(excitation[i]);
     }
 };
 
@@ -11,12 +11,17 @@
 //   Strike pos    -> pickPosition (forwarded directly, FR-023)
 //   Material      -> brightness / decay (FR-033)
 //   Decay         -> decayTime multiplier
+//
+// mapModes() renders the same settings as a harmonic series for the shared
+// modal bank, which StringBody plays while no waveguide is bound.
 // ==============================================================================
 
 #include "../voice_common_params.h"
+#include "membrane_mapper.h"  // for MapperResult
 
 #include <algorithm>
 #include <cmath>
+#include <numbers>
 
 namespace Membrum::Bodies {
 
@@ -63,6 +68,35 @@ struct StringMapper
         return r;
     }
 
+    /// Harmonic approximation of the plucked string for the shared modal bank:
+    /// partials k*f0 with the ideal pick-position spectrum |sin(k*pi*pick)|/k.
+    /// The waveguide's loop filter darkens with `brightness`, the modal damping
+    /// law with falling brightness, so the modal brightness is its complement.
+    static constexpr int kModeCount = 16;
+
+    [[nodiscard]] static MapperResult mapModes(
+        const VoiceCommonParams& params,
+        float pitchHz) noexcept
+    {
+        const auto s = map(params, pitchHz);
+
+        MapperResult r{};
+        for (int k = 0; k < kModeCount; ++k)
+        {
+            const auto harmonic = static_cast<float>(k + 1);
+            r.frequencies[k] = s.frequencyHz * harmonic;
+            r.amplitudes[k] = std::max(
+                std::abs(std::sin(harmonic * std::numbers::pi_v<float> * s.pickPosition))
+                    / harmonic,
+                1.0e-3f);
+        }
+        r.numPartials = kModeCount;
+        r.decayTime   = s.decayTime;
+        r.brightness  = 1.0f - s.brightness;
+        r.damping     = dampingLawFromParams(params, r.decayTime, r.brightness);
+        return r;
+    }
+
 private:
     static float lerp(float a, float b, float t) noexcept
     {
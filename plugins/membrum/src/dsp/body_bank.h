@@ -6,6 +6,12 @@
 // Owns the shared ModalResonatorBank plus a std::variant of 6 body backends.
 // Deferred-swap pattern: setBodyModel() stores pendingType_ only; the swap
 // happens inside configureForNoteOn() called at the start of DrumVoice::noteOn.
+//
+// The swap runs on the audio thread, so everything a body allocates lives here
+// and is prepared in prepare(): the shared modal bank, and the String body's
+// WaveguideString (bound into StringBody on every swap). A pooled voice can
+// hand the waveguide off to its owner instead (useExternalString()), so only
+// owners with a String pad pay for the delay lines.
 // ==============================================================================
 
 #include "bodies/bell_body.h"
@@ -30,16 +36,61 @@ class BodyBank
 public:
     BodyBank() noexcept : active_(std::in_place_type<MembraneBody>) {}
 
+    // StringBody points into this bank's ownString_, so a copy would alias it.
+    BodyBank(const BodyBank&) = delete;
+    BodyBank& operator=(const BodyBank&) = delete;
+    BodyBank(BodyBank&&) = delete;
+    BodyBank& operator=(BodyBank&&) = delete;
+
+    /// NOT real-time safe: allocates the String body's delay lines, unless
+    /// useExternalString() handed them to the owner.
     void prepare(double sampleRate, std::uint32_t voiceId) noexcept
     {
         sampleRate_ = sampleRate;
         voiceId_    = voiceId;
         sharedBank_.prepare(sampleRate);
+        if (!externalString_)
+        {
+            ownString_.prepare(sampleRate);
+            string_ = &ownString_;
+        }
+        bindString();
         std::visit([sampleRate, voiceId](auto& b) noexcept {
             b.prepare(sampleRate, voiceId);
         }, active_);
     }
 
+    /// The owner supplies the String waveguide through setExternalString()
+    /// instead of this bank preparing its own. Call before prepare().
+    void useExternalString() noexcept
+    {
+        externalString_ = true;
+        string_         = nullptr;
+    }
+
+    /// Bind an owner-supplied waveguide, already prepared at this bank's
+    /// sample rate, or nullptr while there is none (the String body then plays
+    /// its modal approximation through the shared bank). A String body already
+    /// in place is re-seeded and silenced.
+    /// Real-time safe.
+    void setExternalString(Krate::DSP::WaveguideString* string) noexcept
+    {
+        if (!externalString_ || string == string_)
+            return;
+        string_ = string;
+        if (auto* s = std::get_if<StringBody>(&active_))
+        {
+            s->string_ = string_;
+            s->prepare(sampleRate_, voiceId_);
+        }
+    }
+
+    /// Heap held by this bank (its own String body delay lines, if any).
+    [[nodiscard]] std::size_t heapBytes() const noexcept
+    {
+        return externalString_ ? 0 : ownString_.heapBytes();
+    }
+
     void reset() noexcept
     {
         sharedBank_.reset();
@@ -81,8 +132,8 @@ public:
     // Single std::visit dispatch per block. Each body variant implements
     // processBlock(sharedBank, excitation, out, numSamples) which routes the
     // modal work through ModalResonatorBank::processBlock — the SIMD-accelerated
-    // fast path (Highway kernel processModalBankSampleSIMD). This is what makes
-    // the per-voice CPU budget meetable at 40 NoiseBody modes.
+    // fast path (time-blocked Highway kernel processModalBankBlockSIMD). This is
+    // what makes the per-voice CPU budget meetable at 40 NoiseBody modes.
     //
     //   out        : pointer to numSamples floats to overwrite
     //   excitation : pointer to numSamples input samples
@@ -117,14 +168,14 @@ public:
     void setLastOutput(float y) noexcept { lastOutput_ = y; }
 
     // Audit H-3: retune the active String waveguide to an absolute pitch (Hz).
-    // The String body owns a WaveguideString instead of the shared modal bank,
+    // The String body drives a WaveguideString instead of the shared modal bank,
     // so the pitch-envelope path can't reach it through updateModes(); this
     // routes the per-sample/block pitch into the waveguide's frequency smoother.
     // No-op for every modal body (their pitch is handled via the shared bank).
     void setStringFrequency(float pitchHz) noexcept
     {
-        if (auto* s = std::get_if<StringBody>(&active_))
-            s->string_.setFrequency(pitchHz);
+        if (string_ != nullptr && std::holds_alternative<StringBody>(active_))
+            string_->setFrequency(pitchHz);
     }
 
     // Audit M-1: re-apply the String mapper's material-derived settings
@@ -133,11 +184,11 @@ public:
     // morph doesn't fight the pitch-envelope glide. No-op for modal bodies.
     void refreshStringMaterial(const VoiceCommonParams& params) noexcept
     {
-        if (auto* s = std::get_if<StringBody>(&active_))
+        if (string_ != nullptr && std::holds_alternative<StringBody>(active_))
         {
             const auto r = Bodies::StringMapper::map(params, 0.0f);
-            s->string_.setBrightness(r.brightness);
-            s->string_.setDecay(r.decayTime);
+            string_->setBrightness(r.brightness);
+            string_->setDecay(r.decayTime);
         }
     }
 
@@ -200,11 +251,21 @@ private:
 
         const double sr        = sampleRate_;
         const std::uint32_t vid = voiceId_;
+        bindString();
         std::visit([sr, vid](auto& b) noexcept { b.prepare(sr, vid); }, active_);
     }
 
+    void bindString() noexcept
+    {
+        if (auto* s = std::get_if<StringBody>(&active_))
+            s->string_ = string_;
+    }
+
     Variant                          active_;
     Krate::DSP::ModalResonatorBank   sharedBank_;
+    Krate::DSP::WaveguideString      ownString_;  // Unprepared when external
+    Krate::DSP::WaveguideString*     string_         = nullptr;  // Driven by StringBody only
+    bool                             externalString_ = false;
     BodyModelType                    currentType_ = BodyModelType::Membrane;
     BodyModelType                    pendingType_ = BodyModelType::Membrane;
     float                            lastOutput_  = 0.0f;
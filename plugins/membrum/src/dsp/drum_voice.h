@@ -45,6 +45,7 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <memory>
 #include <numbers>
 
 namespace Membrum {
@@ -106,6 +107,14 @@ public:
         bodyBank_.getSharedBank().damp(kFastReleaseDampScale);
     }
 
+    /// Stop rendering immediately. Used by VoicePool once a stolen voice's
+    /// fade tail has been captured; the next noteOn() re-arms the voice.
+    void silence() noexcept
+    {
+        active_           = false;
+        silentBlockCount_ = 0;
+    }
+
     // ------------------------------------------------------------------
     // Lifecycle
     // ------------------------------------------------------------------
@@ -121,6 +130,12 @@ public:
         sampleRate_ = sampleRate;
         voiceId_    = voiceId;
 
+        if (scratch_ == nullptr)
+        {
+            ownScratch_ = std::make_unique<Scratch>();
+            scratch_    = ownScratch_.get();
+        }
+
         exciterBank_.prepare(sampleRate, voiceId);
         bodyBank_.prepare(sampleRate, voiceId);
         // Phase 8D: secondary bank lives parallel to the primary body bank.
@@ -588,7 +603,65 @@ public:
     //     per-sample inner loop for correctness.
     static constexpr int kMaxBlockSize = 2048;
 
+    /// Work buffers for the fast path. Holds no state between calls, so one
+    /// set can serve any number of voices rendered one after another;
+    /// VoicePool shares one set across all of its voices.
+    struct Scratch
+    {
+        std::array<float, kMaxBlockSize> exc{};
+        std::array<float, kMaxBlockSize> body{};
+        std::array<float, kMaxBlockSize> noise{};
+        std::array<float, kMaxBlockSize> click{};
+        // Phase 8D: secondary (shell) bank excitation and output.
+        std::array<float, kMaxBlockSize> secondaryExc{};
+        std::array<float, kMaxBlockSize> secondaryOut{};
+    };
+
+    /// Render with externally owned scratch. Call before prepare(): a voice
+    /// that already has scratch does not allocate its own there.
+    void setScratch(Scratch* scratch) noexcept
+    {
+        scratch_ = scratch;
+    }
+
+    /// Leave the String body's waveguide to the owner (see
+    /// BodyBank::useExternalString). Call before prepare().
+    void useExternalString() noexcept
+    {
+        bodyBank_.useExternalString();
+    }
+
+    /// Bind the owner's waveguide for the String body, or nullptr for none.
+    /// Real-time safe.
+    void setExternalString(Krate::DSP::WaveguideString* string) noexcept
+    {
+        bodyBank_.setExternalString(string);
+    }
+
+    /// Heap owned by this voice beyond sizeof(DrumVoice): the exciter and
+    /// body banks' buffers, plus its own scratch if it allocated one.
+    /// Scratch supplied through setScratch() belongs to the caller.
+    [[nodiscard]] std::size_t heapBytes() const noexcept
+    {
+        return exciterBank_.heapBytes() + bodyBank_.heapBytes()
+             + (ownScratch_ != nullptr ? sizeof(Scratch) : 0);
+    }
+
+    /// Render into `out` using the voice's own (or setScratch()) buffers.
     void processBlock(float* out, int numSamples) noexcept
+    {
+        if (scratch_ == nullptr)
+        {
+            // Unprepared voice: nothing to render with.
+            for (int i = 0; i < numSamples; ++i)
+                out[i] = 0.0f;
+            return;
+        }
+        processBlock(out, numSamples, *scratch_);
+    }
+
+    /// Render into `out` using caller-provided `scratch`.
+    void processBlock(float* out, int numSamples, Scratch& scratch) noexcept
     {
         if (numSamples <= 0)
             return;
@@ -625,7 +698,8 @@ public:
         }
         else
         {
-            processBlockFast(out, numSamples, level, morphActive, pitchEnvActive);
+            processBlockFast(out, numSamples, scratch, level, morphActive,
+                             pitchEnvActive);
         }
 
         // Phase 8A.5 retirement: the amp envelope is now only a click-free
@@ -681,16 +755,18 @@ private:
     // slow path instead to preserve strict per-sample semantics.
     void processBlockFast(float* out,
                           int numSamples,
+                          Scratch& scratch,
                           float level,
                           bool morphActive,
                           bool pitchEnvActive) noexcept
     {
-        // Scratch buffers live as DrumVoice members so we don't pay a large
-        // stack allocation per processBlock call (audio-thread friendly).
-        float* excScratch   = excScratch_.data();
-        float* bodyScratch  = bodyScratch_.data();
-        float* noiseScratch = noiseScratch_.data();
-        float* clickScratch = clickScratch_.data();
+        // Scratch buffers come from the caller (pool arena or the voice's
+        // own set) so we don't pay a large stack allocation per
+        // processBlock call (audio-thread friendly).
+        float* excScratch   = scratch.exc.data();
+        float* bodyScratch  = scratch.body.data();
+        float* noiseScratch = scratch.noise.data();
+        float* clickScratch = scratch.click.data();
 
         int offset = 0;
         int remaining = numSamples;
@@ -809,8 +885,8 @@ private:
             // (processBlockSlow) applies the same stage per-sample.
             if (effectiveCoupling_ > 0.0f)
             {
-                float* secExc = secondaryExcScratch_.data();
-                float* secOut = secondaryOutScratch_.data();
+                float* secExc = scratch.secondaryExc.data();
+                float* secOut = scratch.secondaryOut.data();
                 // Secondary excitation = primary body samples * coupling.
                 // This is feedforward (body → shell), not feedback.
                 for (int i = 0; i < chunk; ++i)
@@ -1311,11 +1387,11 @@ private:
     //
     // RT-safe / allocation-free: this reuses the voice's LIVE exciter and click
     // layer (already prepared in DrumVoice::prepare) rather than constructing
-    // local copies -- ImpactExciter::prepare allocates a comb-delay line, so a
-    // per-probe local ExciterBank would allocate on the audio thread. Triggering
-    // exciterBank_ here applies the deferred exciter-type swap that noteOn()
-    // performs a few lines later anyway (so the net allocation is unchanged),
-    // and both components are re-triggered for the audible note below --
+    // local copies -- a per-probe local ExciterBank would have to acquire the
+    // FM sine table on the audio thread. Triggering exciterBank_ here applies
+    // the deferred exciter-type swap that noteOn() performs a few lines later
+    // anyway (the swap itself is lock- and allocation-free), and both
+    // components are re-triggered for the audible note below --
     // trigger() fully re-seeds/resets their state, so the probe leaves no
     // residue on the note (bit-identity preserved). exciterType is passed only
     // to key the cache; the live bank already holds the pending type.
@@ -1673,18 +1749,12 @@ private:
     ClickLayer                 clickLayer_;
     Krate::DSP::ADSREnvelope   ampEnvelope_;
 
-    // Scratch buffers for the fast block-rate path. Kept as members so each
-    // processBlock call avoids the 16 KB stack footprint of 2048-sample
-    // float arrays. Audio-thread safe (no allocation, pre-sized).
-    std::array<float, kMaxBlockSize> excScratch_{};
-    std::array<float, kMaxBlockSize> bodyScratch_{};
-    std::array<float, kMaxBlockSize> noiseScratch_{};
-    std::array<float, kMaxBlockSize> clickScratch_{};
-    // Phase 8D: secondary bank (head <-> shell coupling). Separate scratch
-    // holds the secondary excitation and output for the fast-path's
-    // block-rate coupling loop.
-    std::array<float, kMaxBlockSize> secondaryExcScratch_{};
-    std::array<float, kMaxBlockSize> secondaryOutScratch_{};
+    // Scratch for the fast block-rate path (48 KiB). Either supplied by the
+    // owner via setScratch() or allocated by prepare() into ownScratch_, so
+    // pooled voices share a few sets instead of carrying one each.
+    Scratch*                 scratch_ = nullptr;
+    std::unique_ptr<Scratch> ownScratch_{};
+    // Phase 8D: secondary bank (head <-> shell coupling).
     Krate::DSP::ModalResonatorBank   secondaryBank_{};
     float secondaryLastOutput_ = 0.0f;
 
@@ -7,6 +7,11 @@
 // std::visit, and implements the deferred-swap pattern (setExciterType writes
 // pendingType_ only; the swap happens inside trigger() if pendingType_ differs
 // from currentType_).
+//
+// The swap runs on the audio thread, so every alternative's prepare() must be
+// lock- and allocation-free there: the bank pins the FMImpulse sine table and
+// owns the Friction BowExciter (both bound into the variant on every swap),
+// and the ImpactExciter-based variants skip their comb buffer.
 // ==============================================================================
 
 #include "exciter_type.h"
@@ -28,15 +33,35 @@ class ExciterBank
 public:
     ExciterBank() noexcept : active_(std::in_place_type<ImpulseExciter>) {}
 
+    // FrictionExciter points into this bank's frictionCore_, so a copy would
+    // alias it.
+    ExciterBank(const ExciterBank&) = delete;
+    ExciterBank& operator=(const ExciterBank&) = delete;
+    ExciterBank(ExciterBank&&) = delete;
+    ExciterBank& operator=(ExciterBank&&) = delete;
+
+    /// NOT real-time safe: pins the shared FM sine table on first call and
+    /// prepares the Friction bow.
     void prepare(double sampleRate, std::uint32_t voiceId) noexcept
     {
         sampleRate_ = sampleRate;
         voiceId_    = voiceId;
+        if (!fmSineTable_)
+            fmSineTable_ = Krate::DSP::FMOperator::acquireSineTable();
+        frictionCore_.prepare(sampleRate);
+        bindSharedResources();
         std::visit([sampleRate, voiceId](auto& e) noexcept {
             e.prepare(sampleRate, voiceId);
         }, active_);
     }
 
+    /// Heap held by this bank (the Friction bow). The FM sine table is
+    /// shared process-wide and not counted.
+    [[nodiscard]] std::size_t heapBytes() const noexcept
+    {
+        return frictionCore_.heapBytes();
+    }
+
     void reset() noexcept
     {
         std::visit([](auto& e) noexcept { e.reset(); }, active_);
@@ -223,6 +248,7 @@ private:
 
         const double sr        = sampleRate_;
         const std::uint32_t vid = voiceId_;
+        bindSharedResources();
         std::visit([sr, vid](auto& e) noexcept { e.prepare(sr, vid); }, active_);
 
         // Phase 7: replay the last cached contact-ms into the freshly-swapped
@@ -242,7 +268,19 @@ private:
             std::get<MalletExciter>(active_).setBodySizeHint(pendingMalletSizeHint_);
     }
 
+    void bindSharedResources() noexcept
+    {
+        if (auto* fm = std::get_if<FMImpulseExciter>(&active_))
+            fm->setSineTable(fmSineTable_.get());
+        else if (auto* friction = std::get_if<FrictionExciter>(&active_))
+            friction->setSharedCore(&frictionCore_);
+    }
+
     Variant      active_;
+    // Pinned for the bank's lifetime; FMImpulseExciter only borrows it, so
+    // swapping that variant in or out never locks the WavetableCache.
+    Krate::DSP::WavetableCache::Handle fmSineTable_;
+    Krate::DSP::BowExciter             frictionCore_;  // Driven by FrictionExciter only
     ExciterType  currentType_ = ExciterType::Impulse;
     ExciterType  pendingType_ = ExciterType::Impulse;
     double       sampleRate_  = 44100.0;
@@ -14,9 +14,11 @@
 //   modulation index = lerp(0.5, 3.0, velocity)
 //   amplitude        = velocity
 //
-// NOTE: FMOperator::prepare() is NOT real-time safe (wavetable generation).
-//       prepare() is only called from DrumVoice::prepare() (host setup),
-//       never on the audio thread.
+// NOTE: FMOperator::prepare(double) is NOT real-time safe (locks the
+//       WavetableCache). ExciterBank pins the sine table once in its own
+//       prepare() and binds it with setSineTable(), so the prepare() that runs
+//       on the audio thread when the bank swaps this variant in never touches
+//       the cache. Without a bound table the operators acquire their own.
 // ==============================================================================
 
 #include <krate/dsp/processors/fm_operator.h>
@@ -32,8 +34,16 @@ struct FMImpulseExciter
     void prepare(double sampleRate, std::uint32_t /*voiceId*/) noexcept
     {
         sampleRate_ = sampleRate;
-        carrier_.prepare(sampleRate);
-        modulator_.prepare(sampleRate);
+        if (sineTable_ != nullptr)
+        {
+            carrier_.prepare(sampleRate, sineTable_);
+            modulator_.prepare(sampleRate, sineTable_);
+        }
+        else
+        {
+            carrier_.prepare(sampleRate);
+            modulator_.prepare(sampleRate);
+        }
 
         carrier_.setRatio(1.0f);
         modulator_.setRatio(1.0f);
@@ -112,6 +122,13 @@ struct FMImpulseExciter
         modulatorRatioNorm_ = std::clamp(normalized, 0.0f, 1.0f);
     }
 
+    /// Bind a sine table pinned by the owner (FMOperator::acquireSineTable())
+    /// for the next prepare(). The owner keeps the table alive.
+    void setSineTable(const Krate::DSP::WavetableData* table) noexcept
+    {
+        sineTable_ = table;
+    }
+
     [[nodiscard]] float process(float /*bodyFeedback*/) noexcept
     {
         if (!active_)
@@ -148,6 +165,7 @@ struct FMImpulseExciter
 private:
     Krate::DSP::FMOperator carrier_{};
     Krate::DSP::FMOperator modulator_{};
+    const Krate::DSP::WavetableData* sineTable_ = nullptr;
     double sampleRate_       = 44100.0;
     float  ampEnv_           = 0.0f;
     float  modIndexEnv_      = 0.0f;
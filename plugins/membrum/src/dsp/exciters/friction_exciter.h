@@ -16,6 +16,12 @@
 // The bow auto-releases when the envelope reaches its decay stage's sustain
 // level (0) — we explicitly gate off at the end of the envelope's decay so
 // the bow naturally stops oscillating.
+//
+// BowExciter::prepare() allocates (its rosin LFO builds wavetables), so
+// ExciterBank owns and prepares one BowExciter per voice and binds it with
+// setSharedCore(); the prepare() that runs when the bank swaps this variant
+// in on the audio thread then only resets it. Unbound, the exciter prepares
+// its own core.
 // ==============================================================================
 
 #include <krate/dsp/primitives/adsr_envelope.h>
@@ -33,7 +39,8 @@ struct FrictionExciter
     void prepare(double sampleRate, std::uint32_t /*voiceId*/) noexcept
     {
         sampleRate_ = sampleRate;
-        core_.prepare(sampleRate);
+        if (sharedCore_ == nullptr)
+            ownCore_.prepare(sampleRate);
         bowEnvelope_.prepare(static_cast<float>(sampleRate));
         // Transient envelope: A=1ms, D=40ms, S=0, R=5ms → ≤50 ms total (FR-013).
         bowEnvelope_.setAttack(1.0f);
@@ -53,7 +60,7 @@ struct FrictionExciter
 
     void reset() noexcept
     {
-        core_.reset();
+        core().reset();
         bowEnvelope_.reset();
         bodyFilter_.reset();
         sampleCounter_ = 0;
@@ -76,11 +83,11 @@ struct FrictionExciter
         // FR-013: velocity → pressure, speed. The Friction Pressure parameter
         // adds an extra bow-pressure bias on top of the velocity baseline
         // (amount=0 -> legacy behaviour, amount=1 -> +0.5 heavier bowing).
-        core_.setPressure(
+        core().setPressure(
             std::clamp(0.1f + (0.5f - 0.1f) * velocity + pressureAmount_ * 0.5f,
                        0.0f, 1.0f));
-        core_.setSpeed(0.2f + (0.8f - 0.2f) * velocity);
-        core_.setPosition(0.13f); // default bridge-ish position
+        core().setSpeed(0.2f + (0.8f - 0.2f) * velocity);
+        core().setPosition(0.13f); // default bridge-ish position
 
         // FR-016/SC-004: velocity drives spectral centroid via bandpass cutoff.
         const float cutoff = 400.0f * std::pow(20.0f, velocity); // 400 → 8000 Hz
@@ -92,14 +99,14 @@ struct FrictionExciter
         bowEnvelope_.reset();
         bowEnvelope_.gate(true);
         sampleCounter_ = 0;
-        core_.trigger(velocity);
+        core().trigger(velocity);
         active_ = true;
     }
 
     void release() noexcept
     {
         bowEnvelope_.gate(false);
-        core_.release();
+        core().release();
     }
 
     [[nodiscard]] float process(float /*bodyFeedback*/) noexcept
@@ -116,12 +123,12 @@ struct FrictionExciter
         ++sampleCounter_;
 
         const float envValue = bowEnvelope_.process();
-        core_.setEnvelopeValue(envValue);
+        core().setEnvelopeValue(envValue);
 
         // BowExciter consumes the body-feedback velocity normally; Phase 2 runs
         // the transient mode with zero feedback so the stick-slip signature
         // still emerges from the internal rosin jitter and friction junction.
-        const float raw = core_.process(0.0f);
+        const float raw = core().process(0.0f);
         const float out = bodyFilter_.process(raw);
 
         if (!bowEnvelope_.isActive())
@@ -136,8 +143,21 @@ struct FrictionExciter
         return active_ && bowEnvelope_.isActive();
     }
 
+    /// Bind a BowExciter the owner has already prepared at this sample rate,
+    /// for the next prepare(). The owner keeps it alive.
+    void setSharedCore(Krate::DSP::BowExciter* core) noexcept
+    {
+        sharedCore_ = core;
+    }
+
 private:
-    Krate::DSP::BowExciter   core_{};
+    [[nodiscard]] Krate::DSP::BowExciter& core() noexcept
+    {
+        return sharedCore_ != nullptr ? *sharedCore_ : ownCore_;
+    }
+
+    Krate::DSP::BowExciter   ownCore_{};
+    Krate::DSP::BowExciter*  sharedCore_ = nullptr;
     Krate::DSP::ADSREnvelope bowEnvelope_{};
     Krate::DSP::SVF          bodyFilter_{};
     double sampleRate_         = 44100.0;
@@ -23,7 +23,9 @@ struct ImpulseExciter
 
     void prepare(double sampleRate, std::uint32_t voiceId) noexcept
     {
-        core_.prepare(sampleRate, voiceId);
+        // Always triggered with position 0, so no comb buffer: prepare() runs
+        // on the audio thread when ExciterBank swaps this variant in.
+        core_.prepare(sampleRate, voiceId, 0.0f);
         core_.reset();
     }
 
@@ -962,6 +962,10 @@ tresult PLUGIN_API Processor::setState(IBStream* state)
     for (int pad = 0; pad < kNumPads; ++pad)
         voicePool_.setPadChokeGroup(pad, voicePool_.padConfig(pad).chokeGroup);
 
+    // String pads need the pool's waveguides; allocate them here, off the
+    // audio thread, so the kit's first String hit plays the real waveguide.
+    voicePool_.prepareStringBodies();
+
     selectedPadIndex_ = kit.selectedPadIndex;
 
     // Flush the global SympatheticResonance engine BEFORE installing the
@@ -1076,6 +1080,7 @@ tresult PLUGIN_API Processor::setupProcessing(ProcessSetup& setup)
 
     sampleRate_ = setup.sampleRate;
     maxBlockSize_ = setup.maxSamplesPerBlock;
+    voicePool_.setOfflineRendering(setup.processMode == Steinberg::Vst::kOffline);
     voicePool_.prepare(sampleRate_, maxBlockSize_);
     voicePool_.setMaxPolyphony(maxPolyphony_.load());
     voicePool_.setVoiceStealingPolicy(
@@ -1164,8 +1169,8 @@ tresult PLUGIN_API Processor::disconnect(IConnectionPoint* other)
 }
 
 // ==============================================================================
-// notify() -- IMessage handler. Audition-pad message is the only one we
-// understand; everything else delegates to the SDK base.
+// notify() -- IMessage handler. Audition-pad messages and the controller's
+// String body request; everything else delegates to the SDK base.
 // ==============================================================================
 tresult PLUGIN_API Processor::notify(Steinberg::Vst::IMessage* message)
 {
@@ -1208,6 +1213,14 @@ tresult PLUGIN_API Processor::notify(Steinberg::Vst::IMessage* message)
         return kResultOk;
     }
 
+    // A pad was switched to the String body: allocate the pool's waveguides
+    // here, on the message thread, rather than on the audio thread.
+    if (std::strcmp(id, "PrepareStringBodies") == 0)
+    {
+        voicePool_.allocateStringBodies();
+        return kResultOk;
+    }
+
     return AudioEffect::notify(message);
 }
 
@@ -17,14 +17,21 @@
 #include <cstdint>
 #include <cstring>
 #include <numbers>
-#include <type_traits>
 #include <utility>
 
 namespace Membrum {
 
-// Aliases to make indexing readable without the `(*voicesPtr_)[i]` noise.
+// Alias to make indexing readable without the `(*voicesPtr_)[i]` noise.
 #define VP_VOICES   (*voicesPtr_)
-#define VP_RVOICES  (*releasingVoicesPtr_)
+
+namespace {
+
+// Fallback fade tails are rendered in slices of this size so the voice's
+// block-rate modulators (pitch envelope, morph, tension) refresh at their
+// usual cadence rather than once across the whole tail.
+constexpr int kFadeTailRenderSlice = 64;
+
+} // namespace
 
 // ------------------------------------------------------------------
 // Construction
@@ -32,17 +39,27 @@ namespace Membrum {
 
 VoicePool::VoicePool()
     : voicesPtr_(std::make_unique<std::array<DrumVoice, kMaxVoices>>())
-    , releasingVoicesPtr_(std::make_unique<std::array<DrumVoice, kMaxVoices>>())
+    , voiceScratch_(std::make_unique<DrumVoice::Scratch>())
 {
-    // Both DrumVoice arrays are default-constructed on the heap via
-    // make_unique. Per FR-116 this is the only allocation point outside of
-    // prepare() -- it runs on the host thread during Processor construction,
-    // not on the audio thread.
+    // The DrumVoice array and the shared scratch set are default-constructed
+    // on the heap via make_unique. Per FR-116 this is the only allocation
+    // point outside of prepare() -- it runs on the host thread during
+    // Processor construction, not on the audio thread. Attaching the scratch
+    // before prepare() keeps the voices from allocating their own. Likewise
+    // the String body waveguides: the pool holds them only while a pad uses
+    // that body (prepareStringBodies / allocateStringBodies).
+    for (auto& voice : VP_VOICES)
+    {
+        voice.setScratch(voiceScratch_.get());
+        voice.useExternalString();
+    }
 }
 
+VoicePool::~VoicePool() = default;
+
 DrumVoice& VoicePool::mainVoiceRef(int slot) noexcept
 {
-    return (*voicesPtr_)[static_cast<std::size_t>(slot)];
+    return (*voicesPtr_)[static_cast<std::size_t>(slotVoices_[static_cast<std::size_t>(slot)])];
 }
 
 // ------------------------------------------------------------------
@@ -73,7 +90,6 @@ void VoicePool::prepare(double sampleRate, int maxBlockSize) noexcept
     // FR-116/FR-117/Q4: this is the ONLY allocation point in VoicePool. All
     // subsequent audio-thread calls are allocation-free.
     scratchL_ = std::make_unique<float[]>(static_cast<std::size_t>(maxBlockSize_));
-    scratchR_ = std::make_unique<float[]>(static_cast<std::size_t>(maxBlockSize_));
 
     // FR-124 (Option B) / FR-125: per-sample decay coefficient. `kFastReleaseSecs`
     // is the total wall-clock decay time to the 1e-6 denormal floor (NOT τ). For
@@ -85,32 +101,43 @@ void VoicePool::prepare(double sampleRate, int maxBlockSize) noexcept
     fastReleaseK_ =
         std::exp(-kFastReleaseLnFloor / (kFastReleaseSecs * static_cast<float>(sampleRate_)));
 
-    // Prepare every main + shadow voice with voiceId = slot index. Main and
-    // shadow slots at the same index share the same voiceId because the
-    // two-array fast-release crossfade (beginFastRelease) swaps them via
-    // std::swap, and any voiceId-derived state (PRNG seeds, per-voice
-    // decorrelation) must be IDENTICAL across the two arrays so that a
-    // freshly-swapped voice behaves BIT-IDENTICALLY to a pristine voice at
-    // that slot (FR-124 bit-identity clause / T3.3.2(c)). If the two arrays
-    // held distinct voiceIds, a reused voice after steal/choke would
-    // produce sample-level differences from an isolated fresh-pool voice,
-    // violating the -120 dBFS noise-floor bit-identity requirement.
-    //
-    // Shadow and main slots for the SAME index never render concurrently
-    // with the same state: at any moment either (a) the main slot is
-    // rendering and the shadow is idle-prepared, or (b) the shadow is
-    // fast-releasing the previous voice while the main slot renders the
-    // new note. Even in case (b) they are rendering DIFFERENT notes
-    // triggered at DIFFERENT times, so per-voice PRNG sequences diverge
-    // naturally; sharing the seed does not collapse them into lockstep.
+    // Fade tails hold exactly the samples the ramp lets through: run the same
+    // float recurrence as applyFastRelease until it crosses the floor.
+    int tailLength = 0;
+    for (float gain = 1.0f; gain >= kFastReleaseFloor; gain *= fastReleaseK_)
+        ++tailLength;
+    fadeTailCapacity_ = tailLength;
+    fadeTailBuffer_ = std::make_unique<float[]>(
+        static_cast<std::size_t>(kMaxVoices) * static_cast<std::size_t>(fadeTailCapacity_));
+
+    // String waveguides: re-prepared at the new rate while a pad uses the
+    // String body, released otherwise. The voices let go of the old ones
+    // before they are dropped; the lock keeps a concurrent
+    // allocateStringBodies() (message thread) out meanwhile.
+    {
+        const std::lock_guard<std::mutex> lock(stringsMutex_);
+        for (auto& voice : VP_VOICES)
+            voice.setExternalString(nullptr);
+        stringsReady_.store(false, std::memory_order_release);
+        strings_.reset();
+    }
+    if (anyPadUsesStringBody())
+        allocateStringBodies();
+
+    // Prepare every voice with voiceId = slot index, so voiceId-derived
+    // state (PRNG seeds, per-voice decorrelation) is a pure function of the
+    // slot (FR-124 bit-identity clause / T3.3.2(c)).
     for (int i = 0; i < kMaxVoices; ++i)
     {
-        const auto vid = static_cast<std::uint32_t>(i);
-        VP_VOICES[i].prepare(sampleRate_, vid);
-        VP_RVOICES[i].prepare(sampleRate_, vid);
+        VP_VOICES[i].prepare(sampleRate_, static_cast<std::uint32_t>(i));
 
         meta_[i]          = VoiceMeta{};
         releasingMeta_[i] = VoiceMeta{};
+        fadeTails_[i]     = FadeTail{};
+        slotVoices_[i]    = i;
+        fadeVoice_[i]     = -1;
+        fadeOwner_[i]     = -1;
+        pendingStarts_[i] = PendingStart{};
     }
 
     // Reset the allocator and seed the active voice count so it matches
@@ -121,6 +148,57 @@ void VoicePool::prepare(double sampleRate, int maxBlockSize) noexcept
     sampleCounter_ = 0;
 }
 
+std::size_t VoicePool::memoryFootprintBytes() const noexcept
+{
+    const auto maxBlock = static_cast<std::size_t>(std::max(maxBlockSize_, 0));
+    std::size_t bytes = sizeof(VoicePool) + sizeof(*voicesPtr_) + sizeof(*voiceScratch_);
+    for (int i = 0; i < kMaxVoices; ++i)
+        bytes += VP_VOICES[i].heapBytes();
+    if (scratchL_ != nullptr)
+        bytes += maxBlock * sizeof(float);
+    if (fadeTailBuffer_ != nullptr)
+        bytes += static_cast<std::size_t>(kMaxVoices)
+               * static_cast<std::size_t>(fadeTailCapacity_) * sizeof(float);
+    if (stringBodiesReady())
+    {
+        bytes += sizeof(*strings_);
+        for (const auto& string : *strings_)
+            bytes += string.heapBytes();
+    }
+    return bytes;
+}
+
+// ------------------------------------------------------------------
+// String body waveguides
+// ------------------------------------------------------------------
+
+bool VoicePool::anyPadUsesStringBody() const noexcept
+{
+    return std::any_of(padConfigs_.begin(), padConfigs_.end(),
+                       [](const PadConfig& cfg) {
+                           return cfg.bodyModel == BodyModelType::String;
+                       });
+}
+
+void VoicePool::prepareStringBodies() noexcept
+{
+    if (anyPadUsesStringBody())
+        allocateStringBodies();
+}
+
+void VoicePool::allocateStringBodies() noexcept
+{
+    if (stringBodiesReady())
+        return;
+    const std::lock_guard<std::mutex> lock(stringsMutex_);
+    if (stringBodiesReady())
+        return;
+    strings_ = std::make_unique<std::array<Krate::DSP::WaveguideString, kMaxVoices>>();
+    for (auto& string : *strings_)
+        string.prepare(sampleRate_);
+    stringsReady_.store(true, std::memory_order_release);
+}
+
 // ------------------------------------------------------------------
 // Note events
 // ------------------------------------------------------------------
@@ -145,6 +223,12 @@ void VoicePool::noteOn(std::uint8_t midiNote, float velocity) noexcept
     if (padConfigs_[static_cast<std::size_t>(padIndex)].enabled < 0.5f)
         return;
 
+    // Offline: configs written directly (padConfigMut) never went through
+    // setPadConfigSelector, so a String pad allocates its waveguides here too.
+    if (offlineRendering_
+        && padConfigs_[static_cast<std::size_t>(padIndex)].bodyModel == BodyModelType::String)
+        allocateStringBodies();
+
     // FR-171: note-on sequence = (choke) -> (steal) -> allocator -> DrumVoice.
     // Step 1: choke group iteration. Phase 3.3 fills this in; Phase 3.1 is a
     // no-op stub so the code path compiles.
@@ -207,13 +291,13 @@ void VoicePool::noteOn(std::uint8_t midiNote, float velocity) noexcept
             if (couplingEngine_ != nullptr)
                 couplingEngine_->noteOff(static_cast<int>(ev.voiceIndex));
 
-            // FR-126/FR-127: fade out the stolen voice through the shadow
-            // slot. The hot path must not touch `voices_[ev.voiceIndex]` after
-            // this — the new note will overwrite it below.
+            // FR-126/FR-127: fade out the stolen voice. The slot is free
+            // after this — the new note queued below takes it, on an idle
+            // DrumVoice while the stolen one fades.
             //
-            // Audit M-8: force=true so a same-slot re-steal whose shadow is
-            // still fading from a prior steal (e.g. fast same-note retrigger)
-            // re-snapshots the ringing main voice instead of letting the
+            // Audit M-8: force=true so a same-slot re-steal whose fade is
+            // still running from a prior steal (e.g. fast same-note
+            // retrigger) fades the ringing voice instead of letting the
             // incoming attack hard-overwrite it (a click). A steal only ever
             // targets a genuinely-Active voice — choke already frees + retires
             // its victims before the allocator runs — so a busy shadow here is
@@ -228,24 +312,12 @@ void VoicePool::noteOn(std::uint8_t midiNote, float velocity) noexcept
         {
             const int slot = static_cast<int>(ev.voiceIndex);
 
-            // Configure the voice from the pad's config (Phase 4 per-pad dispatch).
-            applyPadConfigToSlot(slot, padIndex);
-            VP_VOICES[slot].noteOn(clampedVel);
-
-            // Phase 5: Register this voice's partials with the coupling engine.
-            // The engine will create sympathetic resonators at the voice's
-            // modal frequencies (FR-041: velocity scales coupling excitation).
-            //
-            // Phase 6 (US4 / FR-023 CPU optimization): if the struck pad has
-            // couplingAmount == 0.0, it is fully excluded from coupling --
-            // skip resonator registration entirely. No CPU cost for silenced
-            // pads.
-            if (couplingEngine_ != nullptr &&
-                padConfigs_[static_cast<std::size_t>(padIndex)].couplingAmount > 0.0f)
-            {
-                auto partials = VP_VOICES[slot].getPartialInfo();
-                couplingEngine_->noteOn(slot, partials);
-            }
+            // Queue the voice start: the slot's DrumVoice may still be
+            // fading a stolen voice. At the start of the next block
+            // settlePendingSlot() moves that fade off the slot, applies the
+            // pad's config (Phase 4 per-pad dispatch), triggers the voice and
+            // registers its partials with the coupling engine (Phase 5).
+            pendingStarts_[slot] = PendingStart{padIndex, clampedVel, false};
 
             // Bookkeeping: populate the per-slot metadata for later stealing
             // decisions + choke lookups.
@@ -272,9 +344,13 @@ void VoicePool::resetAllVoicesForKitSwitch() noexcept
         if (couplingEngine_ != nullptr && meta_[slot].state != VoiceSlotState::Free)
             couplingEngine_->noteOff(slot);
         VP_VOICES[slot].resetForKitSwitch();
-        VP_RVOICES[slot].resetForKitSwitch();
         meta_[slot]          = VoiceMeta{};
         releasingMeta_[slot] = VoiceMeta{};
+        fadeTails_[slot]     = FadeTail{};
+        slotVoices_[slot]    = slot;
+        fadeVoice_[slot]     = -1;
+        fadeOwner_[slot]     = -1;
+        pendingStarts_[slot] = PendingStart{};
     }
     allocator_.reset();
     (void)allocator_.setVoiceCount(static_cast<std::size_t>(maxPolyphony_));
@@ -293,12 +369,168 @@ void VoicePool::noteOff(std::uint8_t midiNote) noexcept
         if (meta_[slot].state == VoiceSlotState::Active
             && meta_[slot].originatingNote == midiNote)
         {
-            VP_VOICES[slot].noteOff();
+            // A note still queued for the next block is released as it
+            // starts, exactly as if it had started here.
+            if (pendingStarts_[slot].padIndex >= 0)
+                pendingStarts_[slot].released = true;
+            else
+                mainVoiceRef(slot).noteOff();
         }
     }
     (void)allocator_.noteOff(midiNote);
 }
 
+// ------------------------------------------------------------------
+// Queued voice work
+// ------------------------------------------------------------------
+
+void VoicePool::settlePendingSlot(int slot) noexcept
+{
+    PendingStart& start = pendingStarts_[slot];
+    if (start.padIndex < 0)
+        return;
+
+    // FR-124 / Q5: the slot's DrumVoice may still be fading the voice it was
+    // stolen or choked from. Trade it for an idle DrumVoice so the fade runs
+    // on untouched, block by block; the new note starts on the idle voice.
+    // Only with every voice busy is the rest of the fade rendered now, into
+    // the fading slot's tail.
+    const int voiceIndex = slotVoices_[slot];
+    if (fadeOwner_[voiceIndex] >= 0)
+    {
+        const int idle = findIdleSlot();
+        if (idle >= 0)
+            std::swap(slotVoices_[slot], slotVoices_[idle]);
+        else
+            captureFadeTail(fadeOwner_[voiceIndex]);
+    }
+
+    // The queued note fully re-initializes the envelope and re-triggers the
+    // exciter.
+    DrumVoice& voice = mainVoiceRef(slot);
+    applyPadConfigToSlot(slot, start.padIndex);
+    voice.noteOn(start.velocity);
+    if (start.released)
+        voice.noteOff();
+
+    // Phase 5: Register this voice's partials with the coupling engine.
+    // The engine will create sympathetic resonators at the voice's
+    // modal frequencies (FR-041: velocity scales coupling excitation).
+    //
+    // Phase 6 (US4 / FR-023 CPU optimization): if the struck pad has
+    // couplingAmount == 0.0, it is fully excluded from coupling --
+    // skip resonator registration entirely. No CPU cost for silenced
+    // pads.
+    if (couplingEngine_ != nullptr &&
+        padConfigs_[static_cast<std::size_t>(start.padIndex)].couplingAmount > 0.0f)
+    {
+        auto partials = voice.getPartialInfo();
+        couplingEngine_->noteOn(slot, partials);
+    }
+    start = PendingStart{};
+}
+
+int VoicePool::findIdleSlot() const noexcept
+{
+    // Highest slots first: those beyond maxPolyphony are never allocated, so
+    // a fade parked there cannot be asked to move again.
+    for (int slot = kMaxVoices - 1; slot >= 0; --slot)
+    {
+        const int voiceIndex = slotVoices_[slot];
+        if (meta_[slot].state == VoiceSlotState::Free
+            && pendingStarts_[slot].padIndex < 0
+            && fadeOwner_[voiceIndex] < 0
+            && !VP_VOICES[voiceIndex].isActive())
+        {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+void VoicePool::captureFadeTail(int owner) noexcept
+{
+    // The tail is as long as the whole ramp (see prepare()), so it covers
+    // whatever is left of this fade; the ramp still runs from the slot's
+    // current gain as the tail plays back.
+    DrumVoice& voice = VP_VOICES[fadeVoice_[owner]];
+    int length = 0;
+    if (voice.isActive())
+    {
+        float* tail = fadeTail(owner);
+        for (int offset = 0; offset < fadeTailCapacity_; offset += kFadeTailRenderSlice)
+        {
+            const int n = std::min(kFadeTailRenderSlice, fadeTailCapacity_ - offset);
+            voice.processBlock(tail + offset, n);
+        }
+        length = fadeTailCapacity_;
+    }
+    fadeTails_[owner] = FadeTail{length, 0};
+    endVoiceFade(owner);
+}
+
+void VoicePool::endVoiceFade(int owner) noexcept
+{
+    const int voiceIndex = fadeVoice_[owner];
+    VP_VOICES[voiceIndex].silence();
+    fadeOwner_[voiceIndex] = -1;
+    fadeVoice_[owner]      = -1;
+}
+
+void VoicePool::settlePendingSlots() noexcept
+{
+    for (int slot = 0; slot < kMaxVoices; ++slot)
+        settlePendingSlot(slot);
+}
+
+const float* VoicePool::renderMainVoice(int slot, float* scratch, int numSamples) noexcept
+{
+    // A voice fading in place renders with its fade, not as the slot's note.
+    const int voiceIndex = slotVoices_[slot];
+    if (fadeOwner_[voiceIndex] >= 0 || !VP_VOICES[voiceIndex].isActive())
+        return nullptr;
+    VP_VOICES[voiceIndex].processBlock(scratch, numSamples);
+    return scratch;
+}
+
+int VoicePool::renderReleasingVoice(int slot, float* scratch, int numSamples,
+                                    const float*& out) noexcept
+{
+    if (releasingMeta_[slot].state != VoiceSlotState::FastReleasing)
+        return -1;
+
+    // The fading voice renders this block under the ramp; the voice is
+    // silenced and freed once the ramp hits its floor.
+    if (fadeVoice_[slot] >= 0)
+    {
+        DrumVoice& voice = VP_VOICES[fadeVoice_[slot]];
+        if (voice.isActive())
+            voice.processBlock(scratch, numSamples);
+        else
+            std::fill_n(scratch, numSamples, 0.0f);
+        const int liveCount = applyFastRelease(slot, scratch, numSamples);
+        if (releasingMeta_[slot].state != VoiceSlotState::FastReleasing)
+            endVoiceFade(slot);
+        out = scratch;
+        return liveCount;
+    }
+
+    // The ramp is applied in place: each tail sample plays exactly once.
+    FadeTail& tail = fadeTails_[slot];
+    float* samples = fadeTail(slot) + tail.readPos;
+    const int count = std::min(numSamples, tail.length - tail.readPos);
+    const int liveCount = applyFastRelease(slot, samples, count);
+    tail.readPos += count;
+
+    // The tail is sized to end where the ramp hits its floor, so running
+    // out of samples and terminating coincide.
+    if (tail.readPos >= tail.length)
+        releasingMeta_[slot].state = VoiceSlotState::Free;
+
+    out = samples;
+    return liveCount;
+}
+
 // ------------------------------------------------------------------
 // Audio processing
 // ------------------------------------------------------------------
@@ -349,11 +581,12 @@ void VoicePool::processBlock(float* outL, float* outR, int numSamples) noexcept
     // sub-audible plateau forever any more.
     constexpr float kSilenceThreshold = 1.0e-3f;   // ~ -60 dBFS
 
+    settlePendingSlots();
+
     for (int slot = 0; slot < maxPolyphony_; ++slot)
     {
-        if (VP_VOICES[slot].isActive())
+        if (const float* voiceOut = renderMainVoice(slot, scratch, numSamples))
         {
-            VP_VOICES[slot].processBlock(scratch, numSamples);
 
             // M-9: equal-power per-pad pan (DrumVoice is mono).
             float gainL = 1.0f;
@@ -367,10 +600,10 @@ void VoicePool::processBlock(float* outL, float* outR, int numSamples) noexcept
             float peak = 0.0f;
             for (int i = 0; i < numSamples; ++i)
             {
-                const float a = std::fabs(scratch[i]);
+                const float a = std::fabs(voiceOut[i]);
                 peak           = std::max(peak, a);
-                outL[i] += scratch[i] * gainL;
-                outR[i] += scratch[i] * gainR;
+                outL[i] += voiceOut[i] * gainL;
+                outR[i] += voiceOut[i] * gainR;
             }
             meta_[slot].currentLevel = peak;
 
@@ -380,7 +613,7 @@ void VoicePool::processBlock(float* outL, float* outR, int numSamples) noexcept
             if (peak < kSilenceThreshold &&
                 meta_[slot].state == VoiceSlotState::Active)
             {
-                VP_VOICES[slot].noteOff();
+                mainVoiceRef(slot).noteOff();
             }
         }
         else if (meta_[slot].state == VoiceSlotState::Active)
@@ -396,24 +629,22 @@ void VoicePool::processBlock(float* outL, float* outR, int numSamples) noexcept
         }
     }
 
-    // T3.2.6 / FR-124 / Q5: render every fast-releasing shadow voice, apply
-    // the per-sample exponential decay to the scratch buffer, then
+    // T3.2.6 / FR-124 / Q5: render every fast-releasing slot's fade, apply
+    // the per-sample exponential decay to it, then
     // accumulate only the live (pre-floor) samples into the output per
     // FR-124's "does NOT accumulate those zeroed samples into the output"
     // clause.
     for (int slot = 0; slot < kMaxVoices; ++slot)
     {
-        if (releasingMeta_[slot].state != VoiceSlotState::FastReleasing)
+        // Render the slot's fade through the exponential fast-release
+        // ramp. The live count is the number of samples before the 1e-6
+        // floor triggered (numSamples if the fade continues into the next
+        // block); -1 means the slot is not fast-releasing.
+        const float* voiceOut = nullptr;
+        const int liveCount = renderReleasingVoice(slot, scratch, numSamples, voiceOut);
+        if (liveCount < 0)
             continue;
 
-        // Render the shadow copy of the drum voice into scratchL_.
-        VP_RVOICES[slot].processBlock(scratch, numSamples);
-
-        // Apply the exponential fast-release ramp. Returns the count of
-        // samples before the 1e-6 floor triggered (numSamples if the fade
-        // continues into the next block).
-        const int liveCount = applyFastRelease(slot, scratch, numSamples);
-
         // M-9: the fading shadow voice keeps its pad's pan position.
         float gainL = 1.0f;
         float gainR = 1.0f;
@@ -421,8 +652,8 @@ void VoicePool::processBlock(float* outL, float* outR, int numSamples) noexcept
 
         for (int i = 0; i < liveCount; ++i)
         {
-            outL[i] += scratch[i] * gainL;
-            outR[i] += scratch[i] * gainR;
+            outL[i] += voiceOut[i] * gainL;
+            outR[i] += voiceOut[i] * gainR;
         }
 
         // When the slot has transitioned back to Free (floor triggered),
@@ -464,11 +695,12 @@ void VoicePool::processBlock(float* outL, float* outR,
     // See mono path above for the rationale on this threshold.
     constexpr float kSilenceThreshold = 1.0e-3f;
 
+    settlePendingSlots();
+
     for (int slot = 0; slot < maxPolyphony_; ++slot)
     {
-        if (VP_VOICES[slot].isActive())
+        if (const float* voiceOut = renderMainVoice(slot, scratch, numSamples))
         {
-            VP_VOICES[slot].processBlock(scratch, numSamples);
 
             // M-9: equal-power per-pad pan (applied to main and aux alike).
             float gainL = 1.0f;
@@ -478,10 +710,10 @@ void VoicePool::processBlock(float* outL, float* outR,
             float peak = 0.0f;
             for (int i = 0; i < numSamples; ++i)
             {
-                const float a = std::fabs(scratch[i]);
+                const float a = std::fabs(voiceOut[i]);
                 peak = std::max(peak, a);
-                outL[i] += scratch[i] * gainL;
-                outR[i] += scratch[i] * gainR;
+                outL[i] += voiceOut[i] * gainL;
+                outR[i] += voiceOut[i] * gainR;
             }
             meta_[slot].currentLevel = peak;
 
@@ -499,8 +731,8 @@ void VoicePool::processBlock(float* outL, float* outR,
                 {
                     for (int i = 0; i < numSamples; ++i)
                     {
-                        auxL[bus][i] += scratch[i] * gainL;
-                        auxR[bus][i] += scratch[i] * gainR;
+                        auxL[bus][i] += voiceOut[i] * gainL;
+                        auxR[bus][i] += voiceOut[i] * gainR;
                     }
                 }
             }
@@ -508,7 +740,7 @@ void VoicePool::processBlock(float* outL, float* outR,
             if (peak < kSilenceThreshold &&
                 meta_[slot].state == VoiceSlotState::Active)
             {
-                VP_VOICES[slot].noteOff();
+                mainVoiceRef(slot).noteOff();
             }
         }
         else if (meta_[slot].state == VoiceSlotState::Active)
@@ -522,12 +754,11 @@ void VoicePool::processBlock(float* outL, float* outR,
     // Fast-releasing shadow voices
     for (int slot = 0; slot < kMaxVoices; ++slot)
     {
-        if (releasingMeta_[slot].state != VoiceSlotState::FastReleasing)
+        const float* voiceOut = nullptr;
+        const int liveCount = renderReleasingVoice(slot, scratch, numSamples, voiceOut);
+        if (liveCount < 0)
             continue;
 
-        VP_RVOICES[slot].processBlock(scratch, numSamples);
-        const int liveCount = applyFastRelease(slot, scratch, numSamples);
-
         // M-9: the fading shadow voice keeps its pad's pan position.
         float gainL = 1.0f;
         float gainR = 1.0f;
@@ -535,8 +766,8 @@ void VoicePool::processBlock(float* outL, float* outR,
 
         for (int i = 0; i < liveCount; ++i)
         {
-            outL[i] += scratch[i] * gainL;
-            outR[i] += scratch[i] * gainR;
+            outL[i] += voiceOut[i] * gainL;
+            outR[i] += voiceOut[i] * gainR;
         }
 
         // FR-044: also route fast-releasing voices to their aux bus
@@ -553,8 +784,8 @@ void VoicePool::processBlock(float* outL, float* outR,
             {
                 for (int i = 0; i < liveCount; ++i)
                 {
-                    auxL[bus][i] += scratch[i] * gainL;
-                    auxR[bus][i] += scratch[i] * gainR;
+                    auxL[bus][i] += voiceOut[i] * gainL;
+                    auxR[bus][i] += voiceOut[i] * gainR;
                 }
             }
         }
@@ -713,6 +944,11 @@ void VoicePool::setPadConfigSelector(int padIndex, int offset, int discreteValue
     case kPadBodyModel:
         cfg.bodyModel = static_cast<BodyModelType>(
             std::clamp(discreteValue, 0, static_cast<int>(BodyModelType::kCount) - 1));
+        // In real time the controller asks the processor to allocate the
+        // waveguides off the audio thread (allocateStringBodies); offline
+        // renders allocate them here so the next hit already uses them.
+        if (cfg.bodyModel == BodyModelType::String && offlineRendering_)
+            allocateStringBodies();
         break;
     default: break;
     }
@@ -781,7 +1017,12 @@ void VoicePool::applyPadConfigToSlot(int slot, int padIndex) noexcept
     // removed in audit L-12), so kit presets never propagated tone-shaper /
     // pitch-envelope / unnatural-zone / morph fields -- the 808 tom row
     // sounded identical across pads until it was restored.
-    applyPadConfigToVoice(VP_VOICES[slot],
+    // Bind the voice's String waveguide (or none yet) before the config's
+    // body model is swapped in by the voice's noteOn.
+    const auto voiceIndex = static_cast<std::size_t>(slotVoices_[static_cast<std::size_t>(slot)]);
+    VP_VOICES[voiceIndex].setExternalString(
+        stringBodiesReady() ? &(*strings_)[voiceIndex] : nullptr);
+    applyPadConfigToVoice(VP_VOICES[voiceIndex],
                           padConfigs_[static_cast<std::size_t>(padIndex)]);
 }
 
@@ -876,87 +1117,61 @@ void VoicePool::beginFastRelease(int slot, bool force) noexcept
     if (slot < 0 || slot >= kMaxVoices)
         return;
 
-    // FR-127: idempotent. If the shadow slot is already fast-releasing,
-    // leave the in-flight fade alone so a re-entrant call (the choke-
-    // completeness re-scan) does NOT re-snapshot the gain.
+    // FR-127: idempotent. If the slot is already fast-releasing, leave the
+    // in-flight fade alone so a re-entrant call (the choke-completeness
+    // re-scan) does NOT re-snapshot the gain.
     //
     // Audit M-8: the EXCEPTION is a voice-steal that re-steals this slot
-    // while its shadow is still fading from a PRIOR steal (`force == true`).
+    // while a fade from a PRIOR steal is still running (`force == true`).
     // The current main voice is a full-amplitude ring about to be hard-
-    // overwritten by the incoming note's attack; the existing shadow holds an
-    // older, already-attenuated tail. Re-snapshot so the louder ring fades
-    // smoothly through the shadow and only the quieter old tail is truncated —
-    // a far smaller discontinuity. Fall through to the swap + reset below; the
-    // old shadow voice ends up in the main slot and is cleanly overwritten by
-    // the incoming note's applyPadConfigToSlot + noteOn.
+    // overwritten by the incoming note's attack; the running fade is older
+    // and already attenuated. Fade the current voice so the louder ring
+    // fades smoothly and only the quieter old fade is truncated — a far
+    // smaller discontinuity.
     if (releasingMeta_[slot].state == VoiceSlotState::FastReleasing && !force)
         return;
 
-    // FR-124 / Q5 / T3.2.4: snapshot the currently-sounding DrumVoice into
-    // the shadow slot. DrumVoice's implicit COPY assignment is DELETED by
-    // the compiler (one of the exciter variant alternatives,
-    // FrictionExciter -> Krate::DSP::BowExciter, explicitly deletes its
-    // copy operators). DrumVoice's MOVE assignment is however defaulted
-    // and functional -- BowExciter declares `= default` move ops and
-    // std::variant of move-only alternatives is itself move-assignable.
-    // We therefore snapshot via `std::swap`, which is implemented in
-    // terms of move-assignment. After the swap:
-    //   - releasingVoices_[slot] now holds the currently-sounding voice
-    //     state (the "live" voice that must fade out).
-    //   - voices_[slot] holds the previous contents of
-    //     releasingVoices_[slot] -- either a freshly-prepared idle
-    //     DrumVoice (first steal on that slot) or a naturally-ended
-    //     fast-releasing voice from a prior fade (both of which are
-    //     valid DSP states ready to receive a new noteOn).
-    // The subsequent allocator NoteOn path calls
-    // `applySharedParamsToSlot(slot)` + `voices_[slot].noteOn(v)` which
-    // fully re-initializes the envelope and re-triggers the exciter, so
-    // any residual state in voices_[slot] after the swap is overwritten
-    // cleanly. We must call noteOff() on the re-acquired voice first to
-    // gate the envelope off and release the exciter, otherwise a lingering
-    // amp-envelope from a prior fade could add a tiny transient to the new
-    // note's attack.
-    static_assert(std::is_move_assignable_v<DrumVoice>,
-                  "DrumVoice must be move-assignable for the shadow swap "
-                  "technique (Phase 3.2 fast-release).");
-    std::swap(VP_RVOICES[slot], VP_VOICES[slot]);
-    // The re-acquired main voice receives a fresh noteOn from the
-    // subsequent allocator NoteOn event, which fully re-initializes
-    // the envelope and re-triggers the exciter. We do NOT call
-    // noteOff() on it here: that would add unnecessary DSP state
-    // churn (small but non-zero) and could introduce bit-level
-    // differences versus a freshly-prepared DrumVoice.
-
-    // Phase 8A.5: the shadow voice (VP_RVOICES[slot]) is now the live
-    // voice that must fade out. Under Option-D envelope (sustain = 1.0)
-    // its body is still ringing at full amplitude, so the multiplicative
-    // 5 ms fastRelease ramp alone is not enough to keep the residual
-    // below the -30 dBFS click bound. Fire the aggressive fast-release
-    // damp on the shadow's modal bank so the body decays within ~1 ms
-    // (well inside the fast-release window) through its own damping law.
-    VP_RVOICES[slot].fastReleaseDamp();
-
-    // Starting gain is UNITY. The shadow slot's DrumVoice already produces
-    // the voice's absolute amplitude via its own envelopes and filters;
-    // the fast-release ramp is a multiplicative decay applied on top of
-    // that, starting from 1.0 so the transition is perfectly continuous
-    // at the steal sample (FR-124: "applied starting from the voice's
-    // current amplitude at the moment of steal" -- the voice's amplitude
-    // IS the shadow's native output, which starts at unity gain).
+    // A queued note that has not started yet has nothing to fade: drop it
+    // along with the slot. If the slot's voice is already fading (stolen
+    // again before the next block), keep that fade and its ramp.
+    pendingStarts_[slot] = PendingStart{};
+    const int voiceIndex = slotVoices_[slot];
+    if (fadeOwner_[voiceIndex] >= 0)
+        return;
+
+    // M-8: cut the older, already-attenuated fade still running for this
+    // slot; the tail of a fallback capture is simply replaced.
+    if (fadeVoice_[slot] >= 0)
+        endVoiceFade(slot);
+    fadeTails_[slot] = FadeTail{};
+
+    // FR-124 / Q5 / T3.2.4: the voice keeps rendering under the ramp from the
+    // next block on; the slot then either receives the queued note, which
+    // moves the fade to an idle voice (steal), or stays idle (choke / poly
+    // shrink / Quietest pre-release).
+    //
+    // Phase 8A.5: under Option-D envelope (sustain = 1.0) the body is still
+    // ringing at full amplitude, so the multiplicative 5 ms ramp alone is
+    // not enough to keep the residual below the -30 dBFS click bound. Fire
+    // the aggressive fast-release damp on the voice's modal bank first so
+    // the body decays within ~1 ms (well inside the fast-release window)
+    // through its own damping law.
+    VP_VOICES[voiceIndex].fastReleaseDamp();
+    fadeVoice_[slot]       = voiceIndex;
+    fadeOwner_[voiceIndex] = slot;
+
+    // Starting gain is UNITY. The voice already carries its absolute
+    // amplitude via its own envelopes and filters; the fast-release ramp is
+    // a multiplicative decay applied on top of that, starting from 1.0 so
+    // the transition is perfectly continuous at the steal sample (FR-124:
+    // "applied starting from the voice's current amplitude at the moment of
+    // steal").
     releasingMeta_[slot].fastReleaseGain   = 1.0f;
     releasingMeta_[slot].originatingNote   = meta_[slot].originatingNote;
     releasingMeta_[slot].originatingChoke  = meta_[slot].originatingChoke;
     releasingMeta_[slot].noteOnSampleCount = meta_[slot].noteOnSampleCount;
     releasingMeta_[slot].currentLevel      = 0.0f;
     releasingMeta_[slot].state             = VoiceSlotState::FastReleasing;
-
-    // NOTE: We deliberately do NOT call VP_VOICES[slot].noteOff() here.
-    // The main slot is about to be overwritten by the new note's
-    // `applySharedParamsToSlot` + `noteOn(velocity)` call, which will reset
-    // the amp envelope and exciter cleanly. Calling noteOff first would
-    // waste a few instructions and could affect envelope timing on the
-    // new note's attack. The shadow copy retains its own independent state
-    // because we duplicated the DrumVoice above.
 }
 
 int VoicePool::applyFastRelease(int slot,
@@ -1011,8 +1226,8 @@ void VoicePool::processChokeGroups(std::uint8_t newNote) noexcept
     //
     // Both arrays must be scanned:
     //   - `meta_`          : Active main voices -- these are the normal
-    //                        targets; beginFastRelease swaps them into the
-    //                        shadow array and starts the 5 ms ramp.
+    //                        targets; beginFastRelease starts their 5 ms
+    //                        fade.
     //   - `releasingMeta_` : Voices already fast-releasing from a prior
     //                        steal or choke. If their choke group matches
     //                        we leave them alone -- beginFastRelease is
@@ -1042,8 +1257,8 @@ void VoicePool::processChokeGroups(std::uint8_t newNote) noexcept
                 couplingEngine_->noteOff(slot);
 
             // FR-134: reuse the Phase 3.2 fast-release path for click-free
-            // group-wide mute. beginFastRelease swaps the main voice into
-            // the shadow slot and starts the 5 ms ramp.
+            // group-wide mute. beginFastRelease starts the voice's 5 ms
+            // fade.
             beginFastRelease(slot);
             // FR-133: mark the main slot Free so subsequent allocator
             // bookkeeping sees it as available. We also release the
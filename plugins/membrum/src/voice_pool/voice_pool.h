@@ -10,31 +10,42 @@
 // stealing policies (Oldest, Quietest, Priority), and 8 choke groups
 // (plus group 0 = none) via a 32-entry `chokeGroupAssignments` table.
 //
-// Clarification Q5: `DrumVoice` is NOT modified by Phase 3. The fast-release
-// gain ramp is applied by `VoicePool::processBlock` to a local scratch buffer,
-// never inside `DrumVoice`.
+// Clarification Q5: the fast-release gain ramp is applied by `VoicePool` to
+// the fading voice's audio, never inside `DrumVoice`.
 //
-// Two-slot crossfade technique (plan.md Architecture): to keep the old voice
-// audible during its 5 ms fade, the pool holds a shadow
-// `std::array<DrumVoice, kMaxVoices>` + shadow meta array and renders both
-// arrays each block. One fade-out is in flight per slot at a time.
+// Fades: slots map onto the 16 DrumVoices through a permutation. A stolen /
+// choked voice keeps rendering block by block through the exponential ramp;
+// when a new note needs its slot, the slot trades DrumVoices with an idle
+// slot, so the fade runs on in place. Only when no voice is idle (all 16 busy)
+// is the rest of the fade rendered at once into a short per-slot tail. One
+// fade-out is in flight per slot at a time (FR-127); a forced re-steal
+// (audit M-8) cuts the in-flight one.
 //
 // ------------------------------------------------------------------
-// sizeof(DrumVoice) decision (plan.md Open Question #1)
+// Memory footprint
 // ------------------------------------------------------------------
-// Measured on MSVC x64 Release (Phase 3.0, test_voice_pool_scaffold.cpp):
-//   sizeof(DrumVoice) = 224 096 bytes (~218.8 KiB)
-//   32 * sizeof(DrumVoice) = ~6.84 MiB
+// Phase 3 originally kept a full shadow `DrumVoice` per slot for the fade
+// (32 voices, ~6.84 MiB per instance with per-voice scratch). Now:
+//   - DrumVoice's 48 KiB of fast-path scratch lives in a pool-owned arena,
+//     one set shared by every voice (DrumVoice::setScratch);
+//   - fades run on idle voices, or on short tails when none is idle;
+//   - the FM exciter's sine tables and the LFO tables are shared
+//     process-wide.
+// The String body's waveguide (two delay lines sized for 20 Hz, 32 KiB per
+// voice at 44.1 kHz and 128 KiB at 192 kHz) is no longer held by every voice:
+// the pool owns one waveguide per voice and allocates them only while some
+// pad uses the String body -- in prepare(), in prepareStringBodies() (setState)
+// or in allocateStringBodies(), which the processor calls when the controller
+// reports a pad switched to String. The audio thread never allocates them,
+// except in offline renders (setOfflineRendering), which allocate inline so
+// a bounce is reproducible. Until they are ready a String pad plays a modal
+// approximation (StringBody). They are released again by the next prepare()
+// once no pad uses the String body.
 //
-// Decision: per the plan's criteria (`sizeof > 32768` -> fallback), Phase 3
-// takes the **per-slot single-fade reservation** path: exactly one fade-out
-// in flight per slot at a time. `voices_[16]` + `releasingVoices_[16]` are
-// both declared here so Phase 3.2's fast-release ramp can crossfade without
-// touching `DrumVoice` (FR-194), but `VoicePool::beginFastRelease` will
-// reject re-entry on a slot that is already `FastReleasing` (FR-127) --
-// ensuring the shadow footprint stays bounded at `kMaxVoices` entries.
-// The ~6.84 MiB peak is accepted as the Phase 3 memory cost; see
-// `plan.md §Complexity Tracking` for the full rationale.
+// memoryFootprintBytes() reports the total, including each voice's own heap
+// and the String waveguides while they are held. Without String pads the
+// pool stays below the 1 MiB budget at every supported sample
+// rate (test_voice_pool_memory_footprint.cpp).
 //
 // Phase 3.0: scaffolding only -- all methods are stubs. Real bodies land in
 // Phases 3.1 (allocator integration) and 3.2 (fast-release ramp).
@@ -57,9 +68,14 @@
 #include <krate/dsp/systems/sympathetic_resonance.h>
 #include <krate/dsp/systems/voice_allocator.h>
 
+#include <krate/dsp/processors/waveguide_string.h>
+
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace Membrum {
 
@@ -87,7 +103,7 @@ class VoicePool
 {
 public:
     VoicePool();
-    ~VoicePool() = default;
+    ~VoicePool();
 
     VoicePool(const VoicePool&)            = delete;
     VoicePool& operator=(const VoicePool&) = delete;
@@ -103,6 +119,32 @@ public:
     /// the **only** method that may allocate memory (FR-116 / FR-117).
     void prepare(double sampleRate, int maxBlockSize) noexcept;
 
+    /// Offline renders (`kOffline`) allocate the String waveguides inline on
+    /// the audio thread the first time a pad needs them, so a bounce never
+    /// plays a String pad's modal approximation. Set from
+    /// `Processor::setupProcessing`.
+    void setOfflineRendering(bool offline) noexcept
+    {
+        offlineRendering_ = offline;
+    }
+
+    /// Allocate the String waveguides now if any pad uses the String body.
+    /// Non-audio thread only (allocates); safe to call while processBlock
+    /// runs. Called by `Processor::setState` after loading the pads.
+    void prepareStringBodies() noexcept;
+
+    /// Allocate the String waveguides unconditionally (no-op once ready).
+    /// Non-audio thread only; safe to call while processBlock runs. Called
+    /// when the controller reports a String selection, which may reach the
+    /// processor before the parameter change itself does.
+    void allocateStringBodies() noexcept;
+
+    /// True once the String waveguides are allocated and bound on note-on.
+    [[nodiscard]] bool stringBodiesReady() const noexcept
+    {
+        return stringsReady_.load(std::memory_order_acquire);
+    }
+
     // ------------------------------------------------------------------
     // Note events -- audio thread, allocation-free, noexcept
     // ------------------------------------------------------------------
@@ -212,6 +254,12 @@ public:
     /// state transitions).
     [[nodiscard]] const VoiceMeta& releasingMeta(int slot) const noexcept;
 
+    /// Bytes owned by this pool: the object itself, the voices and their own
+    /// heap buffers, the scratch arena, fade tails and String waveguides. Heap
+    /// blocks are counted at their requested size (allocator overhead
+    /// excluded); process-wide shared tables are not counted.
+    [[nodiscard]] std::size_t memoryFootprintBytes() const noexcept;
+
     // ------------------------------------------------------------------
     // State (non-audio thread)
     // ------------------------------------------------------------------
@@ -254,11 +302,14 @@ public:
     // ------------------------------------------------------------------
     // Direct read access for the forEachMainVoice helper (unique_ptr
     // storage requires a non-inline helper method; kept public so the
-    // header-defined template below can reach it).
+    // header-defined template below can reach it). Returns the DrumVoice
+    // currently serving `slot`.
     // ------------------------------------------------------------------
     [[nodiscard]] DrumVoice& mainVoiceRef(int slot) noexcept;
 
 private:
+    [[nodiscard]] bool anyPadUsesStringBody() const noexcept;
+
     // ------------------------------------------------------------------
     // Private helpers (Phase 3.1)
     // ------------------------------------------------------------------
@@ -269,20 +320,20 @@ private:
     /// Returns -1 when no Active slot exists.
     [[nodiscard]] int selectQuietestActiveSlot() const noexcept;
 
-    /// Phase 3.2 hook — snapshot a main slot into the shadow slot and start
-    /// the fast-release ramp. Phase 3.1 provides a scaffolding body that
-    /// transitions `releasingMeta_[slot]` to `FastReleasing`; Phase 3.2
-    /// replaces it with the full exponential decay.
+    /// Phase 3.2 hook — start the fast-release ramp on the slot's voice. The
+    /// voice keeps rendering, block by block, under the ramp; the slot is free
+    /// for the next noteOn, whose voice start is queued and moves the fade to
+    /// an idle DrumVoice (settlePendingSlot).
     ///
     /// `force` (audit M-8): the default (false) keeps the FR-127 idempotent
     /// short-circuit — a re-entrant call on a slot already FastReleasing
     /// leaves the in-flight fade alone (used by the choke-completeness
-    /// re-scan). When true, a re-steal whose shadow is still busy from a
-    /// PRIOR steal re-snapshots the CURRENT (full-amplitude) main voice into
-    /// the shadow, so it fades smoothly and only the older, already-attenuated
-    /// tail is truncated — instead of hard-overwriting the ringing main voice
-    /// with the incoming note's attack (a click). The voice-steal path passes
-    /// true; choke and poly-shrink keep the idempotent default.
+    /// re-scan). When true, a re-steal whose fade is still running from a
+    /// PRIOR steal fades the CURRENT (full-amplitude) voice instead and cuts
+    /// only the older, already-attenuated fade — instead of hard-overwriting
+    /// the ringing voice with the incoming note's attack (a click). The
+    /// voice-steal path passes true; choke and poly-shrink keep the
+    /// idempotent default.
     void beginFastRelease(int slot, bool force = false) noexcept;
 
     /// Phase 3.2 hook — per-sample exponential decay applied to `scratch`
@@ -304,6 +355,25 @@ private:
     /// 3.1 stub is a no-op; Phase 3.3 fills in the body.
     void processChokeGroups(std::uint8_t newNote) noexcept;
 
+    /// Start the slot's queued note and register it with the coupling
+    /// engine. If the slot's voice is still fading, the slot first trades it
+    /// for an idle one (or, with none idle, renders the fade into a tail).
+    void settlePendingSlot(int slot) noexcept;
+
+    /// A slot whose DrumVoice is idle: Free, nothing queued, not fading.
+    /// Slots beyond maxPolyphony come first. -1 when all 16 voices are busy.
+    [[nodiscard]] int findIdleSlot() const noexcept;
+
+    /// Render the remaining fade of `owner`'s voice into its tail and free
+    /// the voice (fallback when no idle voice can take over the fade).
+    void captureFadeTail(int owner) noexcept;
+
+    /// End `owner`'s fade on its voice: silence it and forget the fade.
+    void endVoiceFade(int owner) noexcept;
+
+    /// Settle every slot with queued work. Called at block start.
+    void settlePendingSlots() noexcept;
+
     /// Apply pad N's configuration to a voice slot at noteOn time.
     /// Called internally by noteOn() using the midiNote-to-pad mapping.
     void applyPadConfigToSlot(int slot, int padIndex) noexcept;
@@ -317,26 +387,76 @@ private:
     void panGainsForNote(std::uint8_t originatingNote,
                          float& gainL, float& gainR) const noexcept;
 
+    /// Main slot audio for this block, rendered into `scratch`. nullptr when
+    /// the slot is idle.
+    [[nodiscard]] const float* renderMainVoice(int slot, float* scratch,
+                                               int numSamples) noexcept;
+
+    /// Next `numSamples` of the slot's fade (its fading voice rendered into
+    /// `scratch`, or its tail) with the fast-release ramp applied. Returns the
+    /// live sample count (see applyFastRelease), or -1 when the slot was not
+    /// fast-releasing at block start.
+    [[nodiscard]] int renderReleasingVoice(int slot, float* scratch,
+                                           int numSamples,
+                                           const float*& out) noexcept;
+
 
     // ------------------------------------------------------------------
     // Main voice storage (FR-110) -- always sized `kMaxVoices`; the active
     // count is `maxPolyphony_`, controlled by `allocator_.setVoiceCount`.
-    // Heap-allocated via unique_ptr in the constructor so the 32 * 220 KiB
-    // DrumVoice footprint does not blow up the stack when VoicePool is an
-    // owning member of Processor. All pointer targets are fully constructed
-    // by the time `prepare()` runs; no audio-thread allocation occurs after
+    // Heap-allocated via unique_ptr in the constructor so the DrumVoice
+    // array does not blow up the stack when VoicePool is an owning member
+    // of Processor. All pointer targets are fully constructed by the time
+    // `prepare()` runs; no audio-thread allocation occurs after
     // construction (FR-116).
     // ------------------------------------------------------------------
     std::unique_ptr<std::array<DrumVoice, kMaxVoices>> voicesPtr_;
     std::array<VoiceMeta, kMaxVoices>                  meta_{};
 
+    // Slot -> DrumVoice index. Identity after prepare(); two slots trade
+    // voices only when a queued note finds its slot's voice still fading.
+    std::array<int, kMaxVoices>                        slotVoices_{};
+
     // ------------------------------------------------------------------
-    // Shadow voice storage for the two-array fast-release crossfade. One
-    // fade-out in flight per slot at a time. See `voice_pool.h` comment at
-    // top for the fallback decision criteria.
+    // DrumVoice fast-path scratch, shared by every voice (they render one
+    // after another).
     // ------------------------------------------------------------------
-    std::unique_ptr<std::array<DrumVoice, kMaxVoices>> releasingVoicesPtr_;
-    std::array<VoiceMeta, kMaxVoices>                  releasingMeta_{};
+    std::unique_ptr<DrumVoice::Scratch> voiceScratch_;
+
+    // ------------------------------------------------------------------
+    // Fade-out state per slot, driven by releasingMeta_[slot].fastReleaseGain.
+    // The fade renders from fadeVoice_[slot] (owned back by
+    // fadeOwner_[voice]), or, with fadeVoice_ == -1, plays the slot's tail
+    // carved from fadeTailBuffer_ (kMaxVoices * fadeTailCapacity_ samples),
+    // which holds raw voice output captured when no voice was idle.
+    // ------------------------------------------------------------------
+    struct FadeTail
+    {
+        int length  = 0;  // samples rendered at capture time
+        int readPos = 0;  // next sample to play
+    };
+    std::array<FadeTail, kMaxVoices>   fadeTails_{};
+    std::array<int, kMaxVoices>        fadeVoice_{};  // per slot, -1 = tail
+    std::array<int, kMaxVoices>        fadeOwner_{};  // per voice, -1 = not fading
+    std::array<VoiceMeta, kMaxVoices>  releasingMeta_{};
+    std::unique_ptr<float[]>           fadeTailBuffer_{};
+    int                                fadeTailCapacity_ = 0;
+
+    // A queued start is the note that takes the slot at the next block.
+    // `released` records a noteOff that arrived before the start.
+    struct PendingStart
+    {
+        int   padIndex = -1;
+        float velocity = 0.0f;
+        bool  released = false;
+    };
+    std::array<PendingStart, kMaxVoices> pendingStarts_{};
+
+    [[nodiscard]] float* fadeTail(int slot) noexcept
+    {
+        return fadeTailBuffer_.get()
+             + static_cast<std::size_t>(slot) * static_cast<std::size_t>(fadeTailCapacity_);
+    }
 
     // ------------------------------------------------------------------
     // Allocator + choke table
@@ -345,12 +465,10 @@ private:
     ChokeGroupTable            chokeGroups_{}; // FR-130
 
     // ------------------------------------------------------------------
-    // Scratch buffers -- FR-117 / Clarification Q4. Mono, because DrumVoice
-    // is mono. The right-channel scratch is reserved for a future stereo
-    // DrumVoice (Phase 4+).
+    // Scratch buffer -- FR-117 / Clarification Q4. Mono, because DrumVoice
+    // is mono.
     // ------------------------------------------------------------------
     std::unique_ptr<float[]> scratchL_{};
-    std::unique_ptr<float[]> scratchR_{};
 
     int    maxBlockSize_   = 0;
     double sampleRate_     = 44100.0;
@@ -370,6 +488,17 @@ private:
     // Phase 5: Coupling engine (owned by Processor, non-owning pointer).
     // ------------------------------------------------------------------
     Krate::DSP::SympatheticResonance* couplingEngine_ = nullptr;
+
+    // ------------------------------------------------------------------
+    // String body waveguides, one per DrumVoice, held only while a pad uses
+    // the String body. Writers (non-audio threads, or the audio thread when
+    // offline) serialise on stringsMutex_; `strings_` is published to the
+    // audio thread by the release store of stringsReady_.
+    // ------------------------------------------------------------------
+    std::unique_ptr<std::array<Krate::DSP::WaveguideString, kMaxVoices>> strings_{};
+    std::atomic<bool>           stringsReady_{false};
+    std::mutex                  stringsMutex_;
+    bool                        offlineRendering_ = false;
 };
 
 // ------------------------------------------------------------------
@@ -379,15 +508,17 @@ private:
 // catch any accidental addition of a heap-owning member (std::vector,
 // std::string, etc.) that would enlarge the sizeof at compile time.
 //
-// Budget: 32 * (sizeof(DrumVoice) + sizeof(VoiceMeta))
+// Budget: 32 * sizeof(VoiceMeta) + kMaxVoices * sizeof(FadeTail)
+//       + the slot/fade voice maps (3 ints per slot)
 //       + sizeof(Krate::DSP::VoiceAllocator)
 //       + sizeof(ChokeGroupTable)
-//       + 1 KiB slack for bookkeeping scalars and unique_ptr header fields.
-// Note that the two `unique_ptr<std::array<DrumVoice, 16>>` heap blocks are
-// intentionally included in the 32-slot budget (16 main + 16 shadow = 32).
+//       + per-pad configs
+//       + 2 KiB slack for bookkeeping scalars and unique_ptr header fields.
+// The voices, scratch and fade tails are heap blocks; memoryFootprintBytes()
+// accounts for them.
 // ------------------------------------------------------------------
 constexpr std::size_t kVoicePoolSizeLimit =
-    32 * sizeof(DrumVoice) + 32 * sizeof(VoiceMeta)
+    32 * sizeof(VoiceMeta) + kMaxVoices * 2 * sizeof(int) + kMaxVoices * 3 * sizeof(int)
     + sizeof(Krate::DSP::VoiceAllocator) + sizeof(ChokeGroupTable)
     + kNumPads * sizeof(PadConfig) + 2048;
 
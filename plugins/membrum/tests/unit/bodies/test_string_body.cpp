@@ -31,13 +31,14 @@ TEST_CASE("StringBody: configureForNoteOn + processSample is allocation-free",
     bank.prepare(44100.0, 0);
     bank.setBodyModel(Membrum::BodyModelType::String);
 
-    {
-        TestHelpers::AllocationScope scope;
-        bank.configureForNoteOn(makeDefaultParams(), 160.0f);
-        for (int i = 0; i < 1024; ++i)
-            (void)bank.processSample(i == 0 ? 1.0f : 0.0f);
-        CHECK(scope.getAllocationCount() == 0);
-    }
+    // The first configureForNoteOn applies the Membrane -> String swap, which
+    // must not allocate: the waveguide is owned and prepared by BodyBank.
+    auto& detector = TestHelpers::AllocationDetector::instance();
+    detector.startTracking();
+    bank.configureForNoteOn(makeDefaultParams(), 160.0f);
+    for (int i = 0; i < 1024; ++i)
+        (void)bank.processSample(i == 0 ? 1.0f : 0.0f);
+    CHECK(detector.stopTracking() == 0);
 }
 
 TEST_CASE("StringBody: partials are harmonic (integer multiples +/-1%)",
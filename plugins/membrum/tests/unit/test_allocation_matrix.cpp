@@ -9,7 +9,8 @@
 //     exception-free.
 //
 // This translation unit overrides global operator new / delete so that any
-// heap allocation made inside a TestHelpers::AllocationScope is counted.
+// heap allocation made while the TestHelpers::AllocationDetector is tracking
+// is counted.
 // No other membrum test TU overrides these (verified by
 // `rg "operator new" plugins/membrum/tests` returning nothing before this
 // file was added), so there is no ODR collision in the membrum_tests binary.
@@ -84,6 +85,9 @@ TEST_CASE("AllocationMatrix: zero heap allocs on audio-thread entries for all 36
     constexpr int kNumExciters = static_cast<int>(Membrum::ExciterType::kCount);
     constexpr int kNumBodies   = static_cast<int>(Membrum::BodyModelType::kCount);
 
+    // Counts are read from the detector directly: an AllocationScope only
+    // reports its count once it has been destroyed.
+    auto& detector = TestHelpers::AllocationDetector::instance();
     for (int e = 0; e < kNumExciters; ++e)
     {
         for (int b = 0; b < kNumBodies; ++b)
@@ -127,9 +131,9 @@ TEST_CASE("AllocationMatrix: zero heap allocs on audio-thread entries for all 36
 
             // --- noteOn() must not allocate ---------------------------------
             {
-                TestHelpers::AllocationScope scope;
+                detector.startTracking();
                 voice.noteOn(kVelocity);
-                const size_t count = scope.getAllocationCount();
+                const size_t count = detector.stopTracking();
                 INFO("noteOn() alloc count for " << label << " = " << count);
                 CHECK(count == 0u);
             }
@@ -137,18 +141,18 @@ TEST_CASE("AllocationMatrix: zero heap allocs on audio-thread entries for all 36
             // --- process() block must not allocate --------------------------
             {
                 std::array<float, 512> block{};
-                TestHelpers::AllocationScope scope;
+                detector.startTracking();
                 voice.processBlock(block.data(), 512);
-                const size_t count = scope.getAllocationCount();
+                const size_t count = detector.stopTracking();
                 INFO("processBlock() alloc count for " << label << " = " << count);
                 CHECK(count == 0u);
             }
 
             // --- noteOff() must not allocate --------------------------------
             {
-                TestHelpers::AllocationScope scope;
+                detector.startTracking();
                 voice.noteOff();
-                const size_t count = scope.getAllocationCount();
+                const size_t count = detector.stopTracking();
                 INFO("noteOff() alloc count for " << label << " = " << count);
                 CHECK(count == 0u);
             }
@@ -156,10 +160,10 @@ TEST_CASE("AllocationMatrix: zero heap allocs on audio-thread entries for all 36
             // --- per-sample process() path must not allocate either --------
             {
                 voice.noteOn(kVelocity);
-                TestHelpers::AllocationScope scope;
+                detector.startTracking();
                 for (int i = 0; i < 256; ++i)
                     (void) voice.process();
-                const size_t count = scope.getAllocationCount();
+                const size_t count = detector.stopTracking();
                 INFO("process() alloc count for " << label << " = " << count);
                 CHECK(count == 0u);
                 voice.noteOff();
@@ -167,3 +171,48 @@ TEST_CASE("AllocationMatrix: zero heap allocs on audio-thread entries for all 36
         }
     }
 }
+
+// ==============================================================================
+// FR-072: the deferred exciter/body swap runs inside noteOn() on the audio
+// thread. Walk one prepared voice through every exciter x body combination
+// so each noteOn() swaps at least one variant, and count allocations across
+// the swap itself (no warm-up). FMImpulse swapping out and back in would
+// regenerate the shared sine table if the bank did not pin it, and the
+// Impulse/Mallet/String swaps would re-allocate their delay lines.
+// ==============================================================================
+TEST_CASE("AllocationMatrix: exciter/body swaps inside noteOn do not allocate",
+          "[membrum][allocation][swap]")
+{
+    constexpr int kNumExciters = static_cast<int>(Membrum::ExciterType::kCount);
+    constexpr int kNumBodies   = static_cast<int>(Membrum::BodyModelType::kCount);
+
+    Membrum::DrumVoice voice;
+    voice.prepare(kSampleRate, 0u);
+    voice.setLevel(0.8f);
+
+    std::array<float, 64> block{};
+    auto& detector = TestHelpers::AllocationDetector::instance();
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int e = 0; e < kNumExciters; ++e)
+        {
+            for (int b = 0; b < kNumBodies; ++b)
+            {
+                const auto ex   = static_cast<Membrum::ExciterType>(e);
+                const auto body = static_cast<Membrum::BodyModelType>(b);
+                voice.setExciterType(ex);
+                voice.setBodyModel(body);
+
+                detector.startTracking();
+                voice.noteOn(kVelocity);
+                voice.processBlock(block.data(), 64);
+                voice.noteOff();
+                const size_t count = detector.stopTracking();
+
+                INFO("swap to " << exciterName(ex) << " + " << bodyName(body)
+                                << " alloc count = " << count);
+                CHECK(count == 0u);
+            }
+        }
+    }
+}
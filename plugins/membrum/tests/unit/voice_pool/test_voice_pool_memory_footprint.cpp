@@ -0,0 +1,253 @@
+// ==============================================================================
+// VoicePool memory footprint
+// ==============================================================================
+// Large sessions run many Membrum instances, so the per-instance footprint is
+// budgeted at 1 MiB. The pool meets it
+// by sharing DrumVoice scratch across voices, running fade-outs on idle voices
+// (or short tails) instead of shadow voices, sharing the FM exciter's and the
+// LFOs' tables, and holding the String body's waveguides only while a pad
+// uses that body.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "voice_pool/voice_pool.h"
+#include "voice_pool_test_helpers.h"
+
+#include <krate/dsp/processors/waveguide_string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kOneMiB = 1024U * 1024U;
+
+/// Heap one String waveguide holds, measured on a standalone instance rather
+/// than through the pool's own accounting
+std::size_t stringHeapBytes(double sampleRate)
+{
+    Krate::DSP::WaveguideString string;
+    string.prepare(sampleRate);
+    return string.heapBytes();
+}
+
+void useStringBody(Membrum::VoicePool& pool, int pad)
+{
+    pool.padConfigMut(pad).bodyModel = Membrum::BodyModelType::String;
+}
+
+/// Peak of one block after hitting `note`
+float hitPeak(Membrum::VoicePool& pool, std::uint8_t note)
+{
+    std::vector<float> outL(512, 0.0f);
+    std::vector<float> outR(512, 0.0f);
+    pool.noteOn(note, 0.9f);
+    pool.processBlock(outL.data(), outR.data(), 512);
+    float peak = 0.0f;
+    for (float x : outL)
+        peak = std::max(peak, std::abs(x));
+    return peak;
+}
+
+} // namespace
+
+TEST_CASE("VoicePool stays under 1 MiB per instance",
+          "[voice_pool][memory]")
+{
+    // 4096 stays under the 8192-sample scratch floor, so this is the worst
+    // serial case at each rate.
+    for (double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0})
+    {
+        Membrum::VoicePool pool;
+        pool.prepare(sampleRate, 4096);
+
+        const std::size_t bytes = pool.memoryFootprintBytes();
+        INFO("sample rate " << sampleRate << ": " << bytes << " bytes");
+        CHECK(bytes < kOneMiB);
+    }
+}
+
+TEST_CASE("VoicePool footprint counts every voice",
+          "[voice_pool][memory]")
+{
+    for (double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0})
+    {
+        Membrum::VoicePool pool;
+        pool.prepare(sampleRate, 4096);
+
+        const std::size_t bytes = pool.memoryFootprintBytes();
+        INFO("sample rate " << sampleRate << ": " << bytes << " bytes");
+        REQUIRE(bytes >= sizeof(Membrum::VoicePool)
+                         + Membrum::kMaxVoices * sizeof(Membrum::DrumVoice)
+                         + sizeof(Membrum::DrumVoice::Scratch));
+    }
+}
+
+TEST_CASE("VoicePool holds String waveguides only while a pad uses them",
+          "[voice_pool][memory]")
+{
+    for (double sampleRate : {44100.0, 192000.0})
+    {
+        Membrum::VoicePool pool;
+        pool.prepare(sampleRate, 4096);
+        const std::size_t withoutStrings = pool.memoryFootprintBytes();
+        REQUIRE_FALSE(pool.stringBodiesReady());
+
+        // setState path: pads loaded directly, then prepared off the audio thread
+        useStringBody(pool, 5);
+        pool.prepareStringBodies();
+        REQUIRE(pool.stringBodiesReady());
+        const std::size_t withStrings = pool.memoryFootprintBytes();
+        INFO("sample rate " << sampleRate << ": " << withoutStrings << " -> "
+             << withStrings << " bytes");
+        REQUIRE(withStrings - withoutStrings
+                >= Membrum::kMaxVoices * stringHeapBytes(sampleRate));
+
+        // The next prepare() drops them once no pad needs them
+        pool.padConfigMut(5).bodyModel = Membrum::BodyModelType::Membrane;
+        pool.prepare(sampleRate, 4096);
+        REQUIRE_FALSE(pool.stringBodiesReady());
+        REQUIRE(pool.memoryFootprintBytes() == withoutStrings);
+    }
+}
+
+TEST_CASE("VoicePool prepares String waveguides for a kit that uses them",
+          "[voice_pool][memory]")
+{
+    Membrum::VoicePool pool;
+    useStringBody(pool, 0);
+    pool.prepare(48000.0, 512);
+    REQUIRE(pool.stringBodiesReady());
+
+    Membrum::TestHelpers::setAllPadsVoiceParams(pool, 0.5f, 0.5f, 0.8f, 0.3f, 0.8f);
+    REQUIRE(hitPeak(pool, 36) > 1e-4f);
+}
+
+TEST_CASE("VoicePool String pad selected on the audio thread sounds before its waveguides exist",
+          "[voice_pool][memory]")
+{
+    Membrum::VoicePool pool;
+    pool.prepare(48000.0, 512);
+    Membrum::TestHelpers::setAllPadsVoiceParams(pool, 0.5f, 0.5f, 0.8f, 0.3f, 0.8f);
+
+    // The audio thread never allocates: the pad plays the modal approximation
+    pool.setPadConfigSelector(2, Membrum::kPadBodyModel,
+                              static_cast<int>(Membrum::BodyModelType::String));
+    REQUIRE_FALSE(pool.stringBodiesReady());
+    REQUIRE(hitPeak(pool, 38) > 1e-4f);
+
+    // The processor allocates them on the controller's request
+    pool.allocateStringBodies();
+    REQUIRE(pool.stringBodiesReady());
+    REQUIRE(hitPeak(pool, 38) > 1e-4f);
+}
+
+TEST_CASE("VoicePool offline rendering prepares String waveguides inline",
+          "[voice_pool][memory]")
+{
+    // Two offline renders of the same automation are identical: the String
+    // pad plays its waveguide from the first hit in both.
+    std::vector<float> renders[2];
+    for (auto& render : renders)
+    {
+        Membrum::VoicePool pool;
+        pool.setOfflineRendering(true);
+        pool.prepare(48000.0, 512);
+        Membrum::TestHelpers::setAllPadsVoiceParams(pool, 0.5f, 0.5f, 0.8f, 0.3f, 0.8f);
+
+        pool.setPadConfigSelector(2, Membrum::kPadBodyModel,
+                                  static_cast<int>(Membrum::BodyModelType::String));
+        REQUIRE(pool.stringBodiesReady());
+
+        std::vector<float> outL(512, 0.0f);
+        std::vector<float> outR(512, 0.0f);
+        pool.noteOn(38, 0.9f);
+        for (int block = 0; block < 4; ++block)
+        {
+            pool.processBlock(outL.data(), outR.data(), 512);
+            render.insert(render.end(), outL.begin(), outL.end());
+        }
+    }
+    float peak = 0.0f;
+    for (float x : renders[0])
+        peak = std::max(peak, std::abs(x));
+    REQUIRE(peak > 1e-4f);
+    REQUIRE(renders[0] == renders[1]);
+}
+
+TEST_CASE("VoicePool fade-outs need no voice beyond the main slots",
+          "[voice_pool][memory]")
+{
+    // Every voice stolen in quick succession: all 16 slots fade at once and
+    // no voice is idle to take a fade over, so they play out of the fixed
+    // tail storage. The footprint does not move and every slot still
+    // terminates within the fade window.
+    Membrum::VoicePool pool;
+    pool.prepare(48000.0, 256);
+    pool.setMaxPolyphony(16);
+    Membrum::TestHelpers::setAllPadsVoiceParams(pool, 0.5f, 0.5f, 0.8f, 0.3f, 0.8f);
+    const std::size_t before = pool.memoryFootprintBytes();
+
+    std::vector<float> outL(256, 0.0f);
+    std::vector<float> outR(256, 0.0f);
+    for (int n = 0; n < 32; ++n)
+        pool.noteOn(static_cast<std::uint8_t>(36 + n), 0.9f);
+
+    int fading = 0;
+    for (int slot = 0; slot < Membrum::kMaxVoices; ++slot)
+        if (pool.releasingMeta(slot).state == Membrum::VoiceSlotState::FastReleasing)
+            ++fading;
+    REQUIRE(fading == Membrum::kMaxVoices);
+
+    // 5 ms at 48 kHz is 240 samples: two blocks end every fade.
+    pool.processBlock(outL.data(), outR.data(), 256);
+    pool.processBlock(outL.data(), outR.data(), 256);
+    for (int slot = 0; slot < Membrum::kMaxVoices; ++slot)
+        REQUIRE(pool.releasingMeta(slot).state == Membrum::VoiceSlotState::Free);
+
+    REQUIRE(pool.memoryFootprintBytes() == before);
+}
+
+TEST_CASE("VoicePool stolen voice fades block by block on its own DrumVoice",
+          "[voice_pool][memory]")
+{
+    // At polyphony 4 the slots beyond it hold idle voices: the stolen slot
+    // takes one of them for the new note, and the stolen voice keeps
+    // rendering under the ramp instead of being rendered out at the steal.
+    Membrum::VoicePool pool;
+    pool.prepare(48000.0, 64);
+    pool.setMaxPolyphony(4);
+    Membrum::TestHelpers::setAllPadsVoiceParams(pool, 0.5f, 0.5f, 0.8f, 0.3f, 0.8f);
+
+    std::vector<float> outL(64, 0.0f);
+    std::vector<float> outR(64, 0.0f);
+    for (int n = 0; n < 4; ++n)
+        pool.noteOn(static_cast<std::uint8_t>(36 + n), 0.9f);
+    pool.processBlock(outL.data(), outR.data(), 64);
+
+    int stolen = -1;
+    for (int slot = 0; slot < 4; ++slot)
+        if (pool.voiceMeta(slot).originatingNote == 36)
+            stolen = slot;
+    REQUIRE(stolen >= 0);
+    const Membrum::DrumVoice* stolenVoice = &pool.mainVoiceRef(stolen);
+
+    pool.noteOn(40, 0.9f);
+    REQUIRE(pool.releasingMeta(stolen).state == Membrum::VoiceSlotState::FastReleasing);
+
+    // 5 ms at 48 kHz is 240 samples: the fade spans four 64-sample blocks.
+    pool.processBlock(outL.data(), outR.data(), 64);
+    REQUIRE(&pool.mainVoiceRef(stolen) != stolenVoice);
+    REQUIRE(pool.mainVoiceRef(stolen).isActive());
+    REQUIRE(stolenVoice->isActive());
+    REQUIRE(pool.releasingMeta(stolen).state == Membrum::VoiceSlotState::FastReleasing);
+
+    for (int block = 0; block < 3; ++block)
+        pool.processBlock(outL.data(), outR.data(), 64);
+    REQUIRE(pool.releasingMeta(stolen).state == Membrum::VoiceSlotState::Free);
+    REQUIRE_FALSE(stolenVoice->isActive());
+}
@@ -529,6 +529,9 @@ bool Controller::loadStateCore(Steinberg::IBStreamer& streamer,
     // Arp params (includes all lane step data) - ALWAYS applied
     loadArpParamsToController(streamer, setParam, version);
 
+    // Filter quality (version 9+; older states load as High)
+    loadSettingsFilterQualityToController(streamer, version, synthSetter);
+
     return true;
 }
 
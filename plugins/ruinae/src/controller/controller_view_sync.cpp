@@ -82,7 +82,6 @@ Steinberg::tresult PLUGIN_API Controller::setParamNormalized(
     if (tag == kModSourceViewModeTag) {
         resetModSourceViewPointers();
     }
-
     // During bulk parameter loads (preset switching), skip per-param view updates.
     // syncAllViews() will do a single batch sync afterwards.
     if (bulkParamLoad_)
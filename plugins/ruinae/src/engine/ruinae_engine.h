@@ -29,6 +29,7 @@
 #include <krate/dsp/core/modulation_types.h>
 #include <krate/dsp/core/pitch_utils.h>
 #include <krate/dsp/core/sigmoid.h>
+#include <krate/dsp/core/voice_mix_simd.h>
 
 // Layer 1
 #include <krate/dsp/primitives/svf.h>
@@ -40,6 +41,7 @@
 // Shared DSP systems
 #include <krate/dsp/systems/modulation_engine.h>
 #include <krate/dsp/systems/poly_synth_engine.h>  // For VoiceMode enum
+#include <krate/dsp/systems/spectral_morph_service.h>
 #include <krate/dsp/systems/voice_allocator.h>
 
 // Plugin engine components (co-located)
@@ -104,8 +106,9 @@ static_assert(static_cast<uint32_t>(RuinaeModDest::ArpRate) ==
 /// Single-threaded model. All methods must be called from the same thread.
 ///
 /// @par Real-Time Safety
-/// processBlock() and all setters are fully real-time safe.
-/// prepare() is NOT real-time safe (allocates scratch buffers).
+/// processBlock() and all setters are fully real-time safe. prepare() and
+/// reserveSpectralMorph() are NOT real-time safe (allocate scratch buffers
+/// and the shared spectral morph slots).
 class RuinaeEngine {
 public:
     // =========================================================================
@@ -148,9 +151,15 @@ public:
     void prepare(double sampleRate, size_t maxBlockSize) noexcept {
         sampleRate_ = sampleRate;
 
-        // Initialize all 16 voices
-        for (auto& voice : voices_) {
-            voice.prepare(sampleRate, maxBlockSize);
+        // Shared spectral morph: one slot per voice, slot buffers allocated
+        // only by reserveSpectralMorph() (kept across re-prepares)
+        spectralMorph_.prepare(sampleRate, maxBlockSize, kMaxPolyphony);
+
+        // Initialize all 16 voices (attached first, so they skip their own
+        // standalone morph service)
+        for (size_t i = 0; i < kMaxPolyphony; ++i) {
+            voices_[i].setSpectralMorphService(&spectralMorph_, i);
+            voices_[i].prepare(sampleRate, maxBlockSize);
         }
 
         // Initialize sub-components
@@ -176,7 +185,8 @@ public:
         effectsChain_.prepare(sampleRate, maxBlockSize);
 
         // Allocate scratch buffers
-        voiceScratchBuffer_.resize(maxBlockSize, 0.0f);
+        voiceLaneStride_ = maxBlockSize;
+        voiceLaneBuffer_.resize(kMaxPolyphony * maxBlockSize, 0.0f);
         mixBufferL_.resize(maxBlockSize, 0.0f);
         mixBufferR_.resize(maxBlockSize, 0.0f);
         previousOutputL_.resize(maxBlockSize, 0.0f);
@@ -210,7 +220,7 @@ public:
         effectsChain_.reset();
 
         // Clear scratch buffers
-        std::fill(voiceScratchBuffer_.begin(), voiceScratchBuffer_.end(), 0.0f);
+        std::fill(voiceLaneBuffer_.begin(), voiceLaneBuffer_.end(), 0.0f);
         std::fill(mixBufferL_.begin(), mixBufferL_.end(), 0.0f);
         std::fill(mixBufferR_.begin(), mixBufferR_.end(), 0.0f);
         std::fill(previousOutputL_.begin(), previousOutputL_.end(), 0.0f);
@@ -798,7 +808,7 @@ public:
         }
 
         // Defensive: clamp to scratch buffer size
-        numSamples = std::min(numSamples, voiceScratchBuffer_.size());
+        numSamples = std::min(numSamples, voiceLaneStride_);
 
         // Step 1: Clear stereo mix buffers
         std::fill(mixBufferL_.begin(), mixBufferL_.begin() + numSamples, 0.0f);
@@ -1020,10 +1030,22 @@ public:
 
     // --- Mixer ---
 
+    /// @note SpectralMorph needs reserveSpectralMorph() first; until then
+    ///       the voices keep crossfading.
     void setMixMode(MixMode mode) noexcept {
+        mixMode_ = mode;
         for (auto& voice : voices_) { voice.setMixMode(mode); }
     }
 
+    /// @brief Allocate the spectral morph slots of all kMaxPolyphony voices,
+    ///        so that SpectralMorph mode at any polyphony never allocates.
+    /// @note NOT real-time safe. Call after prepare() while processBlock() is
+    ///       not running (the plugin does so in setupProcessing). Slots
+    ///       survive later prepare() calls.
+    void reserveSpectralMorph() noexcept {
+        spectralMorph_.ensureSlots(kMaxPolyphony);
+    }
+
     void setMixPosition(float mix) noexcept {
         if (detail::isNaN(mix) || detail::isInf(mix)) return;
         voiceMixPosition_ = std::clamp(mix, 0.0f, 1.0f);
@@ -1065,6 +1087,10 @@ public:
         for (auto& voice : voices_) { voice.setFilterKeyTrack(amount); }
     }
 
+    void setFilterQuality(RuinaeFilterQuality quality) noexcept {
+        for (auto& voice : voices_) { voice.setFilterQuality(quality); }
+    }
+
     void setFilterLadderSlope(int poles) noexcept {
         for (auto& voice : voices_) { voice.setFilterLadderSlope(poles); }
     }
@@ -1961,7 +1987,12 @@ private:
             }
         }
 
-        // Step 7: Process each active voice
+        // Step 7: Render each active voice into its own lane
+        std::array<const float*, kMaxPolyphony> lanes{};
+        std::array<float, kMaxPolyphony> laneGainsL{};
+        std::array<float, kMaxPolyphony> laneGainsR{};
+        size_t numLanes = 0;
+
         for (size_t i = 0; i < polyphonyCount_; ++i) {
             if (!voices_[i].isActive()) continue;
 
@@ -1973,20 +2004,40 @@ private:
                 voices_[i].setFrequency(freq);
             }
 
-            // Step 7d: Process voice into scratch buffer (mono output)
-            voices_[i].processBlock(voiceScratchBuffer_.data(), numSamples);
-
-            // Step 7e: Pan and sum into stereo mix buffers (FR-012)
+            // Step 7d: Constant-power pan gains (FR-012)
             const float panPosition = voicePanPositions_[i];
-            const float leftGain = std::cos(panPosition * kPi * 0.5f);
-            const float rightGain = std::sin(panPosition * kPi * 0.5f);
+            laneVoices_[numLanes] = i;
+            lanes[numLanes] = voiceLane(i);
+            laneGainsL[numLanes] = std::cos(panPosition * kPi * 0.5f);
+            laneGainsR[numLanes] = std::sin(panPosition * kPi * 0.5f);
+            ++numLanes;
+        }
 
-            for (size_t s = 0; s < numSamples; ++s) {
-                mixBufferL_[s] += voiceScratchBuffer_[s] * leftGain;
-                mixBufferR_[s] += voiceScratchBuffer_[s] * rightGain;
+        // Step 7e: Process voices into their lanes (mono output). In
+        // SpectralMorph mode the render is split around one batched pass of
+        // the shared morph service, which pairs the voices' FFTs.
+        if (mixMode_ == MixMode::SpectralMorph) {
+            for (size_t l = 0; l < numLanes; ++l) {
+                voices_[laneVoices_[l]].beginBlock(numSamples);
+            }
+            spectralMorph_.process();
+            for (size_t l = 0; l < numLanes; ++l) {
+                const size_t voiceIndex = laneVoices_[l];
+                voices_[voiceIndex].finishBlock(voiceLane(voiceIndex), numSamples);
+            }
+        } else {
+            for (size_t l = 0; l < numLanes; ++l) {
+                const size_t voiceIndex = laneVoices_[l];
+                voices_[voiceIndex].processBlock(voiceLane(voiceIndex), numSamples);
             }
         }
 
+        // Step 7f: Pan and sum all lanes into the stereo mix buffers in one
+        // SIMD pass (voice index order, so the sum is deterministic)
+        mixVoiceLanesStereo(lanes.data(), laneGainsL.data(), laneGainsR.data(),
+                            numLanes, mixBufferL_.data(), mixBufferR_.data(),
+                            numSamples);
+
         // Step 16: Deferred voiceFinished notifications (FR-033, FR-034)
         for (size_t i = 0; i < polyphonyCount_; ++i) {
             if (wasActive[i] && !voices_[i].isActive()) {
@@ -1995,6 +2046,10 @@ private:
         }
     }
 
+    [[nodiscard]] float* voiceLane(size_t voiceIndex) noexcept {
+        return voiceLaneBuffer_.data() + voiceIndex * voiceLaneStride_;
+    }
+
     // =========================================================================
     // Block Processing - Mono Mode
     // =========================================================================
@@ -2115,7 +2170,19 @@ private:
     /// dependency on the host's block size.
     std::array<float, kPortamentoChunk> monoChunkBuffer_{};
 
-    std::vector<float> voiceScratchBuffer_;
+    /// One mono render lane per voice slot, kMaxPolyphony x voiceLaneStride_.
+    /// Voices render into separate lanes and are mixed in a single pass.
+    std::vector<float> voiceLaneBuffer_;
+    size_t voiceLaneStride_ = 0;
+
+    /// Voice index rendered into each lane this block
+    std::array<size_t, kMaxPolyphony> laneVoices_{};
+
+    /// Spectral morph shared by all voices (voice i uses slot i), so the
+    /// voices' FFTs run batched; slot buffers exist only once SpectralMorph
+    /// mode has been selected
+    SpectralMorphService spectralMorph_;
+    MixMode mixMode_ = MixMode::CrossfadeMix;
     std::vector<float> mixBufferL_;
     std::vector<float> mixBufferR_;
     std::vector<float> previousOutputL_;
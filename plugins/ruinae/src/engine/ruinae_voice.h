@@ -15,10 +15,12 @@
 
 #include "ruinae_types.h"
 #include <krate/dsp/systems/selectable_oscillator.h>
+#include <krate/dsp/systems/spectral_morph_service.h>
 #include <krate/dsp/systems/voice_mod_router.h>
 
 // Layer 0
 #include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/core/fast_math.h>
 #include <krate/dsp/core/pitch_utils.h>
 
 // Layer 1
@@ -40,7 +42,6 @@
 #include <krate/dsp/processors/ring_modulator.h>
 #include <krate/dsp/processors/tape_saturator.h>
 #include <krate/dsp/processors/trance_gate.h>
-#include <krate/dsp/processors/spectral_morph_filter.h>
 #include <krate/dsp/processors/envelope_filter.h>
 #include <krate/dsp/processors/self_oscillating_filter.h>
 
@@ -65,7 +66,8 @@ namespace Krate::DSP {
 /// - Pre-allocated filters: SVF, LadderFilter, FormantFilter, FeedbackComb
 /// - Pre-allocated distortions: ChaosWaveshaper, SpectralDistortion,
 ///   GranularDistortion, Wavefolder, TapeSaturator
-/// - SpectralMorphFilter (always allocated, 1024 FFT)
+/// - A slot in a SpectralMorphService (engine-shared, or for a standalone
+///   voice its own one-slot service, allocated in prepare())
 /// - TranceGate (post-DC blocker, pre-VCA) (FR-016 through FR-019)
 /// - DCBlocker (post-distortion)
 /// - ADSREnvelope x3 (amplitude, filter, modulation)
@@ -80,7 +82,8 @@ namespace Krate::DSP {
 ///
 /// @par Real-Time Safety
 /// processBlock() and all setter methods are fully real-time safe (FR-033).
-/// prepare() is NOT real-time safe (allocates all sub-components).
+/// prepare() and setSpectralMorphService() are NOT real-time safe (allocate
+/// sub-components and the standalone spectral morph service).
 class RuinaeVoice {
 public:
     // =========================================================================
@@ -114,12 +117,10 @@ public:
         oscBBuffer_.resize(maxBlockSize, 0.0f);
         mixBuffer_.resize(maxBlockSize, 0.0f);
         distortionBuffer_.resize(maxBlockSize, 0.0f);
-        spectralMorphBuffer_.resize(maxBlockSize, 0.0f);
 
         // Create shared oscillator resources
         if (!oscResources_.wavetable) {
-            oscResources_.wavetable = std::make_unique<WavetableData>();
-            generateMipmappedSaw(*oscResources_.wavetable);
+            oscResources_.wavetable = WavetableCache::instance().acquire(CachedWaveform::Saw);
         }
         if (!oscResources_.minBlepTable) {
             oscResources_.minBlepTable = std::make_unique<MinBlepTable>();
@@ -144,10 +145,13 @@ public:
         // Initialize DC blocker
         dcBlocker_.prepare(sampleRate);
 
-        // SpectralMorphFilter: pre-allocated with 1024 FFT (SC-004)
-        spectralMorph_ = std::make_unique<SpectralMorphFilter>();
-        spectralMorph_->prepare(sampleRate, 1024);
-        spectralMorph_->setMorphAmount(mixPosition_);
+        // Spectral morph: the engine's shared service, or for a standalone
+        // voice its own one-slot service
+        if (sharedSpectralMorph_ == nullptr) {
+            allocateOwnSpectralMorph();
+        } else {
+            ownSpectralMorph_.reset();
+        }
 
         // Initialize TranceGate (FR-016)
         tranceGate_.prepare(sampleRate);
@@ -184,7 +188,6 @@ public:
         resetActiveFilter();
         resetActiveDistortion();
         dcBlocker_.reset();
-        if (spectralMorph_) spectralMorph_->reset();
         tranceGate_.reset();
 
         noteFrequency_ = 0.0f;
@@ -201,7 +204,7 @@ public:
         resetActiveFilter();
         resetActiveDistortion();
         dcBlocker_.reset();
-        if (spectralMorph_) spectralMorph_->reset();
+        if (auto* morph = spectralMorph()) morph->resetSlot(spectralMorphSlot());
         tranceGate_.reset();
         ampEnv_.reset();
         filterEnv_.reset();
@@ -353,24 +356,28 @@ public:
     /// 8. VCA (amplitude envelope) -> output
     /// 9. NaN/Inf flush -> output
     ///
+    /// Equivalent to beginBlock(), running the voice's spectral morph slot,
+    /// then finishBlock().
+    ///
     /// Real-time safe: no allocation, no exceptions, no blocking.
     void processBlock(float* output, size_t numSamples) noexcept {
-        if (!prepared_ || output == nullptr || numSamples == 0) {
-            if (output != nullptr) {
-                std::fill(output, output + numSamples, 0.0f);
-            }
-            return;
-        }
+        beginBlock(numSamples);
+        if (usesSpectralMorph()) spectralMorph()->process(spectralMorphSlot());
+        finishBlock(output, numSamples);
+    }
+
+    /// @brief First half of processBlock(): steps 1-2, and in SpectralMorph
+    /// mode the push of both oscillators into the voice's morph slot.
+    ///
+    /// An engine sharing one SpectralMorphService runs beginBlock() on every
+    /// voice, SpectralMorphService::process() once (batching the FFTs across
+    /// voices), then finishBlock() on every voice.
+    void beginBlock(size_t numSamples) noexcept {
+        if (!prepared_ || numSamples == 0 || !ampEnv_.isActive()) return;
 
         // Clamp to max block size to prevent buffer overruns
         numSamples = std::min(numSamples, maxBlockSize_);
 
-        // Early-out when voice is inactive
-        if (!ampEnv_.isActive()) {
-            std::fill(output, output + numSamples, 0.0f);
-            return;
-        }
-
         // Per-voice portamento ramp (073-per-step-mods, FR-034)
         // Advance portamento at block rate: compute interpolated frequency
         // and update oscillators before block processing.
@@ -393,18 +400,17 @@ public:
         // Step 2: Generate OSC B
         oscB_.processBlock(oscBBuffer_.data(), numSamples);
 
-        // Step 3: Mix oscillators (FR-006, FR-007)
-        if (mixMode_ == MixMode::SpectralMorph && spectralMorph_) {
-            // Apply the OSC levels to the morph INPUTS. The per-sample loop below
-            // that normally does this is gated to CrossfadeMix, so without this
-            // the level knobs and the OscALevel/OscBLevel modulation
-            // destinations had no effect in this mode. Scaling the morphed
-            // output instead would be a single gain and could not express the
-            // A-vs-B balance.
+        if (usesSpectralMorph()) {
+            // Apply the OSC levels to the morph INPUTS. The per-sample loop in
+            // finishBlock() that normally does this is gated to CrossfadeMix,
+            // so without this the level knobs and the OscALevel/OscBLevel
+            // modulation destinations had no effect in this mode. Scaling the
+            // morphed output instead would be a single gain and could not
+            // express the A-vs-B balance.
             //
-            // spectralMorph_ is block-based, so OscLevel modulation is block-rate
-            // in this mode: the offset is sampled once per block rather than per
-            // sample.
+            // The spectral morph is block-based, so OscLevel modulation is
+            // block-rate in this mode: the offset is sampled once per block
+            // rather than per sample.
             const float blockOscALevel = std::clamp(
                 oscALevel_ + modRouter_.getOffset(VoiceModDest::OscALevel)
                     * modDestScales_[static_cast<size_t>(VoiceModDest::OscALevel)],
@@ -421,12 +427,35 @@ public:
                 for (size_t i = 0; i < numSamples; ++i) oscBBuffer_[i] *= blockOscBLevel;
             }
 
+            spectralMorph()->push(spectralMorphSlot(), oscABuffer_.data(),
+                                  oscBBuffer_.data(), numSamples);
+        }
+    }
+
+    /// @brief Second half of processBlock(): steps 3-9. In SpectralMorph mode
+    /// the mix is pulled from the voice's morph slot, so the slot must have
+    /// been processed since beginBlock().
+    void finishBlock(float* output, size_t numSamples) noexcept {
+        if (!prepared_ || output == nullptr || numSamples == 0) {
+            if (output != nullptr) {
+                std::fill(output, output + numSamples, 0.0f);
+            }
+            return;
+        }
+
+        // Clamp to max block size to prevent buffer overruns
+        numSamples = std::min(numSamples, maxBlockSize_);
+
+        // Early-out when voice is inactive
+        if (!ampEnv_.isActive()) {
+            std::fill(output, output + numSamples, 0.0f);
+            return;
+        }
+
+        // Step 3: Mix oscillators (FR-006, FR-007)
+        if (usesSpectralMorph()) {
             // SpectralMorph mode: FFT-based spectral interpolation (FR-006)
-            spectralMorph_->processBlock(oscABuffer_.data(), oscBBuffer_.data(),
-                                         spectralMorphBuffer_.data(), numSamples);
-            std::copy(spectralMorphBuffer_.data(),
-                      spectralMorphBuffer_.data() + numSamples,
-                      mixBuffer_.data());
+            spectralMorph()->pull(spectralMorphSlot(), mixBuffer_.data(), numSamples);
         } else {
             // CrossfadeMix mode: linear crossfade (FR-007)
             // Explicit branches at extremes avoid FMA contraction issues on ARM
@@ -457,6 +486,10 @@ public:
             ? filterKeyTrack_ * (frequencyToMidiNote(noteFrequency_) - 60.0f)
             : 0.0f;
 
+        // Filter control rate (RuinaeFilterQuality): 1 = every sample.
+        const size_t filterUpdateInterval = activeFilterUpdateInterval();
+        size_t filterUpdateCountdown = 0;
+
         for (size_t i = 0; i < numSamples; ++i) {
             // Advance envelopes
             const float filterEnvVal = filterEnv_.process();
@@ -513,25 +546,30 @@ public:
                               + oscBSample * modulatedMix;
             }
 
-            // Compute per-sample cutoff modulation (FR-011)
-            // MPE brightness: map 0-1 to ±48 semitones from center (0.5)
-            const float brightnessOffset = (expressionBrightness_ - 0.5f) * 96.0f;
-            const float totalSemitones = filterEnvAmount_ * filterEnvVal
-                                       + keyTrackSemitones
-                                       + cutoffModSemitones
-                                       + brightnessOffset;
-            float effectiveCutoff = filterCutoffHz_ * semitonesToRatio(totalSemitones);
-            effectiveCutoff = std::clamp(effectiveCutoff, 20.0f, maxCutoff);
-
-            // Update filter cutoff and process sample
-            setActiveFilterCutoff(effectiveCutoff);
-
-            // Apply filter resonance modulation
-            if (resonanceModOffset != 0.0f) {
-                const float effectiveResonance = std::clamp(
-                    filterResonance_ + resonanceModOffset, 0.1f, 30.0f);
-                setActiveFilterResonance(effectiveResonance);
+            // Compute cutoff modulation (FR-011) at the filter control rate
+            if (filterUpdateCountdown == 0) {
+                filterUpdateCountdown = filterUpdateInterval;
+
+                // MPE brightness: map 0-1 to ±48 semitones from center (0.5)
+                const float brightnessOffset = (expressionBrightness_ - 0.5f) * 96.0f;
+                const float totalSemitones = filterEnvAmount_ * filterEnvVal
+                                           + keyTrackSemitones
+                                           + cutoffModSemitones
+                                           + brightnessOffset;
+                float effectiveCutoff = filterCutoffHz_ * cutoffRatio(totalSemitones);
+                effectiveCutoff = std::clamp(effectiveCutoff, 20.0f, maxCutoff);
+
+                // Update filter cutoff
+                setActiveFilterCutoff(effectiveCutoff);
+
+                // Apply filter resonance modulation
+                if (resonanceModOffset != 0.0f) {
+                    const float effectiveResonance = std::clamp(
+                        filterResonance_ + resonanceModOffset, 0.1f, 30.0f);
+                    setActiveFilterResonance(effectiveResonance);
+                }
             }
+            --filterUpdateCountdown;
 
             mixBuffer_[i] = processActiveFilter(mixBuffer_[i]);
 
@@ -544,9 +582,10 @@ public:
             const float tiltModOffset =
                 modRouter_.getOffset(VoiceModDest::SpectralTilt)
                 * modDestScales_[static_cast<size_t>(VoiceModDest::SpectralTilt)];
-            if (tiltModOffset != 0.0f && spectralMorph_) {
+            auto* morph = spectralMorph();
+            if (tiltModOffset != 0.0f && morph != nullptr) {
                 const float modulatedTilt = std::clamp(mixTilt_ + tiltModOffset, -12.0f, 12.0f);
-                spectralMorph_->setSpectralTilt(modulatedTilt);
+                morph->setSpectralTilt(spectralMorphSlot(), modulatedTilt);
             }
         }
 
@@ -714,18 +753,40 @@ public:
 
     /// @brief Set the mixer mode (CrossfadeMix or SpectralMorph).
     ///
-    /// Real-time safe: SpectralMorphFilter is always pre-allocated (SC-004).
+    /// Real-time safe. With a shared service the voice keeps crossfading
+    /// until the owner has allocated its slot (SpectralMorphService::ensureSlots()).
     void setMixMode(MixMode mode) noexcept {
         mixMode_ = mode;
     }
 
+    /// @brief Route SpectralMorph mode through a slot of a shared service.
+    ///
+    /// The service stays owned by the caller (the engine), which is
+    /// responsible for SpectralMorphService::ensureSlots() and for calling
+    /// SpectralMorphService::process() between beginBlock() and finishBlock().
+    /// Passing nullptr detaches the voice. NOT real-time safe (frees the
+    /// voice's own service, if any).
+    void setSpectralMorphService(SpectralMorphService* service, size_t slot) noexcept {
+        sharedSpectralMorph_ = service;
+        sharedSpectralMorphSlot_ = slot;
+        ownSpectralMorph_.reset();
+        if (service != nullptr) {
+            service->setMorphAmount(slot, mixPosition_);
+            service->setSpectralTilt(slot, mixTilt_);
+        } else if (prepared_) {
+            allocateOwnSpectralMorph();
+        }
+    }
+
     /// @brief Set the mix position between OSC A and OSC B.
     ///
     /// 0.0 = OSC A only, 1.0 = OSC B only, 0.5 = equal blend.
     void setMixPosition(float mix) noexcept {
         if (detail::isNaN(mix) || detail::isInf(mix)) return;
         mixPosition_ = std::clamp(mix, 0.0f, 1.0f);
-        if (spectralMorph_) spectralMorph_->setMorphAmount(mixPosition_);
+        if (auto* morph = spectralMorph()) {
+            morph->setMorphAmount(spectralMorphSlot(), mixPosition_);
+        }
     }
 
     /// @brief Set the spectral tilt (brightness control) for SpectralMorph mode.
@@ -734,7 +795,9 @@ public:
     void setMixTilt(float tiltDb) noexcept {
         if (detail::isNaN(tiltDb) || detail::isInf(tiltDb)) return;
         mixTilt_ = std::clamp(tiltDb, -12.0f, 12.0f);
-        if (spectralMorph_) spectralMorph_->setSpectralTilt(mixTilt_);
+        if (auto* morph = spectralMorph()) {
+            morph->setSpectralTilt(spectralMorphSlot(), mixTilt_);
+        }
     }
 
     // =========================================================================
@@ -817,6 +880,13 @@ public:
         if (filterComb_) filterComb_->setDamping(std::clamp(amount, 0.0f, 1.0f));
     }
 
+    /// @brief Set filter modulation quality (control rate and coefficient math).
+    void setFilterQuality(RuinaeFilterQuality quality) noexcept {
+        if (quality >= RuinaeFilterQuality::NumQualities) return;
+        filterQuality_ = quality;
+        applyFilterQuality();
+    }
+
     /// @brief Set SVF slope (1=12dB single stage, 2=24dB cascaded).
     void setFilterSvfSlope(int stages) noexcept {
         const int previous = svfSlopeStages_;
@@ -1219,6 +1289,37 @@ public:
     [[nodiscard]] const ADSREnvelope& getModEnvelope() const noexcept { return modEnv_; }
 
 private:
+    // =========================================================================
+    // Spectral Morph Slot
+    // =========================================================================
+
+    /// @brief The service backing SpectralMorph mode, or nullptr.
+    [[nodiscard]] SpectralMorphService* spectralMorph() const noexcept {
+        return sharedSpectralMorph_ != nullptr ? sharedSpectralMorph_
+                                               : ownSpectralMorph_.get();
+    }
+
+    [[nodiscard]] size_t spectralMorphSlot() const noexcept {
+        return sharedSpectralMorph_ != nullptr ? sharedSpectralMorphSlot_ : 0;
+    }
+
+    /// @brief True when the mix runs through an allocated morph slot. Until
+    /// the slot exists the voice falls back to the crossfade mix.
+    [[nodiscard]] bool usesSpectralMorph() const noexcept {
+        if (mixMode_ != MixMode::SpectralMorph) return false;
+        const auto* morph = spectralMorph();
+        return morph != nullptr && morph->isSlotAllocated(spectralMorphSlot());
+    }
+
+    /// @brief Give a standalone voice its own one-slot service (not real-time safe).
+    void allocateOwnSpectralMorph() noexcept {
+        if (!ownSpectralMorph_) ownSpectralMorph_ = std::make_unique<SpectralMorphService>();
+        ownSpectralMorph_->prepare(sampleRate_, maxBlockSize_, 1);
+        ownSpectralMorph_->setMorphAmount(0, mixPosition_);
+        ownSpectralMorph_->setSpectralTilt(0, mixTilt_);
+        ownSpectralMorph_->ensureSlots(1);
+    }
+
     // =========================================================================
     // Filter Pre-allocation and Dispatch
     // =========================================================================
@@ -1259,6 +1360,50 @@ private:
         filterSelfOsc_ = std::make_unique<SelfOscillatingFilter>();
         filterSelfOsc_->prepare(sampleRate_, static_cast<int>(maxBlockSize_));
         filterSelfOsc_->setExternalMix(0.5f);
+
+        applyFilterQuality();
+    }
+
+    /// @brief Push the coefficient-approximation choice into SVF/ladder.
+    void applyFilterQuality() noexcept {
+        const bool fast = filterQuality_ == RuinaeFilterQuality::Economy;
+        filterSvf_.setFastCoefficients(fast);
+        filterSvf2_.setFastCoefficients(fast);
+        if (filterLadder_) filterLadder_->setFastCoefficients(fast);
+    }
+
+    /// @brief Samples between cutoff/resonance updates for this block.
+    ///
+    /// Only SVF and ladder smooth their coefficients internally; the other
+    /// filter types would step audibly, so they stay per-sample.
+    [[nodiscard]] size_t activeFilterUpdateInterval() const noexcept {
+        switch (filterType_) {
+            case RuinaeFilterType::SVF_LP:
+            case RuinaeFilterType::SVF_HP:
+            case RuinaeFilterType::SVF_BP:
+            case RuinaeFilterType::SVF_Notch:
+            case RuinaeFilterType::SVF_Allpass:
+            case RuinaeFilterType::SVF_Peak:
+            case RuinaeFilterType::SVF_LowShelf:
+            case RuinaeFilterType::SVF_HighShelf:
+            case RuinaeFilterType::Ladder:
+                break;
+            default:
+                return 1;
+        }
+        switch (filterQuality_) {
+            case RuinaeFilterQuality::Standard: return kFilterControlIntervalStandard;
+            case RuinaeFilterQuality::Economy:  return kFilterControlIntervalEconomy;
+            default:                            return 1;
+        }
+    }
+
+    /// @brief Cutoff multiplier for a semitone offset (fastExp2 in Economy).
+    [[nodiscard]] float cutoffRatio(float semitones) const noexcept {
+        if (filterQuality_ == RuinaeFilterQuality::Economy) {
+            return FastMath::fastExp2(semitones * (1.0f / 12.0f));
+        }
+        return semitonesToRatio(semitones);
     }
 
     /// @brief Update SVF mode based on filter type enum (both stages).
@@ -1686,9 +1831,10 @@ private:
     float oscBLevel_{1.0f};
     float oscBPitchModSemitones_{0.0f};  ///< Per-voice mod offset for OSC B pitch
 
-    // Shared oscillator resources (owned here, shared with both oscillators)
+    // Shared oscillator resources (shared with both oscillators; the saw
+    // wavetable is one cached table shared by every voice)
     struct SharedOscResources {
-        std::unique_ptr<WavetableData> wavetable;
+        WavetableCache::Handle wavetable;
         std::unique_ptr<MinBlepTable> minBlepTable;
     } oscResources_;
 
@@ -1697,13 +1843,14 @@ private:
     std::vector<float> oscBBuffer_;
     std::vector<float> mixBuffer_;
     std::vector<float> distortionBuffer_;       // For SpectralDistortion (non-in-place)
-    std::vector<float> spectralMorphBuffer_;    // For SpectralMorphFilter output
 
     // Mixer
     MixMode mixMode_{MixMode::CrossfadeMix};
     float mixPosition_{0.5f};
     float mixTilt_{0.0f};   // Base spectral tilt in dB/octave [-12, +12]
-    std::unique_ptr<SpectralMorphFilter> spectralMorph_;  // Pre-allocated at prepare() (SC-004)
+    SpectralMorphService* sharedSpectralMorph_ = nullptr;  // Engine-owned, not owned here
+    size_t sharedSpectralMorphSlot_ = 0;
+    std::unique_ptr<SpectralMorphService> ownSpectralMorph_;  // Standalone voices only
 
     // Pre-allocated filters (FR-010: all types alive simultaneously)
     SVF filterSvf_;
@@ -1721,6 +1868,10 @@ private:
     float filterResonance_{0.707f};
     float filterEnvAmount_{0.0f};
     float filterKeyTrack_{0.0f};
+    RuinaeFilterQuality filterQuality_{RuinaeFilterQuality::High};
+
+    static constexpr size_t kFilterControlIntervalStandard = 16;
+    static constexpr size_t kFilterControlIntervalEconomy = 32;
 
     // Pre-allocated distortions (FR-013: all types alive simultaneously)
     std::unique_ptr<ChaosWaveshaper> distChaos_;
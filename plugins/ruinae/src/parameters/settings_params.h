@@ -19,6 +19,7 @@ struct SettingsParams {
     std::atomic<int> voiceAllocMode{1};                 // AllocationMode index (0-3), default=Oldest(1)
     std::atomic<int> voiceStealMode{0};                 // StealMode index (0-1), default=Hard(0)
     std::atomic<bool> gainCompensation{true};           // default=ON for new presets
+    std::atomic<int> filterQuality{1};                  // RuinaeFilterQuality index (0-2), default=Standard(1)
 };
 
 inline void handleSettingsParamChange(
@@ -49,6 +50,10 @@ inline void handleSettingsParamChange(
                 std::memory_order_relaxed); break;
         case kSettingsGainCompensationId:
             params.gainCompensation.store(value >= 0.5, std::memory_order_relaxed); break;
+        case kSettingsFilterQualityId:
+            params.filterQuality.store(
+                std::clamp(static_cast<int>(value * 2.0 + 0.5), 0, 2),
+                std::memory_order_relaxed); break;
         default: break;
     }
 }
@@ -87,6 +92,12 @@ inline void registerSettingsParams(Steinberg::Vst::ParameterContainer& parameter
     // Gain Compensation: on/off, default ON (1.0)
     parameters.addParameter(STR16("Gain Compensation"), STR16(""), 1, 1.0,
         ParameterInfo::kCanAutomate, kSettingsGainCompensationId);
+
+    // Filter Quality: 3 options, default Standard (1)
+    parameters.addParameter(createDropdownParameterWithDefault(
+        STR16("Filter Quality"), kSettingsFilterQualityId, 1,
+        {STR16("High"), STR16("Standard"), STR16("Economy")}
+    ));
 }
 
 inline Steinberg::tresult formatSettingsParam(
@@ -151,4 +162,28 @@ inline void loadSettingsParamsToController(
     if (streamer.readInt32(iv)) setParam(kSettingsGainCompensationId, iv != 0 ? 1.0 : 0.0);
 }
 
+// Filter quality is stored after the arpeggiator section (state version 9+).
+// Older states were rendered per sample with exact coefficients, so they load
+// as High and sound as they did when saved.
+inline void saveSettingsFilterQuality(const SettingsParams& params, Steinberg::IBStreamer& streamer) {
+    streamer.writeInt32(params.filterQuality.load(std::memory_order_relaxed));
+}
+
+inline void loadSettingsFilterQuality(SettingsParams& params, Steinberg::IBStreamer& streamer,
+                                      Steinberg::int32 stateVersion) {
+    Steinberg::int32 iv = 0;  // High
+    if (stateVersion < 9 || !streamer.readInt32(iv)) iv = 0;
+    params.filterQuality.store(std::clamp(static_cast<int>(iv), 0, 2), std::memory_order_relaxed);
+}
+
+template<typename SetParamFunc>
+inline void loadSettingsFilterQualityToController(
+    Steinberg::IBStreamer& streamer, Steinberg::int32 stateVersion, SetParamFunc setParam) {
+    Steinberg::int32 iv = 0;  // High
+    if (stateVersion < 9 || !streamer.readInt32(iv)) iv = 0;
+    // Filter Quality: index / 2
+    setParam(kSettingsFilterQualityId,
+        static_cast<double>(std::clamp(static_cast<int>(iv), 0, 2)) / 2.0);
+}
+
 } // namespace Ruinae
@@ -17,7 +17,7 @@ namespace Ruinae {
 
 // State version for serialization (bump when format changes post-release)
 // Shared between Processor and Controller — lives here to avoid cross-includes.
-constexpr Steinberg::int32 kCurrentStateVersion = 8;
+constexpr Steinberg::int32 kCurrentStateVersion = 9;
 
 // Processor Component ID
 // The audio processing component (runs on audio thread)
@@ -58,7 +58,7 @@ static const Steinberg::FUID kControllerUID(0xD6C5B4A3, 0x8B6A4F2E, 0x2F1E0D9C,
 //   1920-1929: Chorus (Rate, Depth, Feedback, Mix, StereoSpread, Voices, Waveform, Sync, NoteValue)
 //   2000-2099: Macros (Macro 1-4 values)
 //   2100-2199: Rungler (Osc1 Freq, Osc2 Freq, Depth, Filter, Bits, Loop Mode)
-//   2200-2299: Settings (Pitch Bend Range, Velocity Curve, Tuning Ref, Alloc Mode, Steal Mode, Gain Comp)
+//   2200-2299: Settings (Pitch Bend Range, Velocity Curve, Tuning Ref, Alloc Mode, Steal Mode, Gain Comp, Filter Quality)
 //   2300-2399: Env Follower
 //   2400-2499: Sample & Hold
 //   2500-2599: Random
@@ -99,7 +99,7 @@ enum ParameterIDs : Steinberg::Vst::ParamID {
     //   1920-1929: Chorus
     //   2000-2099: Macros
     //   2100-2199: Rungler
-    //   2200-2299: Settings (Pitch Bend Range, Velocity Curve, Tuning Ref, Alloc Mode, Steal Mode, Gain Comp)
+    //   2200-2299: Settings (Pitch Bend Range, Velocity Curve, Tuning Ref, Alloc Mode, Steal Mode, Gain Comp, Filter Quality)
     //   2300-2399: Env Follower
     //   2400-2499: Sample & Hold
     //   2500-2599: Random
@@ -751,6 +751,7 @@ enum ParameterIDs : Steinberg::Vst::ParamID {
     kSettingsVoiceAllocModeId = 2203,  // Voice allocation (4 options: RR/Oldest/LowVel/HighNote, default 1 = Oldest)
     kSettingsVoiceStealModeId = 2204,  // Voice steal (2 options: Hard/Soft, default 0 = Hard)
     kSettingsGainCompensationId = 2205, // Gain compensation on/off (default 1 = enabled for new presets)
+    kSettingsFilterQualityId = 2206,   // Voice filter quality (3 options: High/Standard/Economy, default 1 = Standard; states < v9 load High)
     kSettingsEndId = 2299,
 
     // ==========================================================================
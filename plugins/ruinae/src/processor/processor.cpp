@@ -27,10 +27,18 @@
 #include "parameters/arpeggiator_params.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 namespace Ruinae {
 
+namespace {
+
+/// Host PPQ drift (rounding, tempo ramps) below this is not a relocation
+constexpr double kTransportJumpBeats = 0.01;
+
+} // namespace
+
 // ==============================================================================
 // Constructor
 // ==============================================================================
@@ -179,6 +187,13 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
     // Prepare engine (allocates internal buffers)
     engine_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_));
 
+    // Mix Mode is automatable, so SpectralMorph can be selected from
+    // process() alone (host automation, no controller involved). Always
+    // reserve the morph slots of all 16 voices here, whatever the mode:
+    // ~28 KB per voice at 512-sample blocks (~450 KB), and the switch then
+    // takes effect on the block it arrives without allocating.
+    engine_.reserveSpectralMorph();
+
     // Prepare arpeggiator (FR-008)
     arpCore_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_));
 
@@ -302,15 +317,23 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
             arpCtx.isPlaying = true;
         }
 
-        // Detect DAW transport loop (backward PPQ jump) and notify the arp
-        // so it cleanly restarts: NoteOffs, lane reset, immediate step 0.
+        // Seek the arp whenever the host position is not where the last
+        // block ended -- loop wraps, scrubs in either direction, and the
+        // first block after Play, which may start mid-song (offline bounces
+        // from a marker): NoteOffs for sounding notes, then the lane phases
+        // and random state a straight playthrough would have there.
         // Works in both tempo-sync and free-rate modes.
         if (blockCtx.projectTimeMusicValid && blockCtx.isPlaying) {
-            if (prevProjectTimeMusic_ >= 0.0 &&
-                blockCtx.projectTimeMusic < prevProjectTimeMusic_ - 0.01) {
-                arpCore_.notifyTransportLoop();
+            if (expectedProjectTimeMusic_ < 0.0 ||
+                std::abs(blockCtx.projectTimeMusic - expectedProjectTimeMusic_) >
+                    kTransportJumpBeats) {
+                arpCore_.seekTo(blockCtx.projectTimeMusic, arpCtx);
             }
-            prevProjectTimeMusic_ = blockCtx.projectTimeMusic;
+            expectedProjectTimeMusic_ = blockCtx.projectTimeMusic +
+                static_cast<double>(blockCtx.blockSize) * blockCtx.tempoBPM /
+                    (60.0 * blockCtx.sampleRate);
+        } else {
+            expectedProjectTimeMusic_ = -1.0;
         }
 
         // Sync arp step clock to host musical position so transport
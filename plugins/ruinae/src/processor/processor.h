@@ -295,7 +295,7 @@ private:
     float lastSidechainActive_ = -1.0f;  ///< Tracks sidechain state for output param changes
     bool wasTransportPlaying_{false};
     bool hostSupportsTransport_{false}; ///< True once host reports kPlaying
-    double prevProjectTimeMusic_{-1.0}; ///< For detecting backward PPQ jumps (DAW loop)
+    double expectedProjectTimeMusic_{-1.0}; ///< PPQ the next block should start at (< 0 = unknown)
 
     // Previous arp param values -- only call setters that reset internal state
     // (step index, swing counter) when the value actually changes.
@@ -772,6 +772,8 @@ void Processor::applyAuxModSourceParams() {
     engine_.setStealMode(static_cast<Krate::DSP::StealMode>(
         settingsParams_.voiceStealMode.load(std::memory_order_relaxed)));
     engine_.setGainCompensationEnabled(settingsParams_.gainCompensation.load(std::memory_order_relaxed));
+    engine_.setFilterQuality(static_cast<Krate::DSP::RuinaeFilterQuality>(
+        settingsParams_.filterQuality.load(std::memory_order_relaxed)));
 
     // --- Mono Mode ---
     engine_.setMonoPriority(static_cast<MonoMode>(
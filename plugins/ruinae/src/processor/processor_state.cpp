@@ -103,6 +103,9 @@ Steinberg::tresult PLUGIN_API Processor::getState(Steinberg::IBStream* state) {
     // Arpeggiator params (FR-011)
     saveArpParams(arpParams_, streamer);
 
+    // Filter quality (version 9+)
+    saveSettingsFilterQuality(settingsParams_, streamer);
+
     return Steinberg::kResultTrue;
 }
 
@@ -283,6 +286,9 @@ Steinberg::tresult PLUGIN_API Processor::setState(Steinberg::IBStream* state) {
 
         // Arpeggiator params
         loadArpParams(arpParams_, streamer, version);
+
+        // Filter quality (version 9+; older states load as High)
+        loadSettingsFilterQuality(settingsParams_, streamer, version);
     }
 
     // --- Phase 2: Defer voiceRoutes + engine/arp reset to audio thread ---
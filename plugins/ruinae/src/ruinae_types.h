@@ -48,6 +48,23 @@ enum class RuinaeFilterType : uint8_t {
     NumTypes              ///< Sentinel: total number of filter types
 };
 
+// =============================================================================
+// RuinaeFilterQuality Enumeration
+// =============================================================================
+
+/// @brief Voice filter modulation quality (CPU vs. modulation resolution).
+///
+/// Controls how often the modulated cutoff/resonance is pushed into the SVF
+/// and ladder filters. Between control points their own coefficient
+/// smoothers (~5 ms) interpolate, so the reduced rate is inaudible for
+/// envelope/LFO modulation. Other filter types always update per sample.
+enum class RuinaeFilterQuality : uint8_t {
+    High = 0,             ///< Per-sample update, exact std::tan/pow (reference)
+    Standard,             ///< Update every 16 samples, exact coefficients
+    Economy,              ///< Update every 32 samples, fastTan/fastExp2 coefficients
+    NumQualities          ///< Sentinel: total number of quality settings
+};
+
 // =============================================================================
 // RuinaeDistortionType Enumeration
 // =============================================================================
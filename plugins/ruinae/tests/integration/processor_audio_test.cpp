@@ -554,3 +554,89 @@ TEST_CASE("Processor mono mode produces audio via parameter change",
     processor.setActive(false);
     processor.terminate();
 }
+
+// =============================================================================
+// Spectral morph engaged by automation alone
+// =============================================================================
+// Host automation of Mix Mode reaches only process(): no controller message,
+// no setState. The morph slots must already exist, or the voices silently
+// keep crossfading.
+
+TEST_CASE("Processor engages spectral morph from mix mode automation alone",
+          "[processor][integration][spectral-morph]") {
+    constexpr size_t kBlockSize = 512;
+    constexpr int kNumBlocks = 20;
+
+    auto runProcessor = [&](bool automateSpectralMorph) -> std::vector<float> {
+        Ruinae::Processor proc;
+        proc.initialize(nullptr);
+
+        Steinberg::Vst::ProcessSetup setup{};
+        setup.processMode = Steinberg::Vst::kRealtime;
+        setup.symbolicSampleSize = Steinberg::Vst::kSample32;
+        setup.sampleRate = 44100.0;
+        setup.maxSamplesPerBlock = static_cast<Steinberg::int32>(kBlockSize);
+        proc.setupProcessing(setup);
+        proc.setActive(true);
+
+        std::vector<float> outL(kBlockSize, 0.0f);
+        std::vector<float> outR(kBlockSize, 0.0f);
+        float* channelBuffers[2] = {outL.data(), outR.data()};
+
+        Steinberg::Vst::AudioBusBuffers outputBus{};
+        outputBus.numChannels = 2;
+        outputBus.channelBuffers32 = channelBuffers;
+
+        Steinberg::Vst::ProcessData data{};
+        data.processMode = Steinberg::Vst::kRealtime;
+        data.symbolicSampleSize = Steinberg::Vst::kSample32;
+        data.numSamples = static_cast<Steinberg::int32>(kBlockSize);
+        data.numInputs = 0;
+        data.inputs = nullptr;
+        data.numOutputs = 1;
+        data.outputs = &outputBus;
+        data.processContext = nullptr;
+
+        // Block 0: mix mode automation (the only path it takes) + noteOn
+        MockParamChangesWithData params;
+        if (automateSpectralMorph) {
+            params.addChange(Ruinae::kMixerModeId, 1.0);  // SpectralMorph
+        }
+        data.inputParameterChanges = &params;
+        MockEventList events;
+        events.addNoteOn(48, 0.9f);
+        data.inputEvents = &events;
+        proc.process(data);
+
+        MockParameterChanges emptyParams;
+        MockEventList emptyEvents;
+        data.inputParameterChanges = &emptyParams;
+        data.inputEvents = &emptyEvents;
+
+        std::vector<float> allOutput(outL.begin(), outL.end());
+        for (int block = 1; block < kNumBlocks; ++block) {
+            std::fill(outL.begin(), outL.end(), 0.0f);
+            std::fill(outR.begin(), outR.end(), 0.0f);
+            proc.process(data);
+            allOutput.insert(allOutput.end(), outL.begin(), outL.end());
+        }
+
+        proc.setActive(false);
+        proc.terminate();
+        return allOutput;
+    };
+
+    const auto morphed = runProcessor(true);
+    const auto crossfaded = runProcessor(false);
+    REQUIRE(morphed.size() == crossfaded.size());
+
+    float maxDiff = 0.0f;
+    float maxAbs = 0.0f;
+    for (size_t i = 0; i < morphed.size(); ++i) {
+        maxDiff = std::max(maxDiff, std::abs(morphed[i] - crossfaded[i]));
+        maxAbs = std::max(maxAbs, std::abs(morphed[i]));
+    }
+    INFO("Max sample difference (spectral morph vs crossfade): " << maxDiff);
+    REQUIRE(maxAbs > 0.01f);
+    REQUIRE(maxDiff > 0.01f);  // Crossfading voices would match exactly
+}
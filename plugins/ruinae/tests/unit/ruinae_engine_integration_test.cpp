@@ -1771,6 +1771,7 @@ TEST_CASE("RuinaeEngine integration: mono mode produces audio",
         // gated behind canAnalyze(), meaning only ~1/hopSize samples are
         // non-zero when called sample-by-sample.
         engine.setMode(VoiceMode::Mono);
+        engine.reserveSpectralMorph();
         engine.setMixMode(MixMode::SpectralMorph);
         engine.noteOn(60, 100);
 
@@ -17,6 +17,10 @@
 #include <krate/dsp/core/midi_utils.h>
 #include <krate/dsp/core/math_constants.h>
 
+#include <allocation_detector.h>
+// The one TU of ruinae_tests that replaces the global allocation operators
+#include <allocation_operator_overrides.h>
+
 #include <algorithm>
 #include <array>
 #include <chrono>
@@ -815,6 +819,47 @@ TEST_CASE("RuinaeEngine mixer parameter forwarding", "[ruinae-engine][params][US
     }
 }
 
+TEST_CASE("RuinaeEngine SpectralMorph allocates only in reserveSpectralMorph",
+          "[ruinae-engine][params][US7]") {
+    constexpr size_t kBlock = 512;
+    RuinaeEngine reference;
+    RuinaeEngine engine;
+    for (auto* e : {&reference, &engine}) {
+        e->prepare(44100.0, kBlock);
+        e->setSoftLimitEnabled(false);
+        e->setMixPosition(0.5f);
+        e->setOscBType(OscType::Noise);
+    }
+    std::vector<float> refL(kBlock), refR(kBlock), left(kBlock), right(kBlock);
+
+    // Mode and polyphony changes arrive on the audio thread: no allocation
+    TestHelpers::AllocationDetector::instance().startTracking();
+    engine.setMixMode(MixMode::SpectralMorph);
+    engine.setPolyphony(RuinaeEngine::kMaxPolyphony);
+    const size_t allocs = TestHelpers::AllocationDetector::instance().stopTracking();
+    REQUIRE(allocs == 0);
+
+    // Without reserved slots the voices keep crossfading
+    reference.noteOn(60, 100);
+    engine.noteOn(60, 100);
+    for (int block = 0; block < 8; ++block) {
+        reference.processBlock(refL.data(), refR.data(), kBlock);
+        engine.processBlock(left.data(), right.data(), kBlock);
+        REQUIRE(left == refL);
+    }
+
+    // Reserving (message thread) switches them to the spectral morph
+    engine.reserveSpectralMorph();
+    bool differs = false;
+    for (int block = 0; block < 8; ++block) {
+        reference.processBlock(refL.data(), refR.data(), kBlock);
+        engine.processBlock(left.data(), right.data(), kBlock);
+        differs = differs || left != refL;
+    }
+    REQUIRE(differs);
+    REQUIRE(allSamplesFinite(left.data(), kBlock));
+}
+
 TEST_CASE("RuinaeEngine filter parameter forwarding", "[ruinae-engine][params][US7]") {
     RuinaeEngine engine;
     engine.prepare(44100.0, 512);
@@ -1213,6 +1258,7 @@ TEST_CASE("RuinaeEngine AllVoice modulation forwarding", "[ruinae-engine][modula
 
     SECTION("AllVoiceSpectralTilt offset changes voice output") {
         // Use SpectralMorph mode where tilt has an effect
+        engine.reserveSpectralMorph();
         engine.setMixMode(MixMode::SpectralMorph);
         engine.setMixPosition(0.5f);
         engine.setMixTilt(0.0f); // Neutral tilt
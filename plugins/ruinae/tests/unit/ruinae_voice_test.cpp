@@ -2542,3 +2542,60 @@ TEST_CASE("RuinaeVoice: self-oscillating filter sounds at musical Q values",
         REQUIRE(measurePeak(25.0f) >= measurePeak(18.0f) * 0.5f);
     }
 }
+
+// =============================================================================
+// Filter modulation quality (control-rate cutoff updates)
+// =============================================================================
+// Standard/Economy push the modulated cutoff into the SVF/ladder every 16/32
+// samples and let the filter's coefficient smoother interpolate. With a fast
+// filter-envelope sweep the result must stay close to the per-sample
+// reference; a stepped (un-smoothed) cutoff would show up as a large error.
+
+TEST_CASE("RuinaeVoice: reduced filter quality tracks the per-sample reference",
+          "[ruinae_voice][filter][quality]") {
+    const auto render = [](RuinaeFilterType type, RuinaeFilterQuality quality) {
+        RuinaeVoice voice;
+        voice.prepare(44100.0, 512);
+        voice.setFilterType(type);
+        voice.setFilterQuality(quality);
+        voice.setFilterCutoff(300.0f);
+        voice.setFilterResonance(4.0f);
+        voice.setFilterEnvAmount(48.0f);  // default filter ADSR: 10 ms / 200 ms sweep
+        voice.noteOn(110.0f, 1.0f);
+        return processNSamples(voice, 22050, 128);
+    };
+
+    for (auto type : {RuinaeFilterType::SVF_LP, RuinaeFilterType::Ladder}) {
+        const auto reference = render(type, RuinaeFilterQuality::High);
+        const float refRms = computeRMS(reference.data(), reference.size());
+        REQUIRE(refRms > 0.001f);
+
+        for (auto quality : {RuinaeFilterQuality::Standard, RuinaeFilterQuality::Economy}) {
+            const auto out = render(type, quality);
+            std::vector<float> diff(out.size());
+            for (size_t i = 0; i < out.size(); ++i) diff[i] = out[i] - reference[i];
+            const float errRms = computeRMS(diff.data(), diff.size());
+            INFO("type " << static_cast<int>(type) << ", quality "
+                 << static_cast<int>(quality) << ": error/ref RMS = "
+                 << errRms / refRms);
+            CHECK(errRms < refRms * 0.05f);
+        }
+    }
+}
+
+TEST_CASE("RuinaeVoice: High filter quality is the default",
+          "[ruinae_voice][filter][quality]") {
+    // Setting High explicitly must be a no-op relative to a fresh voice, i.e.
+    // existing presets and golden renders are unaffected by the new setting.
+    auto a = createPreparedVoice();
+    auto b = createPreparedVoice();
+    b.setFilterQuality(RuinaeFilterQuality::High);
+    for (auto* v : {&a, &b}) {
+        v->setFilterCutoff(500.0f);
+        v->setFilterEnvAmount(24.0f);
+        v->noteOn(220.0f, 0.8f);
+    }
+    const auto outA = processNSamples(a, 4096);
+    const auto outB = processNSamples(b, 4096);
+    REQUIRE(outA == outB);
+}
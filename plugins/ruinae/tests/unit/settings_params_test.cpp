@@ -128,6 +128,18 @@ TEST_CASE("Settings parameter handle functions", "[settings_params][processor]")
         Ruinae::handleSettingsParamChange(params, Ruinae::kSettingsGainCompensationId, 0.49);
         REQUIRE(params.gainCompensation.load() == false);
     }
+
+    SECTION("handleSettingsParamChange stores correct filter quality") {
+        Ruinae::SettingsParams params;
+        REQUIRE(params.filterQuality.load() == 1);  // Standard for new instances
+
+        Ruinae::handleSettingsParamChange(params, Ruinae::kSettingsFilterQualityId, 0.0);
+        REQUIRE(params.filterQuality.load() == 0);  // High
+        Ruinae::handleSettingsParamChange(params, Ruinae::kSettingsFilterQualityId, 0.5);
+        REQUIRE(params.filterQuality.load() == 1);  // Standard
+        Ruinae::handleSettingsParamChange(params, Ruinae::kSettingsFilterQualityId, 1.0);
+        REQUIRE(params.filterQuality.load() == 2);  // Economy
+    }
 }
 
 TEST_CASE("Settings parameter format functions", "[settings_params][processor]") {
@@ -161,6 +173,7 @@ TEST_CASE("Settings parameter format functions", "[settings_params][processor]")
         REQUIRE(Ruinae::formatSettingsParam(Ruinae::kSettingsVoiceAllocModeId, 0.5, str) == Steinberg::kResultFalse);
         REQUIRE(Ruinae::formatSettingsParam(Ruinae::kSettingsVoiceStealModeId, 0.5, str) == Steinberg::kResultFalse);
         REQUIRE(Ruinae::formatSettingsParam(Ruinae::kSettingsGainCompensationId, 0.5, str) == Steinberg::kResultFalse);
+        REQUIRE(Ruinae::formatSettingsParam(Ruinae::kSettingsFilterQualityId, 0.5, str) == Steinberg::kResultFalse);
     }
 
     SECTION("formatSettingsParam returns kResultFalse for non-settings IDs") {
@@ -281,3 +294,62 @@ TEST_CASE("Settings params load returns false on truncated stream", "[settings_p
     Steinberg::IBStreamer streamer(stream, kLittleEndian);
     REQUIRE(Ruinae::loadSettingsParams(params, streamer) == false);
 }
+
+// =============================================================================
+// Filter quality: state version 9+, older states migrate to High
+// =============================================================================
+
+TEST_CASE("Settings filter quality round-trips and migrates old states",
+          "[settings_params][state_persistence]") {
+    Ruinae::SettingsParams params;
+    params.filterQuality.store(2, std::memory_order_relaxed);  // Economy
+
+    auto stream = Steinberg::owned(new Steinberg::MemoryStream());
+    {
+        Steinberg::IBStreamer streamer(stream, kLittleEndian);
+        Ruinae::saveSettingsFilterQuality(params, streamer);
+    }
+
+    SECTION("version 9 restores the saved quality") {
+        Ruinae::SettingsParams loaded;
+        stream->seek(0, Steinberg::IBStream::kIBSeekSet, nullptr);
+        Steinberg::IBStreamer streamer(stream, kLittleEndian);
+        Ruinae::loadSettingsFilterQuality(loaded, streamer, 9);
+        REQUIRE(loaded.filterQuality.load() == 2);
+    }
+
+    SECTION("version 8 loads High without reading the stream") {
+        Ruinae::SettingsParams loaded;
+        stream->seek(0, Steinberg::IBStream::kIBSeekSet, nullptr);
+        Steinberg::IBStreamer streamer(stream, kLittleEndian);
+        Ruinae::loadSettingsFilterQuality(loaded, streamer, 8);
+        REQUIRE(loaded.filterQuality.load() == 0);
+        Steinberg::int64 pos = -1;
+        stream->tell(&pos);
+        REQUIRE(pos == 0);
+    }
+
+    SECTION("truncated version 9 state loads High") {
+        Ruinae::SettingsParams loaded;
+        auto empty = Steinberg::owned(new Steinberg::MemoryStream());
+        Steinberg::IBStreamer streamer(empty, kLittleEndian);
+        Ruinae::loadSettingsFilterQuality(loaded, streamer, 9);
+        REQUIRE(loaded.filterQuality.load() == 0);
+    }
+
+    SECTION("controller load maps versions the same way") {
+        std::vector<double> values;
+        for (Steinberg::int32 version : {8, 9}) {
+            stream->seek(0, Steinberg::IBStream::kIBSeekSet, nullptr);
+            Steinberg::IBStreamer streamer(stream, kLittleEndian);
+            Ruinae::loadSettingsFilterQualityToController(streamer, version,
+                [&](Steinberg::Vst::ParamID id, double value) {
+                    REQUIRE(id == Ruinae::kSettingsFilterQualityId);
+                    values.push_back(value);
+                });
+        }
+        REQUIRE(values.size() == 2);
+        REQUIRE(values[0] == Approx(0.0));  // v8 -> High
+        REQUIRE(values[1] == Approx(1.0));  // Economy: 2 / 2
+    }
+}
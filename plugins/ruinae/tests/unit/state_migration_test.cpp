@@ -181,3 +181,50 @@ TEST_CASE("setState does not crash on any stream content", "[state][migration]")
 
     proc->terminate();
 }
+
+// =============================================================================
+// Filter quality (state version 9)
+// =============================================================================
+
+static std::vector<uint8_t> stateBytes(Ruinae::Processor& proc) {
+    Steinberg::MemoryStream stream;
+    REQUIRE(proc.getState(&stream) == Steinberg::kResultTrue);
+    Steinberg::int64 size = 0;
+    stream.seek(0, Steinberg::IBStream::kIBSeekEnd, &size);
+    std::vector<uint8_t> data(static_cast<size_t>(size));
+    stream.seek(0, Steinberg::IBStream::kIBSeekSet, nullptr);
+    Steinberg::int32 bytesRead = 0;
+    stream.read(data.data(), static_cast<Steinberg::int32>(size), &bytesRead);
+    return data;
+}
+
+static Steinberg::int32 trailingInt32(const std::vector<uint8_t>& data) {
+    Steinberg::int32 value = 0;
+    std::memcpy(&value, data.data() + data.size() - sizeof(value), sizeof(value));
+    return value;
+}
+
+TEST_CASE("Version 8 state loads with High filter quality", "[state][migration][version]") {
+    // New instances default to Standard; the quality is the last field
+    auto proc = makeProcessor();
+    auto v9Data = stateBytes(*proc);
+    REQUIRE(trailingInt32(v9Data) == 1);
+
+    // A v8 state is the same stream without the quality field
+    Steinberg::int32 v8 = 8;
+    std::memcpy(v9Data.data(), &v8, sizeof(v8));
+    Steinberg::MemoryStream v8Stream;
+    Steinberg::int32 bytesWritten = 0;
+    v8Stream.write(v9Data.data(), static_cast<Steinberg::int32>(v9Data.size() - 4),
+                   &bytesWritten);
+    v8Stream.seek(0, Steinberg::IBStream::kIBSeekSet, nullptr);
+
+    // It was rendered per sample when saved, so it must keep sounding that way
+    auto proc2 = makeProcessor();
+    REQUIRE(proc2->setState(&v8Stream) == Steinberg::kResultTrue);
+    drainPresetTransfer(proc2.get());
+    REQUIRE(trailingInt32(stateBytes(*proc2)) == 0);
+
+    proc->terminate();
+    proc2->terminate();
+}
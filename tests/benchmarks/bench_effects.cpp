@@ -0,0 +1,409 @@
+// ==============================================================================
+// Layer 3/4 benchmarks: feedback network, granular engine, delays, reverb
+// ==============================================================================
+// Supersedes the standalone benchmark_{spectral_delay,shimmer_delay,
+// feedback_network,mode_crossfade}.cpp programs; the scenarios (parameter
+// settings) are carried over so historic numbers stay roughly comparable.
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include <krate/dsp/core/block_context.h>
+#include <krate/dsp/core/crossfade_utils.h>
+#include <krate/dsp/effects/digital_delay.h>
+#include <krate/dsp/effects/fdn_reverb.h>
+#include <krate/dsp/effects/shimmer_delay.h>
+#include <krate/dsp/effects/spectral_delay.h>
+#include <krate/dsp/systems/feedback_network.h>
+#include <krate/dsp/systems/granular_engine.h>
+#include <krate/dsp/systems/harmonizer_engine.h>
+#include <krate/dsp/systems/sympathetic_resonance.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace Krate::Bench;
+using namespace Krate::DSP;
+
+namespace {
+
+/// Stereo scratch shared by every effect case: fresh noise is copied in
+/// before each block because the effects process in place.
+struct StereoIO {
+    std::vector<float> sourceL;
+    std::vector<float> sourceR;
+    std::vector<float> left;
+    std::vector<float> right;
+    BlockContext ctx;
+
+    explicit StereoIO(const BenchConfig& cfg)
+        : sourceL(makeNoise(cfg.blockSize, 0.5f, 1)),
+          sourceR(makeNoise(cfg.blockSize, 0.5f, 2)),
+          left(cfg.blockSize),
+          right(cfg.blockSize) {
+        ctx.sampleRate = cfg.sampleRate;
+        ctx.blockSize = cfg.blockSize;
+    }
+
+    void refill() noexcept {
+        std::copy(sourceL.begin(), sourceL.end(), left.begin());
+        std::copy(sourceR.begin(), sourceR.end(), right.begin());
+    }
+};
+
+// ==============================================================================
+// Layer 3
+// ==============================================================================
+
+KRATE_BENCH("L3/feedback_network/filtered_saturated", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        FeedbackNetwork network;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->network.prepare(cfg.sampleRate, cfg.blockSize, 2000.0f);
+    s->network.setFeedbackAmount(0.75f);
+    s->network.setDelayTimeMs(500.0f);
+    s->network.setFilterEnabled(true);
+    s->network.setFilterType(FilterType::Lowpass);
+    s->network.setFilterCutoff(4000.0f);
+    s->network.setSaturationEnabled(true);
+    s->network.setSaturationDrive(6.0f);
+    s->network.setCrossFeedbackAmount(0.3f);
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        s->network.process(s->io.left.data(), s->io.right.data(), n, s->io.ctx);
+        consume(s->io.left[n - 1]);
+    };
+});
+
+/// 16 held notes x 4 partials fill the sympathetic resonator pool (64), the
+/// Innexus worst case when many notes ring.
+BlockFn makeSympatheticBench(const BenchConfig& cfg, bool block) {
+    struct State {
+        SympatheticResonance resonance;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->resonance.prepare(cfg.sampleRate);
+    s->resonance.setAmount(0.8f);
+    s->resonance.setDecay(0.5f);
+    for (int v = 0; v < 16; ++v) {
+        SympatheticPartialInfo partials;
+        const float f0 = 55.0f * static_cast<float>(v + 2) * 1.03f;
+        for (int p = 0; p < kSympatheticPartialCount; ++p) {
+            partials.frequencies[static_cast<size_t>(p)] = f0 * static_cast<float>(p + 1);
+        }
+        s->resonance.noteOn(v, partials);
+    }
+    s->input = makeNoise(cfg.blockSize, 0.5f, 3);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize, block] {
+        if (block) {
+            s->resonance.processBlock(s->input.data(), s->output.data(), n);
+        } else {
+            for (size_t i = 0; i < n; ++i) s->output[i] = s->resonance.process(s->input[i]);
+        }
+        consume(s->output[n - 1]);
+    };
+}
+
+KRATE_BENCH("L3/sympathetic_resonance/64_per_sample", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeSympatheticBench(cfg, false);
+});
+
+KRATE_BENCH("L3/sympathetic_resonance/64_block", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeSympatheticBench(cfg, true);
+});
+
+/// Densest cloud the engine allows: 100 grains/s of 500 ms keeps ~50 grains
+/// sounding, with spray and pitch so every grain reads its own position.
+BlockFn makeGranularEngineBench(const BenchConfig& cfg, bool block) {
+    struct State {
+        GranularEngine engine;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->engine.prepare(cfg.sampleRate);
+    s->engine.setDensity(100.0f);
+    s->engine.setGrainSize(500.0f);
+    s->engine.setPosition(250.0f);
+    s->engine.setPositionSpray(0.5f);
+    s->engine.setPitchSpray(0.2f);
+    s->engine.setPanSpray(0.8f);
+    s->engine.seed(1);
+    s->engine.reset();
+    return [s, n = cfg.blockSize, block] {
+        s->io.refill();
+        float* left = s->io.left.data();
+        float* right = s->io.right.data();
+        if (block) {
+            s->engine.processBlock(left, right, left, right, n);
+        } else {
+            for (size_t i = 0; i < n; ++i) s->engine.process(left[i], right[i], left[i], right[i]);
+        }
+        consume(left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L3/granular_engine/dense_per_sample", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeGranularEngineBench(cfg, false);
+});
+
+KRATE_BENCH("L3/granular_engine/dense_block", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeGranularEngineBench(cfg, true);
+});
+
+/// Four phase-vocoder voices on one shared analysis: the per-frame cost is
+/// four phase-advance + resynthesis passes over 2049 bins, plus either four
+/// IFFTs or, with spectral summation, one stereo IFFT.
+BlockFn makeHarmonizerBench(const BenchConfig& cfg, bool spectralSummation) {
+    struct State {
+        HarmonizerEngine engine;
+        std::vector<float> input;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+    auto s = std::make_shared<State>();
+    s->engine.prepare(cfg.sampleRate, cfg.blockSize);
+    s->engine.setHarmonyMode(HarmonyMode::Chromatic);
+    s->engine.setPitchShiftMode(PitchMode::PhaseVocoder);
+    s->engine.setSpectralSummation(spectralSummation);
+    s->engine.setNumVoices(4);
+    const int intervals[] = {3, 5, 7, 12};
+    for (int v = 0; v < 4; ++v) {
+        s->engine.setVoiceInterval(v, intervals[v]);
+        s->engine.setVoiceLevel(v, 0.0f);
+        s->engine.setVoicePan(v, -0.75f + 0.5f * static_cast<float>(v));
+    }
+    s->input = makeNoise(cfg.blockSize, 0.5f, 4);
+    s->left.resize(cfg.blockSize);
+    s->right.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->engine.process(s->input.data(), s->left.data(), s->right.data(), n);
+        consume(s->left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L3/harmonizer/phase_vocoder_4_voices", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeHarmonizerBench(cfg, false);
+});
+
+KRATE_BENCH("L3/harmonizer/phase_vocoder_4_voices_summed", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeHarmonizerBench(cfg, true);
+});
+
+// ==============================================================================
+// Layer 4
+// ==============================================================================
+
+BlockFn makeSpectralDelayBench(const BenchConfig& cfg, size_t fftSize,
+                               bool freeze) {
+    struct State {
+        SpectralDelay delay;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->delay.setFFTSize(fftSize);
+    s->delay.prepare(cfg.sampleRate, cfg.blockSize);
+    s->delay.setBaseDelayMs(500.0f);
+    s->delay.setSpreadMs(300.0f);
+    s->delay.setSpreadDirection(SpreadDirection::LowToHigh);
+    s->delay.setFeedback(0.5f);
+    s->delay.setFeedbackTilt(0.2f);
+    s->delay.setDiffusion(0.3f);
+    s->delay.setDryWetMix(0.5f);
+    s->delay.setFreezeEnabled(freeze);
+    s->delay.snapParameters();
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        s->delay.process(s->io.left.data(), s->io.right.data(), n, s->io.ctx);
+        consume(s->io.left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L4/spectral_delay/fft512", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeSpectralDelayBench(cfg, 512, false);
+});
+
+KRATE_BENCH("L4/spectral_delay/fft1024", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeSpectralDelayBench(cfg, 1024, false);
+});
+
+KRATE_BENCH("L4/spectral_delay/fft2048", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeSpectralDelayBench(cfg, 2048, false);
+});
+
+KRATE_BENCH("L4/spectral_delay/fft4096", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeSpectralDelayBench(cfg, 4096, false);
+});
+
+KRATE_BENCH("L4/spectral_delay/fft2048_freeze", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeSpectralDelayBench(cfg, 2048, true);
+});
+
+BlockFn makeShimmerBench(const BenchConfig& cfg, PitchMode mode) {
+    struct State {
+        ShimmerDelay shimmer;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->shimmer.prepare(cfg.sampleRate, cfg.blockSize, 5000.0f);
+    s->shimmer.setDelayTimeMs(500.0f);
+    s->shimmer.setPitchSemitones(12.0f);
+    s->shimmer.setShimmerMix(100.0f);
+    s->shimmer.setFeedbackAmount(0.6f);
+    s->shimmer.setDiffusionSize(50.0f);
+    s->shimmer.setFilterEnabled(true);
+    s->shimmer.setFilterCutoff(4000.0f);
+    s->shimmer.setDryWetMix(50.0f);
+    s->shimmer.setPitchMode(mode);
+    s->shimmer.snapParameters();
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        s->shimmer.process(s->io.left.data(), s->io.right.data(), n, s->io.ctx);
+        consume(s->io.left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L4/shimmer_delay/simple", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeShimmerBench(cfg, PitchMode::Simple);
+});
+
+KRATE_BENCH("L4/shimmer_delay/granular", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeShimmerBench(cfg, PitchMode::Granular);
+});
+
+KRATE_BENCH("L4/shimmer_delay/phase_vocoder", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeShimmerBench(cfg, PitchMode::PhaseVocoder);
+});
+
+// Two delay engines plus an equal-power blend: the cost of an Iterum mode
+// switch while the 50 ms crossfade is running.
+KRATE_BENCH("L4/digital_delay/mode_crossfade", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        DigitalDelay delayA;
+        DigitalDelay delayB;
+        StereoIO io;
+        std::vector<float> fadeL;
+        std::vector<float> fadeR;
+        float increment = 0.0f;
+        float position = 0.0f;
+        explicit State(const BenchConfig& c)
+            : io(c), fadeL(c.blockSize), fadeR(c.blockSize) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->delayA.prepare(cfg.sampleRate, cfg.blockSize);
+    s->delayB.prepare(cfg.sampleRate, cfg.blockSize);
+    s->delayA.setDelayTime(300.0f);
+    s->delayA.setFeedback(0.5f);
+    s->delayA.setMix(0.5f);
+    s->delayB.setDelayTime(400.0f);
+    s->delayB.setFeedback(0.6f);
+    s->delayB.setMix(0.5f);
+    s->increment = crossfadeIncrement(50.0f, cfg.sampleRate);
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        std::copy(s->io.sourceL.begin(), s->io.sourceL.end(), s->fadeL.begin());
+        std::copy(s->io.sourceR.begin(), s->io.sourceR.end(), s->fadeR.begin());
+        s->delayA.process(s->io.left.data(), s->io.right.data(), n, s->io.ctx);
+        s->delayB.process(s->fadeL.data(), s->fadeR.data(), n, s->io.ctx);
+        for (size_t i = 0; i < n; ++i) {
+            float fadeOut = 0.0f;
+            float fadeIn = 0.0f;
+            equalPowerGains(s->position, fadeOut, fadeIn);
+            s->io.left[i] = s->fadeL[i] * fadeOut + s->io.left[i] * fadeIn;
+            s->io.right[i] = s->fadeR[i] * fadeOut + s->io.right[i] * fadeIn;
+            s->position += s->increment;
+            if (s->position >= 1.0f) s->position = 0.0f;  // keep fading forever
+        }
+        consume(s->io.left[n - 1]);
+    };
+});
+
+KRATE_BENCH("L4/fdn_reverb/default", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        FDNReverb reverb;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->reverb.prepare(cfg.sampleRate);
+    ReverbParams params;
+    params.roomSize = 0.8f;
+    params.damping = 0.4f;
+    params.mix = 0.5f;
+    params.modDepth = 0.3f;
+    s->reverb.setParams(params);
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        s->reverb.processBlock(s->io.left.data(), s->io.right.data(), n);
+        consume(s->io.left[n - 1]);
+    };
+});
+
+// Line-count sweep for echo density per CPU cycle: each recirculation
+// multiplies the echo paths by the line count (N^k after k round trips), while
+// the per-sample cost grows roughly linearly with N. Divide the density gain
+// (N/8 per round trip) by the ns/smp ratio against lines8 to compare sizes.
+template <size_t NumLines>
+BlockFn makeFdnReverbBench(const BenchConfig& cfg) {
+    struct State {
+        FDNReverbN<NumLines> reverb;
+        StereoIO io;
+        explicit State(const BenchConfig& c) : io(c) {}
+    };
+    auto s = std::make_shared<State>(cfg);
+    s->reverb.prepare(cfg.sampleRate);
+    ReverbParams params;
+    params.roomSize = 0.8f;
+    params.damping = 0.4f;
+    params.mix = 0.5f;
+    params.modDepth = 0.3f;
+    s->reverb.setParams(params);
+    return [s, n = cfg.blockSize] {
+        s->io.refill();
+        s->reverb.processBlock(s->io.left.data(), s->io.right.data(), n);
+        consume(s->io.left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L4/fdn_reverb/lines8", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) {
+    return makeFdnReverbBench<8>(cfg);
+});
+
+KRATE_BENCH("L4/fdn_reverb/lines16", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) {
+    return makeFdnReverbBench<16>(cfg);
+});
+
+KRATE_BENCH("L4/fdn_reverb/lines32", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) {
+    return makeFdnReverbBench<32>(cfg);
+});
+
+} // anonymous namespace
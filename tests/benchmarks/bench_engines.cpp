@@ -0,0 +1,111 @@
+// ==============================================================================
+// Plugin engine benchmarks: full polyphonic voice rendering
+// ==============================================================================
+// These cover the end-to-end voice paths (oscillators, filters, envelopes,
+// modulation, mixing) that the per-component cases cannot see. Both engines
+// are SDK-free, so they build here without the VST3 SDK.
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include "engine/ruinae_engine.h"
+#include "voice_pool/voice_pool.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Krate::Bench;
+
+namespace {
+
+constexpr int kVoices = 16;
+
+// ==============================================================================
+// Ruinae
+// ==============================================================================
+
+BlockFn makeRuinaeBench(const BenchConfig& cfg,
+                        Krate::DSP::RuinaeFilterQuality filterQuality,
+                        Krate::DSP::MixMode mixMode = Krate::DSP::MixMode::CrossfadeMix) {
+    struct State {
+        Krate::DSP::RuinaeEngine engine;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+    auto s = std::make_shared<State>();
+    s->engine.prepare(cfg.sampleRate, cfg.blockSize);
+    s->engine.setPolyphony(kVoices);
+    s->engine.setSoftLimitEnabled(false);
+    s->engine.setFilterQuality(filterQuality);
+    s->engine.setMixMode(mixMode);
+    if (mixMode == Krate::DSP::MixMode::SpectralMorph) s->engine.reserveSpectralMorph();
+    for (int v = 0; v < kVoices; ++v) {
+        s->engine.noteOn(static_cast<uint8_t>(48 + v), 100);
+    }
+    s->left.resize(cfg.blockSize);
+    s->right.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->engine.processBlock(s->left.data(), s->right.data(), n);
+        consume(s->left[n - 1]);
+    };
+}
+
+// 16 held notes with the default patch: every voice stays in sustain, so the
+// measured cost is the steady-state full-polyphony load.
+KRATE_BENCH("engine/ruinae/poly16_sustain", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeRuinaeBench(cfg, Krate::DSP::RuinaeFilterQuality::High);
+});
+
+// Same load with control-rate filter modulation and fast coefficients.
+KRATE_BENCH("engine/ruinae/poly16_sustain_filter_economy", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeRuinaeBench(cfg, Krate::DSP::RuinaeFilterQuality::Economy);
+});
+
+// 16 voices mixing through the shared spectral morph: per hop each voice
+// costs one paired forward and half a paired inverse FFT.
+KRATE_BENCH("engine/ruinae/poly16_sustain_spectral_morph", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeRuinaeBench(cfg, Krate::DSP::RuinaeFilterQuality::High,
+                           Krate::DSP::MixMode::SpectralMorph);
+});
+
+// ==============================================================================
+// Membrum
+// ==============================================================================
+
+// All 16 voices ringing on distinct pads. Percussive voices decay to
+// silence, so every pad is re-struck each 250 ms of audio to keep the pool
+// saturated (same approach as membrum's [.perf] polyphony tests).
+KRATE_BENCH("engine/membrum/poly16_retrigger", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        Membrum::VoicePool pool;
+        std::vector<float> left;
+        std::vector<float> right;
+        size_t samplesUntilRetrigger = 0;
+        size_t retriggerInterval = 0;
+    };
+    auto s = std::make_shared<State>();
+    s->pool.prepare(cfg.sampleRate, static_cast<int>(cfg.blockSize));
+    s->pool.setMaxPolyphony(kVoices);
+    s->left.resize(cfg.blockSize);
+    s->right.resize(cfg.blockSize);
+    s->retriggerInterval = static_cast<size_t>(cfg.sampleRate * 0.25);
+    return [s, n = cfg.blockSize] {
+        if (s->samplesUntilRetrigger < n) {
+            for (int v = 0; v < kVoices; ++v) {
+                s->pool.noteOn(static_cast<std::uint8_t>(36 + v), 0.8f);
+            }
+            s->samplesUntilRetrigger += s->retriggerInterval;
+        }
+        s->samplesUntilRetrigger -= n;
+        s->pool.processBlock(s->left.data(), s->right.data(),
+                             static_cast<int>(n));
+        consume(s->left[n - 1]);
+    };
+});
+
+} // anonymous namespace
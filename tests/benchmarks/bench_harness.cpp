@@ -0,0 +1,228 @@
+// ==============================================================================
+// KrateDSP Benchmark Harness - runner, JSON I/O, baseline comparison
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <random>
+
+namespace Krate::Bench {
+
+std::vector<BenchCase>& registry() {
+    static std::vector<BenchCase> cases;
+    return cases;
+}
+
+namespace {
+volatile float gSink = 0.0f;
+} // anonymous namespace
+
+void consume(float value) noexcept {
+    gSink = value;
+}
+
+std::vector<float> makeNoise(size_t numSamples, float amplitude, unsigned seed) {
+    std::vector<float> out(numSamples);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-amplitude, amplitude);
+    for (auto& x : out) x = dist(rng);
+    return out;
+}
+
+std::string BenchResult::key() const {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "@%.0fHz/%zu", sampleRate, blockSize);
+    return name + buf;
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double median(std::vector<double> v) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    const size_t mid = v.size() / 2;
+    return (v.size() % 2 != 0) ? v[mid] : 0.5 * (v[mid - 1] + v[mid]);
+}
+
+/// Pick a block count so one repetition spans at least minTimeSeconds.
+size_t calibrateBlocks(const BlockFn& fn, double minTimeSeconds) {
+    size_t blocks = 1;
+    for (;;) {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < blocks; ++i) fn();
+        const double elapsed =
+            std::chrono::duration<double>(Clock::now() - start).count();
+        if (elapsed >= minTimeSeconds * 0.5 || blocks >= (size_t{1} << 24)) {
+            const double perBlock = elapsed / static_cast<double>(blocks);
+            if (perBlock <= 0.0) return blocks;
+            return std::max<size_t>(
+                1, static_cast<size_t>(minTimeSeconds / perBlock));
+        }
+        blocks *= 2;
+    }
+}
+
+BenchResult runOne(const BenchCase& bc, const BenchConfig& cfg,
+                   const RunOptions& options) {
+    BenchResult result;
+    result.name = bc.name;
+    result.sampleRate = cfg.sampleRate;
+    result.blockSize = cfg.blockSize;
+
+    BlockFn fn = bc.factory(cfg);
+    if (!fn) return result;
+
+    if (options.smoke) {
+        fn();
+        result.blocksPerRepetition = 1;
+        return result;
+    }
+
+    for (int i = 0; i < options.warmupBlocks; ++i) fn();
+
+    const size_t blocks = calibrateBlocks(fn, options.minTimeSeconds);
+    result.blocksPerRepetition = blocks;
+
+    const double samples = static_cast<double>(blocks * cfg.blockSize);
+    const double audioSeconds = samples / cfg.sampleRate;
+
+    std::vector<double> nsPerSample;
+    std::vector<double> rtPercent;
+    for (int r = 0; r < options.repetitions; ++r) {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < blocks; ++i) fn();
+        const double elapsed =
+            std::chrono::duration<double>(Clock::now() - start).count();
+        nsPerSample.push_back(elapsed * 1e9 / samples);
+        rtPercent.push_back(elapsed / audioSeconds * 100.0);
+    }
+
+    result.nsPerSample = median(std::move(nsPerSample));
+    result.realtimePercent = median(std::move(rtPercent));
+    return result;
+}
+
+} // anonymous namespace
+
+std::vector<BenchResult> runAll(const RunOptions& options) {
+    auto cases = registry();
+    std::sort(cases.begin(), cases.end(),
+              [](const BenchCase& a, const BenchCase& b) { return a.name < b.name; });
+
+    std::vector<BenchResult> results;
+    for (const auto& bc : cases) {
+        if (!options.filter.empty() &&
+            bc.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        for (double sr : bc.sampleRates) {
+            for (size_t bs : bc.blockSizes) {
+                results.push_back(runOne(bc, {sr, bs}, options));
+                const auto& r = results.back();
+                if (options.smoke) {
+                    std::printf("  ok  %s\n", r.key().c_str());
+                } else {
+                    std::printf("%-48s %8.0f Hz %6zu  %10.2f ns/smp  %8.3f %%RT\n",
+                                r.name.c_str(), r.sampleRate, r.blockSize,
+                                r.nsPerSample, r.realtimePercent);
+                }
+                std::fflush(stdout);
+            }
+        }
+    }
+    return results;
+}
+
+// ==============================================================================
+// JSON
+// ==============================================================================
+
+bool writeJson(const std::vector<BenchResult>& results, const std::string& path) {
+    nlohmann::json root;
+    root["schema"] = 1;
+#if defined(__clang__)
+    root["compiler"] = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    root["compiler"] = std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    root["compiler"] = "msvc " + std::to_string(_MSC_VER);
+#endif
+#ifdef NDEBUG
+    root["buildType"] = "release";
+#else
+    root["buildType"] = "debug";
+#endif
+
+    auto& arr = root["results"];
+    arr = nlohmann::json::array();
+    for (const auto& r : results) {
+        arr.push_back({{"name", r.name},
+                       {"sampleRate", r.sampleRate},
+                       {"blockSize", r.blockSize},
+                       {"nsPerSample", r.nsPerSample},
+                       {"realtimePercent", r.realtimePercent}});
+    }
+
+    std::ofstream out(path);
+    if (!out) return false;
+    out << root.dump(2) << '\n';
+    return static_cast<bool>(out);
+}
+
+bool readJson(const std::string& path, std::vector<BenchResult>& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    const auto root = nlohmann::json::parse(in, nullptr, /*allow_exceptions=*/false);
+    if (root.is_discarded() || !root.contains("results") ||
+        !root["results"].is_array()) {
+        return false;
+    }
+
+    out.clear();
+    for (const auto& e : root["results"]) {
+        BenchResult r;
+        r.name = e.value("name", std::string{});
+        r.sampleRate = e.value("sampleRate", 0.0);
+        r.blockSize = e.value("blockSize", size_t{0});
+        r.nsPerSample = e.value("nsPerSample", 0.0);
+        r.realtimePercent = e.value("realtimePercent", 0.0);
+        if (!r.name.empty()) out.push_back(std::move(r));
+    }
+    return true;
+}
+
+std::vector<Comparison> compare(const std::vector<BenchResult>& current,
+                                const std::vector<BenchResult>& baseline,
+                                double tolerance) {
+    std::map<std::string, const BenchResult*> byKey;
+    for (const auto& b : baseline) byKey[b.key()] = &b;
+
+    std::vector<Comparison> out;
+    out.reserve(current.size());
+    for (const auto& c : current) {
+        Comparison cmp;
+        cmp.current = c;
+        const auto it = byKey.find(c.key());
+        if (it == byKey.end() || it->second->nsPerSample <= 0.0) {
+            cmp.missing = true;
+        } else {
+            cmp.baselineNsPerSample = it->second->nsPerSample;
+            cmp.ratio = c.nsPerSample / cmp.baselineNsPerSample;
+            cmp.regression = cmp.ratio > 1.0 + tolerance;
+        }
+        out.push_back(std::move(cmp));
+    }
+    return out;
+}
+
+} // namespace Krate::Bench
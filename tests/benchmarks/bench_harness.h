@@ -0,0 +1,151 @@
+#pragma once
+// ==============================================================================
+// KrateDSP Benchmark Harness
+// ==============================================================================
+// Minimal registry + timing loop for the krate_dsp_bench target. Every
+// benchmark case is a factory that, given a (sampleRate, blockSize)
+// configuration, prepares a component and returns a closure that renders
+// exactly one block. The runner times that closure and reports:
+//
+//   - ns/sample          wall-clock nanoseconds per rendered sample
+//   - % of realtime      processing time / audio duration of the rendered span
+//
+// Results are printed as a table and optionally written to JSON so they can
+// be compared against a stored baseline (see bench_main.cpp for the CLI).
+//
+// Registration:
+//   KRATE_BENCH("L1/svf/lowpass", kBlockSizesDefault, kSampleRatesDefault,
+//               [](const BenchConfig& cfg) -> BlockFn { ... });
+//
+// Conventions:
+//   - Name prefix is the KrateDSP layer (L0..L4) or "engine/" for plugin-level
+//     voice engines, so --filter can select a layer.
+//   - Everything allocated by the factory is owned by the returned closure
+//     (capture a std::shared_ptr), so the timed region is allocation-free.
+//   - Pass something observable to consume() so the optimizer cannot discard
+//     the work.
+// ==============================================================================
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Krate::Bench {
+
+// ==============================================================================
+// Configuration
+// ==============================================================================
+
+/// One point in the sample-rate x block-size sweep.
+struct BenchConfig {
+    double sampleRate = 44100.0;
+    size_t blockSize = 512;
+};
+
+/// Renders one block of `BenchConfig::blockSize` samples.
+using BlockFn = std::function<void()>;
+
+/// Builds (and prepares) a component for a configuration. Runs untimed.
+using BenchFactory = std::function<BlockFn(const BenchConfig&)>;
+
+/// Standard sweeps. Kept small so a full run stays in the tens of seconds.
+inline const std::vector<size_t> kBlockSizesDefault{32, 128, 512};
+inline const std::vector<size_t> kBlockSizesLarge{128, 512, 2048};
+inline const std::vector<double> kSampleRatesDefault{44100.0, 96000.0};
+inline const std::vector<double> kSampleRatesSingle{48000.0};
+
+// ==============================================================================
+// Registry
+// ==============================================================================
+
+struct BenchCase {
+    std::string name;
+    std::vector<size_t> blockSizes;
+    std::vector<double> sampleRates;
+    BenchFactory factory;
+};
+
+/// Global benchmark registry (populated by static registrars).
+std::vector<BenchCase>& registry();
+
+/// Static registrar used by KRATE_BENCH.
+struct BenchRegistrar {
+    BenchRegistrar(std::string name, std::vector<size_t> blockSizes,
+                   std::vector<double> sampleRates, BenchFactory factory) {
+        registry().push_back({std::move(name), std::move(blockSizes),
+                              std::move(sampleRates), std::move(factory)});
+    }
+};
+
+#define KRATE_BENCH_CONCAT_IMPL(a, b) a##b
+#define KRATE_BENCH_CONCAT(a, b) KRATE_BENCH_CONCAT_IMPL(a, b)
+
+/// Register a benchmark case at static-initialization time.
+#define KRATE_BENCH(name, blockSizes, sampleRates, ...)                       \
+    static const ::Krate::Bench::BenchRegistrar KRATE_BENCH_CONCAT(           \
+        kKrateBenchRegistrar_, __LINE__){name, blockSizes, sampleRates,       \
+                                         __VA_ARGS__}
+
+// ==============================================================================
+// Results
+// ==============================================================================
+
+struct BenchResult {
+    std::string name;
+    double sampleRate = 0.0;
+    size_t blockSize = 0;
+    double nsPerSample = 0.0;      ///< Median over repetitions
+    double realtimePercent = 0.0;  ///< Median over repetitions
+    size_t blocksPerRepetition = 0;
+
+    /// Stable key used to match results against a baseline.
+    [[nodiscard]] std::string key() const;
+};
+
+struct RunOptions {
+    std::string filter;              ///< Substring filter on case name (empty = all)
+    double minTimeSeconds = 0.25;    ///< Minimum timed span per repetition
+    int repetitions = 5;             ///< Median is taken over these
+    int warmupBlocks = 16;
+    bool smoke = false;              ///< One block per config, no timing (CI sanity)
+};
+
+/// Run every registered case matching the filter.
+std::vector<BenchResult> runAll(const RunOptions& options);
+
+// ==============================================================================
+// Baseline I/O
+// ==============================================================================
+
+/// Serialize results as JSON ({"schema":1,"results":[...]}).
+bool writeJson(const std::vector<BenchResult>& results, const std::string& path);
+
+/// Load results previously written with writeJson(). Returns false on error.
+bool readJson(const std::string& path, std::vector<BenchResult>& out);
+
+struct Comparison {
+    BenchResult current;
+    double baselineNsPerSample = 0.0;
+    double ratio = 0.0;       ///< current / baseline (1.0 = unchanged)
+    bool regression = false;  ///< ratio > 1 + tolerance
+    bool missing = false;     ///< no baseline entry for this key
+};
+
+/// Compare results against a baseline. `tolerance` is fractional (0.10 = 10%).
+std::vector<Comparison> compare(const std::vector<BenchResult>& current,
+                                const std::vector<BenchResult>& baseline,
+                                double tolerance);
+
+// ==============================================================================
+// Helpers for benchmark bodies
+// ==============================================================================
+
+/// Store a value to a volatile sink so the optimizer cannot discard the work.
+void consume(float value) noexcept;
+
+/// Deterministic white noise in [-amplitude, amplitude].
+std::vector<float> makeNoise(size_t numSamples, float amplitude = 0.5f,
+                             unsigned seed = 42);
+
+} // namespace Krate::Bench
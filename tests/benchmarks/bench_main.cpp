@@ -0,0 +1,153 @@
+// ==============================================================================
+// krate_dsp_bench - KrateDSP hot-path benchmark suite
+// ==============================================================================
+// Usage:
+//   krate_dsp_bench [options]
+//
+// Options:
+//   --list                 List registered benchmark cases and exit
+//   --filter <substr>      Only run cases whose name contains <substr>
+//                          (e.g. "L1/", "oversampler", "engine/")
+//   --min-time <seconds>   Minimum timed span per repetition (default 0.25)
+//   --repetitions <n>      Repetitions per configuration; median reported (5)
+//   --quick                Shorthand for --min-time 0.02 --repetitions 3
+//   --smoke                Render one block per configuration, no timing
+//   --json <path>          Write results as JSON
+//   --baseline <path>      Compare against a JSON file written by --json
+//   --tolerance <percent>  Allowed ns/sample growth vs baseline (default 10)
+//
+// Exit status: 0 on success, 1 when --baseline finds a regression beyond
+// --tolerance, 2 on usage / I/O errors.
+//
+// Typical release workflow:
+//   krate_dsp_bench --json bench-main.json                 (on main)
+//   krate_dsp_bench --baseline bench-main.json             (on the branch)
+//
+// Baselines are machine-specific: only compare runs from the same box, with
+// the same build type, and with frequency scaling pinned where possible.
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include <enable_ftz_daz.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace Krate::Bench;
+
+namespace {
+
+void printUsage() {
+    std::printf(
+        "usage: krate_dsp_bench [--list] [--filter <substr>] [--min-time <s>]\n"
+        "                       [--repetitions <n>] [--quick] [--smoke]\n"
+        "                       [--json <path>] [--baseline <path>]\n"
+        "                       [--tolerance <percent>]\n");
+}
+
+int reportComparison(const std::vector<Comparison>& comparisons,
+                     double tolerance) {
+    int regressions = 0;
+    int missing = 0;
+    std::printf("\nBaseline comparison (tolerance %.1f%%)\n", tolerance * 100.0);
+    std::printf("%-64s %12s %12s %8s\n", "case", "baseline", "current", "ratio");
+    for (const auto& c : comparisons) {
+        if (c.missing) {
+            ++missing;
+            std::printf("%-64s %12s %12.2f %8s\n", c.current.key().c_str(),
+                        "-", c.current.nsPerSample, "new");
+            continue;
+        }
+        if (c.regression) ++regressions;
+        std::printf("%-64s %12.2f %12.2f %7.2fx%s\n", c.current.key().c_str(),
+                    c.baselineNsPerSample, c.current.nsPerSample, c.ratio,
+                    c.regression ? "  REGRESSION" : "");
+    }
+    std::printf("\n%d regression(s), %d case(s) without baseline\n",
+                regressions, missing);
+    return regressions > 0 ? 1 : 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    // Match the audio-thread runtime: denormals flushed (see dsp_test_main.cpp)
+    enableFTZDAZ();
+
+    RunOptions options;
+    std::string jsonPath;
+    std::string baselinePath;
+    double tolerance = 0.10;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        auto next = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "missing value for %s\n", argv[i]);
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--list") {
+            listOnly = true;
+        } else if (arg == "--filter") {
+            options.filter = next();
+        } else if (arg == "--min-time") {
+            options.minTimeSeconds = std::atof(next());
+        } else if (arg == "--repetitions") {
+            options.repetitions = std::max(1, std::atoi(next()));
+        } else if (arg == "--quick") {
+            options.minTimeSeconds = 0.02;
+            options.repetitions = 3;
+        } else if (arg == "--smoke") {
+            options.smoke = true;
+        } else if (arg == "--json") {
+            jsonPath = next();
+        } else if (arg == "--baseline") {
+            baselinePath = next();
+        } else if (arg == "--tolerance") {
+            tolerance = std::atof(next()) / 100.0;
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (listOnly) {
+        for (const auto& bc : registry()) {
+            if (options.filter.empty() ||
+                bc.name.find(options.filter) != std::string::npos) {
+                std::printf("%s\n", bc.name.c_str());
+            }
+        }
+        return 0;
+    }
+
+    std::vector<BenchResult> baseline;
+    if (!baselinePath.empty() && !readJson(baselinePath, baseline)) {
+        std::fprintf(stderr, "failed to read baseline: %s\n", baselinePath.c_str());
+        return 2;
+    }
+
+    const auto results = runAll(options);
+
+    if (!jsonPath.empty() && !writeJson(results, jsonPath)) {
+        std::fprintf(stderr, "failed to write JSON: %s\n", jsonPath.c_str());
+        return 2;
+    }
+
+    if (!baselinePath.empty() && !options.smoke) {
+        return reportComparison(compare(results, baseline, tolerance), tolerance);
+    }
+    return 0;
+}
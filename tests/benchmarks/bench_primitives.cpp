@@ -0,0 +1,410 @@
+// ==============================================================================
+// Layer 1 benchmarks: FFT/STFT, oversampling, filters, waveshaping math
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include <krate/dsp/core/fast_math.h>
+#include <krate/dsp/primitives/biquad.h>
+#include <krate/dsp/primitives/fft.h>
+#include <krate/dsp/primitives/ladder_filter.h>
+#include <krate/dsp/primitives/oversampler.h>
+#include <krate/dsp/primitives/spectral_buffer.h>
+#include <krate/dsp/primitives/stft.h>
+#include <krate/dsp/primitives/svf.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Krate::Bench;
+using namespace Krate::DSP;
+
+namespace {
+
+// ==============================================================================
+// FFT / STFT
+// ==============================================================================
+
+// For the FFT cases "block size" is the transform size: one block is one
+// forward + inverse round trip, so ns/sample is directly comparable across
+// sizes (ideal O(N log N) growth is ~log2(N) per sample).
+BlockFn makeFFTRoundTrip(const BenchConfig& cfg) {
+    struct State {
+        FFT fft;
+        std::vector<float> input;
+        std::vector<Complex> spectrum;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->fft.prepare(cfg.blockSize);
+    s->input = makeNoise(cfg.blockSize);
+    s->spectrum.resize(s->fft.numBins());
+    s->output.resize(cfg.blockSize);
+    return [s] {
+        s->fft.forward(s->input.data(), s->spectrum.data());
+        s->fft.inverse(s->spectrum.data(), s->output.data());
+        consume(s->output[0]);
+    };
+}
+
+KRATE_BENCH("L1/fft/roundtrip", (std::vector<size_t>{256, 1024, 4096, 8192}),
+            kSampleRatesSingle, makeFFTRoundTrip);
+
+// Analysis sizes beyond the real-time range, plus 3*2^n / 5*2^n sizes
+// (compare 3072/5120 against the 4096 power-of-2 case above).
+KRATE_BENCH("L1/fft/roundtrip_extended",
+            (std::vector<size_t>{3072, 5120, 16384, 24576, 65536}),
+            kSampleRatesSingle, makeFFTRoundTrip);
+
+// Streaming STFT analysis + overlap-add resynthesis (2048 / hop 512, Hann),
+// the framing used by SpectralDelay and the phase vocoder.
+KRATE_BENCH("L1/stft/analyze_resynthesize", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    constexpr size_t kFFTSize = 2048;
+    constexpr size_t kHop = 512;
+    struct State {
+        STFT stft;
+        OverlapAdd ola;
+        SpectralBuffer spectrum;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->stft.prepare(kFFTSize, kHop, WindowType::Hann);
+    s->ola.prepare(kFFTSize, kHop, WindowType::Hann);
+    s->spectrum.prepare(kFFTSize);
+    s->input = makeNoise(cfg.blockSize);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->stft.pushSamples(s->input.data(), n);
+        while (s->stft.canAnalyze()) {
+            s->stft.analyze(s->spectrum);
+            s->ola.synthesize(s->spectrum);
+        }
+        const size_t ready = std::min(n, s->ola.samplesAvailable());
+        s->ola.pullSamples(s->output.data(), ready);
+        consume(s->output[0]);
+    };
+});
+
+// Stereo framing two ways: two independent STFT/OverlapAdd pipelines (what
+// SpectralDelay used to run) vs one MultiChannelSTFT/OverlapAdd pair sharing
+// the window, hop bookkeeping and a paired complex transform.
+KRATE_BENCH("L1/stft/stereo_separate", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    constexpr size_t kFFTSize = 2048;
+    constexpr size_t kHop = 512;
+    struct State {
+        std::array<STFT, 2> stft;
+        std::array<OverlapAdd, 2> ola;
+        std::array<SpectralBuffer, 2> spectrum;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    for (size_t ch = 0; ch < 2; ++ch) {
+        s->stft[ch].prepare(kFFTSize, kHop, WindowType::Hann);
+        s->ola[ch].prepare(kFFTSize, kHop, WindowType::Hann);
+        s->spectrum[ch].prepare(kFFTSize);
+    }
+    s->input = makeNoise(cfg.blockSize);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        for (size_t ch = 0; ch < 2; ++ch) {
+            s->stft[ch].pushSamples(s->input.data(), n);
+            while (s->stft[ch].canAnalyze()) {
+                s->stft[ch].analyze(s->spectrum[ch]);
+                s->ola[ch].synthesize(s->spectrum[ch]);
+            }
+            const size_t ready = std::min(n, s->ola[ch].samplesAvailable());
+            s->ola[ch].pullSamples(s->output.data(), ready);
+        }
+        consume(s->output[0]);
+    };
+});
+
+KRATE_BENCH("L1/stft/stereo_batched", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    constexpr size_t kFFTSize = 2048;
+    constexpr size_t kHop = 512;
+    struct State {
+        MultiChannelSTFT stft;
+        MultiChannelOverlapAdd ola;
+        std::array<SpectralBuffer, 2> spectrum;
+        std::vector<float> input;
+        std::vector<float> outputL;
+        std::vector<float> outputR;
+    };
+    auto s = std::make_shared<State>();
+    s->stft.prepare(2, kFFTSize, kHop, WindowType::Hann);
+    s->ola.prepare(2, kFFTSize, kHop, WindowType::Hann);
+    for (auto& spectrum : s->spectrum) spectrum.prepare(kFFTSize);
+    s->input = makeNoise(cfg.blockSize);
+    s->outputL.resize(cfg.blockSize);
+    s->outputR.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        const float* inputs[] = {s->input.data(), s->input.data()};
+        SpectralBuffer* analysisOut[] = {&s->spectrum[0], &s->spectrum[1]};
+        const SpectralBuffer* synthesisIn[] = {&s->spectrum[0], &s->spectrum[1]};
+        s->stft.pushSamples(inputs, n);
+        while (s->stft.canAnalyze()) {
+            s->stft.analyze(analysisOut);
+            s->ola.synthesize(synthesisIn);
+        }
+        const size_t ready = std::min(n, s->ola.samplesAvailable());
+        float* outputs[] = {s->outputL.data(), s->outputR.data()};
+        s->ola.pullSamples(outputs, ready);
+        consume(s->outputL[0]);
+    };
+});
+
+// ==============================================================================
+// Oversampling
+// ==============================================================================
+
+// Stereo up/down round trip around a cheap nonlinearity, i.e. the overhead a
+// saturator pays for running oversampled.
+template <size_t Factor>
+BlockFn makeOversamplerBench(const BenchConfig& cfg, OversamplingQuality quality,
+                             OversamplingMode mode = OversamplingMode::ZeroLatency) {
+    struct State {
+        Oversampler<Factor, 2> os;
+        typename Oversampler<Factor, 2>::StereoCallback callback;
+        std::vector<float> source;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+    auto s = std::make_shared<State>();
+    s->os.prepare(cfg.sampleRate, cfg.blockSize, quality, mode);
+    s->callback = [](float* l, float* r, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            l[i] = FastMath::fastTanh(2.0f * l[i]);
+            r[i] = FastMath::fastTanh(2.0f * r[i]);
+        }
+    };
+    s->source = makeNoise(cfg.blockSize);
+    s->left.resize(cfg.blockSize);
+    s->right.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        std::copy(s->source.begin(), s->source.end(), s->left.begin());
+        std::copy(s->source.begin(), s->source.end(), s->right.begin());
+        s->os.process(s->left.data(), s->right.data(), n, s->callback);
+        consume(s->left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L1/oversampler/2x_economy", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<2>(cfg, OversamplingQuality::Economy);
+});
+
+KRATE_BENCH("L1/oversampler/2x_high", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<2>(cfg, OversamplingQuality::High);
+});
+
+KRATE_BENCH("L1/oversampler/4x_economy", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<4>(cfg, OversamplingQuality::Economy);
+});
+
+KRATE_BENCH("L1/oversampler/4x_high", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<4>(cfg, OversamplingQuality::High);
+});
+
+KRATE_BENCH("L1/oversampler/2x_high_linear_phase", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<2>(cfg, OversamplingQuality::High,
+                                   OversamplingMode::LinearPhase);
+});
+
+KRATE_BENCH("L1/oversampler/4x_high_linear_phase", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeOversamplerBench<4>(cfg, OversamplingQuality::High,
+                                   OversamplingMode::LinearPhase);
+});
+
+// One 63-tap 2x up + down round trip, mono: the direct-form HalfbandFilter
+// (zero-stuff, shift, all taps) against the polyphase interpolator/decimator
+// the Oversampler FIR path uses.
+KRATE_BENCH("L1/halfband/63tap_direct", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        HalfbandFilterHigh up;
+        HalfbandFilterHigh down;
+        std::vector<float> input;
+        std::vector<float> oversampled;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->up.setCoefficients(detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+    s->down.setCoefficients(detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+    s->input = makeNoise(cfg.blockSize);
+    s->oversampled.resize(cfg.blockSize * 2);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        for (size_t i = 0; i < n; ++i) {
+            s->oversampled[2 * i] = s->input[i] * 2.0f;
+            s->oversampled[2 * i + 1] = 0.0f;
+        }
+        s->up.processBlock(s->oversampled.data(), n * 2);
+        s->down.processBlock(s->oversampled.data(), n * 2);
+        for (size_t i = 0; i < n; ++i) s->output[i] = s->oversampled[2 * i];
+        consume(s->output[n - 1]);
+    };
+});
+
+KRATE_BENCH("L1/halfband/63tap_polyphase", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        HalfbandInterpolator<detail::kHighFirLength> up;
+        HalfbandDecimator<detail::kHighFirLength> down;
+        std::vector<float> input;
+        std::vector<float> oversampled;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->up.setCoefficients(detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+    s->down.setCoefficients(detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+    s->input = makeNoise(cfg.blockSize);
+    s->oversampled.resize(cfg.blockSize * 2);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->up.process(s->input.data(), s->oversampled.data(), n);
+        s->down.process(s->oversampled.data(), s->output.data(), n);
+        consume(s->output[n - 1]);
+    };
+});
+
+// ==============================================================================
+// Filters
+// ==============================================================================
+
+KRATE_BENCH("L1/svf/lowpass_static", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        SVF svf;
+        std::vector<float> source;
+        std::vector<float> buffer;
+    };
+    auto s = std::make_shared<State>();
+    s->svf.prepare(cfg.sampleRate);
+    s->svf.setMode(SVFMode::Lowpass);
+    s->svf.setCutoff(1200.0f);
+    s->svf.setResonance(2.0f);
+    s->source = makeNoise(cfg.blockSize);
+    s->buffer.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        std::copy(s->source.begin(), s->source.end(), s->buffer.begin());
+        s->svf.processBlock(s->buffer.data(), n);
+        consume(s->buffer[n - 1]);
+    };
+});
+
+// Per-sample cutoff sweep: the coefficient-recompute cost paid by voices with
+// an envelope or LFO on the cutoff.
+KRATE_BENCH("L1/svf/lowpass_modulated", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        SVF svf;
+        std::vector<float> source;
+        float phase = 0.0f;
+    };
+    auto s = std::make_shared<State>();
+    s->svf.prepare(cfg.sampleRate);
+    s->svf.setMode(SVFMode::Lowpass);
+    s->svf.setResonance(2.0f);
+    s->source = makeNoise(cfg.blockSize);
+    const float phaseInc = static_cast<float>(3.0 / cfg.sampleRate);
+    return [s, phaseInc] {
+        float last = 0.0f;
+        for (float x : s->source) {
+            s->phase += phaseInc;
+            if (s->phase >= 1.0f) s->phase -= 1.0f;
+            s->svf.setCutoff(200.0f + 4000.0f * s->phase);
+            last = s->svf.process(x);
+        }
+        consume(last);
+    };
+});
+
+KRATE_BENCH("L1/biquad/lowpass", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) -> BlockFn {
+    struct State {
+        Biquad biquad;
+        std::vector<float> source;
+        std::vector<float> buffer;
+    };
+    auto s = std::make_shared<State>();
+    s->biquad.configure(FilterType::Lowpass, 1200.0f, 0.707f, 0.0f,
+                        static_cast<float>(cfg.sampleRate));
+    s->source = makeNoise(cfg.blockSize);
+    s->buffer.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        std::copy(s->source.begin(), s->source.end(), s->buffer.begin());
+        s->biquad.processBlock(s->buffer.data(), n);
+        consume(s->buffer[n - 1]);
+    };
+});
+
+BlockFn makeLadderBench(const BenchConfig& cfg, LadderModel model,
+                        int oversampling) {
+    struct State {
+        LadderFilter ladder;
+        std::vector<float> source;
+        std::vector<float> buffer;
+    };
+    auto s = std::make_shared<State>();
+    s->ladder.prepare(cfg.sampleRate, static_cast<int>(cfg.blockSize));
+    s->ladder.setModel(model);
+    s->ladder.setOversamplingFactor(oversampling);
+    s->ladder.setCutoff(1200.0f);
+    s->ladder.setResonance(2.5f);
+    s->source = makeNoise(cfg.blockSize);
+    s->buffer.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        std::copy(s->source.begin(), s->source.end(), s->buffer.begin());
+        s->ladder.processBlock(s->buffer.data(), n);
+        consume(s->buffer[n - 1]);
+    };
+}
+
+KRATE_BENCH("L1/ladder/linear", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeLadderBench(cfg, LadderModel::Linear, 1);
+});
+
+KRATE_BENCH("L1/ladder/nonlinear_2x", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makeLadderBench(cfg, LadderModel::Nonlinear, 2);
+});
+
+// ==============================================================================
+// Waveshaping math (replaces the old standalone benchmark_tanh)
+// ==============================================================================
+
+KRATE_BENCH("L0/math/std_tanh", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    auto source = std::make_shared<std::vector<float>>(makeNoise(cfg.blockSize, 3.0f));
+    return [source] {
+        float acc = 0.0f;
+        for (float x : *source) acc += std::tanh(x);
+        consume(acc);
+    };
+});
+
+KRATE_BENCH("L0/math/fast_tanh", kBlockSizesDefault, kSampleRatesSingle,
+            [](const BenchConfig& cfg) -> BlockFn {
+    auto source = std::make_shared<std::vector<float>>(makeNoise(cfg.blockSize, 3.0f));
+    return [source] {
+        float acc = 0.0f;
+        for (float x : *source) acc += FastMath::fastTanh(x);
+        consume(acc);
+    };
+});
+
+} // anonymous namespace
@@ -0,0 +1,378 @@
+// ==============================================================================
+// Layer 2 benchmarks: resonator / oscillator banks, pitch shifting, convolution,
+// arpeggiator seek
+// ==============================================================================
+
+#include "bench_harness.h"
+
+#include <krate/dsp/processors/arpeggiator_core.h>
+#include <krate/dsp/processors/convolver.h>
+#include <krate/dsp/processors/harmonic_oscillator_bank.h>
+#include <krate/dsp/processors/harmonic_types.h>
+#include <krate/dsp/processors/modal_resonator_bank.h>
+#include <krate/dsp/processors/pitch_shift_processor.h>
+#include <krate/dsp/processors/stereo_band_splitter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Krate::Bench;
+using namespace Krate::DSP;
+
+namespace {
+
+// ==============================================================================
+// Banks
+// ==============================================================================
+
+// Full 96-mode bank excited by a short noise burst at the start of every
+// block, so the modes never decay into the denormal-free silent tail.
+KRATE_BENCH("L2/modal_resonator_bank/96_modes", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    constexpr int kModes = ModalResonatorBank::kMaxModes;
+    struct State {
+        ModalResonatorBank bank;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->bank.prepare(cfg.sampleRate);
+
+    float freqs[kModes];
+    float amps[kModes];
+    for (int k = 0; k < kModes; ++k) {
+        freqs[k] = 110.0f * static_cast<float>(k + 1);
+        amps[k] = 1.0f / static_cast<float>(k + 1);
+    }
+    s->bank.setModes(freqs, amps, kModes, 1.5f, 0.5f, 0.0f, 0.0f);
+
+    s->input.assign(cfg.blockSize, 0.0f);
+    const auto burst = makeNoise(std::min<size_t>(cfg.blockSize, 16));
+    std::copy(burst.begin(), burst.end(), s->input.begin());
+    s->output.resize(cfg.blockSize);
+    return [s, n = static_cast<int>(cfg.blockSize)] {
+        s->bank.processBlock(s->input.data(), s->output.data(), n);
+        consume(s->output[static_cast<size_t>(n - 1)]);
+    };
+});
+
+// Same bank under mallet choke: processBlock(..., decayScale) runs the SIMD
+// kernel on pow(R, decayScale) radii taken once per block.
+KRATE_BENCH("L2/modal_resonator_bank/96_modes_choke", kBlockSizesDefault,
+            kSampleRatesSingle, [](const BenchConfig& cfg) -> BlockFn {
+    constexpr int kModes = ModalResonatorBank::kMaxModes;
+    struct State {
+        ModalResonatorBank bank;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->bank.prepare(cfg.sampleRate);
+
+    float freqs[kModes];
+    float amps[kModes];
+    for (int k = 0; k < kModes; ++k) {
+        freqs[k] = 110.0f * static_cast<float>(k + 1);
+        amps[k] = 1.0f / static_cast<float>(k + 1);
+    }
+    s->bank.setModes(freqs, amps, kModes, 1.5f, 0.5f, 0.0f, 0.0f);
+
+    s->input.assign(cfg.blockSize, 0.0f);
+    const auto burst = makeNoise(std::min<size_t>(cfg.blockSize, 16));
+    std::copy(burst.begin(), burst.end(), s->input.begin());
+    s->output.resize(cfg.blockSize);
+    return [s, n = static_cast<int>(cfg.blockSize)] {
+        s->bank.processBlock(s->input.data(), s->output.data(), n, 1.001f);
+        consume(s->output[static_cast<size_t>(n - 1)]);
+    };
+});
+
+// 96 configured modes of which 84 fall below the amplitude-culling floor
+// (a sparse Membrum body). Culled modes never enter the live-mode set, so the
+// cost should track the 12 active modes rather than numModes.
+KRATE_BENCH("L2/modal_resonator_bank/96_modes_12_active", kBlockSizesDefault,
+            kSampleRatesSingle, [](const BenchConfig& cfg) -> BlockFn {
+    constexpr int kModes = ModalResonatorBank::kMaxModes;
+    constexpr int kActive = 12;
+    struct State {
+        ModalResonatorBank bank;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->bank.prepare(cfg.sampleRate);
+
+    float freqs[kModes];
+    float amps[kModes];
+    for (int k = 0; k < kModes; ++k) {
+        freqs[k] = 110.0f * static_cast<float>(k + 1);
+        amps[k] = k < kActive ? 1.0f / static_cast<float>(k + 1) : 0.0f;
+    }
+    s->bank.setModes(freqs, amps, kModes, 1.5f, 0.5f, 0.0f, 0.0f);
+
+    s->input.assign(cfg.blockSize, 0.0f);
+    const auto burst = makeNoise(std::min<size_t>(cfg.blockSize, 16));
+    std::copy(burst.begin(), burst.end(), s->input.begin());
+    s->output.resize(cfg.blockSize);
+    return [s, n = static_cast<int>(cfg.blockSize)] {
+        s->bank.processBlock(s->input.data(), s->output.data(), n);
+        consume(s->output[static_cast<size_t>(n - 1)]);
+    };
+});
+
+// 48 harmonic partials, the Innexus resynthesis workload.
+KRATE_BENCH("L2/harmonic_oscillator_bank/48_partials", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) -> BlockFn {
+    constexpr int kPartials = 48;
+    struct State {
+        HarmonicOscillatorBank bank;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->bank.prepare(cfg.sampleRate);
+
+    HarmonicFrame frame;
+    frame.f0 = 110.0f;
+    frame.f0Confidence = 1.0f;
+    frame.numPartials = kPartials;
+    frame.globalAmplitude = 0.5f;
+    for (int k = 0; k < kPartials; ++k) {
+        auto& p = frame.partials[static_cast<size_t>(k)];
+        p.harmonicIndex = k + 1;
+        p.frequency = frame.f0 * static_cast<float>(k + 1);
+        p.relativeFrequency = static_cast<float>(k + 1);
+        p.amplitude = 0.5f / static_cast<float>(k + 1);
+        p.stability = 1.0f;
+    }
+    s->bank.loadFrame(frame, 220.0f);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->bank.processBlock(s->output.data(), n);
+        consume(s->output[n - 1]);
+    };
+});
+
+// ==============================================================================
+// Pitch shifting
+// ==============================================================================
+
+BlockFn makePitchShiftBench(const BenchConfig& cfg, PitchMode mode) {
+    struct State {
+        PitchShiftProcessor shifter;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+    auto s = std::make_shared<State>();
+    s->shifter.prepare(cfg.sampleRate, cfg.blockSize);
+    s->shifter.setMode(mode);
+    s->shifter.setSemitones(7.0f);
+    s->input = makeNoise(cfg.blockSize);
+    s->output.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        s->shifter.process(s->input.data(), s->output.data(), n);
+        consume(s->output[n - 1]);
+    };
+}
+
+KRATE_BENCH("L2/pitch_shift/simple", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makePitchShiftBench(cfg, PitchMode::Simple);
+});
+
+KRATE_BENCH("L2/pitch_shift/granular", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makePitchShiftBench(cfg, PitchMode::Granular);
+});
+
+KRATE_BENCH("L2/pitch_shift/phase_vocoder", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makePitchShiftBench(cfg, PitchMode::PhaseVocoder);
+});
+
+KRATE_BENCH("L2/pitch_shift/pitch_sync", kBlockSizesDefault, kSampleRatesDefault,
+            [](const BenchConfig& cfg) {
+    return makePitchShiftBench(cfg, PitchMode::PitchSync);
+});
+
+// ==============================================================================
+// Convolution
+// ==============================================================================
+
+// 64 is the target host buffer; 512 shows how the cost flattens out.
+const std::vector<size_t> kBlockSizesConvolver{64, 512};
+
+// Stereo 4 s decaying-noise IR (a long hall). With the background tail the
+// audio thread only runs the head and the first FFT stage, so the reported
+// time is what the host callback sees; the worker's share is on top of it.
+BlockFn makeConvolverBench(const BenchConfig& cfg, bool backgroundTail) {
+    struct State {
+        Convolver convolver;
+        std::vector<float> input;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+    auto s = std::make_shared<State>();
+    const size_t irLength = static_cast<size_t>(4.0 * cfg.sampleRate);
+    auto irLeft = makeNoise(irLength);
+    auto irRight = makeNoise(irLength);
+    for (size_t i = 0; i < irLength; ++i) {
+        const float decay = std::exp(-6.9f * static_cast<float>(i) / static_cast<float>(irLength));
+        irLeft[i] *= decay;
+        irRight[i] *= decay;
+    }
+
+    PartitionedConvolver::Options options;
+    options.backgroundTail = backgroundTail;
+    s->convolver.prepare(cfg.sampleRate, cfg.blockSize);
+    s->convolver.setOptions(options);
+    s->convolver.setCrossfadeTime(0.0f);
+    s->convolver.loadImpulseResponse(irLeft.data(), irRight.data(), irLength);
+    s->input = makeNoise(cfg.blockSize);
+    s->left.resize(cfg.blockSize);
+    s->right.resize(cfg.blockSize);
+    return [s, n = cfg.blockSize] {
+        // Processing is in place: restart from the same dry block each time
+        std::copy(s->input.begin(), s->input.end(), s->left.begin());
+        std::copy(s->input.begin(), s->input.end(), s->right.begin());
+        s->convolver.process(s->left.data(), s->right.data(), n);
+        consume(s->left[n - 1]);
+    };
+}
+
+KRATE_BENCH("L2/convolver/4s_stereo_background", kBlockSizesConvolver,
+            kSampleRatesSingle, [](const BenchConfig& cfg) {
+    return makeConvolverBench(cfg, true);
+});
+
+KRATE_BENCH("L2/convolver/4s_stereo_inline", kBlockSizesConvolver,
+            kSampleRatesSingle, [](const BenchConfig& cfg) {
+    return makeConvolverBench(cfg, false);
+});
+
+// ==============================================================================
+// Crossovers
+// ==============================================================================
+
+// Stereo 4-band split (the Disrumpo layout). Minimum phase is the LR4 cascade
+// with both channels in one SIMD pair; linear phase is the FFT crossover,
+// whose cost lands on the block that completes each 2048-sample hop.
+BlockFn makeBandSplitterBench(const BenchConfig& cfg, CrossoverPhase phase) {
+    constexpr int kBands = 4;
+    struct State {
+        StereoBandSplitter splitter;
+        std::vector<float> left;
+        std::vector<float> right;
+        std::vector<std::vector<float>> bandsL;
+        std::vector<std::vector<float>> bandsR;
+        std::vector<float*> ptrL;
+        std::vector<float*> ptrR;
+    };
+    auto s = std::make_shared<State>();
+    s->splitter.prepare(cfg.sampleRate);
+    s->splitter.setPhase(phase);
+    s->splitter.setNumBands(kBands);
+    s->splitter.setCrossoverFrequency(0, 120.0f);
+    s->splitter.setCrossoverFrequency(1, 800.0f);
+    s->splitter.setCrossoverFrequency(2, 5000.0f);
+    s->left = makeNoise(cfg.blockSize);
+    s->right = makeNoise(cfg.blockSize);
+    s->bandsL.assign(kBands, std::vector<float>(cfg.blockSize));
+    s->bandsR.assign(kBands, std::vector<float>(cfg.blockSize));
+    for (int b = 0; b < kBands; ++b) {
+        s->ptrL.push_back(s->bandsL[static_cast<size_t>(b)].data());
+        s->ptrR.push_back(s->bandsR[static_cast<size_t>(b)].data());
+    }
+    return [s, n = cfg.blockSize] {
+        s->splitter.process(s->left.data(), s->right.data(), s->ptrL.data(),
+                            s->ptrR.data(), n);
+        consume(s->bandsR[kBands - 1][n - 1]);
+    };
+}
+
+KRATE_BENCH("L2/stereo_band_splitter/4_bands_minimum_phase", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeBandSplitterBench(cfg, CrossoverPhase::Minimum);
+});
+
+KRATE_BENCH("L2/stereo_band_splitter/4_bands_linear_phase", kBlockSizesDefault,
+            kSampleRatesSingle, [](const BenchConfig& cfg) {
+    return makeBandSplitterBench(cfg, CrossoverPhase::Linear);
+});
+
+// ==============================================================================
+// Arpeggiator seek
+// ==============================================================================
+
+// One host relocation to bar ~1000 (97 BPM, eighth triplets) per block,
+// followed by the block itself. "closed_form" solves the state and replays at
+// most one step. The history cases add bar retrigger and length jitter, which
+// replay the playthrough: "history_loop_wrap" seeks to the same target every
+// block, so all but the first restore its checkpoint; "history_cold" edits the
+// gate length each block, cycling through more values than there are
+// checkpoints, so every seek misses the cache and, bar 1000 being past the
+// replay budget, solves the state 64 steps back and replays those.
+enum class ArpSeekBench : uint8_t { ClosedForm, HistoryLoopWrap, HistoryCold };
+
+BlockFn makeArpSeekBench(const BenchConfig& cfg, ArpSeekBench kind) {
+    struct State {
+        ArpeggiatorCore arp;
+        BlockContext ctx;
+        std::array<ArpEvent, 128> events{};
+        size_t pass{0};
+    };
+    auto s = std::make_shared<State>();
+    s->arp.prepare(cfg.sampleRate, cfg.blockSize);
+    s->arp.setEnabled(true);
+    s->arp.setMode(ArpMode::UpDown);
+    s->arp.setOctaveRange(2);
+    s->arp.setNoteValue(NoteValue::Eighth, NoteModifier::Triplet);
+    s->arp.setHumanize(0.3f);
+    s->arp.pitchLane().setLength(5);
+    s->arp.setLaneSpeed(2, 1.5f);
+    s->arp.setLaneSwing(0, 40.0f);
+    s->arp.ratchetLane().setLength(5);
+    s->arp.ratchetLane().setStep(3, static_cast<uint8_t>(3));
+    s->arp.conditionLane().setLength(4);
+    s->arp.conditionLane().setStep(1, static_cast<uint8_t>(TrigCondition::Prob50));
+    if (kind != ArpSeekBench::ClosedForm) {
+        s->arp.setRetrigger(ArpRetriggerMode::Beat);
+        s->arp.setLaneLengthJitter(1, 2);
+    }
+    s->arp.noteOn(48, 100);
+    s->arp.noteOn(55, 100);
+    s->arp.noteOn(62, 100);
+
+    s->ctx.sampleRate = cfg.sampleRate;
+    s->ctx.blockSize = cfg.blockSize;
+    s->ctx.tempoBPM = 97.0;
+    s->ctx.isPlaying = true;
+    return [s, kind] {
+        constexpr double kBar1000 = 4000.0;
+        if (kind == ArpSeekBench::HistoryCold) {
+            const size_t variant = s->pass++ % (ArpeggiatorCore::kSeekCheckpoints + 1);
+            s->arp.setGateLength(60.0f + static_cast<float>(variant));
+        }
+        s->arp.seekTo(kBar1000, s->ctx);
+        const size_t count = s->arp.processBlock(s->ctx, s->events);
+        consume(static_cast<float>(count + s->arp.lastSeekReplayedSamples()));
+    };
+}
+
+KRATE_BENCH("L2/arpeggiator/seek_bar_1000_closed_form", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeArpSeekBench(cfg, ArpSeekBench::ClosedForm);
+});
+
+KRATE_BENCH("L2/arpeggiator/seek_bar_1000_history_loop_wrap", kBlockSizesDefault,
+            kSampleRatesDefault, [](const BenchConfig& cfg) {
+    return makeArpSeekBench(cfg, ArpSeekBench::HistoryLoopWrap);
+});
+
+KRATE_BENCH("L2/arpeggiator/seek_bar_1000_history_cold", kBlockSizesDefault,
+            kSampleRatesSingle, [](const BenchConfig& cfg) {
+    return makeArpSeekBench(cfg, ArpSeekBench::HistoryCold);
+});
+
+} // anonymous namespace
@@ -59,6 +59,10 @@ int parseCli(int argc, char** argv, CliArgs& outArgs) {
     auto* kit = app.add_subcommand("kit", "Fit a WAV directory / SFZ into a Membrum kit preset");
     kit->add_option("input", outArgs.input, "kit JSON map or SFZ file")->required();
     kit->add_option("output", outArgs.output, "output directory (or .vstpreset path)")->required();
+    kit->add_option("-j,--jobs", outArgs.jobs,
+                    "Pads fitted concurrently (0 = one per hardware thread)")
+        ->default_val(1)
+        ->check(CLI::Range(0, 1024));
 
     std::string modalMethod = "mp";
     app.add_option("--modal-method", modalMethod, "Modal extractor: mp|esprit")
@@ -69,6 +73,10 @@ int parseCli(int argc, char** argv, CliArgs& outArgs) {
     app.add_option("--max-evals", outArgs.options.maxBobyqaEvals, "BOBYQA max evaluations")
         ->default_val(300);
     app.add_flag("--global", outArgs.options.enableGlobalCMAES, "Enable CMA-ES global escape (Phase 4)");
+    app.add_option("--global-threads", outArgs.options.globalSearchThreads,
+                   "Concurrent global-escape searches (one thread each, sharing --max-evals)")
+        ->default_val(1)
+        ->check(CLI::Range(1, 256));
     app.add_flag("--json", outArgs.options.writeJson, "Also write a JSON intermediate");
     app.add_option("--w-stft", outArgs.options.wSTFT, "MSS loss weight")->default_val(0.6f);
     app.add_option("--w-mfcc", outArgs.options.wMFCC, "MFCC loss weight")->default_val(0.2f);
@@ -18,6 +18,8 @@ struct CliArgs {
     std::filesystem::path   output;
     std::string             presetName = "Fitted";
     std::string             subcategory = "Acoustic";
+    // Kit mode: pads fitted concurrently. 0 = one per hardware thread.
+    int                     jobs = 1;
     FitOptions              options{};
 };
 
@@ -27,9 +27,17 @@
 
 #include "dsp/default_kit.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <mutex>
+#include <optional>
 #include <span>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace MembrumFit {
 
@@ -306,6 +314,7 @@ FitResult fitSample(const std::filesystem::path& wavPath, const FitOptions& opti
         RefineContext gctx = rctx;
         gctx.initial = rr.final;
         gctx.maxEvals = options.maxBobyqaEvals;
+        gctx.numThreads = options.globalSearchThreads;
         const auto gr = refineGlobalCRS(gctx, voice);
         if (gr.finalLoss < rr.finalLoss) {
             rr.final = gr.final;
@@ -324,6 +333,81 @@ FitResult fitSample(const std::filesystem::path& wavPath, const FitOptions& opti
     return res;
 }
 
+namespace {
+
+struct PadJob {
+    int padIdx = 0;
+    int midiNote = 0;
+    std::filesystem::path wav;
+    FitOptions options;
+};
+
+std::string padSummary(const PadJob& job, const FitResult& fit) {
+    char line[512];
+    std::snprintf(line, sizeof(line),
+        "  pad %2d (MIDI %d, %s): loss %.4f -> %.4f (%d evals%s%s%s)\n",
+        job.padIdx, job.midiNote, job.wav.filename().string().c_str(),
+        fit.quality.initialLoss, fit.quality.finalLoss, fit.quality.bobyqaEvals,
+        fit.quality.bobyqaConverged ? ", converged" : "",
+        fit.quality.cmaesUsed ? ", CMA-ES" : "",
+        job.options.forcedBody.has_value() ? ", forced body" : "");
+    return line;
+}
+
+// Fit every pad on up to `numJobs` threads. Pads are independent, so each
+// thread claims the next unfitted pad from a shared counter until none are
+// left -- a slow pad never holds up the others. Per-pad summaries go to
+// stdout in job order (each as soon as every earlier pad is done); progress
+// with an ETA goes to stderr as pads finish. Every fit is a pure function
+// of its sample and options, so results do not depend on numJobs.
+std::vector<FitResult> fitPads(const std::vector<PadJob>& jobs, int numJobs) {
+    if (jobs.empty()) return {};
+    std::vector<std::optional<FitResult>> results(jobs.size());
+    std::atomic<std::size_t> nextJob{0};
+    std::mutex reportMutex;
+    std::size_t finished = 0;
+    std::size_t printed = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&] {
+        for (;;) {
+            const std::size_t i = nextJob.fetch_add(1);
+            if (i >= jobs.size()) return;
+            auto fit = fitSample(jobs[i].wav, jobs[i].options);
+
+            std::lock_guard<std::mutex> lock(reportMutex);
+            results[i] = std::move(fit);
+            ++finished;
+            const double elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+            const double eta = elapsed / static_cast<double>(finished)
+                             * static_cast<double>(jobs.size() - finished);
+            std::fprintf(stderr, "  [%zu/%zu] pad %d done, %.0f s elapsed, ETA %.0f s\n",
+                         finished, jobs.size(), jobs[i].padIdx, elapsed, eta);
+            std::fflush(stderr);
+            while (printed < jobs.size() && results[printed].has_value()) {
+                std::fputs(padSummary(jobs[printed], *results[printed]).c_str(), stdout);
+                ++printed;
+            }
+            std::fflush(stdout);
+        }
+    };
+
+    const std::size_t numThreads =
+        std::clamp<std::size_t>(static_cast<std::size_t>(std::max(numJobs, 1)), 1, jobs.size());
+    std::vector<std::thread> helpers;
+    for (std::size_t t = 1; t < numThreads; ++t) helpers.emplace_back(worker);
+    worker();
+    for (auto& h : helpers) h.join();
+
+    std::vector<FitResult> out;
+    out.reserve(jobs.size());
+    for (auto& r : results) out.push_back(std::move(*r));
+    return out;
+}
+
+}  // namespace
+
 int runMembrumFit(const CliArgs& args) {
     if (args.mode == CliMode::PerPad) {
         const auto fit = fitSample(args.input, args.options);
@@ -365,25 +449,25 @@ int runMembrumFit(const CliArgs& args) {
         p.enabled = 0.0f;
     }
 
+    std::vector<PadJob> jobs;
     for (const auto& [midiNote, wav] : spec.midiNoteToFile) {
         const int padIdx = midiNote - 36;
         if (padIdx < 0 || padIdx >= 32) continue;
-        FitOptions perPadOptions = args.options;
-        perPadOptions.bodyOverrides.clear();  // only the per-pad field is consumed downstream
+        PadJob job{ padIdx, midiNote, wav, args.options };
+        job.options.bodyOverrides.clear();  // only the per-pad field is consumed downstream
         if (auto it = args.options.bodyOverrides.find(midiNote);
             it != args.options.bodyOverrides.end()) {
-            perPadOptions.forcedBody = it->second;
+            job.options.forcedBody = it->second;
         }
-        const auto fit = fitSample(wav, perPadOptions);
-        pads[padIdx] = fit.padConfig;
-        std::fprintf(stdout,
-            "  pad %2d (MIDI %d, %s): loss %.4f -> %.4f (%d evals%s%s%s)\n",
-            padIdx, midiNote, wav.filename().string().c_str(),
-            fit.quality.initialLoss, fit.quality.finalLoss, fit.quality.bobyqaEvals,
-            fit.quality.bobyqaConverged ? ", converged" : "",
-            fit.quality.cmaesUsed ? ", CMA-ES" : "",
-            perPadOptions.forcedBody.has_value() ? ", forced body" : "");
-        std::fflush(stdout);
+        jobs.push_back(std::move(job));
+    }
+
+    const int numJobs = (args.jobs > 0)
+        ? args.jobs
+        : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const auto fits = fitPads(jobs, numJobs);
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        pads[static_cast<std::size_t>(jobs[i].padIdx)] = fits[i].padConfig;
     }
 
     const std::filesystem::path outFile = (args.output.extension() == ".vstpreset")
@@ -107,9 +107,7 @@ struct EvalState {
     const RefineContext* ctx;
     RenderableMembrumVoice* voice;
     Membrum::PadConfig working;
-    std::span<const float> targetClipped;
-    std::vector<float> targetMfcc;
-    std::vector<float> targetEnv;
+    const LossTarget* target;
     float renderSec;
     int evals;
     float bestLoss;
@@ -122,9 +120,8 @@ double bobyqaObjective(unsigned n, const double* x, double* /*grad*/, void* user
     for (unsigned i = 0; i < n; ++i) xf[i] = static_cast<float>(x[i]);
     vectorToPadConfig(xf, st->ctx->optimisable, st->working);
     auto rendered = st->voice->renderToVector(st->working, /*vel*/ 1.0f, st->renderSec);
-    if (rendered.size() > st->targetClipped.size()) rendered.resize(st->targetClipped.size());
-    const float l = totalLoss(st->targetClipped, st->targetMfcc, st->targetEnv,
-                              rendered, st->ctx->sampleRate, st->ctx->weights);
+    if (rendered.size() > st->target->length) rendered.resize(st->target->length);
+    const float l = totalLoss(*st->target, rendered, st->ctx->weights);
     if (l < st->bestLoss) { st->bestLoss = l; st->bestCfg = st->working; }
     ++st->evals;
     return static_cast<double>(l);
@@ -143,9 +140,9 @@ RefineResult refineBOBYQA(const RefineContext& ctx, RenderableMembrumVoice& voic
     if (initial.size() > ctx.target.size()) initial.resize(ctx.target.size());
     const std::span<const float> tClipped(ctx.target.data(),
         std::min(ctx.target.size(), initial.size()));
-    const auto tMfcc = computeMFCC(tClipped, ctx.sampleRate);
-    const auto tEnv  = computeLogEnvelope(tClipped, ctx.sampleRate);
-    r.initialLoss = totalLoss(tClipped, tMfcc, tEnv, initial, ctx.sampleRate, ctx.weights);
+    // Target features are fixed for the whole run: transform them once.
+    const LossTarget target = prepareLossTarget(tClipped, ctx.sampleRate);
+    r.initialLoss = totalLoss(target, initial, ctx.weights);
     r.finalLoss   = r.initialLoss;
 
 #if MEMBRUM_FIT_HAVE_NLOPT
@@ -155,9 +152,7 @@ RefineResult refineBOBYQA(const RefineContext& ctx, RenderableMembrumVoice& voic
     st.ctx = &ctx;
     st.voice = &voice;
     st.working = ctx.initial;
-    st.targetClipped = tClipped;
-    st.targetMfcc = tMfcc;
-    st.targetEnv  = tEnv;
+    st.target = &target;
     st.renderSec = renderSec;
     st.evals = 0;
     st.bestLoss = r.initialLoss;
@@ -25,6 +25,10 @@ struct RefineContext {
     int                       maxEvals = 300;
     float                     earlyStopRelLoss = 0.01f;  // 1 %
     int                       earlyStopWindow  = 20;
+    // refineGlobalCRS only: number of independent searches run concurrently,
+    // one thread and one RenderableMembrumVoice each, splitting maxEvals
+    // between them. 1 = single search on the caller's thread and voice.
+    int                       numThreads = 1;
 };
 
 struct RefineResult {
@@ -6,7 +6,9 @@
 #endif
 
 #include <algorithm>
+#include <memory>
 #include <span>
+#include <thread>
 #include <vector>
 
 namespace MembrumFit {
@@ -18,29 +20,57 @@ struct CrsState {
     const RefineContext* ctx;
     RenderableMembrumVoice* voice;
     Membrum::PadConfig working;
-    std::span<const float> targetClipped;
-    std::vector<float> targetMfcc;
-    std::vector<float> targetEnv;
+    const LossTarget* target;
     float renderSec;
+    int maxEvals;  // this search's share of ctx.maxEvals
     int evals;
     float bestLoss;
     Membrum::PadConfig bestCfg;
+    nlopt_result rc;
 };
 
+// Search i uses kCrsSeedBase + i, so results are reproducible run to run.
+constexpr unsigned long kCrsSeedBase = 0x4d656d62ul;
+
 double crsObjective(unsigned n, const double* x, double* /*grad*/, void* userData) {
     auto* st = static_cast<CrsState*>(userData);
     std::vector<float> xf(n);
     for (unsigned i = 0; i < n; ++i) xf[i] = static_cast<float>(x[i]);
     vectorToPadConfig(xf, st->ctx->optimisable, st->working);
     auto rendered = st->voice->renderToVector(st->working, /*vel*/ 1.0f, st->renderSec);
-    if (rendered.size() > st->targetClipped.size()) rendered.resize(st->targetClipped.size());
-    const float l = totalLoss(st->targetClipped, st->targetMfcc, st->targetEnv,
-                              rendered, st->ctx->sampleRate, st->ctx->weights);
+    if (rendered.size() > st->target->length) rendered.resize(st->target->length);
+    const float l = totalLoss(*st->target, rendered, st->ctx->weights);
     if (l < st->bestLoss) { st->bestLoss = l; st->bestCfg = st->working; }
     ++st->evals;
     return static_cast<double>(l);
 }
 
+// One CRS2 search starting from ctx.initial. Results land in `st`.
+void runCrsSearch(CrsState& st, unsigned long seed) {
+    const auto& ctx = *st.ctx;
+    const unsigned dim = static_cast<unsigned>(ctx.optimisable.size());
+    nlopt_opt opt = nlopt_create(NLOPT_GN_CRS2_LM, dim);
+    if (!opt) { st.rc = NLOPT_FAILURE; return; }
+
+    // NLopt keeps its RNG state per thread, so seeding here only affects
+    // this search -- and makes the fit independent of whatever ran on this
+    // thread before (kit mode fits several pads per thread).
+    nlopt_srand(seed);
+
+    std::vector<double> lb(dim, 0.0), ub(dim, 1.0), x(dim, 0.0);
+    auto x0 = padConfigToVector(ctx.initial, ctx.optimisable);
+    for (unsigned i = 0; i < dim; ++i) x[i] = static_cast<double>(x0[i]);
+    nlopt_set_lower_bounds(opt, lb.data());
+    nlopt_set_upper_bounds(opt, ub.data());
+    nlopt_set_min_objective(opt, crsObjective, &st);
+    nlopt_set_maxeval(opt, st.maxEvals);
+    nlopt_set_xtol_rel(opt, 1e-3);
+
+    double minF = 0.0;
+    st.rc = nlopt_optimize(opt, x.data(), &minF);
+    nlopt_destroy(opt);
+}
+
 }  // namespace
 #endif
 
@@ -54,47 +84,63 @@ RefineResult refineGlobalCRS(const RefineContext& ctx, RenderableMembrumVoice& v
     if (initial.size() > ctx.target.size()) initial.resize(ctx.target.size());
     const std::span<const float> tClipped(ctx.target.data(),
         std::min(ctx.target.size(), initial.size()));
-    const auto tMfcc = computeMFCC(tClipped, ctx.sampleRate);
-    const auto tEnv  = computeLogEnvelope(tClipped, ctx.sampleRate);
-    r.initialLoss = totalLoss(tClipped, tMfcc, tEnv, initial, ctx.sampleRate, ctx.weights);
+    // Shared read-only by every search thread.
+    const LossTarget target = prepareLossTarget(tClipped, ctx.sampleRate);
+    r.initialLoss = totalLoss(target, initial, ctx.weights);
     r.finalLoss   = r.initialLoss;
 
 #if MEMBRUM_FIT_HAVE_NLOPT
     if (ctx.optimisable.empty() || ctx.maxEvals <= 0) return r;
 
-    CrsState st{};
-    st.ctx = &ctx;
-    st.voice = &voice;
-    st.working = ctx.initial;
-    st.targetClipped = tClipped;
-    st.targetMfcc = tMfcc;
-    st.targetEnv = tEnv;
-    st.renderSec = renderSec;
-    st.evals = 0;
-    st.bestLoss = r.initialLoss;
-    st.bestCfg  = ctx.initial;
-
-    const unsigned dim = static_cast<unsigned>(ctx.optimisable.size());
-    nlopt_opt opt = nlopt_create(NLOPT_GN_CRS2_LM, dim);
-    if (!opt) return r;
-
-    std::vector<double> lb(dim, 0.0), ub(dim, 1.0), x(dim, 0.0);
-    auto x0 = padConfigToVector(ctx.initial, ctx.optimisable);
-    for (unsigned i = 0; i < dim; ++i) x[i] = static_cast<double>(x0[i]);
-    nlopt_set_lower_bounds(opt, lb.data());
-    nlopt_set_upper_bounds(opt, ub.data());
-    nlopt_set_min_objective(opt, crsObjective, &st);
-    nlopt_set_maxeval(opt, ctx.maxEvals);
-    nlopt_set_xtol_rel(opt, 1e-3);
-
-    double minF = 0.0;
-    const auto rc = nlopt_optimize(opt, x.data(), &minF);
-    nlopt_destroy(opt);
-
-    r.final     = st.bestCfg;
-    r.finalLoss = st.bestLoss;
-    r.evalCount = st.evals;
-    r.escapedCMAES = (rc > 0);
+    CrsState base{};
+    base.ctx = &ctx;
+    base.voice = &voice;
+    base.working = ctx.initial;
+    base.target = &target;
+    base.renderSec = renderSec;
+    base.maxEvals = ctx.maxEvals;
+    base.evals = 0;
+    base.bestLoss = r.initialLoss;
+    base.bestCfg  = ctx.initial;
+    base.rc = NLOPT_FAILURE;
+
+    // The searches split ctx.maxEvals (remainder to the lower indices), so
+    // more threads cost no more renders; never more searches than evals.
+    const std::size_t numSearches = static_cast<std::size_t>(
+        std::clamp(ctx.numThreads, 1, ctx.maxEvals));
+    std::vector<CrsState> searches(numSearches, base);
+    const int share = ctx.maxEvals / static_cast<int>(numSearches);
+    const int remainder = ctx.maxEvals % static_cast<int>(numSearches);
+    for (std::size_t i = 0; i < numSearches; ++i) {
+        searches[i].maxEvals = share + (static_cast<int>(i) < remainder ? 1 : 0);
+    }
+    if (numSearches == 1) {
+        runCrsSearch(searches[0], kCrsSeedBase);
+    } else {
+        std::vector<std::unique_ptr<RenderableMembrumVoice>> voices(numSearches);
+        std::vector<std::thread> threads;
+        threads.reserve(numSearches - 1);
+        for (std::size_t i = 1; i < numSearches; ++i) {
+            voices[i] = std::make_unique<RenderableMembrumVoice>();
+            voices[i]->prepare(voice.sampleRate());
+            searches[i].voice = voices[i].get();
+            threads.emplace_back([&searches, i] {
+                runCrsSearch(searches[i], kCrsSeedBase + i);
+            });
+        }
+        runCrsSearch(searches[0], kCrsSeedBase);
+        for (auto& t : threads) t.join();
+    }
+
+    // Reduce in search order so the winner does not depend on thread timing.
+    const CrsState* best = &searches[0];
+    for (const auto& st : searches) {
+        r.evalCount += st.evals;
+        if (st.bestLoss < best->bestLoss) best = &st;
+    }
+    r.final     = best->bestCfg;
+    r.finalLoss = best->bestLoss;
+    r.escapedCMAES = (best->rc > 0);
 #endif
     return r;
 }
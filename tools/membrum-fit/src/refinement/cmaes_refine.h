@@ -14,6 +14,16 @@ namespace MembrumFit {
 // NLopt's CRS keeps the entire toolchain permissively licensed without
 // any new dependencies. CMA-ES via libcmaes remains available via the
 // MEMBRUM_FIT_ENABLE_CMAES CMake option for users who explicitly opt in.
+//
+// NLopt evaluates CRS candidates one at a time, so the parallelism is across
+// searches instead: with ctx.numThreads = N > 1, N searches with fixed,
+// distinct seeds run concurrently, each with its own voice, and the lowest
+// loss wins, ties going to the lower search index. The searches share the
+// ctx.maxEvals budget: each gets maxEvals / N evaluations, the remainder
+// going to the lower indices (N is capped at maxEvals). More threads buy
+// more restarts for the same render count and shorter wall time, at the
+// price of shallower searches. `voice` renders search 0; the others get
+// fresh voices prepared at voice.sampleRate().
 RefineResult refineGlobalCRS(const RefineContext& ctx,
                              RenderableMembrumVoice& voice);
 
@@ -1,40 +1,20 @@
 #include "loss.h"
 
+#include <krate/dsp/primitives/fft.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <complex>
 #include <numeric>
 
 namespace MembrumFit {
 
 namespace {
 
-void fftInPlace(std::vector<std::complex<float>>& x) {
-    const std::size_t n = x.size();
-    if (n < 2) return;
-    std::size_t j = 0;
-    for (std::size_t i = 1; i < n; ++i) {
-        std::size_t bit = n >> 1;
-        for (; j & bit; bit >>= 1) j ^= bit;
-        j ^= bit;
-        if (i < j) std::swap(x[i], x[j]);
-    }
-    for (std::size_t len = 2; len <= n; len <<= 1) {
-        const float ang = -2.0f * 3.14159265358979323846f / static_cast<float>(len);
-        const std::complex<float> wlen(std::cos(ang), std::sin(ang));
-        for (std::size_t i = 0; i < n; i += len) {
-            std::complex<float> w(1.0f, 0.0f);
-            for (std::size_t k = 0; k < len / 2; ++k) {
-                const auto u = x[i + k];
-                const auto v = x[i + k + len / 2] * w;
-                x[i + k] = u + v;
-                x[i + k + len / 2] = u - v;
-                w *= wlen;
-            }
-        }
-    }
-}
+constexpr std::size_t kNumScales = kMssFftSizes.size();
+constexpr std::size_t kMfccFftN = 2048;
+constexpr std::size_t kMfccScale = kNumScales - 1;  // the 2048-point scale
+static_assert(kMssFftSizes[kMfccScale] == kMfccFftN);
 
 std::vector<float> hannWindow(std::size_t n) {
     std::vector<float> w(n);
@@ -43,37 +23,92 @@ std::vector<float> hannWindow(std::size_t n) {
     return w;
 }
 
-float singleScaleSTFT(std::span<const float> a, std::span<const float> b, std::size_t fftN) {
-    const std::size_t hop = fftN / 4;
-    const auto w = hannWindow(fftN);
-    const std::size_t len = std::min(a.size(), b.size());
-    if (len < fftN) return 0.0f;
-    std::vector<std::complex<float>> bufA(fftN), bufB(fftN);
-    double sum = 0.0; std::size_t frames = 0;
-    for (std::size_t off = 0; off + fftN <= len; off += hop) {
-        for (std::size_t i = 0; i < fftN; ++i) {
-            bufA[i] = { a[off + i] * w[i], 0.0f };
-            bufB[i] = { b[off + i] * w[i], 0.0f };
+// Per-thread transform state: a pffft-backed FFT and a Hann window for every
+// MSS scale, built once per thread instead of once per call. thread_local so
+// candidates can be scored from several refinement threads at once.
+struct Workspace {
+    std::array<Krate::DSP::FFT, kNumScales> ffts;
+    std::array<std::vector<float>, kNumScales> windows;
+    std::vector<float> frame;
+    std::vector<Krate::DSP::Complex> spectrum;
+    std::vector<float> logMag;
+    std::vector<float> mfccWindow;  // hannWindow(take); rebuilt when take changes
+
+    Workspace() {
+        for (std::size_t s = 0; s < kNumScales; ++s) {
+            ffts[s].prepare(kMssFftSizes[s]);
+            windows[s] = hannWindow(kMssFftSizes[s]);
         }
-        fftInPlace(bufA);
-        fftInPlace(bufB);
-        for (std::size_t k = 0; k < fftN / 2; ++k) {
-            const float ma = std::log1p(std::abs(bufA[k]));
-            const float mb = std::log1p(std::abs(bufB[k]));
-            sum += std::abs(ma - mb);
-        }
-        ++frames;
+        frame.resize(kMfccFftN);
+        spectrum.resize(kMfccFftN / 2 + 1);
+        logMag.resize(kMfccFftN / 2);
+    }
+};
+
+Workspace& workspace() {
+    thread_local Workspace ws;
+    return ws;
+}
+
+std::size_t frameCount(std::size_t len, std::size_t fftN) {
+    return (len < fftN) ? 0 : (len - fftN) / (fftN / 4) + 1;
+}
+
+// log1p|X[k]| for k in [0, fftN / 2) of the windowed frame starting at x.
+void logMagnitudes(Workspace& ws, std::size_t scale, const float* x, float* out) {
+    const std::size_t fftN = kMssFftSizes[scale];
+    const auto& w = ws.windows[scale];
+    for (std::size_t i = 0; i < fftN; ++i) ws.frame[i] = x[i] * w[i];
+    ws.ffts[scale].forward(ws.frame.data(), ws.spectrum.data());
+    for (std::size_t k = 0; k < fftN / 2; ++k)
+        out[k] = std::log1p(ws.spectrum[k].magnitude());
+}
+
+float singleScaleSTFT(std::span<const float> a, std::span<const float> b, std::size_t scale) {
+    const std::size_t fftN = kMssFftSizes[scale];
+    const std::size_t hop = fftN / 4;
+    const std::size_t half = fftN / 2;
+    const std::size_t frames = frameCount(std::min(a.size(), b.size()), fftN);
+    if (frames == 0) return 0.0f;
+    auto& ws = workspace();
+    std::vector<float> magA(half);
+    double sum = 0.0;
+    for (std::size_t f = 0; f < frames; ++f) {
+        logMagnitudes(ws, scale, a.data() + f * hop, magA.data());
+        logMagnitudes(ws, scale, b.data() + f * hop, ws.logMag.data());
+        for (std::size_t k = 0; k < half; ++k) sum += std::abs(magA[k] - ws.logMag[k]);
     }
-    return (frames > 0) ? static_cast<float>(sum / static_cast<double>(frames * (fftN / 2))) : 0.0f;
+    return static_cast<float>(sum / static_cast<double>(frames * half));
+}
+
+float singleScaleSTFT(const LossTarget& target, std::span<const float> b, std::size_t scale) {
+    const std::size_t fftN = kMssFftSizes[scale];
+    const std::size_t hop = fftN / 4;
+    const std::size_t half = fftN / 2;
+    const std::size_t frames = frameCount(std::min(target.length, b.size()), fftN);
+    if (frames == 0) return 0.0f;
+    auto& ws = workspace();
+    const float* magA = target.stftLogMag[scale].data();
+    double sum = 0.0;
+    for (std::size_t f = 0; f < frames; ++f, magA += half) {
+        logMagnitudes(ws, scale, b.data() + f * hop, ws.logMag.data());
+        for (std::size_t k = 0; k < half; ++k) sum += std::abs(magA[k] - ws.logMag[k]);
+    }
+    return static_cast<float>(sum / static_cast<double>(frames * half));
 }
 
 }  // namespace
 
 float computeMSSLoss(std::span<const float> target, std::span<const float> candidate) {
-    const std::array<std::size_t, 6> sizes = { 64, 128, 256, 512, 1024, 2048 };
     double total = 0.0;
-    for (auto n : sizes) total += singleScaleSTFT(target, candidate, n);
-    return static_cast<float>(total / static_cast<double>(sizes.size()));
+    for (std::size_t s = 0; s < kNumScales; ++s) total += singleScaleSTFT(target, candidate, s);
+    return static_cast<float>(total / static_cast<double>(kNumScales));
+}
+
+float computeMSSLoss(const LossTarget& target, std::span<const float> candidate) {
+    double total = 0.0;
+    for (std::size_t s = 0; s < kNumScales; ++s) total += singleScaleSTFT(target, candidate, s);
+    return static_cast<float>(total / static_cast<double>(kNumScales));
 }
 
 std::vector<float> computeMFCC(std::span<const float> signal, double sampleRate) {
@@ -82,14 +117,15 @@ std::vector<float> computeMFCC(std::span<const float> signal, double sampleRate)
     if (signal.empty()) return {};
     constexpr int    kNumMel  = 26;
     constexpr float  kMelLow  = 0.0f;
-    constexpr std::size_t kFFTN = 2048;
-    std::vector<std::complex<float>> buf(kFFTN, {0.0f, 0.0f});
+    constexpr std::size_t kFFTN = kMfccFftN;
+    auto& ws = workspace();
     const std::size_t take = std::min<std::size_t>(signal.size(), kFFTN);
-    const auto w = hannWindow(take);
-    for (std::size_t i = 0; i < take; ++i) buf[i] = { signal[i] * w[i], 0.0f };
-    fftInPlace(buf);
+    if (ws.mfccWindow.size() != take) ws.mfccWindow = hannWindow(take);
+    std::fill(ws.frame.begin(), ws.frame.end(), 0.0f);
+    for (std::size_t i = 0; i < take; ++i) ws.frame[i] = signal[i] * ws.mfccWindow[i];
+    ws.ffts[kMfccScale].forward(ws.frame.data(), ws.spectrum.data());
     std::vector<float> mag(kFFTN / 2);
-    for (std::size_t k = 0; k < mag.size(); ++k) mag[k] = std::abs(buf[k]);
+    for (std::size_t k = 0; k < mag.size(); ++k) mag[k] = ws.spectrum[k].magnitude();
 
     auto hz2mel = [](float hz){ return 2595.0f * std::log10(1.0f + hz / 700.0f); };
     auto mel2hz = [](float m) { return 700.0f * (std::pow(10.0f, m / 2595.0f) - 1.0f); };
@@ -173,4 +209,31 @@ float totalLoss(std::span<const float> target,
     return w.stft * lStft + w.mfcc * lMfcc + w.env * lEnv;
 }
 
+LossTarget prepareLossTarget(std::span<const float> target, double sampleRate) {
+    LossTarget t;
+    t.length = target.size();
+    t.sampleRate = sampleRate;
+    auto& ws = workspace();
+    for (std::size_t s = 0; s < kNumScales; ++s) {
+        const std::size_t fftN = kMssFftSizes[s];
+        const std::size_t frames = frameCount(target.size(), fftN);
+        t.stftLogMag[s].resize(frames * (fftN / 2));
+        for (std::size_t f = 0; f < frames; ++f) {
+            logMagnitudes(ws, s, target.data() + f * (fftN / 4),
+                          t.stftLogMag[s].data() + f * (fftN / 2));
+        }
+    }
+    t.mfcc = computeMFCC(target, sampleRate);
+    t.env  = computeLogEnvelope(target, sampleRate);
+    return t;
+}
+
+float totalLoss(const LossTarget& target, std::span<const float> candidate, LossWeights w) {
+    const float lStft = computeMSSLoss(target, candidate);
+    const float lMfcc = computeMFCCL1(target.mfcc, computeMFCC(candidate, target.sampleRate));
+    const float lEnv  = computeEnvelopeL1(target.env,
+                                          computeLogEnvelope(candidate, target.sampleRate));
+    return w.stft * lStft + w.mfcc * lMfcc + w.env * lEnv;
+}
+
 }  // namespace MembrumFit
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <span>
 #include <vector>
 
@@ -36,4 +38,30 @@ float totalLoss(std::span<const float> target,
 
 constexpr int kMfccCoeffCount = 20;
 
+// MSS window sizes, smallest first.
+constexpr std::array<std::size_t, 6> kMssFftSizes = { 64, 128, 256, 512, 1024, 2048 };
+
+// Everything the loss needs from the target, computed once per pad: the
+// log-magnitude frames of every MSS scale, the MFCC and the log-envelope.
+// The refiners evaluate hundreds of candidates against one target, so only
+// the candidate side is transformed per evaluation. Immutable once built;
+// any number of threads may evaluate against the same LossTarget.
+struct LossTarget {
+    std::size_t length = 0;
+    double sampleRate = 44100.0;
+    // Per scale: frames x (fftN / 2) log1p-magnitudes, frame-major.
+    std::array<std::vector<float>, kMssFftSizes.size()> stftLogMag;
+    std::vector<float> mfcc;
+    std::vector<float> env;
+};
+
+LossTarget prepareLossTarget(std::span<const float> target, double sampleRate);
+
+// Same value as totalLoss(target, mfcc, env, candidate, ...) on the signal
+// the LossTarget was prepared from.
+float totalLoss(const LossTarget& target,
+                std::span<const float> candidate,
+                LossWeights weights);
+float computeMSSLoss(const LossTarget& target, std::span<const float> candidate);
+
 }  // namespace MembrumFit
@@ -103,6 +103,8 @@ struct FitOptions {
     double              targetSampleRate = 44100.0;
     int                 maxBobyqaEvals = 300;
     bool                enableGlobalCMAES = false;
+    // Concurrent searches for the global (CRS) escape; see refineGlobalCRS().
+    int                 globalSearchThreads = 1;
     float               wSTFT = 0.6f;
     float               wMFCC = 0.2f;
     float               wEnv  = 0.2f;
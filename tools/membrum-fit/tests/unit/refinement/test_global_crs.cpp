@@ -1,6 +1,6 @@
-// Smoke test for the --global CRS escape path. Verifies the CRS optimiser
-// runs and produces a finite finalLoss; tuning quality is exercised by
-// the [.corpus] sweep, not here.
+// Smoke tests for the --global CRS escape path. Verify the CRS optimiser
+// runs, produces a finite finalLoss and keeps parallel searches within the
+// shared eval budget; tuning quality is exercised by the [.corpus] sweep.
 #include "src/refinement/cmaes_refine.h"
 #include "src/refinement/render_voice.h"
 
@@ -34,3 +34,38 @@ TEST_CASE("Global CRS: returns a finite RefineResult on Kick render") {
     REQUIRE(r.finalLoss <= r.initialLoss + 1e-3f);
     REQUIRE(r.evalCount > 0);
 }
+
+TEST_CASE("Global CRS: parallel searches split the eval budget") {
+    constexpr double sr = 44100.0;
+
+    Membrum::PadConfig ground{};
+    Membrum::DefaultKit::applyTemplate(ground, Membrum::DrumTemplate::Kick);
+
+    MembrumFit::RenderableMembrumVoice voice;
+    voice.prepare(sr);
+    const auto target = voice.renderToVector(ground, 1.0f, 0.1f);
+
+    MembrumFit::RefineContext ctx;
+    ctx.target = std::span<const float>(target.data(), target.size());
+    ctx.sampleRate = sr;
+    ctx.initial = ground;
+    ctx.initial.material = 0.2f;  // start away from the answer
+    ctx.optimisable = { 2, 3, 4 };
+
+    SECTION("four searches render no more than one would") {
+        ctx.maxEvals = 30;
+        ctx.numThreads = 4;
+        const auto r = MembrumFit::refineGlobalCRS(ctx, voice);
+        REQUIRE(r.evalCount > 0);
+        REQUIRE(r.evalCount <= ctx.maxEvals);
+        REQUIRE(r.finalLoss <= r.initialLoss);
+    }
+
+    SECTION("more threads than evals run one search per eval") {
+        ctx.maxEvals = 3;
+        ctx.numThreads = 8;
+        const auto r = MembrumFit::refineGlobalCRS(ctx, voice);
+        REQUIRE(r.evalCount > 0);
+        REQUIRE(r.evalCount <= ctx.maxEvals);
+    }
+}
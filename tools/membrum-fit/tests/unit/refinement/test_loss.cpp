@@ -4,7 +4,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <array>
 #include <cmath>
+#include <span>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -43,3 +46,44 @@ TEST_CASE("Log envelope L1: zero for identical, > 0 for different amplitudes") {
     REQUIRE(MembrumFit::computeEnvelopeL1(ea, ea) == Catch::Approx(0.0f));
     REQUIRE(MembrumFit::computeEnvelopeL1(ea, eb) > 1.0f);
 }
+
+TEST_CASE("Prepared LossTarget gives the same total loss as the one-shot path") {
+    constexpr double sr = 44100.0;
+    auto target = sine(220.0f, static_cast<float>(sr), 11025);
+    auto candidate = sine(233.0f, static_cast<float>(sr), 11025);
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        const float decay = std::exp(-static_cast<float>(i) / 3000.0f);
+        target[i] *= decay;
+        candidate[i] *= decay * 0.7f;
+    }
+    const MembrumFit::LossWeights w{};
+    const auto prepared = MembrumFit::prepareLossTarget(target, sr);
+
+    const float oneShot = MembrumFit::totalLoss(target, {}, {}, candidate, sr, w);
+    REQUIRE(MembrumFit::totalLoss(prepared, candidate, w) == oneShot);
+    REQUIRE(MembrumFit::totalLoss(prepared, target, w) < 1e-3f);
+
+    // A shorter candidate is compared over its own length, as before.
+    const std::span<const float> shorter(candidate.data(), 5000);
+    REQUIRE(MembrumFit::totalLoss(prepared, shorter, w)
+            == MembrumFit::totalLoss(target, {}, {}, shorter, sr, w));
+}
+
+TEST_CASE("Loss evaluation is identical across threads sharing one LossTarget") {
+    constexpr double sr = 44100.0;
+    const auto target = sine(440.0f, static_cast<float>(sr), 8192);
+    const auto candidate = sine(660.0f, static_cast<float>(sr), 8192);
+    const auto prepared = MembrumFit::prepareLossTarget(target, sr);
+    const float expected = MembrumFit::totalLoss(prepared, candidate, {});
+
+    std::array<float, 4> results{};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 3; ++i)
+                results[t] = MembrumFit::totalLoss(prepared, candidate, {});
+        });
+    }
+    for (auto& th : threads) th.join();
+    for (float r : results) REQUIRE(r == expected);
+}
@@ -2,9 +2,17 @@
 // fitSample pipeline against it, write a per-pad preset, then read the
 // preset back via the state codec and check the fitted parameters round-
 // trip. This exercises every linkable layer except the actual entry.cpp.
+//
+// The kit --jobs determinism check runs six full fits (minutes), so it is
+// tagged "[.slow]" and hidden by default; run with:
+//   membrum_fit_tests "[.slow]"
+// The fast check below covers the same guarantee for the --global search.
+#include "src/cli.h"
 #include "src/loader.h"
 #include "src/main.h"
 #include "src/preset_io/pad_preset_writer.h"
+#include "src/refinement/bobyqa_refine.h"
+#include "src/refinement/cmaes_refine.h"
 #include "src/refinement/render_voice.h"
 
 #include "dsp/default_kit.h"
@@ -18,6 +26,11 @@
 
 #include <cstdio>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -36,6 +49,11 @@ bool writeFloatWav(const std::filesystem::path& p, const std::vector<float>& s,
     return wrote == s.size();
 }
 
+std::vector<char> readBytes(const std::filesystem::path& p) {
+    std::ifstream in(p, std::ios::binary);
+    return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+}
+
 }  // namespace
 
 TEST_CASE("CLI e2e: render Kick -> fitSample -> writePadPreset -> file exists") {
@@ -70,3 +88,85 @@ TEST_CASE("CLI e2e: render Kick -> fitSample -> writePadPreset -> file exists")
     std::error_code ec;
     std::filesystem::remove_all(dir, ec);
 }
+
+TEST_CASE("CLI e2e: kit preset bytes do not depend on --jobs", "[.slow]") {
+    const auto dir = std::filesystem::temp_directory_path() / "membrum_fit_e2e_jobs";
+    std::filesystem::create_directories(dir);
+
+    MembrumFit::RenderableMembrumVoice voice;
+    voice.prepare(44100.0);
+    const std::pair<Membrum::DrumTemplate, const char*> pads[] = {
+        { Membrum::DrumTemplate::Kick,  "kick.wav" },
+        { Membrum::DrumTemplate::Snare, "snare.wav" },
+        { Membrum::DrumTemplate::Perc,  "perc.wav" },
+    };
+    for (const auto& [tmpl, name] : pads) {
+        Membrum::PadConfig cfg{};
+        Membrum::DefaultKit::applyTemplate(cfg, tmpl);
+        REQUIRE(writeFloatWav(dir / name, voice.renderToVector(cfg, 1.0f, 0.3f), 44100));
+    }
+    {
+        std::ofstream json(dir / "kit.json");
+        json << R"({ "36": "kick.wav", "38": "snare.wav", "40": "perc.wav" })";
+    }
+
+    auto runKit = [&](int jobs, const char* outName) {
+        MembrumFit::CliArgs args;
+        args.mode   = MembrumFit::CliMode::Kit;
+        args.input  = dir / "kit.json";
+        args.output = dir / outName;
+        args.jobs   = jobs;
+        args.options.maxBobyqaEvals = 20;
+        args.options.enableGlobalCMAES = true;  // --global
+        args.options.globalSearchThreads = 2;
+        REQUIRE(MembrumFit::runMembrumFit(args) == 0);
+        return readBytes(dir / outName);
+    };
+    const auto serial   = runKit(1, "serial.vstpreset");
+    const auto parallel = runKit(3, "parallel.vstpreset");
+    REQUIRE(!serial.empty());
+    REQUIRE(serial == parallel);
+
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+}
+
+TEST_CASE("CLI e2e: --global search is reproducible on any thread") {
+    // Kit mode fits pads on worker threads, one after another. The global
+    // CRS search seeds its RNG per search, so its result must not depend on
+    // which thread runs it or on what that thread ran before.
+    constexpr double sr = 44100.0;
+    Membrum::PadConfig ground{};
+    Membrum::DefaultKit::applyTemplate(ground, Membrum::DrumTemplate::Kick);
+
+    MembrumFit::RenderableMembrumVoice voice;
+    voice.prepare(sr);
+    const auto target = voice.renderToVector(ground, 1.0f, 0.1f);
+
+    MembrumFit::RefineContext ctx;
+    ctx.target = std::span<const float>(target.data(), target.size());
+    ctx.sampleRate = sr;
+    ctx.initial = ground;
+    ctx.initial.material = 0.2f;  // start away from the answer
+    ctx.optimisable = { 2, 3, 4 };
+    ctx.maxEvals = 12;
+    ctx.numThreads = 2;
+
+    const auto first  = MembrumFit::refineGlobalCRS(ctx, voice);
+    const auto second = MembrumFit::refineGlobalCRS(ctx, voice);
+    MembrumFit::RefineResult onWorker;
+    std::thread([&] {
+        MembrumFit::RenderableMembrumVoice workerVoice;
+        workerVoice.prepare(sr);
+        onWorker = MembrumFit::refineGlobalCRS(ctx, workerVoice);
+    }).join();
+
+    const auto params = [&](const MembrumFit::RefineResult& r) {
+        return MembrumFit::padConfigToVector(r.final, ctx.optimisable);
+    };
+    REQUIRE(first.finalLoss == second.finalLoss);
+    REQUIRE(params(first) == params(second));
+    REQUIRE(first.finalLoss == onWorker.finalLoss);
+    REQUIRE(params(first) == params(onWorker));
+    REQUIRE(first.evalCount == onWorker.evalCount);
+}
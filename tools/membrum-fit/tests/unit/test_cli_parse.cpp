@@ -54,3 +54,20 @@ TEST_CASE("CLI: kit subcommand selects ESPRIT modal method") {
     REQUIRE(out.options.modalMethod == MembrumFit::ModalMethod::ESPRIT);
     REQUIRE(out.options.enableGlobalCMAES);
 }
+
+TEST_CASE("CLI: kit --jobs sets the pad concurrency") {
+    std::vector<std::string> args = {
+        "membrum_fit", "kit", "kit.sfz", "out_dir", "--jobs", "8",
+    };
+    auto argv = mkArgv(args);
+    MembrumFit::CliArgs out;
+    REQUIRE(MembrumFit::parseCli(static_cast<int>(argv.size()), argv.data(), out) == 0);
+    REQUIRE(out.mode == MembrumFit::CliMode::Kit);
+    REQUIRE(out.jobs == 8);
+
+    std::vector<std::string> defaults = { "membrum_fit", "kit", "kit.sfz", "out_dir" };
+    auto argv2 = mkArgv(defaults);
+    MembrumFit::CliArgs out2;
+    REQUIRE(MembrumFit::parseCli(static_cast<int>(argv2.size()), argv2.data(), out2) == 0);
+    REQUIRE(out2.jobs == 1);
+}
@@ -45,7 +45,7 @@ public:
 // Constants
 // ==============================================================================
 
-static constexpr int32_t kStateVersion = 8;
+static constexpr int32_t kStateVersion = 9;
 
 // Trance gate state version marker (must match kTranceGateStateVersion in trance_gate_params.h)
 static constexpr int32_t kTranceGateStateVersion = 3;
@@ -1174,6 +1174,9 @@ struct RuinaePresetState {
     // Arpeggiator
     ArpState arp;
 
+    // Voice filter quality (v9+): 0=High, 1=Standard, 2=Economy
+    int32_t filterQuality = 1; // Standard
+
     std::vector<uint8_t> serialize() const {
         BinaryWriter w;
 
@@ -1244,6 +1247,9 @@ struct RuinaePresetState {
         // 34. Arpeggiator
         arp.serialize(w);
 
+        // 35. Filter quality (v9+)
+        w.writeInt32(filterQuality);
+
         return w.data;
     }
 };